@@ -0,0 +1,269 @@
+/**
+ *  @file   PandoraSDK/benchmarks/BenchmarkHelper.h
+ *
+ *  @brief  Header file for the benchmark helper functions, shared by the PandoraSDK benchmarks.
+ *
+ *  $Log: $
+ */
+#ifndef PANDORA_BENCHMARK_HELPER_H
+#define PANDORA_BENCHMARK_HELPER_H 1
+
+#include "Api/PandoraApi.h"
+
+#include "Objects/CaloHitBlock.h"
+#include "Objects/CartesianVector.h"
+
+#include "Plugins/PseudoLayerPlugin.h"
+
+#include "Xml/tinyxml.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+
+namespace pandora_benchmark
+{
+
+/**
+ *  @brief  BenchmarkTimer class, a wall clock stopwatch
+ */
+class BenchmarkTimer
+{
+public:
+    /**
+     *  @brief  Constructor, starting the timer
+     */
+    BenchmarkTimer();
+
+    /**
+     *  @brief  Get the wall time since construction
+     *
+     *  @return the elapsed wall time, units ms
+     */
+    double GetElapsedMs() const;
+
+private:
+    std::chrono::steady_clock::time_point m_start; ///< The start time
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  BenchmarkPseudoLayerPlugin class, assigning pseudolayers in concentric 10mm shells about the origin
+ */
+class BenchmarkPseudoLayerPlugin : public pandora::PseudoLayerPlugin
+{
+public:
+    unsigned int GetPseudoLayer(const pandora::CartesianVector &positionVector) const;
+    unsigned int GetPseudoLayerAtIp() const;
+
+private:
+    pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Write a pandora settings file running a single algorithm of a specified type
+ *
+ *  @param  fileName the settings file name
+ *  @param  algorithmType the algorithm type
+ *  @param  algorithmSettings the xml settings for the algorithm, if any
+ */
+void WriteSettingsFile(const std::string &fileName, const std::string &algorithmType, const std::string &algorithmSettings = "");
+
+/**
+ *  @brief  Fill a calo hit block with a number of random calo hits, spread over a 2m sphere about the origin
+ *
+ *  @param  nCaloHits the number of calo hits
+ *  @param  seed the random seed
+ *  @param  caloHitBlock to receive the calo hits
+ */
+void FillCaloHitBlock(const unsigned int nCaloHits, const unsigned int seed, pandora::CaloHitBlock &caloHitBlock);
+
+/**
+ *  @brief  Create the calo hits in a calo hit block one at a time, through the per-hit creation api
+ *
+ *  @param  pandora the pandora instance
+ *  @param  caloHitBlock the calo hit block
+ */
+pandora::StatusCode CreateCaloHits(const pandora::Pandora &pandora, const pandora::CaloHitBlock &caloHitBlock);
+
+/**
+ *  @brief  Read an unsigned integer command line argument, with a default if absent
+ *
+ *  @param  argc the number of arguments
+ *  @param  argv the arguments
+ *  @param  index the argument index
+ *  @param  defaultValue the default value
+ *
+ *  @return the argument value
+ */
+unsigned int GetArgument(const int argc, char *argv[], const int index, const unsigned int defaultValue);
+
+/**
+ *  @brief  Print a named benchmark result
+ *
+ *  @param  name the result name
+ *  @param  timeMs the measured time, units ms
+ *  @param  nOperations the number of operations timed
+ *  @param  operationName the name of an operation, e.g. events or fills
+ */
+void PrintResult(const std::string &name, const double timeMs, const unsigned int nOperations, const std::string &operationName);
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline BenchmarkTimer::BenchmarkTimer() :
+    m_start(std::chrono::steady_clock::now())
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double BenchmarkTimer::GetElapsedMs() const
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_start).count();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int BenchmarkPseudoLayerPlugin::GetPseudoLayer(const pandora::CartesianVector &positionVector) const
+{
+    return 1 + static_cast<unsigned int>(positionVector.GetMagnitude() / 10.f);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int BenchmarkPseudoLayerPlugin::GetPseudoLayerAtIp() const
+{
+    return 1;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline pandora::StatusCode BenchmarkPseudoLayerPlugin::ReadSettings(const pandora::TiXmlHandle)
+{
+    return pandora::STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void WriteSettingsFile(const std::string &fileName, const std::string &algorithmType, const std::string &algorithmSettings)
+{
+    std::ofstream settingsFile(fileName);
+    settingsFile << "<pandora>\n    <algorithm type = \"" << algorithmType << "\">" << algorithmSettings << "</algorithm>\n</pandora>\n";
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void FillCaloHitBlock(const unsigned int nCaloHits, const unsigned int seed, pandora::CaloHitBlock &caloHitBlock)
+{
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> unitDistribution(0.f, 1.f);
+
+    caloHitBlock.Resize(nCaloHits);
+
+    for (unsigned int iHit = 0; iHit < nCaloHits; ++iHit)
+    {
+        const float r(2000.f * std::cbrt(unitDistribution(generator)));
+        const float cosTheta(2.f * unitDistribution(generator) - 1.f), phi(6.2831853f * unitDistribution(generator));
+        const float sinTheta(std::sqrt(1.f - cosTheta * cosTheta));
+        const pandora::CartesianVector position(r * sinTheta * std::cos(phi), r * sinTheta * std::sin(phi), r * cosTheta);
+        const pandora::CartesianVector direction(position.GetMagnitude() > 0.f ? position.GetUnitVector() : pandora::CartesianVector(0.f, 0.f, 1.f));
+
+        caloHitBlock.m_cellGeometry[iHit] = pandora::RECTANGULAR;
+        caloHitBlock.m_positionX[iHit] = position.GetX();
+        caloHitBlock.m_positionY[iHit] = position.GetY();
+        caloHitBlock.m_positionZ[iHit] = position.GetZ();
+        caloHitBlock.m_expectedDirectionX[iHit] = direction.GetX();
+        caloHitBlock.m_expectedDirectionY[iHit] = direction.GetY();
+        caloHitBlock.m_expectedDirectionZ[iHit] = direction.GetZ();
+        caloHitBlock.m_cellNormalX[iHit] = direction.GetX();
+        caloHitBlock.m_cellNormalY[iHit] = direction.GetY();
+        caloHitBlock.m_cellNormalZ[iHit] = direction.GetZ();
+        caloHitBlock.m_cellThickness[iHit] = 2.f;
+        caloHitBlock.m_nCellRadiationLengths[iHit] = 0.5f;
+        caloHitBlock.m_nCellInteractionLengths[iHit] = 0.05f;
+        caloHitBlock.m_time[iHit] = 10.f * unitDistribution(generator);
+        caloHitBlock.m_inputEnergy[iHit] = 0.01f + unitDistribution(generator);
+        caloHitBlock.m_mipEquivalentEnergy[iHit] = 1.f + 10.f * unitDistribution(generator);
+        caloHitBlock.m_electromagneticEnergy[iHit] = caloHitBlock.m_inputEnergy[iHit];
+        caloHitBlock.m_hadronicEnergy[iHit] = caloHitBlock.m_inputEnergy[iHit];
+        caloHitBlock.m_isDigital[iHit] = 0;
+        caloHitBlock.m_hitType[iHit] = (r < 1500.f) ? pandora::ECAL : pandora::HCAL;
+        caloHitBlock.m_hitRegion[iHit] = pandora::BARREL;
+        caloHitBlock.m_layer[iHit] = static_cast<unsigned int>(r / 10.f);
+        caloHitBlock.m_isInOuterSamplingLayer[iHit] = 0;
+        caloHitBlock.m_parentAddress[iHit] = reinterpret_cast<const void *>(static_cast<std::uintptr_t>(iHit + 1));
+        caloHitBlock.m_cellSize0[iHit] = 5.f;
+        caloHitBlock.m_cellSize1[iHit] = 5.f;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline pandora::StatusCode CreateCaloHits(const pandora::Pandora &pandora, const pandora::CaloHitBlock &caloHitBlock)
+{
+    for (unsigned int iHit = 0, nHits = caloHitBlock.m_positionX.size(); iHit < nHits; ++iHit)
+    {
+        PandoraApi::CaloHit::Parameters parameters;
+        parameters.m_positionVector = pandora::CartesianVector(caloHitBlock.m_positionX[iHit], caloHitBlock.m_positionY[iHit], caloHitBlock.m_positionZ[iHit]);
+        parameters.m_expectedDirection = pandora::CartesianVector(
+            caloHitBlock.m_expectedDirectionX[iHit], caloHitBlock.m_expectedDirectionY[iHit], caloHitBlock.m_expectedDirectionZ[iHit]);
+        parameters.m_cellNormalVector =
+            pandora::CartesianVector(caloHitBlock.m_cellNormalX[iHit], caloHitBlock.m_cellNormalY[iHit], caloHitBlock.m_cellNormalZ[iHit]);
+        parameters.m_cellGeometry = caloHitBlock.m_cellGeometry[iHit];
+        parameters.m_cellSize0 = caloHitBlock.m_cellSize0[iHit];
+        parameters.m_cellSize1 = caloHitBlock.m_cellSize1[iHit];
+        parameters.m_cellThickness = caloHitBlock.m_cellThickness[iHit];
+        parameters.m_nCellRadiationLengths = caloHitBlock.m_nCellRadiationLengths[iHit];
+        parameters.m_nCellInteractionLengths = caloHitBlock.m_nCellInteractionLengths[iHit];
+        parameters.m_time = caloHitBlock.m_time[iHit];
+        parameters.m_inputEnergy = caloHitBlock.m_inputEnergy[iHit];
+        parameters.m_mipEquivalentEnergy = caloHitBlock.m_mipEquivalentEnergy[iHit];
+        parameters.m_electromagneticEnergy = caloHitBlock.m_electromagneticEnergy[iHit];
+        parameters.m_hadronicEnergy = caloHitBlock.m_hadronicEnergy[iHit];
+        parameters.m_isDigital = (0 != caloHitBlock.m_isDigital[iHit]);
+        parameters.m_hitType = caloHitBlock.m_hitType[iHit];
+        parameters.m_hitRegion = caloHitBlock.m_hitRegion[iHit];
+        parameters.m_layer = caloHitBlock.m_layer[iHit];
+        parameters.m_isInOuterSamplingLayer = (0 != caloHitBlock.m_isInOuterSamplingLayer[iHit]);
+        parameters.m_pParentAddress = caloHitBlock.m_parentAddress[iHit];
+
+        const pandora::StatusCode statusCode(PandoraApi::CaloHit::Create(pandora, parameters));
+
+        if (pandora::STATUS_CODE_SUCCESS != statusCode)
+            return statusCode;
+    }
+
+    return pandora::STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int GetArgument(const int argc, char *argv[], const int index, const unsigned int defaultValue)
+{
+    return (index < argc) ? static_cast<unsigned int>(std::strtoul(argv[index], nullptr, 10)) : defaultValue;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void PrintResult(const std::string &name, const double timeMs, const unsigned int nOperations, const std::string &operationName)
+{
+    std::cout << std::left << std::setw(48) << name << std::right << std::fixed << std::setprecision(1) << std::setw(10) << timeMs << " ms"
+              << std::setw(14) << std::setprecision(1) << (timeMs > 0. ? 1000. * nOperations / timeMs : 0.) << " " << operationName << "/s"
+              << std::endl;
+}
+
+} // namespace pandora_benchmark
+
+#endif // #ifndef PANDORA_BENCHMARK_HELPER_H
@@ -0,0 +1,189 @@
+/**
+ *  @file   PandoraSDK/benchmarks/HelixBatchBenchmark.cc
+ *
+ *  @brief  Benchmark of helix propagation to many targets, calling the Helix member functions for each helix and target or the HelixBatch
+ *          functions once per batch. The batch results are checked to be identical to the Helix results.
+ *
+ *          Usage: HelixBatchBenchmark [nHelices = 300] [nTargets = 2000]
+ *
+ *  $Log: $
+ */
+
+#include "Objects/Helix.h"
+#include "Objects/HelixBatch.h"
+
+#include "BenchmarkHelper.h"
+
+using namespace pandora;
+using namespace pandora_benchmark;
+
+/**
+ *  @brief  Check that a batch result is identical to the corresponding Helix result
+ *
+ *  @param  isFound whether the Helix result was found
+ *  @param  intersectionPoint the Helix intersection point, or distance
+ *  @param  genericTime the Helix generic time
+ *  @param  batchIsFound whether the batch result was found
+ *  @param  batchIntersectionPoint the batch intersection point, or distance
+ *  @param  batchGenericTime the batch generic time
+ *
+ *  @return whether the results are identical
+ */
+bool IsIdentical(const bool isFound, const CartesianVector &intersectionPoint, const float genericTime, const bool batchIsFound,
+    const CartesianVector &batchIntersectionPoint, const float batchGenericTime);
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool IsIdentical(const bool isFound, const CartesianVector &intersectionPoint, const float genericTime, const bool batchIsFound,
+    const CartesianVector &batchIntersectionPoint, const float batchGenericTime)
+{
+    if (isFound != batchIsFound)
+        return false;
+
+    if (!isFound)
+        return true;
+
+    return ((intersectionPoint.GetX() == batchIntersectionPoint.GetX()) && (intersectionPoint.GetY() == batchIntersectionPoint.GetY()) &&
+        (intersectionPoint.GetZ() == batchIntersectionPoint.GetZ()) && (genericTime == batchGenericTime));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const unsigned int nHelices(GetArgument(argc, argv, 1, 300));
+    const unsigned int nTargets(GetArgument(argc, argv, 2, 2000));
+    const unsigned int nCalls(nHelices * nTargets);
+
+    try
+    {
+        // Helices from track states near the calorimeter front face, propagated to points, z planes and cylinders across the detector
+        std::mt19937 generator(12345);
+        std::uniform_real_distribution<float> uniform(-1.f, 1.f);
+
+        std::vector<Helix> helixVector;
+        HelixBatch helixBatch;
+
+        for (unsigned int iHelix = 0; iHelix < nHelices; ++iHelix)
+        {
+            const CartesianVector position(1800.f * uniform(generator), 1800.f * uniform(generator), 2000.f * uniform(generator));
+            const CartesianVector momentum(5.f * uniform(generator), 5.f * uniform(generator), 5.f * uniform(generator));
+            helixVector.emplace_back(position, momentum, (uniform(generator) > 0.f) ? 1.f : -1.f, 3.5f);
+            helixBatch.AddHelix(helixVector.back());
+        }
+
+        CartesianPointVector points;
+        FloatVector zPlanes, radii;
+
+        for (unsigned int iTarget = 0; iTarget < nTargets; ++iTarget)
+        {
+            points.emplace_back(2000.f * uniform(generator), 2000.f * uniform(generator), 2000.f * uniform(generator));
+            zPlanes.push_back(2000.f * uniform(generator));
+            radii.push_back(1000.f + 1000.f * uniform(generator));
+        }
+
+        // Helix member functions, one call per helix and target
+        CartesianPointVector distances(nCalls, CartesianVector(0.f, 0.f, 0.f)), zIntersections(distances), circleIntersections(distances);
+        FloatVector distanceTimes(nCalls, 0.f), zTimes(nCalls, 0.f), circleTimes(nCalls, 0.f);
+        BoolVector isFoundInZ(nCalls, false), isFoundOnCircle(nCalls, false);
+
+        BenchmarkTimer timer;
+        for (unsigned int iHelix = 0, index = 0; iHelix < nHelices; ++iHelix)
+        {
+            const Helix &helix(helixVector[iHelix]);
+
+            for (unsigned int iTarget = 0; iTarget < nTargets; ++iTarget, ++index)
+            {
+                PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+                    helix.GetDistanceToPoint(points[iTarget], distances[index], distanceTimes[index]));
+            }
+        }
+        const double distanceMs(timer.GetElapsedMs());
+
+        timer = BenchmarkTimer();
+        for (unsigned int iHelix = 0, index = 0; iHelix < nHelices; ++iHelix)
+        {
+            const Helix &helix(helixVector[iHelix]);
+
+            for (unsigned int iTarget = 0; iTarget < nTargets; ++iTarget, ++index)
+            {
+                isFoundInZ[index] = (STATUS_CODE_SUCCESS ==
+                    helix.GetPointInZ(zPlanes[iTarget], helix.GetReferencePoint(), zIntersections[index], zTimes[index]));
+            }
+        }
+        const double zMs(timer.GetElapsedMs());
+
+        timer = BenchmarkTimer();
+        for (unsigned int iHelix = 0, index = 0; iHelix < nHelices; ++iHelix)
+        {
+            const Helix &helix(helixVector[iHelix]);
+
+            for (unsigned int iTarget = 0; iTarget < nTargets; ++iTarget, ++index)
+            {
+                isFoundOnCircle[index] = (STATUS_CODE_SUCCESS ==
+                    helix.GetPointOnCircle(radii[iTarget], helix.GetReferencePoint(), circleIntersections[index], circleTimes[index]));
+            }
+        }
+        const double circleMs(timer.GetElapsedMs());
+
+        // HelixBatch functions, one call per batch
+        CartesianPointVector batchDistances, batchZIntersections, batchCircleIntersections;
+        FloatVector batchDistanceTimes, batchZTimes, batchCircleTimes;
+        BoolVector batchIsFoundInZ, batchIsFoundOnCircle;
+
+        timer = BenchmarkTimer();
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, helixBatch.GetDistancesToPoints(points, batchDistances, batchDistanceTimes));
+        const double batchDistanceMs(timer.GetElapsedMs());
+
+        timer = BenchmarkTimer();
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            helixBatch.GetPointsInZ(zPlanes, batchZIntersections, batchZTimes, batchIsFoundInZ));
+        const double batchZMs(timer.GetElapsedMs());
+
+        timer = BenchmarkTimer();
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            helixBatch.GetPointsOnCircle(radii, batchCircleIntersections, batchCircleTimes, batchIsFoundOnCircle));
+        const double batchCircleMs(timer.GetElapsedMs());
+
+        unsigned int nMismatches(0);
+
+        for (unsigned int index = 0; index < nCalls; ++index)
+        {
+            if (!IsIdentical(true, distances[index], distanceTimes[index], true, batchDistances[index], batchDistanceTimes[index]))
+                ++nMismatches;
+
+            if (!IsIdentical(isFoundInZ[index], zIntersections[index], zTimes[index], batchIsFoundInZ[index], batchZIntersections[index],
+                    batchZTimes[index]))
+            {
+                ++nMismatches;
+            }
+
+            if (!IsIdentical(isFoundOnCircle[index], circleIntersections[index], circleTimes[index], batchIsFoundOnCircle[index],
+                    batchCircleIntersections[index], batchCircleTimes[index]))
+            {
+                ++nMismatches;
+            }
+        }
+
+        PrintResult("Helix::GetDistanceToPoint", distanceMs, nCalls, "calls");
+        PrintResult("HelixBatch::GetDistancesToPoints", batchDistanceMs, nCalls, "calls");
+        PrintResult("Helix::GetPointInZ", zMs, nCalls, "calls");
+        PrintResult("HelixBatch::GetPointsInZ", batchZMs, nCalls, "calls");
+        PrintResult("Helix::GetPointOnCircle", circleMs, nCalls, "calls");
+        PrintResult("HelixBatch::GetPointsOnCircle", batchCircleMs, nCalls, "calls");
+
+        if (0 != nMismatches)
+        {
+            std::cout << "HelixBatchBenchmark: " << nMismatches << " batch results differ from the helix results" << std::endl;
+            return 1;
+        }
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "HelixBatchBenchmark failed: " << statusCodeException.ToString() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
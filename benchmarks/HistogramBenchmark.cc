@@ -0,0 +1,189 @@
+/**
+ *  @file   PandoraSDK/benchmarks/HistogramBenchmark.cc
+ *
+ *  @brief  Fill and query throughput benchmark for Histogram and TwoDHistogram. Only the public histogram interface is used, so the same
+ *          benchmark may be built against earlier versions of the library for comparison.
+ *
+ *          Usage: HistogramBenchmark [nFills = 5000000] [nQueries = 10000]
+ *
+ *  $Log: $
+ */
+
+#include "Objects/Histograms.h"
+
+#include "BenchmarkHelper.h"
+
+using namespace pandora;
+using namespace pandora_benchmark;
+
+/**
+ *  @brief  Fill a histogram with uniformly distributed values, a tenth of which fall outside the histogram range
+ *
+ *  @param  nBinsX the number of bins
+ *  @param  nFills the number of fills
+ *  @param  checkSum to receive a sum of the histogram contents, which depends upon the fills
+ */
+void BenchmarkFills(const unsigned int nBinsX, const unsigned int nFills, float &checkSum);
+
+/**
+ *  @brief  Fill a two dimensional histogram with uniformly distributed values, a tenth of which fall outside the histogram range in each
+ *          dimension
+ *
+ *  @param  nBinsX the number of bins in x
+ *  @param  nBinsY the number of bins in y
+ *  @param  nFills the number of fills
+ *  @param  checkSum to receive a sum of the histogram contents, which depends upon the fills
+ */
+void BenchmarkTwoDFills(const unsigned int nBinsX, const unsigned int nBinsY, const unsigned int nFills, float &checkSum);
+
+/**
+ *  @brief  Query the maximum, cumulative sum, mean and standard deviation of a filled histogram, over its full range
+ *
+ *  @param  nBinsX the number of bins
+ *  @param  nQueries the number of queries of each kind
+ *  @param  checkSum to receive a sum of the query results
+ */
+void BenchmarkQueries(const unsigned int nBinsX, const unsigned int nQueries, float &checkSum);
+
+/**
+ *  @brief  Query the maximum, cumulative sum, means and standard deviations of a filled two dimensional histogram, over its full range
+ *
+ *  @param  nBinsX the number of bins in x
+ *  @param  nBinsY the number of bins in y
+ *  @param  nQueries the number of queries of each kind
+ *  @param  checkSum to receive a sum of the query results
+ */
+void BenchmarkTwoDQueries(const unsigned int nBinsX, const unsigned int nBinsY, const unsigned int nQueries, float &checkSum);
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void BenchmarkFills(const unsigned int nBinsX, const unsigned int nFills, float &checkSum)
+{
+    std::mt19937 generator(12345);
+    std::uniform_real_distribution<float> distribution(-0.05f, 1.05f);
+
+    FloatVector values;
+    for (unsigned int iFill = 0; iFill < nFills; ++iFill)
+        values.push_back(distribution(generator));
+
+    Histogram histogram(nBinsX, 0.f, 1.f);
+
+    const BenchmarkTimer timer;
+
+    for (const float value : values)
+        histogram.Fill(value);
+
+    PrintResult("Histogram::Fill, " + std::to_string(nBinsX) + " bins", timer.GetElapsedMs(), nFills, "fills");
+    checkSum += histogram.GetCumulativeSum();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void BenchmarkTwoDFills(const unsigned int nBinsX, const unsigned int nBinsY, const unsigned int nFills, float &checkSum)
+{
+    std::mt19937 generator(12345);
+    std::uniform_real_distribution<float> distribution(-0.05f, 1.05f);
+
+    FloatVector valuesX, valuesY;
+    for (unsigned int iFill = 0; iFill < nFills; ++iFill)
+    {
+        valuesX.push_back(distribution(generator));
+        valuesY.push_back(distribution(generator));
+    }
+
+    TwoDHistogram histogram(nBinsX, 0.f, 1.f, nBinsY, 0.f, 1.f);
+
+    const BenchmarkTimer timer;
+
+    for (unsigned int iFill = 0; iFill < nFills; ++iFill)
+        histogram.Fill(valuesX[iFill], valuesY[iFill]);
+
+    PrintResult("TwoDHistogram::Fill, " + std::to_string(nBinsX) + "x" + std::to_string(nBinsY) + " bins", timer.GetElapsedMs(), nFills,
+        "fills");
+    checkSum += histogram.GetCumulativeSum();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void BenchmarkQueries(const unsigned int nBinsX, const unsigned int nQueries, float &checkSum)
+{
+    std::mt19937 generator(12345);
+    std::uniform_real_distribution<float> distribution(0.f, 1.f);
+
+    Histogram histogram(nBinsX, 0.f, 1.f);
+
+    for (unsigned int iFill = 0; iFill < 10 * nBinsX; ++iFill)
+        histogram.Fill(distribution(generator), distribution(generator));
+
+    const BenchmarkTimer timer;
+
+    for (unsigned int iQuery = 0; iQuery < nQueries; ++iQuery)
+    {
+        float maximumValue(0.f);
+        int maximumBinX(0);
+        histogram.GetMaximum(maximumValue, maximumBinX);
+
+        checkSum += maximumValue + histogram.GetCumulativeSum() + histogram.GetMeanX() + histogram.GetStandardDeviationX();
+    }
+
+    PrintResult("Histogram queries, " + std::to_string(nBinsX) + " bins", timer.GetElapsedMs(), nQueries, "query sets");
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void BenchmarkTwoDQueries(const unsigned int nBinsX, const unsigned int nBinsY, const unsigned int nQueries, float &checkSum)
+{
+    std::mt19937 generator(12345);
+    std::uniform_real_distribution<float> distribution(0.f, 1.f);
+
+    TwoDHistogram histogram(nBinsX, 0.f, 1.f, nBinsY, 0.f, 1.f);
+
+    for (unsigned int iFill = 0; iFill < 10 * nBinsX * nBinsY; ++iFill)
+        histogram.Fill(distribution(generator), distribution(generator), distribution(generator));
+
+    const BenchmarkTimer timer;
+
+    for (unsigned int iQuery = 0; iQuery < nQueries; ++iQuery)
+    {
+        float maximumValue(0.f);
+        int maximumBinX(0), maximumBinY(0);
+        histogram.GetMaximum(maximumValue, maximumBinX, maximumBinY);
+
+        checkSum += maximumValue + histogram.GetCumulativeSum() + histogram.GetMeanX() + histogram.GetStandardDeviationX() +
+            histogram.GetMeanY() + histogram.GetStandardDeviationY();
+    }
+
+    PrintResult("TwoDHistogram queries, " + std::to_string(nBinsX) + "x" + std::to_string(nBinsY) + " bins", timer.GetElapsedMs(), nQueries,
+        "query sets");
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const unsigned int nFills(GetArgument(argc, argv, 1, 5000000));
+    const unsigned int nQueries(GetArgument(argc, argv, 2, 10000));
+
+    try
+    {
+        float checkSum(0.f);
+
+        BenchmarkFills(10, nFills, checkSum);
+        BenchmarkFills(1000, nFills, checkSum);
+        BenchmarkTwoDFills(10, 10, nFills, checkSum);
+        BenchmarkTwoDFills(1000, 1000, nFills, checkSum);
+        BenchmarkQueries(1000, nQueries, checkSum);
+        BenchmarkTwoDQueries(100, 100, nQueries / 10, checkSum);
+
+        // ATTN Print the check sum, so that the benchmarked calls cannot be optimized away
+        std::cout << "Check sum " << checkSum << std::endl;
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "HistogramBenchmark failed: " << statusCodeException.ToString() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
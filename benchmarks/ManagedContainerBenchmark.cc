@@ -0,0 +1,183 @@
+/**
+ *  @file   PandoraSDK/benchmarks/ManagedContainerBenchmark.cc
+ *
+ *  @brief  Event throughput benchmark for the managed object list backend, std::list or ManagedVector. The benchmark is built once
+ *          against each backend, as ManagedContainerBenchmark_List and ManagedContainerBenchmark_Vector.
+ *
+ *          Usage: ManagedContainerBenchmark_<Backend> [nEvents = 20] [nCaloHitsPerEvent = 50000]
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraContentApi.h"
+
+#include "Pandora/Algorithm.h"
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "BenchmarkHelper.h"
+
+#include <cstdio>
+
+using namespace pandora;
+using namespace pandora_benchmark;
+
+/**
+ *  @brief  ManagedContainerBenchmarkAlgorithm class, exercising the list operations of a typical clustering and pfo-building chain:
+ *          cluster creation and growth, merging, deletion, list saving, repeated traversal and pfo creation
+ */
+class ManagedContainerBenchmarkAlgorithm : public Algorithm
+{
+public:
+    /**
+     *  @brief  Factory class for instantiating algorithm
+     */
+    class Factory : public AlgorithmFactory
+    {
+    public:
+        Algorithm *CreateAlgorithm() const;
+    };
+
+private:
+    StatusCode Run();
+    StatusCode ReadSettings(const TiXmlHandle xmlHandle);
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+Algorithm *ManagedContainerBenchmarkAlgorithm::Factory::CreateAlgorithm() const
+{
+    return new ManagedContainerBenchmarkAlgorithm();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ManagedContainerBenchmarkAlgorithm::Run()
+{
+    const unsigned int nHitsPerCluster(8);
+
+    const CaloHitList *pCaloHitList(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pCaloHitList));
+
+    const ClusterList *pClusterList(nullptr);
+    std::string clusterListName;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::CreateTemporaryListAndSetCurrent(*this, pClusterList, clusterListName));
+
+    // Seed a cluster from every nHitsPerCluster-th hit, then grow it hit by hit
+    const Cluster *pCluster(nullptr);
+    unsigned int hitCounter(0);
+
+    for (const CaloHit *const pCaloHit : *pCaloHitList)
+    {
+        if (0 == hitCounter++ % nHitsPerCluster)
+        {
+            PandoraContentApi::Cluster::Parameters parameters;
+            parameters.m_caloHitList.push_back(pCaloHit);
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Cluster::Create(*this, parameters, pCluster));
+        }
+        else
+        {
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::AddToCluster(*this, pCluster, pCaloHit));
+        }
+    }
+
+    // Merge neighbouring pairs of clusters, erasing one cluster from the list at each step
+    ClusterVector clusterVector(pClusterList->begin(), pClusterList->end());
+
+    for (unsigned int iCluster = 0; iCluster + 1 < clusterVector.size(); iCluster += 4)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, clusterVector[iCluster], clusterVector[iCluster + 1]));
+
+    // Traverse the surviving clusters several times, as a chain of algorithms would
+    float energySum(0.f);
+
+    for (unsigned int iPass = 0; iPass < 10; ++iPass)
+    {
+        for (const Cluster *const pListCluster : *pClusterList)
+            energySum += pListCluster->GetHadronicEnergy();
+    }
+
+    if (energySum < 0.f)
+        return STATUS_CODE_FAILURE;
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::SaveList<Cluster>(*this, "BenchmarkClusters"));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ReplaceCurrentList<Cluster>(*this, "BenchmarkClusters"));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pClusterList));
+
+    // Make one pfo per cluster
+    const PfoList *pPfoList(nullptr);
+    std::string pfoListName;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::CreateTemporaryListAndSetCurrent(*this, pPfoList, pfoListName));
+
+    for (const Cluster *const pListCluster : *pClusterList)
+    {
+        PandoraContentApi::ParticleFlowObject::Parameters parameters;
+        parameters.m_particleId = 22;
+        parameters.m_charge = 0;
+        parameters.m_mass = 0.f;
+        parameters.m_energy = pListCluster->GetHadronicEnergy();
+        parameters.m_momentum = CartesianVector(0.f, 0.f, pListCluster->GetHadronicEnergy());
+        parameters.m_clusterList.push_back(pListCluster);
+
+        const ParticleFlowObject *pPfo(nullptr);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::Create(*this, parameters, pPfo));
+    }
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::SaveList<ParticleFlowObject>(*this, "BenchmarkPfos"));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ManagedContainerBenchmarkAlgorithm::ReadSettings(const TiXmlHandle)
+{
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const unsigned int nEvents(GetArgument(argc, argv, 1, 20));
+    const unsigned int nCaloHits(GetArgument(argc, argv, 2, 50000));
+    const std::string settingsFileName("ManagedContainerBenchmarkSettings.xml");
+
+#ifdef PANDORA_VECTOR_MANAGED_CONTAINER
+    const std::string backendName("ManagedVector");
+#else
+    const std::string backendName("std::list");
+#endif
+
+    try
+    {
+        const Pandora pandora;
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetPseudoLayerPlugin(pandora, new BenchmarkPseudoLayerPlugin));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            PandoraApi::RegisterAlgorithmFactory(pandora, "ManagedContainerBenchmark", new ManagedContainerBenchmarkAlgorithm::Factory));
+
+        WriteSettingsFile(settingsFileName, "ManagedContainerBenchmark");
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ReadSettings(pandora, settingsFileName));
+        std::remove(settingsFileName.c_str());
+
+        CaloHitBlock caloHitBlock;
+        FillCaloHitBlock(nCaloHits, 12345, caloHitBlock);
+
+        const BenchmarkTimer timer;
+
+        for (unsigned int iEvent = 0; iEvent < nEvents; ++iEvent)
+        {
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, CreateCaloHits(pandora, caloHitBlock));
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(pandora));
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(pandora));
+        }
+
+        PrintResult(backendName + ", " + std::to_string(nCaloHits) + " hits per event", timer.GetElapsedMs(), nEvents, "events");
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "ManagedContainerBenchmark failed: " << statusCodeException.ToString() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+/**
+ *  @file   PandoraSDK/benchmarks/PersistencyBenchmark.cc
+ *
+ *  @brief  File size and read throughput benchmark for the binary event file formats: uncompressed (minor version 0), compressed event
+ *          containers (minor version 1) and compressed calo hit blocks (minor version 2). The codec is zlib in builds configured with
+ *          PandoraSDK_ZLIB, otherwise the built-in pandora lz codec.
+ *
+ *          Usage: PersistencyBenchmark [nEvents = 50] [nCaloHitsPerEvent = 20000]
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+
+#include "BenchmarkHelper.h"
+
+#include <cstdio>
+
+using namespace pandora;
+using namespace pandora_benchmark;
+
+/**
+ *  @brief  Write a number of events to a binary event file
+ *
+ *  @param  fileName the event file name
+ *  @param  formatSettings the event writing algorithm settings selecting the file format
+ *  @param  caloHitBlock the calo hits to write in each event
+ *  @param  nEvents the number of events
+ */
+void WriteEventFile(const std::string &fileName, const std::string &formatSettings, const CaloHitBlock &caloHitBlock, const unsigned int nEvents);
+
+/**
+ *  @brief  Read all events from a binary event file
+ *
+ *  @param  fileName the event file name
+ *  @param  nEvents the number of events
+ *
+ *  @return the wall time taken to read the events, units ms
+ */
+double ReadEventFile(const std::string &fileName, const unsigned int nEvents);
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void WriteEventFile(const std::string &fileName, const std::string &formatSettings, const CaloHitBlock &caloHitBlock, const unsigned int nEvents)
+{
+    const std::string settingsFileName("PersistencyBenchmarkWriteSettings.xml");
+
+    const Pandora pandora;
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetPseudoLayerPlugin(pandora, new BenchmarkPseudoLayerPlugin));
+
+    WriteSettingsFile(settingsFileName, "EventWriting",
+        "<EventFileName>" + fileName + "</EventFileName><ShouldOverwriteEventFile>true</ShouldOverwriteEventFile>" + formatSettings);
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ReadSettings(pandora, settingsFileName));
+    std::remove(settingsFileName.c_str());
+
+    for (unsigned int iEvent = 0; iEvent < nEvents; ++iEvent)
+    {
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, CreateCaloHits(pandora, caloHitBlock));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(pandora));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(pandora));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+double ReadEventFile(const std::string &fileName, const unsigned int nEvents)
+{
+    const std::string settingsFileName("PersistencyBenchmarkReadSettings.xml");
+
+    const Pandora pandora;
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetPseudoLayerPlugin(pandora, new BenchmarkPseudoLayerPlugin));
+
+    WriteSettingsFile(settingsFileName, "EventReading", "<EventFileNameList>" + fileName + "</EventFileNameList>");
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ReadSettings(pandora, settingsFileName));
+    std::remove(settingsFileName.c_str());
+
+    const BenchmarkTimer timer;
+
+    for (unsigned int iEvent = 0; iEvent < nEvents; ++iEvent)
+    {
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(pandora));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(pandora));
+    }
+
+    return timer.GetElapsedMs();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const unsigned int nEvents(GetArgument(argc, argv, 1, 50));
+    const unsigned int nCaloHits(GetArgument(argc, argv, 2, 20000));
+
+    const std::string formatNames[3] = {"uncompressed", "compressed containers", "compressed calo hit blocks"};
+    const std::string formatSettings[3] = {"", "<ShouldCompressEventFile>true</ShouldCompressEventFile>",
+        "<ShouldWriteCaloHitBlocks>true</ShouldWriteCaloHitBlocks>"};
+
+    try
+    {
+        CaloHitBlock caloHitBlock;
+        FillCaloHitBlock(nCaloHits, 12345, caloHitBlock);
+
+        for (unsigned int iFormat = 0; iFormat < 3; ++iFormat)
+        {
+            const std::string fileName("PersistencyBenchmark" + std::to_string(iFormat) + ".pndr");
+            WriteEventFile(fileName, formatSettings[iFormat], caloHitBlock, nEvents);
+
+            std::ifstream fileStream(fileName, std::ios::in | std::ios::binary | std::ios::ate);
+            const double fileSizeMB(static_cast<double>(fileStream.tellg()) / (1024. * 1024.));
+            fileStream.close();
+
+            const double timeMs(ReadEventFile(fileName, nEvents));
+            std::remove(fileName.c_str());
+
+            std::cout << formatNames[iFormat] << ", file size " << std::fixed << std::setprecision(1) << fileSizeMB << " MB, read "
+                      << (timeMs > 0. ? 1000. * fileSizeMB / timeMs : 0.) << " MB/s" << std::endl;
+            PrintResult("  " + formatNames[iFormat] + " read", timeMs, nEvents, "events");
+        }
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "PersistencyBenchmark failed: " << statusCodeException.ToString() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
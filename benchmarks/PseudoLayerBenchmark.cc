@@ -0,0 +1,328 @@
+/**
+ *  @file   PandoraSDK/benchmarks/PseudoLayerBenchmark.cc
+ *
+ *  @brief  Benchmark of pseudolayer assignment in a linear collider style detector, calling a pseudo layer plugin that searches the sub
+ *          detector layer positions directly, or the same plugin wrapped by the TabulatedPseudoLayerPlugin. The tabulated results are
+ *          checked to be identical to those of the wrapped plugin.
+ *
+ *          Usage: PseudoLayerBenchmark [nPositions = 2000000]
+ *
+ *  $Log: $
+ */
+
+#include "Geometry/SubDetector.h"
+
+#include "Managers/GeometryManager.h"
+#include "Managers/PluginManager.h"
+
+#include "BenchmarkHelper.h"
+
+#include <algorithm>
+
+using namespace pandora;
+using namespace pandora_benchmark;
+
+/**
+ *  @brief  LCStylePseudoLayerPlugin class, assigning pseudolayers from the layer positions of the barrel and endcap sub detectors, with
+ *          barrel positions measured as polygonal radius w.r.t. the ecal barrel inner polygon
+ */
+class LCStylePseudoLayerPlugin : public PseudoLayerPlugin
+{
+public:
+    unsigned int GetPseudoLayer(const CartesianVector &positionVector) const;
+    unsigned int GetPseudoLayerAtIp() const;
+
+private:
+    StatusCode ReadSettings(const TiXmlHandle xmlHandle);
+    StatusCode Initialize();
+
+    /**
+     *  @brief  Append the layer positions of a sub detector to a list of layer positions
+     *
+     *  @param  subDetectorType the sub detector type
+     *  @param  layerPositions the list of layer positions
+     */
+    void AddLayerPositions(const SubDetectorType subDetectorType, FloatVector &layerPositions) const;
+
+    /**
+     *  @brief  Find the layer containing a specified position, counting the layer positions that do not exceed it
+     *
+     *  @param  position the position, either polygonal radius or absolute z coordinate
+     *  @param  layerPositions the sorted layer positions
+     *
+     *  @return the layer
+     */
+    unsigned int FindMatchingLayer(const float position, const FloatVector &layerPositions) const;
+
+    FloatVector     m_barrelLayerPositions;     ///< The barrel layer positions, as polygonal radius
+    FloatVector     m_endCapLayerPositions;     ///< The endcap layer positions, as absolute z coordinate
+    FloatVector     m_sideNormalX;              ///< The x components of the normals to the sides of the ecal barrel inner polygon
+    FloatVector     m_sideNormalY;              ///< The y components of the normals to the sides of the ecal barrel inner polygon
+    float           m_barrelInnerR;             ///< The ecal barrel inner polygonal radius
+    float           m_endCapInnerZ;             ///< The ecal endcap inner absolute z coordinate
+};
+
+/**
+ *  @brief  Get parameters for a sub detector with equally spaced layers
+ *
+ *  @param  subDetectorType the sub detector type
+ *  @param  innerR the inner r coordinate, units mm
+ *  @param  outerR the outer r coordinate, units mm
+ *  @param  innerZ the inner z coordinate, units mm
+ *  @param  outerZ the outer z coordinate, units mm
+ *  @param  innerSymmetryOrder the inner order of symmetry
+ *  @param  outerSymmetryOrder the outer order of symmetry
+ *  @param  nLayers the number of layers
+ *
+ *  @return the sub detector parameters
+ */
+PandoraApi::Geometry::SubDetector::Parameters GetSubDetectorParameters(const SubDetectorType subDetectorType, const float innerR,
+    const float outerR, const float innerZ, const float outerZ, const unsigned int innerSymmetryOrder,
+    const unsigned int outerSymmetryOrder, const unsigned int nLayers);
+
+/**
+ *  @brief  Create the sub detectors of a linear collider style detector, with barrel and endcap ecal, hcal and muon system
+ *
+ *  @param  pandora the pandora instance
+ */
+void CreateGeometry(const Pandora &pandora);
+
+/**
+ *  @brief  Time the pseudolayer assignment of a pseudo layer plugin, both per position and per batch of positions
+ *
+ *  @param  name the benchmark name
+ *  @param  pPseudoLayerPlugin address of the pseudo layer plugin
+ *  @param  positionVectors the positions
+ *  @param  pseudoLayers to receive the per position pseudolayers
+ *  @param  batchPseudoLayers to receive the batch pseudolayers
+ */
+void BenchmarkPseudoLayers(const std::string &name, const PseudoLayerPlugin *const pPseudoLayerPlugin,
+    const CartesianPointVector &positionVectors, UIntVector &pseudoLayers, UIntVector &batchPseudoLayers);
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int LCStylePseudoLayerPlugin::GetPseudoLayer(const CartesianVector &positionVector) const
+{
+    const float x(positionVector.GetX()), y(positionVector.GetY()), z(std::fabs(positionVector.GetZ()));
+    float polygonalRadius(x * m_sideNormalX.front() + y * m_sideNormalY.front());
+
+    for (unsigned int iSide = 1, nSides = m_sideNormalX.size(); iSide < nSides; ++iSide)
+        polygonalRadius = std::max(polygonalRadius, x * m_sideNormalX[iSide] + y * m_sideNormalY[iSide]);
+
+    if (z < m_endCapInnerZ)
+        return this->FindMatchingLayer(polygonalRadius, m_barrelLayerPositions);
+
+    if (polygonalRadius < m_barrelInnerR)
+        return this->FindMatchingLayer(z, m_endCapLayerPositions);
+
+    return std::max(this->FindMatchingLayer(polygonalRadius, m_barrelLayerPositions), this->FindMatchingLayer(z, m_endCapLayerPositions));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int LCStylePseudoLayerPlugin::GetPseudoLayerAtIp() const
+{
+    return 0;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode LCStylePseudoLayerPlugin::ReadSettings(const TiXmlHandle)
+{
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode LCStylePseudoLayerPlugin::Initialize()
+{
+    const SubDetector &ecalBarrel(this->GetPandora().GetGeometry()->GetSubDetector(ECAL_BARREL));
+    m_barrelInnerR = ecalBarrel.GetInnerRCoordinate();
+    m_endCapInnerZ = this->GetPandora().GetGeometry()->GetSubDetector(ECAL_ENDCAP).GetInnerZCoordinate();
+
+    for (unsigned int iSide = 0, nSides = ecalBarrel.GetInnerSymmetryOrder(); iSide < nSides; ++iSide)
+    {
+        const float phi(ecalBarrel.GetInnerPhiCoordinate() + 6.2831853f * static_cast<float>(iSide) / static_cast<float>(nSides));
+        m_sideNormalX.push_back(std::cos(phi));
+        m_sideNormalY.push_back(std::sin(phi));
+    }
+
+    for (const SubDetectorType subDetectorType : {ECAL_BARREL, HCAL_BARREL, MUON_BARREL})
+        this->AddLayerPositions(subDetectorType, m_barrelLayerPositions);
+
+    for (const SubDetectorType subDetectorType : {ECAL_ENDCAP, HCAL_ENDCAP, MUON_ENDCAP})
+        this->AddLayerPositions(subDetectorType, m_endCapLayerPositions);
+
+    std::sort(m_barrelLayerPositions.begin(), m_barrelLayerPositions.end());
+    std::sort(m_endCapLayerPositions.begin(), m_endCapLayerPositions.end());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LCStylePseudoLayerPlugin::AddLayerPositions(const SubDetectorType subDetectorType, FloatVector &layerPositions) const
+{
+    const SubDetector &subDetector(this->GetPandora().GetGeometry()->GetSubDetector(subDetectorType));
+
+    for (const SubDetector::SubDetectorLayer &layer : subDetector.GetSubDetectorLayerVector())
+        layerPositions.push_back(layer.GetClosestDistanceToIp());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int LCStylePseudoLayerPlugin::FindMatchingLayer(const float position, const FloatVector &layerPositions) const
+{
+    return static_cast<unsigned int>(std::upper_bound(layerPositions.begin(), layerPositions.end(), position) - layerPositions.begin());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+PandoraApi::Geometry::SubDetector::Parameters GetSubDetectorParameters(const SubDetectorType subDetectorType, const float innerR,
+    const float outerR, const float innerZ, const float outerZ, const unsigned int innerSymmetryOrder,
+    const unsigned int outerSymmetryOrder, const unsigned int nLayers)
+{
+    const bool isBarrel((ECAL_BARREL == subDetectorType) || (HCAL_BARREL == subDetectorType) || (MUON_BARREL == subDetectorType));
+
+    PandoraApi::Geometry::SubDetector::Parameters parameters;
+    parameters.m_subDetectorName = "SubDetector" + std::to_string(subDetectorType);
+    parameters.m_subDetectorType = subDetectorType;
+    parameters.m_innerRCoordinate = innerR;
+    parameters.m_innerZCoordinate = innerZ;
+    parameters.m_innerPhiCoordinate = 0.f;
+    parameters.m_innerSymmetryOrder = innerSymmetryOrder;
+    parameters.m_outerRCoordinate = outerR;
+    parameters.m_outerZCoordinate = outerZ;
+    parameters.m_outerPhiCoordinate = 0.f;
+    parameters.m_outerSymmetryOrder = outerSymmetryOrder;
+    parameters.m_isMirroredInZ = !isBarrel;
+    parameters.m_nLayers = nLayers;
+
+    const float layerInner(isBarrel ? innerR : innerZ), layerOuter(isBarrel ? outerR : outerZ);
+
+    for (unsigned int iLayer = 0; iLayer < nLayers; ++iLayer)
+    {
+        PandoraApi::Geometry::LayerParameters layerParameters;
+        layerParameters.m_closestDistanceToIp =
+            layerInner + (layerOuter - layerInner) * static_cast<float>(iLayer) / static_cast<float>(nLayers);
+        layerParameters.m_nRadiationLengths = 1.f;
+        layerParameters.m_nInteractionLengths = 0.1f;
+        parameters.m_layerParametersVector.push_back(layerParameters);
+    }
+
+    return parameters;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CreateGeometry(const Pandora &pandora)
+{
+    // ATTN The hcal outer edges and muon system have symmetries different to the ecal barrel, the reference polygon for the table
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Geometry::SubDetector::Create(pandora,
+        GetSubDetectorParameters(ECAL_BARREL, 1805.f, 2028.f, 0.f, 2350.f, 8, 8, 30)));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Geometry::SubDetector::Create(pandora,
+        GetSubDetectorParameters(ECAL_ENDCAP, 400.f, 2088.f, 2411.f, 2635.f, 4, 8, 30)));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Geometry::SubDetector::Create(pandora,
+        GetSubDetectorParameters(HCAL_BARREL, 2058.f, 3345.f, 0.f, 2350.f, 8, 16, 48)));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Geometry::SubDetector::Create(pandora,
+        GetSubDetectorParameters(HCAL_ENDCAP, 350.f, 3395.f, 2650.f, 3937.f, 8, 16, 48)));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Geometry::SubDetector::Create(pandora,
+        GetSubDetectorParameters(MUON_BARREL, 4450.f, 7755.f, 0.f, 4047.f, 12, 12, 14)));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Geometry::SubDetector::Create(pandora,
+        GetSubDetectorParameters(MUON_ENDCAP, 300.f, 7755.f, 4072.f, 6712.f, 12, 12, 12)));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void BenchmarkPseudoLayers(const std::string &name, const PseudoLayerPlugin *const pPseudoLayerPlugin,
+    const CartesianPointVector &positionVectors, UIntVector &pseudoLayers, UIntVector &batchPseudoLayers)
+{
+    pseudoLayers.clear();
+    pseudoLayers.reserve(positionVectors.size());
+
+    BenchmarkTimer timer;
+    for (const CartesianVector &positionVector : positionVectors)
+        pseudoLayers.push_back(pPseudoLayerPlugin->GetPseudoLayer(positionVector));
+    PrintResult(name + "::GetPseudoLayer", timer.GetElapsedMs(), positionVectors.size(), "positions");
+
+    timer = BenchmarkTimer();
+    pPseudoLayerPlugin->GetPseudoLayers(positionVectors, batchPseudoLayers);
+    PrintResult(name + "::GetPseudoLayers", timer.GetElapsedMs(), positionVectors.size(), "positions");
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const unsigned int nPositions(GetArgument(argc, argv, 1, 2000000));
+
+    try
+    {
+        // Two instances with the same geometry and plugin, the second wrapping its plugin with the lookup table
+        const Pandora pandora, tabulatedPandora;
+        const std::string settingsFileName("PseudoLayerBenchmarkSettings.xml");
+
+        for (const Pandora *const pPandora : {&pandora, &tabulatedPandora})
+        {
+            CreateGeometry(*pPandora);
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetPseudoLayerPlugin(*pPandora, new LCStylePseudoLayerPlugin));
+
+            std::ofstream settingsFile(settingsFileName);
+            settingsFile << "<pandora>\n" << ((pPandora == &tabulatedPandora) ? "    <TabulatedPseudoLayerPlugin/>\n" : "")
+                         << "</pandora>\n";
+            settingsFile.close();
+
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ReadSettings(*pPandora, settingsFileName));
+            std::remove(settingsFileName.c_str());
+        }
+
+        // Positions spread through the calorimeters, including the barrel and endcap overlap and the surrounding gaps
+        std::mt19937 generator(12345);
+        std::uniform_real_distribution<float> uniform(0.f, 1.f);
+        CartesianPointVector positionVectors;
+
+        for (unsigned int iPosition = 0; iPosition < nPositions; ++iPosition)
+        {
+            const float r(300.f + 3300.f * uniform(generator)), phi(6.2831853f * uniform(generator));
+            const float z(8000.f * uniform(generator) - 4000.f);
+            positionVectors.emplace_back(r * std::cos(phi), r * std::sin(phi), z);
+        }
+
+        UIntVector pseudoLayers, batchPseudoLayers, tabulatedPseudoLayers, tabulatedBatchPseudoLayers;
+        BenchmarkPseudoLayers("LCStylePseudoLayerPlugin", pandora.GetPlugins()->GetPseudoLayerPlugin(), positionVectors, pseudoLayers,
+            batchPseudoLayers);
+        BenchmarkPseudoLayers("TabulatedPseudoLayerPlugin", tabulatedPandora.GetPlugins()->GetPseudoLayerPlugin(), positionVectors,
+            tabulatedPseudoLayers, tabulatedBatchPseudoLayers);
+
+        unsigned int nMismatches(0), checkSum(0);
+
+        for (unsigned int index = 0; index < nPositions; ++index)
+        {
+            if ((pseudoLayers[index] != batchPseudoLayers[index]) || (pseudoLayers[index] != tabulatedPseudoLayers[index]) ||
+                (pseudoLayers[index] != tabulatedBatchPseudoLayers[index]))
+            {
+                ++nMismatches;
+            }
+
+            checkSum += pseudoLayers[index];
+        }
+
+        // ATTN Print the check sum, so that the benchmarked calls cannot be optimized away
+        std::cout << "Check sum " << checkSum << std::endl;
+
+        if (0 != nMismatches)
+        {
+            std::cout << "PseudoLayerBenchmark: " << nMismatches << " tabulated pseudolayers differ from the wrapped plugin pseudolayers"
+                      << std::endl;
+            return 1;
+        }
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "PseudoLayerBenchmark failed: " << statusCodeException.ToString() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
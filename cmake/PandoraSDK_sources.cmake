@@ -4,6 +4,7 @@ set(PANDORA_SDK_SRCS
     src/Api/PandoraContentApi.cc
     src/Api/PandoraContentApiImpl.cc
     src/Geometry/DetectorGap.cc
+    src/Geometry/DetectorGapIndex.cc
     src/Geometry/LArTPC.cc
     src/Geometry/SubDetector.cc
     src/Helpers/ClusterFitHelper.cc
@@ -12,6 +13,7 @@ set(PANDORA_SDK_SRCS
     src/Managers/AlgorithmManager.cc
     src/Managers/AlgorithmObjectManager.cc
     src/Managers/CaloHitManager.cc
+    src/Managers/CaloHitSpatialIndex.cc
     src/Managers/ClusterManager.cc
     src/Managers/GeometryManager.cc
     src/Managers/InputObjectManager.cc
@@ -27,6 +29,7 @@ set(PANDORA_SDK_SRCS
     src/Objects/Cluster.cc
     src/Objects/EventContext.cc
     src/Objects/Helix.cc
+    src/Objects/HelixBatch.cc
     src/Objects/Histograms.cc
     src/Objects/MCParticle.cc
     src/Objects/OrderedCaloHitList.cc
@@ -34,23 +37,33 @@ set(PANDORA_SDK_SRCS
     src/Objects/Track.cc
     src/Objects/TrackState.cc
     src/Objects/Vertex.cc
+    src/Pandora/AlgorithmProfiler.cc
+    src/Pandora/DaughterAlgorithmGroup.cc
+    src/Pandora/EventParallelRunner.cc
     src/Pandora/ExternallyConfiguredAlgorithm.cc
     src/Pandora/ObjectCreation.cc
+    src/Pandora/ObjectPool.cc
     src/Pandora/Pandora.cc
     src/Pandora/PandoraImpl.cc
     src/Pandora/PandoraObjectFactories.cc
     src/Pandora/PandoraSettings.cc
     src/Persistency/BinaryFileReader.cc
     src/Persistency/BinaryFileWriter.cc
+    src/Persistency/CompressionHelper.cc
     src/Persistency/EventReadingAlgorithm.cc
     src/Persistency/EventWritingAlgorithm.cc
     src/Persistency/FileReader.cc
     src/Persistency/FileWriter.cc
+    src/Persistency/MappedBinaryFileReader.cc
     src/Persistency/Persistency.cc
     src/Persistency/XmlFileReader.cc
     src/Persistency/XmlFileWriter.cc
+    src/Plugins/BFieldPlugin.cc
     src/Plugins/EnergyCorrectionsPlugin.cc
+    src/Plugins/InterpolatedBFieldPlugin.cc
     src/Plugins/ParticleIdPlugin.cc
+    src/Plugins/PseudoLayerPlugin.cc
+    src/Plugins/TabulatedPseudoLayerPlugin.cc
     src/Templates/TemplateAlgorithm.cc
     src/Templates/TemplateAlgorithmTool.cc
     src/Xml/tinystr.cc
@@ -16,6 +16,7 @@ namespace pandora
 {
 class AlgorithmFactory;
 class AlgorithmToolFactory;
+class CaloHitBlock;
 } // namespace pandora
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -101,6 +102,15 @@ public:
     static pandora::StatusCode RegisterAlgorithmToolFactory(
         const pandora::Pandora &pandora, const std::string &algorithmToolType, pandora::AlgorithmToolFactory *const pAlgorithmToolFactory);
 
+    /**
+     *  @brief  Create calo hits in bulk, from a block holding each calo hit property as a contiguous column. The whole block is validated
+     *          before any calo hits are created, then all calo hits are added to the input calo hit list at once.
+     *
+     *  @param  pandora the pandora instance to create the calo hits
+     *  @param  caloHitBlock the calo hit block
+     */
+    static pandora::StatusCode CreateCaloHits(const pandora::Pandora &pandora, const pandora::CaloHitBlock &caloHitBlock);
+
     /**
      *  @brief  Set parent-daughter mc particle relationship
      *
@@ -190,6 +200,15 @@ public:
      */
     static pandora::StatusCode SetHitTypeGranularity(const pandora::Pandora &pandora, const pandora::HitType hitType, const pandora::Granularity granularity);
 
+    /**
+     *  @brief  Share the geometry of one pandora instance with another, replacing any geometry registered with the target instance.
+     *          The shared geometry is immutable from then on, in both instances, and is deleted with the last instance sharing it.
+     *
+     *  @param  sourcePandora the pandora instance whose geometry is to be shared
+     *  @param  targetPandora the pandora instance to receive the shared geometry
+     */
+    static pandora::StatusCode ShareGeometry(const pandora::Pandora &sourcePandora, const pandora::Pandora &targetPandora);
+
     /**
      *  @brief  Set the bfield plugin used by pandora
      *
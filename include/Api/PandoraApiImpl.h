@@ -32,6 +32,13 @@ private:
     template <typename PARAMETERS, typename OBJECT>
     StatusCode Create(const PARAMETERS &parameters, const ObjectFactory<PARAMETERS, OBJECT> &factory) const;
 
+    /**
+     *  @brief  Create calo hits in bulk, from a block of calo hit properties
+     *
+     *  @param  caloHitBlock the calo hit block
+     */
+    StatusCode CreateCaloHits(const CaloHitBlock &caloHitBlock) const;
+
     /**
      *  @brief  Process event
      */
@@ -146,6 +153,13 @@ private:
      */
     StatusCode SetHitTypeGranularity(const HitType hitType, const Granularity granularity) const;
 
+    /**
+     *  @brief  Share the geometry of another pandora instance, in place of any geometry already registered with this instance
+     *
+     *  @param  sourcePandora the pandora instance whose geometry is to be shared
+     */
+    StatusCode ShareGeometry(const Pandora &sourcePandora) const;
+
     /**
      *  @brief  Set the bfield plugin used by pandora
      *
@@ -136,6 +136,17 @@ public:
      */
     static pandora::StatusCode RunDaughterAlgorithm(const pandora::Algorithm &algorithm, const std::string &daughterAlgorithmName);
 
+    /**
+     *  @brief  Run a group of daughter algorithms, from within a parent algorithm, in the stage order implied by their declared input and
+     *          output list names. Each daughter must have been created by this parent algorithm, must leave the current lists unchanged,
+     *          may only read saved lists declared as its inputs or outputs and may only write saved lists declared as its outputs, so that
+     *          daughters within a stage are isolated from one another; violations are reported as STATUS_CODE_NOT_ALLOWED.
+     * 
+     *  @param  algorithm the parent algorithm, now attempting to run the daughter algorithms
+     *  @param  daughterAlgorithmGroup the group of daughter algorithms to run
+     */
+    static pandora::StatusCode RunDaughterAlgorithmGroup(const pandora::Algorithm &algorithm, const pandora::DaughterAlgorithmGroup &daughterAlgorithmGroup);
+
     /**
      *  @brief  Run a clustering algorithm (an algorithm that will create new cluster objects)
      * 
@@ -313,6 +324,19 @@ public:
     static bool IsAvailable(const pandora::Algorithm &algorithm, const T *const pT);
 
 
+    /* Object-related functions: input objects only (CaloHits, Tracks, MCParticles) */
+
+    /**
+     *  @brief  Get the number of dense per-event indices assigned to input objects of a given type, see e.g. CaloHit::GetIndex. This
+     *          exceeds the index of every such object in the event, so can be used to size per-object tables held in plain vectors.
+     * 
+     *  @param  algorithm the algorithm calling this function
+     *  @param  nIndices to receive the number of indices assigned
+     */
+    template <typename T>
+    static pandora::StatusCode GetNIndices(const pandora::Algorithm &algorithm, unsigned int &nIndices);
+
+
     /* Object-related functions: algorithm objects only (Clusters, Pfos, Vertices) */
 
     /**
@@ -394,6 +418,22 @@ public:
         const float fraction1, const pandora::CaloHit *&pDaughterCaloHit1, const pandora::CaloHit *&pDaughterCaloHit2,
         const pandora::ObjectFactory<object_creation::CaloHitFragment::Parameters, object_creation::CaloHitFragment::Object> &factory = pandora::PandoraObjectFactory<object_creation::CaloHitFragment::Parameters, object_creation::CaloHitFragment::Object>());
 
+    /**
+     *  @brief  Fragment many calo hits, each into two daughter calo hits with a specified energy division. All the resulting calo hit
+     *          replacements are applied together, in a single pass over each calo hit list, so this is preferred to repeated calls to
+     *          fragment individual calo hits.
+     *
+     *  @param  algorithm the algorithm calling this function
+     *  @param  originalCaloHits the original calo hits, which will be deleted
+     *  @param  fractions1 the fractions of energy to be assigned to daughter fragment 1, one for each original calo hit
+     *  @param  daughterCaloHits1 to receive the addresses of daughter fragment 1, one for each original calo hit
+     *  @param  daughterCaloHits2 to receive the addresses of daughter fragment 2, one for each original calo hit
+     *  @param  factory to create the fragmented calo hits
+     */
+    static pandora::StatusCode Fragment(const pandora::Algorithm &algorithm, const pandora::CaloHitVector &originalCaloHits,
+        const pandora::FloatVector &fractions1, pandora::CaloHitVector &daughterCaloHits1, pandora::CaloHitVector &daughterCaloHits2,
+        const pandora::ObjectFactory<object_creation::CaloHitFragment::Parameters, object_creation::CaloHitFragment::Object> &factory = pandora::PandoraObjectFactory<object_creation::CaloHitFragment::Parameters, object_creation::CaloHitFragment::Object>());
+
     /**
      *  @brief  Merge two calo hit fragments, originally from the same parent hit, to form a new calo hit
      *
@@ -407,6 +447,34 @@ public:
         const pandora::CaloHit *const pFragmentCaloHit2, const pandora::CaloHit *&pMergedCaloHit,
         const pandora::ObjectFactory<object_creation::CaloHitFragment::Parameters, object_creation::CaloHitFragment::Object> &factory = pandora::PandoraObjectFactory<object_creation::CaloHitFragment::Parameters, object_creation::CaloHitFragment::Object>());
 
+    /**
+     *  @brief  Get the available calo hits, of a specified hit type in a named calo hit list, within a specified distance of a position.
+     *          A spatial index for the list and hit type is built on first use and kept until the list is changed.
+     *
+     *  @param  algorithm the algorithm calling this function
+     *  @param  listName the name of the calo hit list
+     *  @param  hitType the hit type
+     *  @param  position the position
+     *  @param  distance the distance
+     *  @param  caloHitVector to receive the calo hits, ordered by increasing distance from the position
+     */
+    static pandora::StatusCode GetCaloHitsInRange(const pandora::Algorithm &algorithm, const std::string &listName, const pandora::HitType hitType,
+        const pandora::CartesianVector &position, const float distance, pandora::CaloHitVector &caloHitVector);
+
+    /**
+     *  @brief  Get the available calo hits, of a specified hit type in a named calo hit list, nearest to a position. A spatial index for
+     *          the list and hit type is built on first use and kept until the list is changed.
+     *
+     *  @param  algorithm the algorithm calling this function
+     *  @param  listName the name of the calo hit list
+     *  @param  hitType the hit type
+     *  @param  position the position
+     *  @param  nCaloHits the maximum number of calo hits to receive
+     *  @param  caloHitVector to receive the calo hits, ordered by increasing distance from the position
+     */
+    static pandora::StatusCode GetNearestCaloHits(const pandora::Algorithm &algorithm, const std::string &listName, const pandora::HitType hitType,
+        const pandora::CartesianVector &position, const unsigned int nCaloHits, pandora::CaloHitVector &caloHitVector);
+
 
     /* Track-related functions */
 
@@ -10,6 +10,7 @@
 
 #include "Api/PandoraContentApi.h"
 
+#include "Pandora/AlgorithmProfiler.h"
 #include "Pandora/ObjectCreation.h"
 #include "Pandora/StatusCodes.h"
 
@@ -147,10 +148,11 @@ private:
      *  @brief  Create an algorithm instance, via one of the algorithm factories registered with pandora.
      *          This function is expected to be called whilst reading the settings for a parent algorithm.
      * 
+     *  @param  parentAlgorithm the parent algorithm, recorded so that it alone may run the daughter algorithm in a group
      *  @param  pXmlElement address of the xml element describing the daughter algorithm type and settings
      *  @param  daughterAlgorithmName to receive the name of the daughter algorithm instance
      */
-    StatusCode CreateDaughterAlgorithm(TiXmlElement *const pXmlElement, std::string &daughterAlgorithmName) const;
+    StatusCode CreateDaughterAlgorithm(const Algorithm &parentAlgorithm, TiXmlElement *const pXmlElement, std::string &daughterAlgorithmName) const;
 
     /**
      *  @brief  Run an algorithm registered with pandora
@@ -159,6 +161,23 @@ private:
      */
     StatusCode RunAlgorithm(const std::string &algorithmName) const;
 
+    /**
+     *  @brief  Run a group of daughter algorithms, stage by stage, checking that each was created by the running parent algorithm and
+     *          accesses only its declared saved lists
+     * 
+     *  @param  parentAlgorithm the parent algorithm, which must be running
+     *  @param  daughterAlgorithmGroup the group of daughter algorithms
+     */
+    StatusCode RunAlgorithmGroup(const Algorithm &parentAlgorithm, const DaughterAlgorithmGroup &daughterAlgorithmGroup) const;
+
+    /**
+     *  @brief  Run an algorithm as part of a group, recording and checking the saved lists it accesses
+     * 
+     *  @param  algorithmName the algorithm name
+     *  @param  daughterAlgorithmGroup the group of algorithms, holding the declared input and output lists of the algorithm
+     */
+    StatusCode RunGroupedAlgorithm(const std::string &algorithmName, const DaughterAlgorithmGroup &daughterAlgorithmGroup) const;
+
     /**
      *  @brief  Run a clustering algorithm (an algorithm that will create new cluster objects)
      * 
@@ -315,6 +334,17 @@ private:
     bool IsAvailable(const T *const pT) const;
 
 
+    /* Object-related functions: input objects only (CaloHits, Tracks, MCParticles) */
+
+    /**
+     *  @brief  Get the number of dense per-event indices assigned to input objects of a given type
+     * 
+     *  @param  nIndices to receive the number of indices assigned
+     */
+    template <typename T>
+    StatusCode GetNIndices(unsigned int &nIndices) const;
+
+
     /* Object-related functions: algorithm objects only (Clusters, Pfos, Vertices) */
 
     /**
@@ -386,6 +416,18 @@ private:
     StatusCode Fragment(const CaloHit *const pOriginalCaloHit, const float fraction1, const CaloHit *&pDaughterCaloHit1,
         const CaloHit *&pDaughterCaloHit2, const ObjectFactory<object_creation::CaloHitFragment::Parameters, object_creation::CaloHitFragment::Object> &factory) const;
 
+    /**
+     *  @brief  Fragment many calo hits, each into two daughter calo hits with a specified energy division
+     *
+     *  @param  originalCaloHits the original calo hits, which will be deleted
+     *  @param  fractions1 the fractions of energy to be assigned to daughter fragment 1, one for each original calo hit
+     *  @param  daughterCaloHits1 to receive the addresses of daughter fragment 1, one for each original calo hit
+     *  @param  daughterCaloHits2 to receive the addresses of daughter fragment 2, one for each original calo hit
+     *  @param  factory to create the fragmented calo hits
+     */
+    StatusCode Fragment(const CaloHitVector &originalCaloHits, const FloatVector &fractions1, CaloHitVector &daughterCaloHits1,
+        CaloHitVector &daughterCaloHits2, const ObjectFactory<object_creation::CaloHitFragment::Parameters, object_creation::CaloHitFragment::Object> &factory) const;
+
     /**
      *  @brief  Merge two calo hit fragments, originally from the same parent hit, to form a new calo hit
      *
@@ -397,6 +439,30 @@ private:
     StatusCode MergeFragments(const CaloHit *const pFragmentCaloHit1, const CaloHit *const pFragmentCaloHit2,
         const CaloHit *&pMergedCaloHit, const ObjectFactory<object_creation::CaloHitFragment::Parameters, object_creation::CaloHitFragment::Object> &factory) const;
 
+    /**
+     *  @brief  Get the available calo hits, of a specified hit type in a named calo hit list, within a specified distance of a position
+     *
+     *  @param  listName the name of the calo hit list
+     *  @param  hitType the hit type
+     *  @param  position the position
+     *  @param  distance the distance
+     *  @param  caloHitVector to receive the calo hits, ordered by increasing distance from the position
+     */
+    StatusCode GetCaloHitsInRange(const std::string &listName, const HitType hitType, const CartesianVector &position, const float distance,
+        CaloHitVector &caloHitVector) const;
+
+    /**
+     *  @brief  Get the available calo hits, of a specified hit type in a named calo hit list, nearest to a position
+     *
+     *  @param  listName the name of the calo hit list
+     *  @param  hitType the hit type
+     *  @param  position the position
+     *  @param  nCaloHits the maximum number of calo hits to receive
+     *  @param  caloHitVector to receive the calo hits, ordered by increasing distance from the position
+     */
+    StatusCode GetNearestCaloHits(const std::string &listName, const HitType hitType, const CartesianVector &position, const unsigned int nCaloHits,
+        CaloHitVector &caloHitVector) const;
+
 
     /* Track-related functions */
 
@@ -592,7 +658,100 @@ private:
      */
     StatusCode PostRunAlgorithm(Algorithm *const pAlgorithm) const;
 
-    Pandora    *m_pPandora;    ///< The pandora object to provide an interface to
+    /**
+     *  @brief  Start profiling a run of an algorithm, recording the current manager object counts
+     * 
+     *  @param  pAlgorithm address of the algorithm
+     */
+    void BeginAlgorithmProfile(const Algorithm *const pAlgorithm) const;
+
+    /**
+     *  @brief  Stop profiling the innermost algorithm run being profiled, recording the current manager object counts
+     */
+    void EndAlgorithmProfile() const;
+
+    /**
+     *  @brief  Get the cumulative numbers of objects created and deleted by each profiled manager
+     * 
+     *  @param  objectCounts to receive the object counts
+     */
+    void GetObjectCounts(AlgorithmProfiler::ObjectCounts &objectCounts) const;
+
+    /**
+     *  @brief  ListState class, recording the current list and the saved lists of a manager
+     */
+    class ListState
+    {
+    public:
+        std::string     m_currentListName;      ///< The name of the current list
+        StringSet       m_savedListNames;       ///< The names of the saved lists
+    };
+
+    typedef std::vector<ListState> ListStateVector;
+
+    /**
+     *  @brief  Get the list states of all object managers
+     * 
+     *  @param  listStateVector to receive the list states
+     */
+    void GetListStates(ListStateVector &listStateVector) const;
+
+    /**
+     *  @brief  Get the list state of the manager for a specified object type
+     * 
+     *  @param  listState to receive the list state
+     */
+    template <typename T>
+    void GetListState(ListState &listState) const;
+
+    /**
+     *  @brief  ListAccess class, recording the names of the saved lists accessed by an algorithm run as part of a group
+     */
+    class ListAccess
+    {
+    public:
+        bool            m_isRecording;          ///< Whether list accesses are being recorded
+        StringSet       m_readListNames;        ///< The names of the saved lists read
+        StringSet       m_writtenListNames;     ///< The names of the saved lists written
+    };
+
+    /**
+     *  @brief  Record that a list has been read, if list accesses are being recorded and the list is a saved list
+     * 
+     *  @param  listName the list name
+     */
+    template <typename T>
+    void RecordListRead(const std::string &listName) const;
+
+    /**
+     *  @brief  Record that a list has been written, if list accesses are being recorded and the list is a saved list
+     * 
+     *  @param  listName the list name
+     */
+    template <typename T>
+    void RecordListWrite(const std::string &listName) const;
+
+    /**
+     *  @brief  Record that the current list has been read, if list accesses are being recorded and the current list is a saved list
+     */
+    template <typename T>
+    void RecordCurrentListRead() const;
+
+    /**
+     *  @brief  Check that an algorithm run as part of a group left the current lists unchanged, read only its declared input or output
+     *          lists and wrote or saved only its declared output lists
+     * 
+     *  @param  algorithmName the algorithm name
+     *  @param  inputListNames the declared input list names
+     *  @param  outputListNames the declared output list names
+     *  @param  listStateVector the list states of all object managers before the algorithm was run
+     *  @param  listAccess the saved lists accessed by the algorithm
+     */
+    StatusCode CheckListStates(const std::string &algorithmName, const StringSet &inputListNames, const StringSet &outputListNames,
+        const ListStateVector &listStateVector, const ListAccess &listAccess) const;
+
+    Pandora            *m_pPandora;         ///< The pandora object to provide an interface to
+    mutable ListAccess  m_listAccess;       ///< The saved lists accessed by the algorithm currently run as part of a group
 
     friend class Pandora;
     friend class PandoraImpl;
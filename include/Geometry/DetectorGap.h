@@ -153,6 +153,12 @@ private:
     const CartesianVector   m_side1;                ///< Cartesian vector describing first side meeting vertex, units mm
     const CartesianVector   m_side2;                ///< Cartesian vector describing second side meeting vertex, units mm
     const CartesianVector   m_side3;                ///< Cartesian vector describing third side meeting vertex, units mm
+    const CartesianVector   m_unitSide1;            ///< Unit vector along first side meeting vertex
+    const CartesianVector   m_unitSide2;            ///< Unit vector along second side meeting vertex
+    const CartesianVector   m_unitSide3;            ///< Unit vector along third side meeting vertex
+    const float             m_side1Length;          ///< Length of first side meeting vertex, units mm
+    const float             m_side2Length;          ///< Length of second side meeting vertex, units mm
+    const float             m_side3Length;          ///< Length of third side meeting vertex, units mm
 
     friend class PandoraObjectFactory<object_creation::Geometry::BoxGap::Parameters, object_creation::Geometry::BoxGap::Object>;
 };
@@ -223,6 +229,13 @@ public:
      */
     unsigned int GetOuterSymmetryOrder() const;
 
+    /**
+     *  @brief  Get the max outer cylindrical polar r coordinate, the circumradius of the outer polygon
+     * 
+     *  @param  the max outer cylindrical polar r coordinate
+     */
+    float GetOuterRMax() const;
+
 private:
     /**
      *  @brief  Constructor
@@ -262,6 +275,7 @@ private:
     const float             m_outerRCoordinate;     ///< Outer cylindrical polar r coordinate, origin interaction point, units mm
     const float             m_outerPhiCoordinate;   ///< Outer cylindrical polar phi coordinate (angle wrt cartesian x axis)
     const unsigned int      m_outerSymmetryOrder;   ///< Order of symmetry of the outermost edge of gap
+    float                   m_outerRMax;            ///< Max outer cylindrical polar r coordinate, the circumradius of the outer polygon
 
     VertexPointList         m_innerVertexPointList; ///< The vertex points of the inner polygon
     VertexPointList         m_outerVertexPointList; ///< The vertex points of the outer polygon
@@ -391,6 +405,13 @@ inline unsigned int ConcentricGap::GetOuterSymmetryOrder() const
     return m_outerSymmetryOrder;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float ConcentricGap::GetOuterRMax() const
+{
+    return m_outerRMax;
+}
+
 } // namespace pandora
 
 #endif // #ifndef PANDORA_DETECTOR_GAP_H
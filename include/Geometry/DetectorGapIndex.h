@@ -0,0 +1,234 @@
+/**
+ *  @file   PandoraSDK/include/Geometry/DetectorGapIndex.h
+ *
+ *  @brief  Header file for the detector gap index class.
+ *
+ *  $Log: $
+ */
+#ifndef PANDORA_DETECTOR_GAP_INDEX_H
+#define PANDORA_DETECTOR_GAP_INDEX_H 1
+
+#include "Pandora/PandoraEnumeratedTypes.h"
+#include "Pandora/PandoraInternal.h"
+#include "Pandora/StatusCodes.h"
+
+namespace pandora
+{
+
+/**
+ *  @brief  DetectorGapIndex class, an acceleration structure answering whether a position lies within any of a set of detector gaps. Line
+ *          gaps are held, per line gap type, as intervals sorted by lower edge, alongside the running maximum of their upper edges, so a
+ *          single binary search decides whether any interval contains a coordinate. Box and concentric gaps are held in a bounding volume
+ *          hierarchy of axis-aligned boxes, so only the gaps whose bounds contain a position are asked whether the position is in the gap.
+ *
+ *          Gaps added since the index was last built are held separately and tested one by one, so the index always gives the same result
+ *          as testing every gap, whilst the cost of building is paid only when the index is explicitly brought up to date.
+ */
+class DetectorGapIndex
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    DetectorGapIndex();
+
+    /**
+     *  @brief  Add a detector gap, which will be tested individually until the index is next built
+     *
+     *  @param  pDetectorGap address of the detector gap
+     */
+    void AddDetectorGap(const DetectorGap *const pDetectorGap);
+
+    /**
+     *  @brief  Build the index over all detector gaps added so far
+     */
+    void Build();
+
+    /**
+     *  @brief  Whether all detector gaps added so far are held in the index structures
+     *
+     *  @return boolean
+     */
+    bool IsUpToDate() const;
+
+    /**
+     *  @brief  Whether a specified position lies within any detector gap. As for DetectorGap::IsInGap, an exception is raised if there are
+     *          any gaps unable to interpret the hit type: line gaps for non-tpc hit types, or box and concentric gaps for 2D tpc hit types.
+     *
+     *  @param  positionVector the position vector
+     *  @param  hitType the hit type, providing context to aid interpretation of provided position vector
+     *  @param  gapTolerance tolerance allowed when declaring a point to be "in" a gap region, units mm
+     *
+     *  @return boolean
+     */
+    bool IsInAnyGap(const CartesianVector &positionVector, const HitType hitType, const float gapTolerance) const;
+
+private:
+    /**
+     *  @brief  IntervalList class, answering whether any of a set of open intervals, widened by a tolerance, contains a coordinate
+     */
+    class IntervalList
+    {
+    public:
+        /**
+         *  @brief  Set the intervals
+         *
+         *  @param  lowerEdges the interval lower edges
+         *  @param  upperEdges the interval upper edges, in the same order as the lower edges
+         */
+        void SetIntervals(const FloatVector &lowerEdges, const FloatVector &upperEdges);
+
+        /**
+         *  @brief  Whether any interval, widened by a tolerance, contains a coordinate
+         *
+         *  @param  coordinate the coordinate
+         *  @param  tolerance the tolerance
+         *
+         *  @return boolean
+         */
+        bool Contains(const float coordinate, const float tolerance) const;
+
+    private:
+        FloatVector             m_lowerEdges;           ///< The interval lower edges, in increasing order
+        FloatVector             m_maxUpperEdges;        ///< The maximum upper edge of the intervals up to and including each lower edge
+    };
+
+    /**
+     *  @brief  BoundingBox class, an axis-aligned box that grows with the gap tolerance
+     */
+    class BoundingBox
+    {
+    public:
+        /**
+         *  @brief  Whether the box, grown for a specified gap tolerance, contains a position
+         *
+         *  @param  position the position coordinates
+         *  @param  gapTolerance the gap tolerance
+         *
+         *  @return boolean
+         */
+        bool Contains(const float *const position, const float gapTolerance) const;
+
+        /**
+         *  @brief  Extend the box to enclose another box
+         *
+         *  @param  rhs the other box
+         */
+        void Enclose(const BoundingBox &rhs);
+
+        float                   m_min[3];               ///< The minimum coordinates, for zero gap tolerance
+        float                   m_max[3];               ///< The maximum coordinates, for zero gap tolerance
+        float                   m_growth[3];            ///< The growth of the box, on each side, per unit gap tolerance
+    };
+
+    /**
+     *  @brief  BoundedGap class, a box or concentric gap and its bounding box
+     */
+    class BoundedGap
+    {
+    public:
+        BoundingBox             m_boundingBox;          ///< The bounding box
+        const DetectorGap      *m_pDetectorGap;         ///< Address of the detector gap
+    };
+
+    /**
+     *  @brief  BoundingNode class, a node in the bounding volume hierarchy. The first child of a branch node immediately follows it.
+     */
+    class BoundingNode
+    {
+    public:
+        BoundingBox             m_boundingBox;          ///< The bounding box enclosing all gaps under the node
+        unsigned int            m_begin;                ///< The index of the first bounded gap under the node
+        unsigned int            m_end;                  ///< The index one past the last bounded gap under the node
+        unsigned int            m_secondChild;          ///< The index of the second child node, or zero for a leaf node
+    };
+
+    /**
+     *  @brief  CentreLessThan class, ordering bounded gaps by the centre of their bounding boxes along a single axis
+     */
+    class CentreLessThan
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  dimension the index of the axis
+         */
+        CentreLessThan(const unsigned int dimension);
+
+        /**
+         *  @brief  Operator< for bounded gaps, comparing the bounding box centres along the chosen axis
+         *
+         *  @param  lhs the first bounded gap
+         *  @param  rhs the second bounded gap
+         */
+        bool operator()(const BoundedGap &lhs, const BoundedGap &rhs) const;
+
+    private:
+        unsigned int            m_dimension;            ///< The index of the axis
+    };
+
+    typedef std::vector<BoundedGap> BoundedGapVector;
+    typedef std::vector<BoundingNode> BoundingNodeVector;
+
+    /**
+     *  @brief  Get the bounding box of a box gap, enclosing the region within which its IsInGap implementation can return true
+     *
+     *  @param  pBoxGap address of the box gap
+     *  @param  boundingBox to receive the bounding box
+     *
+     *  @return whether the region is bounded
+     */
+    static bool GetBoundingBox(const BoxGap *const pBoxGap, BoundingBox &boundingBox);
+
+    /**
+     *  @brief  Get the bounding box of a concentric gap, enclosing the region within which its IsInGap implementation can return true
+     *
+     *  @param  pConcentricGap address of the concentric gap
+     *  @param  boundingBox to receive the bounding box
+     */
+    static void GetBoundingBox(const ConcentricGap *const pConcentricGap, BoundingBox &boundingBox);
+
+    /**
+     *  @brief  Build the subtree of the bounding volume hierarchy for a range of bounded gaps
+     *
+     *  @param  begin the index of the first bounded gap in the range
+     *  @param  end the index one past the last bounded gap in the range
+     */
+    void BuildNode(const unsigned int begin, const unsigned int end);
+
+    /**
+     *  @brief  Whether a position lies within any gap under a node of the bounding volume hierarchy
+     *
+     *  @param  nodeIndex the index of the node
+     *  @param  position the position coordinates
+     *  @param  positionVector the position vector
+     *  @param  hitType the hit type
+     *  @param  gapTolerance the gap tolerance
+     *
+     *  @return boolean
+     */
+    bool IsInBoundedGap(const unsigned int nodeIndex, const float *const position, const CartesianVector &positionVector, const HitType hitType,
+        const float gapTolerance) const;
+
+    DetectorGapVector           m_detectorGapVector;    ///< All detector gaps added, in order of addition
+    unsigned int                m_nIndexedGaps;         ///< The number of detector gaps, from the start of the vector, held in the index
+    unsigned int                m_nLineGaps;            ///< The number of line gaps added
+    unsigned int                m_nVolumeGaps;          ///< The number of box and concentric gaps added
+    IntervalList                m_wireGapLists[3];      ///< The z intervals of the u, v and w wire gaps
+    IntervalList                m_driftGapList;         ///< The x intervals of the drift gaps
+    BoundedGapVector            m_boundedGapVector;     ///< The bounded gaps, ordered as the leaves of the bounding volume hierarchy
+    BoundingNodeVector          m_boundingNodeVector;   ///< The nodes of the bounding volume hierarchy, with the root first
+    DetectorGapVector           m_unboundedGapVector;   ///< The indexed box gaps with unbounded regions, to be tested individually
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool DetectorGapIndex::IsUpToDate() const
+{
+    return (m_nIndexedGaps == m_detectorGapVector.size());
+}
+
+} // namespace pandora
+
+#endif // #ifndef PANDORA_DETECTOR_GAP_INDEX_H
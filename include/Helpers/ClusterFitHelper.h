@@ -208,6 +208,78 @@ typedef std::vector<ClusterFitResult> ClusterFitResultList;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+/**
+ *  @brief  ClusterFitMoments class, holding running sums over calo hits of their positions, cell normal vectors, position errors and
+ *          pseudo layers. A linear fit equivalent to that of ClusterFitHelper::FitPoints can be made from these sums without revisiting
+ *          the calo hits, and the sums can be updated in constant time as calo hits are added to or removed from a cluster.
+ */
+class ClusterFitMoments
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    ClusterFitMoments();
+
+    /**
+     *  @brief  Add the contribution of a calo hit
+     * 
+     *  @param  pCaloHit address of the calo hit
+     */
+    void AddCaloHit(const CaloHit *const pCaloHit);
+
+    /**
+     *  @brief  Remove the contribution of a calo hit, which must previously have been added
+     * 
+     *  @param  pCaloHit address of the calo hit
+     */
+    void RemoveCaloHit(const CaloHit *const pCaloHit);
+
+    /**
+     *  @brief  Add the contributions summed in other cluster fit moments
+     * 
+     *  @param  rhs the other cluster fit moments
+     */
+    void Add(const ClusterFitMoments &rhs);
+
+    /**
+     *  @brief  Get the number of fit points, i.e. calo hits, contributing to the moments
+     * 
+     *  @return the number of fit points
+     */
+    unsigned int GetNPoints() const;
+
+    /**
+     *  @brief  Reset the cluster fit moments
+     */
+    void Reset();
+
+private:
+    /**
+     *  @brief  Add or subtract the contribution of a calo hit
+     * 
+     *  @param  pCaloHit address of the calo hit
+     *  @param  isAddition whether to add, rather than subtract, the contribution
+     */
+    void Accumulate(const CaloHit *const pCaloHit, const bool isAddition);
+
+    unsigned int            m_nPoints;                          ///< The number of fit points
+    unsigned int            m_nInvalidPoints;                   ///< The number of fit points with no cell size, which cannot be fitted
+    double                  m_positionSums[3];                  ///< The sums of x, y and z
+    double                  m_positionProductSums[6];           ///< The sums of xx, xy, xz, yy, yz and zz
+    double                  m_normalSums[3];                    ///< The sums of the cell normal vector components
+    double                  m_weightSum;                        ///< The sum of the weights, the inverse squared position errors
+    double                  m_weightedPositionSums[3];          ///< The weighted sums of x, y and z
+    double                  m_weightedPositionProductSums[6];   ///< The weighted sums of xx, xy, xz, yy, yz and zz
+    double                  m_layerSum;                         ///< The sum of the pseudo layers
+    double                  m_layerSquaredSum;                  ///< The sum of the squared pseudo layers
+    double                  m_layerPositionSums[3];             ///< The sums of the pseudo layer multiplied by x, y and z
+
+    friend class ClusterFitHelper;
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  ClusterFitHelper class
  */
@@ -240,6 +312,14 @@ public:
      */
     static StatusCode FitFullCluster(const Cluster *const pCluster, ClusterFitResult &clusterFitResult);
 
+    /**
+     *  @brief  Fit all points in each of a number of clusters, as for FitFullCluster. The success of each fit is recorded in its result.
+     * 
+     *  @param  clusterVector the clusters to fit
+     *  @param  clusterFitResultList to receive the cluster fit results, one per cluster and in the same order
+     */
+    static StatusCode FitClusters(const ClusterVector &clusterVector, ClusterFitResultList &clusterFitResultList);
+
     /**
      *  @brief  Fit all cluster points within the specified (inclusive) pseudolayer range
      * 
@@ -270,17 +350,55 @@ public:
      */
     static StatusCode FitPoints(ClusterFitPointList &clusterFitPointList, ClusterFitResult &clusterFitResult);
 
+    /**
+     *  @brief  Perform the linear fit of FitPoints using only the summed moments of the fit points, in time independent of their number
+     * 
+     *  @param  clusterFitMoments the cluster fit moments
+     *  @param  clusterFitResult to receive the cluster fit result
+     */
+    static StatusCode FitMoments(const ClusterFitMoments &clusterFitMoments, ClusterFitResult &clusterFitResult);
+
 private:
     /**
      *  @brief  Perform linear fit to cluster fit points
      * 
      *  @param  centralPosition central position of the cluster fit points
      *  @param  centralDirection central direction of normal to cluster fit calorimeter cells
-     *  @param  clusterFitPointList list of cluster fit points
+     *  @param  clusterFitPointList list of cluster fit points, sorted to fix the order in which contributions are summed
      *  @param  clusterFitResult to receive the cluster fit result
      */
     static StatusCode PerformLinearFit(const CartesianVector &centralPosition, const CartesianVector &centralDirection,
-        ClusterFitPointList &clusterFitPointList, ClusterFitResult &clusterFitResult);
+        const ClusterFitPointList &clusterFitPointList, ClusterFitResult &clusterFitResult);
+
+    /**
+     *  @brief  Perform linear fit to cluster fit moments, using the same parametrization as for a fit to cluster fit points
+     * 
+     *  @param  centralPosition central position of the cluster fit points
+     *  @param  centralDirection central direction of normal to cluster fit calorimeter cells
+     *  @param  clusterFitMoments the cluster fit moments
+     *  @param  clusterFitResult to receive the cluster fit result
+     */
+    static StatusCode PerformLinearFit(const CartesianVector &centralPosition, const CartesianVector &centralDirection,
+        const ClusterFitMoments &clusterFitMoments, ClusterFitResult &clusterFitResult);
+
+    /**
+     *  @brief  Get the matrix rotating the central direction of normal to cluster fit calorimeter cells onto the z axis
+     * 
+     *  @param  centralDirection central direction of normal to cluster fit calorimeter cells
+     *  @param  rotation to receive the rotation matrix, indexed by row then column
+     */
+    static void GetRotationMatrix(const CartesianVector &centralDirection, double rotation[3][3]);
+
+    /**
+     *  @brief  Get the quadratic form u^T M v for a symmetric matrix M, specified by its upper triangle: xx, xy, xz, yy, yz and zz
+     * 
+     *  @param  u the first vector
+     *  @param  symmetricMatrix the symmetric matrix
+     *  @param  v the second vector
+     * 
+     *  @return the quadratic form
+     */
+    static double GetQuadraticForm(const double *const u, const double *const symmetricMatrix, const double *const v);
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -322,6 +440,14 @@ inline unsigned int ClusterFitPoint::GetPseudoLayer() const
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline unsigned int ClusterFitMoments::GetNPoints() const
+{
+    return m_nPoints;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline ClusterFitResult::ClusterFitResult() :
     m_isFitSuccessful(false),
     m_direction(0.f, 0.f, 0.f),
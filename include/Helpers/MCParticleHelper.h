@@ -29,6 +29,16 @@ public:
      */
     template <typename T>
     static const MCParticle *GetMainMCParticle(const T *const pT);
+
+private:
+    /**
+     *  @brief  Find the mc particle with the largest weight in a specified mc particle weight map
+     * 
+     *  @param  mcParticleWeightMap the mc particle weight map
+     * 
+     *  @return address of the mc particle with the largest weight, or nullptr if no mc particle has positive weight
+     */
+    static const MCParticle *GetBestMCParticle(const MCParticleWeightMap &mcParticleWeightMap);
 };
 
 } // namespace pandora
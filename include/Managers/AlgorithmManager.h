@@ -112,6 +112,10 @@ private:
     SpecificAlgorithmInstanceMap    m_specificAlgorithmInstanceMap;     ///< The specific algorithm instance map
     StringVector                    m_pandoraAlgorithms;                ///< The ordered list of names of top-level algorithms, to be run by pandora
 
+    typedef std::map<const Algorithm *, StringSet> DaughterAlgorithmMap;
+
+    DaughterAlgorithmMap            m_daughterAlgorithmMap;             ///< The names of the daughter algorithms created by each parent algorithm
+
     typedef std::map<const std::string, AlgorithmToolFactory *const> AlgorithmToolFactoryMap;
 
     AlgorithmToolVector             m_algorithmToolVector;              ///< The algorithm tool vector
@@ -34,6 +34,7 @@ public:
 
 protected:
     typedef typename Manager<T>::ObjectList ObjectList;
+    typedef typename Manager<T>::ObjectSet ObjectSet;
 
     /**
      *  @brief  Make a temporary list and set it to be the current list
@@ -169,7 +170,45 @@ protected:
      */
     virtual StatusCode EraseAllContent();
 
-    bool        m_canMakeNewObjects;            ///< Whether the manager is allowed to make new objects when requested by algorithms
+    /**
+     *  @brief  Add an object to a list, keeping the membership index of the list up to date
+     * 
+     *  @param  objectList the list
+     *  @param  pT address of the object to add
+     */
+    void AddObjectToList(ObjectList &objectList, const T *const pT);
+
+    /**
+     *  @brief  Get the membership index of a list, building it on first use. The index is then maintained on every insertion into,
+     *          or erasure from, the list, and is dropped when the list is deleted.
+     * 
+     *  @param  objectList the list
+     * 
+     *  @return the membership index of the list
+     */
+    ObjectSet &GetListIndex(const ObjectList &objectList);
+
+    /**
+     *  @brief  Erase a set of objects from a list, preserving the order of the remaining objects and keeping the membership index of
+     *          the list up to date
+     * 
+     *  @param  objectList the list from which to erase the objects
+     *  @param  objectsToErase the set of objects to erase
+     */
+    void EraseObjects(ObjectList &objectList, const ObjectSet &objectsToErase);
+
+    /**
+     *  @brief  Erase a single object from a list, keeping the membership index of the list up to date
+     * 
+     *  @param  objectList the list from which to erase the object
+     *  @param  pT address of the object to erase, which must be present in the list
+     */
+    void EraseObject(ObjectList &objectList, const T *const pT);
+
+    typedef std::unordered_map<const ObjectList *, ObjectSet> ListIndexMap;
+
+    bool            m_canMakeNewObjects;        ///< Whether the manager is allowed to make new objects when requested by algorithms
+    ListIndexMap    m_listIndexMap;             ///< The membership indices of the lists in the name to list map, keyed by list address
 };
 
 } // namespace pandora
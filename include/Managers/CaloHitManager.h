@@ -8,6 +8,7 @@
 #ifndef PANDORA_CALO_HIT_MANAGER_H
 #define PANDORA_CALO_HIT_MANAGER_H 1
 
+#include "Managers/CaloHitSpatialIndex.h"
 #include "Managers/InputObjectManager.h"
 #include "Managers/Metadata.h"
 
@@ -17,6 +18,10 @@
 namespace pandora
 {
 
+class CaloHitBlock;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  CaloHitManager class
  */
@@ -46,13 +51,38 @@ private:
     StatusCode Create(const object_creation::CaloHit::Parameters &parameters, const CaloHit *&pCaloHit,
         const ObjectFactory<object_creation::CaloHit::Parameters, object_creation::CaloHit::Object> &factory);
 
+    /**
+     *  @brief  Create calo hits in bulk, from a block of calo hit properties, adding them to the input calo hit list. The block is validated
+     *          in full before any calo hits are created, so either all or none of the calo hits are created.
+     * 
+     *  @param  caloHitBlock the calo hit block
+     */
+    StatusCode Create(const CaloHitBlock &caloHitBlock);
+
+    /**
+     *  @brief  Check that all columns of a calo hit block have the same length, that all floating point properties are finite and that
+     *          all direction vectors can be normalized
+     * 
+     *  @param  caloHitBlock the calo hit block
+     * 
+     *  @return boolean
+     */
+    static bool IsValid(const CaloHitBlock &caloHitBlock);
+
+    /**
+     *  @brief  Assign pseudolayers to a number of newly created calo hits, using a single batch call to the pseudo layer plugin
+     * 
+     *  @param  caloHitVector the calo hits
+     */
+    StatusCode AssignPseudoLayers(const CaloHitVector &caloHitVector);
+
     /**
      *  @brief  Alter the metadata information stored in a calo hit
      * 
      *  @param  pCaloHit address of the calo hit to modify
      *  @param  metaData the metadata (only populated metadata fields will be propagated to the object)
      */
-    StatusCode AlterMetadata(const CaloHit *const pCaloHit, const object_creation::CaloHit::Metadata &metadata) const;
+    StatusCode AlterMetadata(const CaloHit *const pCaloHit, const object_creation::CaloHit::Metadata &metadata);
 
     /**
      *  @brief  Is a calo hit, or a list of calo hits, available to add to a cluster
@@ -84,11 +114,96 @@ private:
      */
     StatusCode CreateTemporaryListAndSetCurrent(const Algorithm *const pAlgorithm, const ClusterList &clusterList, std::string &temporaryListName);
 
+    /**
+     *  @brief  Save a list of calo hits
+     * 
+     *  @param  listName the list name
+     *  @param  caloHitList the list of calo hits
+     */
+    StatusCode SaveList(const std::string &listName, const CaloHitList &caloHitList);
+
+    /**
+     *  @brief  Add calo hits to a saved calo hit list
+     * 
+     *  @param  listName the saved list name
+     *  @param  caloHitList the list of calo hits to add
+     */
+    StatusCode AddObjectsToList(const std::string &listName, const CaloHitList &caloHitList);
+
+    /**
+     *  @brief  Remove calo hits from a saved calo hit list
+     * 
+     *  @param  listName the saved list name
+     *  @param  caloHitList the list of calo hits to remove
+     */
+    StatusCode RemoveObjectsFromList(const std::string &listName, const CaloHitList &caloHitList);
+
+    /**
+     *  @brief  Change the name of a calo hit list
+     * 
+     *  @param  oldListName the old list name
+     *  @param  newListName the new list name
+     */
+    StatusCode RenameList(const std::string &oldListName, const std::string &newListName);
+
+    /**
+     *  @brief  Remove temporary lists and reset the current list to that when algorithm was initialized
+     * 
+     *  @param  pAlgorithm address of the algorithm altering the lists
+     *  @param  isAlgorithmFinished whether the algorithm has completely finished and the algorithm info should be entirely removed
+     */
+    StatusCode ResetAlgorithmInfo(const Algorithm *const pAlgorithm, bool isAlgorithmFinished);
+
     /**
      *  @brief  Erase all calo hit manager content
      */
     StatusCode EraseAllContent();
 
+    /**
+     *  @brief  Get the available calo hits, of a specified hit type in a named list, within a specified distance of a position
+     * 
+     *  @param  listName the name of the calo hit list
+     *  @param  hitType the hit type
+     *  @param  position the position
+     *  @param  distance the distance
+     *  @param  caloHitVector to receive the calo hits, ordered by increasing distance from the position
+     */
+    StatusCode GetCaloHitsInRange(const std::string &listName, const HitType hitType, const CartesianVector &position, const float distance,
+        CaloHitVector &caloHitVector);
+
+    /**
+     *  @brief  Get the available calo hits, of a specified hit type in a named list, nearest to a position
+     * 
+     *  @param  listName the name of the calo hit list
+     *  @param  hitType the hit type
+     *  @param  position the position
+     *  @param  nCaloHits the maximum number of calo hits to receive
+     *  @param  caloHitVector to receive the calo hits, ordered by increasing distance from the position
+     */
+    StatusCode GetNearestCaloHits(const std::string &listName, const HitType hitType, const CartesianVector &position, const unsigned int nCaloHits,
+        CaloHitVector &caloHitVector);
+
+    /**
+     *  @brief  Get the spatial index for the calo hits of a specified hit type in a named list, building it if required
+     * 
+     *  @param  listName the name of the calo hit list
+     *  @param  hitType the hit type
+     *  @param  pCaloHitSpatialIndex to receive the address of the spatial index
+     */
+    StatusCode GetSpatialIndex(const std::string &listName, const HitType hitType, const CaloHitSpatialIndex *&pCaloHitSpatialIndex);
+
+    /**
+     *  @brief  Delete all spatial indices, e.g. following calo hit replacements, which may alter any calo hit list
+     */
+    void ResetSpatialIndices();
+
+    /**
+     *  @brief  Delete the spatial indices for a named calo hit list, following a change to its contents
+     * 
+     *  @param  listName the name of the calo hit list
+     */
+    void ResetSpatialIndices(const std::string &listName);
+
     /**
      *  @brief  Match calo hits to their correct mc particles for particle flow
      * 
@@ -113,6 +228,19 @@ private:
     StatusCode FragmentCaloHit(const CaloHit *const pOriginalCaloHit, const float fraction1, const CaloHit *&pDaughterCaloHit1,
         const CaloHit *&pDaughterCaloHit2, const ObjectFactory<object_creation::CaloHitFragment::Parameters, object_creation::CaloHitFragment::Object> &factory);
 
+    /**
+     *  @brief  Fragment many calo hits, each into two daughter calo hits with a specified energy division, applying all the
+     *          resulting calo hit replacements in a single pass over each calo hit list
+     *
+     *  @param  originalCaloHits the original calo hits, which will be deleted
+     *  @param  fractions1 the fractions of energy to be assigned to daughter fragment 1, one for each original calo hit
+     *  @param  daughterCaloHits1 to receive the addresses of daughter fragment 1, one for each original calo hit
+     *  @param  daughterCaloHits2 to receive the addresses of daughter fragment 2, one for each original calo hit
+     *  @param  factory to create the calo hit fragments
+     */
+    StatusCode FragmentCaloHits(const CaloHitVector &originalCaloHits, const FloatVector &fractions1, CaloHitVector &daughterCaloHits1,
+        CaloHitVector &daughterCaloHits2, const ObjectFactory<object_creation::CaloHitFragment::Parameters, object_creation::CaloHitFragment::Object> &factory);
+
     /**
      *  @brief  Merge two calo hit fragments, originally from the same parent hit, to form a new calo hit
      *
@@ -184,6 +312,21 @@ private:
      */
     StatusCode Update(const CaloHitReplacement &caloHitReplacement);
 
+    /**
+     *  @brief  Update all calo hit lists to account for a list of calo hit replacements, applied in order
+     * 
+     *  @param  caloHitReplacementList the calo hit replacement list
+     */
+    StatusCode Update(const CaloHitReplacementList &caloHitReplacementList);
+
+    /**
+     *  @brief  Update a calo hit list to account for a list of calo hit replacements, applied in order, using a single pass over the list
+     * 
+     *  @param  pCaloHitList address of the calo hit list
+     *  @param  caloHitReplacementList the calo hit replacement list
+     */
+    StatusCode Update(CaloHitList *const pCaloHitList, const CaloHitReplacementList &caloHitReplacementList);
+
     /**
      *  @brief  Update a calo hit list to account for a specific calo hit replacement
      * 
@@ -196,6 +339,11 @@ private:
     ReclusterMetadata              *m_pCurrentReclusterMetadata;        ///< Address of the current recluster metadata
     ReclusterMetadataList           m_reclusterMetadataList;            ///< The recluster metadata list
 
+    typedef std::pair<std::string, HitType> SpatialIndexKey;
+    typedef std::map<SpatialIndexKey, CaloHitSpatialIndex *> SpatialIndexMap;
+
+    SpatialIndexMap                 m_spatialIndexMap;                  ///< The spatial indices, built on demand, by list name and hit type
+
     friend class PandoraApiImpl;
     friend class PandoraContentApiImpl;
     friend class PandoraImpl;
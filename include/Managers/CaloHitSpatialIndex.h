@@ -0,0 +1,178 @@
+/**
+ *  @file   PandoraSDK/include/Managers/CaloHitSpatialIndex.h
+ *
+ *  @brief  Header file for the calo hit spatial index class.
+ *
+ *  $Log: $
+ */
+#ifndef PANDORA_CALO_HIT_SPATIAL_INDEX_H
+#define PANDORA_CALO_HIT_SPATIAL_INDEX_H 1
+
+#include "Pandora/PandoraEnumeratedTypes.h"
+#include "Pandora/PandoraInternal.h"
+#include "Pandora/StatusCodes.h"
+
+namespace pandora
+{
+
+class CaloHitMetadata;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  CaloHitSpatialIndex class, a k-d tree over the positions of the calo hits of a single hit type in a calo hit list. Each split
+ *          is made along the coordinate with the largest spread, so hits in a two dimensional view, which share a common y coordinate,
+ *          are indexed by an effectively two dimensional tree. Queries report only available calo hits, ordered by increasing distance,
+ *          with equidistant calo hits ordered by their dense per-event index.
+ */
+class CaloHitSpatialIndex
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  caloHitList the calo hit list
+     *  @param  hitType the hit type of the calo hits to index
+     */
+    CaloHitSpatialIndex(const CaloHitList &caloHitList, const HitType hitType);
+
+    /**
+     *  @brief  Get the available calo hits within a specified distance of a position
+     *
+     *  @param  position the position
+     *  @param  distance the distance
+     *  @param  pCaloHitMetadata address of the current reclustering calo hit metadata, or nullptr if not reclustering
+     *  @param  caloHitVector to receive the calo hits
+     */
+    void GetCaloHitsInRange(const CartesianVector &position, const float distance, const CaloHitMetadata *const pCaloHitMetadata,
+        CaloHitVector &caloHitVector) const;
+
+    /**
+     *  @brief  Get the available calo hits nearest to a position
+     *
+     *  @param  position the position
+     *  @param  nCaloHits the maximum number of calo hits to receive
+     *  @param  pCaloHitMetadata address of the current reclustering calo hit metadata, or nullptr if not reclustering
+     *  @param  caloHitVector to receive the calo hits
+     */
+    void GetNearestCaloHits(const CartesianVector &position, const unsigned int nCaloHits, const CaloHitMetadata *const pCaloHitMetadata,
+        CaloHitVector &caloHitVector) const;
+
+private:
+    /**
+     *  @brief  Point class, a calo hit and its position
+     */
+    class Point
+    {
+    public:
+        float                   m_position[3];          ///< The calo hit position
+        const CaloHit          *m_pCaloHit;             ///< Address of the calo hit
+    };
+
+    /**
+     *  @brief  CoordinateLessThan class, ordering points by a single position coordinate
+     */
+    class CoordinateLessThan
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  dimension the index of the position coordinate
+         */
+        CoordinateLessThan(const unsigned int dimension);
+
+        /**
+         *  @brief  Operator< for points, comparing the chosen position coordinate
+         *
+         *  @param  lhs the first point
+         *  @param  rhs the second point
+         */
+        bool operator()(const Point &lhs, const Point &rhs) const;
+
+    private:
+        unsigned int            m_dimension;            ///< The index of the position coordinate
+    };
+
+    /**
+     *  @brief  Neighbour class, a calo hit and its squared distance from a query position
+     */
+    class Neighbour
+    {
+    public:
+        /**
+         *  @brief  Operator< for neighbours, comparing squared distance, then calo hit index
+         *
+         *  @param  rhs the neighbour for comparison
+         */
+        bool operator<(const Neighbour &rhs) const;
+
+        float                   m_distanceSquared;      ///< The squared distance from the query position
+        const CaloHit          *m_pCaloHit;             ///< Address of the calo hit
+    };
+
+    typedef std::vector<Point> PointVector;
+    typedef std::vector<Neighbour> NeighbourVector;
+    typedef std::vector<unsigned char> DimensionVector;
+
+    /**
+     *  @brief  Build the subtree for a range of points, placing the median point, along the coordinate of largest spread, at its centre
+     *
+     *  @param  begin the index of the first point in the range
+     *  @param  end the index one past the last point in the range
+     */
+    void Build(const unsigned int begin, const unsigned int end);
+
+    /**
+     *  @brief  Collect the available calo hits within a specified distance of a position, from the subtree for a range of points
+     *
+     *  @param  begin the index of the first point in the range
+     *  @param  end the index one past the last point in the range
+     *  @param  position the position coordinates
+     *  @param  distanceSquared the squared distance
+     *  @param  pCaloHitMetadata address of the current reclustering calo hit metadata, or nullptr if not reclustering
+     *  @param  neighbourVector to receive the neighbours
+     */
+    void FindInRange(const unsigned int begin, const unsigned int end, const float *const position, const float distanceSquared,
+        const CaloHitMetadata *const pCaloHitMetadata, NeighbourVector &neighbourVector) const;
+
+    /**
+     *  @brief  Collect the available calo hits nearest to a position, from the subtree for a range of points
+     *
+     *  @param  begin the index of the first point in the range
+     *  @param  end the index one past the last point in the range
+     *  @param  position the position coordinates
+     *  @param  nCaloHits the maximum number of calo hits to collect
+     *  @param  pCaloHitMetadata address of the current reclustering calo hit metadata, or nullptr if not reclustering
+     *  @param  neighbourHeap the nearest neighbours found so far, as a heap with the furthest at its front
+     */
+    void FindNearest(const unsigned int begin, const unsigned int end, const float *const position, const unsigned int nCaloHits,
+        const CaloHitMetadata *const pCaloHitMetadata, NeighbourVector &neighbourHeap) const;
+
+    /**
+     *  @brief  Whether a calo hit is available, as determined by the current reclustering calo hit metadata if reclustering
+     *
+     *  @param  pCaloHit address of the calo hit
+     *  @param  pCaloHitMetadata address of the current reclustering calo hit metadata, or nullptr if not reclustering
+     *
+     *  @return boolean
+     */
+    static bool IsAvailable(const CaloHit *const pCaloHit, const CaloHitMetadata *const pCaloHitMetadata);
+
+    /**
+     *  @brief  Get the squared distance between a point and a position
+     *
+     *  @param  point the point
+     *  @param  position the position coordinates
+     *
+     *  @return the squared distance
+     */
+    static float GetDistanceSquared(const Point &point, const float *const position);
+
+    PointVector                 m_points;               ///< The points, ordered as an implicit k-d tree
+    DimensionVector             m_splitDimensions;      ///< The coordinate along which each subtree is split, indexed by its median point
+};
+
+} // namespace pandora
+
+#endif // #ifndef PANDORA_CALO_HIT_SPATIAL_INDEX_H
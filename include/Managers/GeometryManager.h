@@ -8,14 +8,20 @@
 #ifndef PANDORA_GEOMETRY_MANAGER_H
 #define PANDORA_GEOMETRY_MANAGER_H 1
 
+#include "Geometry/DetectorGapIndex.h"
+
 #include "Pandora/ObjectCreation.h"
 #include "Pandora/PandoraEnumeratedTypes.h"
 
+#include <atomic>
+
 namespace pandora
 {
 
 /**
- *  @brief  GeometryManager class
+ *  @brief  GeometryManager class. The geometry content may be shared by several pandora instances, see PandoraApi::ShareGeometry, after
+ *          which it is immutable and is deleted only when the last sharing instance is destroyed. The const accessors neither modify nor
+ *          cache any state, so may be called concurrently from threads running different pandora instances that share the content.
  */
 class GeometryManager
 {
@@ -79,6 +85,28 @@ public:
      */
     const DetectorGapList &GetDetectorGapList() const;
 
+    /**
+     *  @brief  Whether a specified position lies within any gap in the active detector volume. Equivalent to asking each gap in the detector
+     *          gap list in turn, except that an exception is raised if the list contains any gap unable to interpret the hit type.
+     * 
+     *  @param  positionVector the position vector
+     *  @param  hitType the hit type, providing context to aid interpretation of provided position vector
+     *  @param  gapTolerance tolerance allowed when declaring a point to be "in" a gap region, units mm
+     * 
+     *  @return boolean
+     */
+    bool IsInAnyGap(const CartesianVector &positionVector, const HitType hitType, const float gapTolerance = 0.f) const;
+
+    /**
+     *  @brief  Whether each of a number of positions lies within any gap in the active detector volume
+     * 
+     *  @param  positionVectors the position vectors
+     *  @param  hitType the hit type, providing context to aid interpretation of provided position vectors
+     *  @param  gapTolerance tolerance allowed when declaring a point to be "in" a gap region, units mm
+     *  @param  isInGapVector to receive, for each position vector, whether it lies within any gap
+     */
+    void IsInAnyGap(const CartesianPointVector &positionVectors, const HitType hitType, const float gapTolerance, BoolVector &isInGapVector) const;
+
     /**
      *  @brief  Get the granularity level specified for a given calorimeter hit type
      * 
@@ -88,6 +116,13 @@ public:
      */
     Granularity GetHitTypeGranularity(const HitType hitType) const;
 
+    /**
+     *  @brief  Whether the geometry content is shared with other pandora instances, and so can no longer be modified
+     *
+     *  @return boolean
+     */
+    bool IsShared() const;
+
 private:
     /**
      *  @brief  Create sub detector
@@ -117,10 +152,29 @@ private:
     StatusCode CreateGap(const PARAMETERS &parameters, const ObjectFactory<PARAMETERS, OBJECT> &factory);
 
     /**
-     *  @brief  Erase all geometry manager content
+     *  @brief  Bring the detector gap index up to date with the detector gap list
+     */
+    StatusCode IndexDetectorGaps();
+
+    /**
+     *  @brief  Share the geometry content of another geometry manager, which then becomes immutable, releasing any current content
+     *
+     *  @param  sourceManager the geometry manager whose content is to be shared
+     */
+    StatusCode ShareContent(const GeometryManager &sourceManager);
+
+    /**
+     *  @brief  Release the reference to the geometry content, erasing the content if no other geometry manager shares it
      */
     StatusCode EraseAllContent();
 
+    /**
+     *  @brief  Whether the geometry content may be modified, printing a message if not
+     *
+     *  @return boolean
+     */
+    bool IsModifiable() const;
+
     typedef std::map<HitType, Granularity> HitTypeToGranularityMap;
 
     /**
@@ -140,36 +194,74 @@ private:
 
     typedef std::multimap<SubDetectorType, const SubDetector*> SubDetectorTypeMap;
 
-    SubDetectorMap              m_subDetectorMap;           ///< Map from sub detector name to sub detector
-    SubDetectorTypeMap          m_subDetectorTypeMap;       ///< Map from sub detector type to sub detector
-    LArTPCMap                   m_larTPCMap;                ///< Map from lar tpc volume id to lar tpc
-    DetectorGapList             m_detectorGapList;          ///< List of gaps in the active detector volume
-    HitTypeToGranularityMap     m_hitTypeToGranularityMap;  ///< The hit type to granularity map
+    /**
+     *  @brief  GeometryContent class, owning the detector description and counting the geometry managers that refer to it
+     */
+    class GeometryContent
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  hitTypeToGranularityMap the initial hit type to granularity map
+         */
+        GeometryContent(const HitTypeToGranularityMap &hitTypeToGranularityMap);
+
+        /**
+         *  @brief  Destructor
+         */
+        ~GeometryContent();
 
+        SubDetectorMap              m_subDetectorMap;           ///< Map from sub detector name to sub detector
+        SubDetectorTypeMap          m_subDetectorTypeMap;       ///< Map from sub detector type to sub detector
+        LArTPCMap                   m_larTPCMap;                ///< Map from lar tpc volume id to lar tpc
+        DetectorGapList             m_detectorGapList;          ///< List of gaps in the active detector volume
+        DetectorGapIndex            m_detectorGapIndex;         ///< Index of the gaps in the active detector volume
+        HitTypeToGranularityMap     m_hitTypeToGranularityMap;  ///< The hit type to granularity map
+        std::atomic<unsigned int>   m_nReferences;              ///< The number of geometry managers referring to the content
+        std::atomic<bool>           m_isShared;                 ///< Whether the content has ever been shared, after which it is immutable
+    };
+
+    GeometryContent            *m_pGeometryContent;         ///< The geometry content, possibly shared with other pandora instances
     const Pandora *const        m_pPandora;                 ///< The associated pandora object
 
     friend class PandoraApiImpl;
+    friend class PandoraImpl;
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 inline const SubDetectorMap &GeometryManager::GetSubDetectorMap() const
 {
-    return m_subDetectorMap;
+    return m_pGeometryContent->m_subDetectorMap;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 inline const LArTPCMap &GeometryManager::GetLArTPCMap() const
 {
-    return m_larTPCMap;
+    return m_pGeometryContent->m_larTPCMap;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 inline const DetectorGapList &GeometryManager::GetDetectorGapList() const
 {
-    return m_detectorGapList;
+    return m_pGeometryContent->m_detectorGapList;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool GeometryManager::IsInAnyGap(const CartesianVector &positionVector, const HitType hitType, const float gapTolerance) const
+{
+    return m_pGeometryContent->m_detectorGapIndex.IsInAnyGap(positionVector, hitType, gapTolerance);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool GeometryManager::IsShared() const
+{
+    return m_pGeometryContent->m_isShared;
 }
 
 } // namespace pandora
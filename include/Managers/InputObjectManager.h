@@ -94,9 +94,34 @@ protected:
      */
     virtual StatusCode CreateInitialLists();
 
+    /**
+     *  @brief  Assign the next dense per-event index to a newly created object. Indices are issued in order of creation, from zero, and
+     *          are not reused within an event, so may be used to key per-object tables held in plain vectors.
+     *
+     *  @param  pT address of the newly created object
+     */
+    void AssignIndex(const T *const pT);
+
+    /**
+     *  @brief  Get the number of indices assigned in the current event, which exceeds the index of every object in the event
+     *
+     *  @return the number of indices assigned
+     */
+    unsigned int GetNIndices() const;
+
     const std::string               m_inputListName;                    ///< The name of the input list
+    unsigned int                    m_nIndices;                         ///< The number of dense per-event indices assigned
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+inline unsigned int InputObjectManager<T>::GetNIndices() const
+{
+    return m_nIndices;
+}
+
 } // namespace pandora
 
 #endif // #ifndef PANDORA_INPUT_OBJECT_MANAGER
@@ -8,6 +8,7 @@
 #ifndef PANDORA_MANAGER_H
 #define PANDORA_MANAGER_H 1
 
+#include "Pandora/ObjectPool.h"
 #include "Pandora/PandoraInternal.h"
 #include "Pandora/StatusCodes.h"
 
@@ -40,6 +41,7 @@ public:
 
 protected:
     typedef MANAGED_CONTAINER<const T *> ObjectList;
+    typedef std::unordered_set<const T *> ObjectSet;
 
     /**
      *  @brief  Get a list
@@ -180,6 +182,11 @@ protected:
 
     std::string                     m_currentListName;                  ///< The name of the current list
     StringSet                       m_savedLists;                       ///< The set of saved lists
+
+    ObjectPool                      m_objectPool;                       ///< The event-scoped storage for pooled objects, rewound between events
+
+    std::size_t                     m_nObjectsCreated;                  ///< The number of objects created by the manager, for profiling
+    std::size_t                     m_nObjectsDeleted;                  ///< The number of objects deleted by the manager, for profiling
 };
 
 } // namespace pandora
@@ -33,7 +33,9 @@ typedef std::unordered_map<const CaloHit *, bool> CaloHitUsageMap;
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 /**
- *  @brief  CaloHitMetadata class
+ *  @brief  CaloHitMetadata class, describing the calo hit availability for a reclustering option as an overlay on the reclustering input
+ *          hits. Only the hits whose availability has changed, or which have been added or removed by calo hit replacements, are stored,
+ *          so beginning, trying and discarding a reclustering option costs of order the number of changed hits.
  */
 class CaloHitMetadata
 {
@@ -41,11 +43,14 @@ public:
     /**
      *  @brief  Constructor
      * 
-     *  @param  pCaloHitList address of the associated calo hit list
+     *  @param  pCaloHitList address of the associated calo hit list, initially holding the same hits as the base calo hit list
+     *  @param  pBaseCaloHitList address of the base calo hit list, the reclustering input, which must outlive the metadata
+     *  @param  pBaseCaloHitSet address of the set of hits in the base calo hit list, which must outlive the metadata
      *  @param  caloHitListName name of the associated calo hit list
      *  @param  initialHitAvailability the initial availability of the calo hits
      */
-    CaloHitMetadata(CaloHitList *const pCaloHitList, const std::string &caloHitListName, const bool initialHitAvailability);
+    CaloHitMetadata(CaloHitList *const pCaloHitList, const CaloHitList *const pBaseCaloHitList, const CaloHitSet *const pBaseCaloHitSet,
+        const std::string &caloHitListName, const bool initialHitAvailability);
 
     /**
      *  @brief  Destructor
@@ -85,17 +90,25 @@ public:
      */
     StatusCode Update(const CaloHitReplacement &caloHitReplacement);
 
+    /**
+     *  @brief  Update metadata to account for a list of calo hit replacements, applied in order, using a single pass over the calo hit list
+     * 
+     *  @param  caloHitReplacementList the calo hit replacement list
+     */
+    StatusCode Update(const CaloHitReplacementList &caloHitReplacementList);
+
     /**
      *  @brief  Clear all metadata content
      */
     void Clear();
 
     /**
-     *  @brief  Get the calo hit usage map
+     *  @brief  Get the calo hits described by the metadata: the base calo hits that have not been removed, in their original order,
+     *          followed by any calo hits added by replacements
      * 
-     *  @return the calo hit usage map
+     *  @param  caloHitVector to receive the calo hits
      */
-    const CaloHitUsageMap &GetCaloHitUsageMap() const;
+    void GetCaloHits(CaloHitVector &caloHitVector) const;
 
     /**
      *  @brief  Get the calo hit replacement list
@@ -105,9 +118,22 @@ public:
     const CaloHitReplacementList &GetCaloHitReplacementList() const;
 
 private:
+    /**
+     *  @brief  Whether a calo hit is described by the metadata, i.e. is a base calo hit that has not been removed, or has been added
+     * 
+     *  @param  pCaloHit address of the calo hit
+     * 
+     *  @return boolean
+     */
+    bool IsMember(const CaloHit *const pCaloHit) const;
+
     CaloHitList                *m_pCaloHitList;                     ///< Address of the associated calo hit list
+    const CaloHitList          *m_pBaseCaloHitList;                 ///< Address of the base calo hit list
+    const CaloHitSet           *m_pBaseCaloHitSet;                  ///< Address of the set of base calo hits
     std::string                 m_caloHitListName;                  ///< The name of the associated calo hit list
-    CaloHitUsageMap             m_caloHitUsageMap;                  ///< The calo hit usage map
+    bool                        m_initialHitAvailability;           ///< The initial availability of the base calo hits
+    CaloHitUsageMap             m_caloHitUsageMap;                  ///< The usage of added calo hits, or of those changed from initial
+    CaloHitSet                  m_removedCaloHits;                  ///< The base calo hits removed by calo hit replacements
     CaloHitReplacementList      m_caloHitReplacementList;           ///< The calo hit replacement list
 };
 
@@ -170,6 +196,7 @@ private:
 
     CaloHitMetadata            *m_pCurrentCaloHitMetadata;          ///< Address of the current calo hit metadata
     CaloHitList                 m_caloHitList;                      ///< Copy of the reclustering input calo hit list
+    CaloHitSet                  m_caloHitSet;                       ///< The set of reclustering input calo hits, for all metadata
     NameToMetadataMap           m_nameToMetadataMap;                ///< The recluster list name to metadata map
 };
 
@@ -178,9 +205,12 @@ typedef std::vector<ReclusterMetadata *> ReclusterMetadataList;
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-inline const CaloHitUsageMap &CaloHitMetadata::GetCaloHitUsageMap() const
+inline bool CaloHitMetadata::IsMember(const CaloHit *const pCaloHit) const
 {
-    return m_caloHitUsageMap;
+    if (m_caloHitUsageMap.count(pCaloHit))
+        return true;
+
+    return (!m_removedCaloHits.count(pCaloHit) && m_pBaseCaloHitSet->count(pCaloHit));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
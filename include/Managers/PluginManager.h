@@ -14,9 +14,11 @@ namespace pandora
 {
 
 class BFieldPlugin;
+class InterpolatedBFieldPlugin;
 class LArTransformationPlugin;
 class PseudoLayerPlugin;
 class ShowerProfilePlugin;
+class TabulatedPseudoLayerPlugin;
 
 class EnergyCorrections;
 class ParticleId;
@@ -73,7 +75,7 @@ public:
     bool HasShowerProfilePlugin() const;
 
     /**
-     *  @brief  Get the address of the b field plugin
+     *  @brief  Get the address of the b field plugin, which is the interpolated bfield plugin wrapping the registered plugin, if requested
      * 
      *  @return the address of the b field plugin
      */
@@ -87,7 +89,7 @@ public:
     const LArTransformationPlugin *GetLArTransformationPlugin() const;
 
     /**
-     *  @brief  Get the address of the pseudo layer plugin
+     *  @brief  Get the address of the pseudo layer plugin, which is the tabulated pseudo layer plugin wrapping the registered plugin, if requested
      * 
      *  @return the address of the pseudo layer plugin
      */
@@ -156,8 +158,10 @@ private:
     StatusCode ResetForNextEvent();
 
     BFieldPlugin                   *m_pBFieldPlugin;                    ///< Address of the bfield plugin
+    InterpolatedBFieldPlugin       *m_pInterpolatedBFieldPlugin;        ///< Address of the interpolated bfield plugin, wrapping the bfield plugin
     LArTransformationPlugin        *m_pLArTransformationPlugin;         ///< Address of the lar transformation plugin
     PseudoLayerPlugin              *m_pPseudoLayerPlugin;               ///< Address of the pseudolayer plugin
+    TabulatedPseudoLayerPlugin     *m_pTabulatedPseudoLayerPlugin;      ///< Address of the tabulated pseudolayer plugin, wrapping the pseudolayer plugin
     ShowerProfilePlugin            *m_pShowerProfilePlugin;             ///< The shower profile plugin
 
     EnergyCorrections              *m_pEnergyCorrections;               ///< The energy corrections
@@ -9,11 +9,13 @@
 #define PANDORA_CALO_HIT_H 1
 
 #include "Pandora/ObjectCreation.h"
+#include "Pandora/ObjectPool.h"
 #include "Pandora/StatusCodes.h"
 
 namespace pandora
 {
 
+class CaloHitBlock;
 template<typename T> class InputObjectManager;
 template<typename T, typename S> class PandoraObjectFactory;
 
@@ -212,6 +214,13 @@ public:
      */
     const void *GetParentAddress() const;
 
+    /**
+     *  @brief  Get the dense per-event index of the calo hit, assigned on creation and unique amongst the calo hits created in the event
+     * 
+     *  @return the index
+     */
+    unsigned int GetIndex() const;
+
     /**
      *  @brief  Get the list of cartesian coordinates for the cell corners
      * 
@@ -228,6 +237,24 @@ public:
      */
     bool operator< (const CaloHit &rhs) const;
 
+#ifdef PANDORA_OBJECT_POOL
+    /**
+     *  @brief  Allocate storage for a calo hit, drawing on the event-scoped object pool when one is active
+     * 
+     *  @param  size the number of bytes required
+     * 
+     *  @return the address of the storage
+     */
+    static void *operator new(std::size_t size);
+
+    /**
+     *  @brief  Release storage for a calo hit, returning it to its object pool
+     * 
+     *  @param  pAddress the address of the storage
+     */
+    static void operator delete(void *pAddress);
+#endif
+
 protected:
     /**
      *  @brief  Constructor
@@ -243,6 +270,14 @@ protected:
      */
     CaloHit(const object_creation::CaloHitFragment::Parameters &parameters);
 
+    /**
+     *  @brief  Constructor, from a single calo hit within a block of calo hit properties, which must already have been validated
+     * 
+     *  @param  caloHitBlock the calo hit block
+     *  @param  iCaloHit the index of the calo hit within the block
+     */
+    CaloHit(const CaloHitBlock &caloHitBlock, const unsigned int iCaloHit);
+
     /**
      *  @brief  Destructor
      */
@@ -337,9 +372,11 @@ protected:
     float                   m_weight;                   ///< The calo hit weight, which may not be unity if the hit has been fragmented
     MCParticleWeightMap     m_mcParticleWeightMap;      ///< The mc particle weight map
     const void             *m_pParentAddress;           ///< The address of the parent calo hit in the user framework
+    unsigned int            m_index;                    ///< The dense per-event index, assigned by the calo hit manager
 
     friend class CaloHitMetadata;
     friend class CaloHitManager;
+    friend class CaloHitSpatialIndex;
     friend class InputObjectManager<CaloHit>;
     friend class PandoraObjectFactory<object_creation::CaloHit::Parameters, object_creation::CaloHit::Object>;
     friend class PandoraObjectFactory<object_creation::CaloHitFragment::Parameters, object_creation::CaloHitFragment::Object>;
@@ -536,6 +573,13 @@ inline const void *CaloHit::GetParentAddress() const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline unsigned int CaloHit::GetIndex() const
+{
+    return m_index;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline bool CaloHit::IsAvailable() const
 {
     return m_isAvailable;
@@ -548,6 +592,22 @@ inline void CaloHit::SetAvailability(bool isAvailable)
     m_isAvailable = isAvailable;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+#ifdef PANDORA_OBJECT_POOL
+inline void *CaloHit::operator new(std::size_t size)
+{
+    return ObjectPool::Allocate(size);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void CaloHit::operator delete(void *pAddress)
+{
+    ObjectPool::Free(pAddress);
+}
+#endif
+
 } // namespace pandora
 
 #endif // #ifndef PANDORA_CALO_HIT_H
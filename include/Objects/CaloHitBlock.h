@@ -0,0 +1,102 @@
+/**
+ *  @file   PandoraSDK/include/Objects/CaloHitBlock.h
+ *
+ *  @brief  Header file for the calo hit block class.
+ *
+ *  $Log: $
+ */
+#ifndef PANDORA_CALO_HIT_BLOCK_H
+#define PANDORA_CALO_HIT_BLOCK_H 1
+
+#include "Pandora/PandoraEnumeratedTypes.h"
+
+#include <vector>
+
+namespace pandora
+{
+
+/**
+ *  @brief  CaloHitBlock class, holding the properties of all calo hits in an event column-wise, with one contiguous array per property.
+ *          Columns are persisted in the order in which they are declared, each as a single run of nCaloHits values.
+ */
+class CaloHitBlock
+{
+public:
+    typedef std::vector<float> FloatColumn;
+    typedef std::vector<unsigned int> UIntColumn;
+    typedef std::vector<unsigned char> FlagColumn;
+    typedef std::vector<const void *> AddressColumn;
+    typedef std::vector<CellGeometry> CellGeometryColumn;
+    typedef std::vector<HitType> HitTypeColumn;
+    typedef std::vector<HitRegion> HitRegionColumn;
+
+    /**
+     *  @brief  Resize all columns to hold a specified number of calo hits
+     *
+     *  @param  nCaloHits the number of calo hits
+     */
+    void Resize(const unsigned int nCaloHits);
+
+    CellGeometryColumn m_cellGeometry;           ///< The cell geometries
+    FloatColumn m_positionX;                     ///< The position vector x coordinates
+    FloatColumn m_positionY;                     ///< The position vector y coordinates
+    FloatColumn m_positionZ;                     ///< The position vector z coordinates
+    FloatColumn m_expectedDirectionX;            ///< The expected direction x components
+    FloatColumn m_expectedDirectionY;            ///< The expected direction y components
+    FloatColumn m_expectedDirectionZ;            ///< The expected direction z components
+    FloatColumn m_cellNormalX;                   ///< The cell normal vector x components
+    FloatColumn m_cellNormalY;                   ///< The cell normal vector y components
+    FloatColumn m_cellNormalZ;                   ///< The cell normal vector z components
+    FloatColumn m_cellThickness;                 ///< The cell thicknesses
+    FloatColumn m_nCellRadiationLengths;         ///< The absorber material in front of each cell, units radiation lengths
+    FloatColumn m_nCellInteractionLengths;       ///< The absorber material in front of each cell, units interaction lengths
+    FloatColumn m_time;                          ///< The times of (earliest) energy deposition
+    FloatColumn m_inputEnergy;                   ///< The calibrated input energies
+    FloatColumn m_mipEquivalentEnergy;           ///< The calibrated mip equivalent energies
+    FloatColumn m_electromagneticEnergy;         ///< The calibrated electromagnetic energies
+    FloatColumn m_hadronicEnergy;                ///< The calibrated hadronic energies
+    FlagColumn m_isDigital;                      ///< Whether each cell has a digital readout, as 0 or 1
+    HitTypeColumn m_hitType;                     ///< The hit types
+    HitRegionColumn m_hitRegion;                 ///< The hit regions
+    UIntColumn m_layer;                          ///< The subdetector readout layer numbers
+    FlagColumn m_isInOuterSamplingLayer;         ///< Whether each cell is in one of the outermost detector sampling layers, as 0 or 1
+    AddressColumn m_parentAddress;               ///< The addresses of the parent calo hits in the user framework
+    FloatColumn m_cellSize0;                     ///< The first cell dimensions
+    FloatColumn m_cellSize1;                     ///< The second cell dimensions
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void CaloHitBlock::Resize(const unsigned int nCaloHits)
+{
+    m_cellGeometry.resize(nCaloHits);
+    m_positionX.resize(nCaloHits);
+    m_positionY.resize(nCaloHits);
+    m_positionZ.resize(nCaloHits);
+    m_expectedDirectionX.resize(nCaloHits);
+    m_expectedDirectionY.resize(nCaloHits);
+    m_expectedDirectionZ.resize(nCaloHits);
+    m_cellNormalX.resize(nCaloHits);
+    m_cellNormalY.resize(nCaloHits);
+    m_cellNormalZ.resize(nCaloHits);
+    m_cellThickness.resize(nCaloHits);
+    m_nCellRadiationLengths.resize(nCaloHits);
+    m_nCellInteractionLengths.resize(nCaloHits);
+    m_time.resize(nCaloHits);
+    m_inputEnergy.resize(nCaloHits);
+    m_mipEquivalentEnergy.resize(nCaloHits);
+    m_electromagneticEnergy.resize(nCaloHits);
+    m_hadronicEnergy.resize(nCaloHits);
+    m_isDigital.resize(nCaloHits);
+    m_hitType.resize(nCaloHits);
+    m_hitRegion.resize(nCaloHits);
+    m_layer.resize(nCaloHits);
+    m_isInOuterSamplingLayer.resize(nCaloHits);
+    m_parentAddress.resize(nCaloHits);
+    m_cellSize0.resize(nCaloHits);
+    m_cellSize1.resize(nCaloHits);
+}
+
+} // namespace pandora
+
+#endif // #ifndef PANDORA_CALO_HIT_BLOCK_H
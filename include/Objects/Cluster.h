@@ -13,6 +13,7 @@
 #include "Objects/OrderedCaloHitList.h"
 
 #include "Pandora/ObjectCreation.h"
+#include "Pandora/ObjectPool.h"
 #include "Pandora/StatusCodes.h"
 
 namespace pandora
@@ -151,6 +152,22 @@ public:
      */
     const CartesianVector GetCentroid(const unsigned int pseudoLayer) const;
 
+    /**
+     *  @brief  Get the cluster fit moments, running sums over all calo hits in the ordered calo hit list, used for linear fits to the cluster
+     * 
+     *  @return The cluster fit moments
+     */
+    const ClusterFitMoments &GetFitMoments() const;
+
+    /**
+     *  @brief  Get the cluster fit moments for the calo hits in a particular pseudo layer
+     * 
+     *  @param  pseudoLayer the pseudo layer of interest
+     * 
+     *  @return The cluster fit moments for the pseudo layer
+     */
+    const ClusterFitMoments &GetFitMoments(const unsigned int pseudoLayer) const;
+
     /**
      *  @brief  Get the initial direction of the cluster
      * 
@@ -276,6 +293,24 @@ public:
      */
     void GetClusterSpanZ(const float xmin, const float xmax, float &zmin, float &zmax) const;
 
+#ifdef PANDORA_OBJECT_POOL
+    /**
+     *  @brief  Allocate storage for a cluster, drawing on the event-scoped object pool when one is active
+     * 
+     *  @param  size the number of bytes required
+     * 
+     *  @return the address of the storage
+     */
+    static void *operator new(std::size_t size);
+
+    /**
+     *  @brief  Release storage for a cluster, returning it to its object pool
+     * 
+     *  @param  pAddress the address of the storage
+     */
+    static void operator delete(void *pAddress);
+#endif
+
 protected:
     /**
      *  @brief  Constructor
@@ -421,6 +456,7 @@ protected:
     public:
         double                  m_xyzPositionSums[3];           ///< The sum of the x, y and z hit positions in the pseudo layer
         unsigned int            m_nHits;                        ///< The number of hits in the pseudo layer
+        ClusterFitMoments       m_fitMoments;                   ///< The cluster fit moments for the hits in the pseudo layer
     };
 
     typedef std::map<unsigned int, SimplePoint> PointByPseudoLayerMap;///< The point by pseudo layer typedef
@@ -438,6 +474,7 @@ protected:
     int                         m_particleId;                   ///< The particle id flag
     const Track                *m_pTrackSeed;                   ///< Address of the track with which the cluster is seeded
     PointByPseudoLayerMap       m_sumXYZByPseudoLayer;          ///< Construct to allow rapid calculation of centroid in each pseudolayer
+    ClusterFitMoments           m_fitMoments;                   ///< The cluster fit moments, allowing rapid linear fits to all calo hits
     InputUInt                   m_innerPseudoLayer;             ///< The innermost pseudo layer in the cluster
     InputUInt                   m_outerPseudoLayer;             ///< The outermost pseudo layer in the cluster
 
@@ -572,6 +609,13 @@ inline unsigned int Cluster::GetOuterPseudoLayer() const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline const ClusterFitMoments &Cluster::GetFitMoments() const
+{
+    return m_fitMoments;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline const TrackList &Cluster::GetAssociatedTrackList() const
 {
     return m_associatedTrackList;
@@ -591,6 +635,22 @@ inline void Cluster::SetAvailability(bool isAvailable)
     m_isAvailable = isAvailable;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+#ifdef PANDORA_OBJECT_POOL
+inline void *Cluster::operator new(std::size_t size)
+{
+    return ObjectPool::Allocate(size);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void Cluster::operator delete(void *pAddress)
+{
+    ObjectPool::Free(pAddress);
+}
+#endif
+
 } // namespace pandora
 
 #endif // #ifndef PANDORA_CLUSTER_H
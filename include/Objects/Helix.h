@@ -12,6 +12,11 @@
 
 #include "Pandora/StatusCodes.h"
 
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+
 namespace pandora
 {
 
@@ -240,6 +245,112 @@ public:
     float GetRadius() const;
 
 private:
+    /**
+     *  @brief  The arithmetic kernels below are shared by the helix member functions and by HelixBatch. Each takes the helix parameters
+     *          explicitly, with the phi of the reference point w.r.t. the circle centre, so that a batch can compute per-helix terms once.
+     */
+
+    /**
+     *  @brief  Get the distance of closest approach of a helix to a point, see GetDistanceToPoint
+     *
+     *  @param  xCentre the circle centre x coordinate
+     *  @param  yCentre the circle centre y coordinate
+     *  @param  radius the circle radius
+     *  @param  charge the particle charge
+     *  @param  tanLambda the tangent of the dip angle
+     *  @param  pxy the transverse momentum
+     *  @param  pz the momentum z component
+     *  @param  zReference the reference point z coordinate
+     *  @param  phiReference the phi of the reference point w.r.t. the circle centre
+     *  @param  point the point
+     *  @param  distance to receive the distance of closest approach
+     *  @param  genericTime to receive the generic time
+     */
+    static void GetDistanceToPoint(const float xCentre, const float yCentre, const float radius, const float charge, const float tanLambda,
+        const float pxy, const float pz, const float zReference, const float phiReference, const CartesianVector &point,
+        CartesianVector &distance, float &genericTime);
+
+    /**
+     *  @brief  Get the intersection of a helix with a plane perpendicular to the z axis, see GetPointInZ. The momentum z component must be
+     *          non-zero.
+     *
+     *  @param  xCentre the circle centre x coordinate
+     *  @param  yCentre the circle centre y coordinate
+     *  @param  radius the circle radius
+     *  @param  charge the particle charge
+     *  @param  pxy the transverse momentum
+     *  @param  pz the momentum z component
+     *  @param  zReference the reference point z coordinate
+     *  @param  phiReference the phi of the reference point w.r.t. the circle centre
+     *  @param  zPlane the z coordinate of the plane
+     *  @param  intersectionPoint to receive the intersection point
+     *  @param  genericTime to receive the generic time
+     */
+    static void GetPointInZ(const float xCentre, const float yCentre, const float radius, const float charge, const float pxy,
+        const float pz, const float zReference, const float phiReference, const float zPlane, CartesianVector &intersectionPoint,
+        float &genericTime);
+
+    /**
+     *  @brief  Get the two candidate intersections, in the xy plane, of a helix circle with a plane parallel to z, see GetPointInXY
+     *
+     *  @param  xCentre the circle centre x coordinate
+     *  @param  yCentre the circle centre y coordinate
+     *  @param  radius the circle radius
+     *  @param  x0 the x coordinate of a point in the plane
+     *  @param  y0 the y coordinate of a point in the plane
+     *  @param  ax the x component of the plane normal
+     *  @param  ay the y component of the plane normal
+     *  @param  aa the magnitude of the xy components of the plane normal, which must be positive
+     *  @param  x1 to receive the x coordinate of the first candidate
+     *  @param  y1 to receive the y coordinate of the first candidate
+     *  @param  x2 to receive the x coordinate of the second candidate
+     *  @param  y2 to receive the y coordinate of the second candidate
+     *
+     *  @return whether the circle and plane intersect
+     */
+    static bool GetPlaneIntersections(const float xCentre, const float yCentre, const float radius, const float x0, const float y0,
+        const float ax, const float ay, const float aa, float &x1, float &y1, float &x2, float &y2);
+
+    /**
+     *  @brief  Get the two candidate intersections, in the xy plane, of a helix circle with a cylinder about z, see GetPointOnCircle
+     *
+     *  @param  helixRadius the helix circle radius
+     *  @param  distCentreToIP the distance of the helix circle centre from the origin
+     *  @param  phiCentre the phi of the helix circle centre w.r.t. the origin
+     *  @param  radius the cylinder radius
+     *  @param  x1 to receive the x coordinate of the first candidate
+     *  @param  y1 to receive the y coordinate of the first candidate
+     *  @param  x2 to receive the x coordinate of the second candidate
+     *  @param  y2 to receive the y coordinate of the second candidate
+     *
+     *  @return whether the circle and cylinder intersect
+     */
+    static bool GetCircleIntersections(const float helixRadius, const float distCentreToIP, const float phiCentre, const float radius,
+        float &x1, float &y1, float &x2, float &y2);
+
+    /**
+     *  @brief  Choose the candidate intersection reached first along a helix, see GetPointInXY and GetPointOnCircle
+     *
+     *  @param  xCentre the circle centre x coordinate
+     *  @param  yCentre the circle centre y coordinate
+     *  @param  radius the circle radius
+     *  @param  charge the particle charge
+     *  @param  pxy the transverse momentum
+     *  @param  pz the momentum z component
+     *  @param  zReference the reference point z coordinate
+     *  @param  phiReference the phi of the reference point w.r.t. the circle centre
+     *  @param  x1 the x coordinate of the first candidate
+     *  @param  y1 the y coordinate of the first candidate
+     *  @param  x2 the x coordinate of the second candidate
+     *  @param  y2 the y coordinate of the second candidate
+     *  @param  pFunctionName the name of the calling function, for use in warning messages
+     *  @param  intersectionPoint to receive the intersection point
+     *  @param  genericTime to receive the generic time
+     */
+    static void ChooseIntersection(const float xCentre, const float yCentre, const float radius, const float charge, const float pxy,
+        const float pz, const float zReference, const float phiReference, const float x1, const float y1, const float x2, const float y2,
+        const char *const pFunctionName, CartesianVector &intersectionPoint, float &genericTime);
+
     static const float FCT;
     static const float TWO_PI;
     static const float HALF_PI;
@@ -264,6 +375,8 @@ private:
     float               m_pxAtPCA;              ///< Momentum x component at point of closest approach
     float               m_pyAtPCA;              ///< Momentum y component at point of closest approach
     float               m_phiMomRefPoint;       ///< Phi of Momentum vector at reference point
+
+    friend class HelixBatch;
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -386,6 +499,168 @@ inline float Helix::GetRadius() const
     return m_radius;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void Helix::GetDistanceToPoint(const float xCentre, const float yCentre, const float radius, const float charge,
+    const float tanLambda, const float pxy, const float pz, const float zReference, const float phiReference, const CartesianVector &point,
+    CartesianVector &distance, float &genericTime)
+{
+    const float phi(std::atan2(point.GetY() - yCentre, point.GetX() - xCentre));
+
+    int nCircles = 0;
+    if (std::fabs(tanLambda * radius) > 1.e-20)
+    {
+        const float xCircles((phiReference - phi - charge * (point.GetZ() - zReference) / (tanLambda * radius)) / TWO_PI);
+
+        int n1, n2;
+        if (xCircles >= std::numeric_limits<float>::epsilon())
+        {
+            n1 = static_cast<int>(xCircles);
+            n2 = n1 + 1;
+        }
+        else
+        {
+            n1 = static_cast<int>(xCircles) - 1;
+            n2 = n1 + 1;
+        }
+
+        nCircles = ((std::fabs(n1 - xCircles) < std::fabs(n2 - xCircles) ? n1 : n2));
+    }
+
+    const float dPhi(TWO_PI * (static_cast<float>(nCircles)) + phi - phiReference);
+    const float zOnHelix(zReference - charge * radius * tanLambda * dPhi);
+
+    const float distX(std::fabs(xCentre - point.GetX()));
+    const float distY(std::fabs(yCentre - point.GetY()));
+    const float distZ(std::fabs(zOnHelix - point.GetZ()));
+
+    float distXY(std::sqrt(distX * distX + distY * distY));
+    distXY = std::fabs(distXY - radius);
+
+    distance.SetValues(distXY, distZ, std::sqrt(distXY * distXY + distZ * distZ));
+
+    if (std::fabs(pz) > 0)
+    {
+        genericTime = (zOnHelix - zReference) / pz;
+    }
+    else
+    {
+        genericTime = charge * radius * dPhi / pxy;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void Helix::GetPointInZ(const float xCentre, const float yCentre, const float radius, const float charge, const float pxy,
+    const float pz, const float zReference, const float phiReference, const float zPlane, CartesianVector &intersectionPoint,
+    float &genericTime)
+{
+    genericTime = (zPlane - zReference) / pz;
+
+    const float phi(phiReference - charge * pxy * genericTime / radius);
+    intersectionPoint.SetValues(xCentre + radius * std::cos(phi), yCentre + radius * std::sin(phi), zPlane);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool Helix::GetPlaneIntersections(const float xCentre, const float yCentre, const float radius, const float x0, const float y0,
+    const float ax, const float ay, const float aa, float &x1, float &y1, float &x2, float &y2)
+{
+    const float BB((ax * (x0 - xCentre) + ay * (y0 - yCentre)) / aa);
+    const float CC(((x0 - xCentre) * (x0 - xCentre) + (y0 - yCentre) * (y0 - yCentre) - radius * radius) / aa);
+
+    const float DET(BB * BB - CC);
+
+    if (DET < 0)
+        return false;
+
+    const float tt1(-BB + std::sqrt(DET));
+    const float tt2(-BB - std::sqrt(DET));
+
+    x1 = x0 + tt1 * ax;
+    y1 = y0 + tt1 * ay;
+    x2 = x0 + tt2 * ax;
+    y2 = y0 + tt2 * ay;
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool Helix::GetCircleIntersections(const float helixRadius, const float distCentreToIP, const float phiCentre, const float radius,
+    float &x1, float &y1, float &x2, float &y2)
+{
+    if (((distCentreToIP + helixRadius) < radius) || ((helixRadius + radius) < distCentreToIP))
+        return false;
+
+    float phiStar(radius * radius + distCentreToIP * distCentreToIP - helixRadius * helixRadius);
+    phiStar = 0.5f * phiStar / std::max(1.e-20f, radius * distCentreToIP);
+
+    if (phiStar > 1.f)
+        phiStar = 0.9999999f;
+
+    if (phiStar < -1.f)
+        phiStar = -0.9999999f;
+
+    phiStar = std::acos(phiStar);
+
+    x1 = radius * std::cos(phiCentre + phiStar);
+    y1 = radius * std::sin(phiCentre + phiStar);
+    x2 = radius * std::cos(phiCentre - phiStar);
+    y2 = radius * std::sin(phiCentre - phiStar);
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void Helix::ChooseIntersection(const float xCentre, const float yCentre, const float radius, const float charge, const float pxy,
+    const float pz, const float zReference, const float phiReference, const float x1, const float y1, const float x2, const float y2,
+    const char *const pFunctionName, CartesianVector &intersectionPoint, float &genericTime)
+{
+    const float phi1(std::atan2(y1 - yCentre, x1 - xCentre));
+    const float phi2(std::atan2(y2 - yCentre, x2 - xCentre));
+
+    float dphi1(phi1 - phiReference);
+    float dphi2(phi2 - phiReference);
+
+    if (dphi1 < 0 && charge < 0)
+    {
+        dphi1 = dphi1 + TWO_PI;
+    }
+    else if (dphi1 > 0 && charge > 0)
+    {
+        dphi1 = dphi1 - TWO_PI;
+    }
+
+    if (dphi2 < 0 && charge < 0)
+    {
+        dphi2 = dphi2 + TWO_PI;
+    }
+    else if (dphi2 > 0 && charge > 0)
+    {
+        dphi2 = dphi2 - TWO_PI;
+    }
+
+    // Calculate generic time
+    const float tt1(-charge * dphi1 * radius / pxy);
+    const float tt2(-charge * dphi2 * radius / pxy);
+
+    if ((tt1 < 0.) || (tt2 < 0.))
+        std::cout << "Helix:: " << pFunctionName << ", warning - negative generic time, tt1 " << tt1 << ", tt2 " << tt2 << std::endl;
+
+    if (tt1 < tt2)
+    {
+        genericTime = tt1;
+        intersectionPoint.SetValues(x1, y1, zReference + genericTime * pz);
+    }
+    else
+    {
+        genericTime = tt2;
+        intersectionPoint.SetValues(x2, y2, zReference + genericTime * pz);
+    }
+}
+
 } // namespace pandora
 
 #endif // #ifndef PANDORA_HELIX_H
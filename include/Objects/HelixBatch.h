@@ -0,0 +1,134 @@
+/**
+ *  @file   PandoraSDK/include/Objects/HelixBatch.h
+ *
+ *  @brief  Header file for the helix batch class.
+ *
+ *  $Log: $
+ */
+#ifndef PANDORA_HELIX_BATCH_H
+#define PANDORA_HELIX_BATCH_H 1
+
+#include "Pandora/PandoraInternal.h"
+#include "Pandora/StatusCodes.h"
+
+namespace pandora
+{
+
+/**
+ *  @brief  HelixBatch class, holding the parameters of many helices as a structure of arrays, so that each helix may be propagated to many
+ *          targets in bulk. Each helix is propagated from its own reference point. Terms that depend only upon the helix, including the
+ *          angles of its reference point and circle centre, are calculated once and reused for every target; the remaining calculations
+ *          use the same arithmetic kernels as the Helix class, so give identical results.
+ *
+ *          Results are ordered by helix, then by target: the result for helix i and target j is at index (i * nTargets + j).
+ */
+class HelixBatch
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    HelixBatch();
+
+    /**
+     *  @brief  Constructor, adding the helix fit to the track state at the calorimeter of each track, in the order of the track list
+     *
+     *  @param  trackList the track list
+     *  @param  bFieldPlugin the bfield plugin, providing the magnetic field at each track state
+     */
+    HelixBatch(const TrackList &trackList, const BFieldPlugin &bFieldPlugin);
+
+    /**
+     *  @brief  Add a helix to the batch
+     *
+     *  @param  helix the helix
+     */
+    void AddHelix(const Helix &helix);
+
+    /**
+     *  @brief  Get the number of helices in the batch
+     *
+     *  @return the number of helices
+     */
+    unsigned int GetNHelices() const;
+
+    /**
+     *  @brief  Get the distances of closest approach of each helix to each of a number of points, as for Helix::GetDistanceToPoint
+     *
+     *  @param  points the points
+     *  @param  distances to receive the distance vectors: x component the distance in the R-Phi plane, y component the distance along
+     *          the z axis and z component the 3D distance magnitude
+     *  @param  genericTimes to receive the generic times
+     */
+    StatusCode GetDistancesToPoints(const CartesianPointVector &points, CartesianPointVector &distances, FloatVector &genericTimes) const;
+
+    /**
+     *  @brief  Get the intersection points of each helix with each of a number of planes perpendicular to the z axis, as for Helix::GetPointInZ
+     *
+     *  @param  zPlanes the z coordinates of the planes
+     *  @param  intersectionPoints to receive the intersection points
+     *  @param  genericTimes to receive the generic times
+     *  @param  isFound to receive whether each intersection point was found
+     */
+    StatusCode GetPointsInZ(const FloatVector &zPlanes, CartesianPointVector &intersectionPoints, FloatVector &genericTimes,
+        BoolVector &isFound) const;
+
+    /**
+     *  @brief  Get the intersection points of each helix with each of a number of planes parallel to the z axis, as for Helix::GetPointInXY.
+     *          Each plane is defined by a point in the plane and a normal vector, of which only the x and y coordinates are used.
+     *
+     *  @param  planePoints the points in the planes
+     *  @param  planeNormals the vectors normal to the planes
+     *  @param  intersectionPoints to receive the intersection points
+     *  @param  genericTimes to receive the generic times
+     *  @param  isFound to receive whether each intersection point was found
+     */
+    StatusCode GetPointsInXY(const CartesianPointVector &planePoints, const CartesianPointVector &planeNormals,
+        CartesianPointVector &intersectionPoints, FloatVector &genericTimes, BoolVector &isFound) const;
+
+    /**
+     *  @brief  Get the intersection points of each helix with each of a number of cylinders aligned along the z axis, as for
+     *          Helix::GetPointOnCircle
+     *
+     *  @param  radii the radii of the cylinders
+     *  @param  intersectionPoints to receive the intersection points
+     *  @param  genericTimes to receive the generic times
+     *  @param  isFound to receive whether each intersection point was found
+     */
+    StatusCode GetPointsOnCircle(const FloatVector &radii, CartesianPointVector &intersectionPoints, FloatVector &genericTimes,
+        BoolVector &isFound) const;
+
+private:
+    /**
+     *  @brief  Prepare the output vectors for a number of targets, marking all results as not found
+     *
+     *  @param  nTargets the number of targets
+     *  @param  intersectionPoints the intersection points
+     *  @param  genericTimes the generic times
+     *  @param  isFound whether each intersection point was found
+     */
+    void PrepareOutput(const unsigned int nTargets, CartesianPointVector &intersectionPoints, FloatVector &genericTimes, BoolVector &isFound) const;
+
+    FloatVector         m_xCentre;              ///< The circle centre x coordinates
+    FloatVector         m_yCentre;              ///< The circle centre y coordinates
+    FloatVector         m_radius;               ///< The circle radii in the XY plane
+    FloatVector         m_charge;               ///< The particle charges
+    FloatVector         m_pxy;                  ///< The transverse momenta
+    FloatVector         m_pz;                   ///< The momentum z components
+    FloatVector         m_tanLambda;            ///< The tangents of the dip angles
+    FloatVector         m_zReference;           ///< The reference point z coordinates
+    FloatVector         m_phiReference;         ///< The phi of the reference point w.r.t. the circle centre
+    FloatVector         m_phiCentre;            ///< The phi of the circle centre w.r.t. the origin
+    FloatVector         m_distCentreToIP;       ///< The distance of the circle centre from the origin
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int HelixBatch::GetNHelices() const
+{
+    return m_xCentre.size();
+}
+
+} // namespace pandora
+
+#endif // #ifndef PANDORA_HELIX_BATCH_H
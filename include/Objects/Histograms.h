@@ -8,7 +8,7 @@
 #ifndef PANDORA_HISTOGRAMS_H
 #define PANDORA_HISTOGRAMS_H 1
 
-#include <map>
+#include "Pandora/PandoraInternal.h"
 
 namespace pandora
 {
@@ -233,9 +233,16 @@ public:
     void WriteToXml(TiXmlDocument *const pTiXmlDocument, const std::string &xmlElementName) const;
 
 private:
-    typedef std::map<int, float> HistogramMap;
+    /**
+     *  @brief  Get the index of a specified bin in the bin contents vector
+     * 
+     *  @param  binX the specified bin number, which must lie between the underflow and overflow bin numbers
+     * 
+     *  @return The index
+     */
+    unsigned int GetBinIndex(const int binX) const;
 
-    HistogramMap        m_histogramMap;         ///< The histogram map
+    FloatVector         m_binContents;          ///< The bin contents, from the underflow bin to the overflow bin
 
     int                 m_nBinsX;               ///< The number of x bins
     float               m_xLow;                 ///< The min binned x value
@@ -588,11 +595,22 @@ public:
     void WriteToXml(TiXmlDocument *const pTiXmlDocument, const std::string &xmlElementName) const;
 
 private:
-    typedef std::map<int, float> HistogramMap;
-    typedef std::map<int, HistogramMap> TwoDHistogramMap;
+    /**
+     *  @brief  Get the index of a specified bin in the bin contents vector
+     * 
+     *  @param  binX the specified x bin number, which must lie between the underflow and overflow x bin numbers
+     *  @param  binY the specified y bin number, which must lie between the underflow and overflow y bin numbers
+     * 
+     *  @return The index
+     */
+    unsigned int GetBinIndex(const int binX, const int binY) const;
+
+    /**
+     *  @brief  Allocate the bin contents, including underflow and overflow bins, initialized to zero
+     */
+    void AllocateBinContents();
 
-    TwoDHistogramMap    m_xyHistogramMap;       ///< The x->y->value 2d histogram map
-    TwoDHistogramMap    m_yxHistogramMap;       ///< The y->x->value 2d histogram map
+    FloatVector         m_binContents;          ///< The bin contents, row-major with x varying fastest, including underflow and overflow bins
 
     int                 m_nBinsX;               ///< The number of x bins
     float               m_xLow;                 ///< The min binned x value
@@ -690,6 +708,13 @@ inline float Histogram::GetStandardDeviationX() const
     return this->GetStandardDeviationX(this->GetMinBinNumber(), this->GetMaxBinNumber());
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int Histogram::GetBinIndex(const int binX) const
+{
+    return static_cast<unsigned int>(binX - this->GetUnderflowBinNumber());
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -843,6 +868,14 @@ inline float TwoDHistogram::GetStandardDeviationY() const
     return this->GetStandardDeviationY(this->GetMinBinNumberX(), this->GetMaxBinNumberX(), this->GetMinBinNumberY(), this->GetMaxBinNumberY());
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int TwoDHistogram::GetBinIndex(const int binX, const int binY) const
+{
+    return (static_cast<unsigned int>(binY - this->GetUnderflowBinNumberY()) * (static_cast<unsigned int>(m_nBinsX) + 2) +
+        static_cast<unsigned int>(binX - this->GetUnderflowBinNumberX()));
+}
+
 } // namespace pandora
 
 #endif // #ifndef PANDORA_HISTOGRAMS_H
@@ -9,6 +9,7 @@
 #define PANDORA_MC_PARTICLE_H 1
 
 #include "Pandora/ObjectCreation.h"
+#include "Pandora/ObjectPool.h"
 #include "Pandora/StatusCodes.h"
 
 namespace pandora
@@ -116,6 +117,14 @@ public:
      */
     Uid GetUid() const;
 
+    /**
+     *  @brief  Get the dense per-event index of the mc particle, assigned on creation and unique amongst the mc particles created in the
+     *          event
+     * 
+     *  @return the index
+     */
+    unsigned int GetIndex() const;
+
     /**
      *  @brief  Get list of parents of mc particle
      * 
@@ -139,6 +148,24 @@ public:
      */
     bool operator< (const MCParticle &rhs) const;
 
+#ifdef PANDORA_OBJECT_POOL
+    /**
+     *  @brief  Allocate storage for a mc particle, drawing on the event-scoped object pool when one is active
+     * 
+     *  @param  size the number of bytes required
+     * 
+     *  @return the address of the storage
+     */
+    static void *operator new(std::size_t size);
+
+    /**
+     *  @brief  Release storage for a mc particle, returning it to its object pool
+     * 
+     *  @param  pAddress the address of the storage
+     */
+    static void operator delete(void *pAddress);
+#endif
+
 protected:
     /**
      *  @brief  Constructor
@@ -204,6 +231,7 @@ protected:
     const MCParticle       *m_pPfoTarget;               ///< The address of the pfo target
     MCParticleList          m_daughterList;             ///< The list of mc daughter particles
     MCParticleList          m_parentList;               ///< The list of mc parent particles
+    unsigned int            m_index;                    ///< The dense per-event index, assigned by the mc manager
 
     friend class MCManager;
     friend class InputObjectManager<MCParticle>;
@@ -240,6 +268,13 @@ inline Uid MCParticle::GetUid() const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline unsigned int MCParticle::GetIndex() const
+{
+    return m_index;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline float MCParticle::GetEnergy() const
 {
     return m_energy;
@@ -308,6 +343,22 @@ inline const MCParticleList &MCParticle::GetDaughterList() const
     return m_daughterList;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+#ifdef PANDORA_OBJECT_POOL
+inline void *MCParticle::operator new(std::size_t size)
+{
+    return ObjectPool::Allocate(size);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void MCParticle::operator delete(void *pAddress)
+{
+    ObjectPool::Free(pAddress);
+}
+#endif
+
 } // namespace pandora
 
 #endif // #ifndef PANDORA_MC_PARTICLE_H
@@ -13,18 +13,35 @@
 #include "Pandora/PandoraInternal.h"
 #include "Pandora/StatusCodes.h"
 
-#include <map>
+#include <algorithm>
+#include <utility>
+#include <vector>
 
 namespace pandora
 {
 
 /**
- *  @brief  Calo hit lists arranged by pseudo layer
+ *  @brief  Calo hit lists arranged by pseudo layer. Layers are held in a flat vector of (pseudo layer, calo hit list) entries, sorted by
+ *          pseudo layer, and the per-layer calo hit lists are recycled rather than reallocated. Each per-layer list is a CaloHitList, so
+ *          still allocates a node per calo hit unless the vector-backed managed container is selected. Duplicate calo hits are detected
+ *          in constant time, via flags indexed by the dense per-event calo hit indices: the per-layer list is only searched if the flag
+ *          for the calo hit index is already set, i.e. if the calo hit is present, was present before a removal, or shares an index
+ *          with a calo hit from another event or pandora instance.
+ *
+ *          Iterator and reference invalidation, which differs from that of the std::map used previously:
+ *          - Adding a calo hit to a populated layer, or removing one that leaves its layer populated, invalidates only iterators into that
+ *            layer's calo hit list, as for the CaloHitList itself. Layer iterators and references to layer entries remain valid.
+ *          - Adding a calo hit to a new layer, removing the last calo hit in a layer, adding a whole ordered calo hit list, Reset and
+ *            assignment invalidate all layer iterators and all references to layer entries, including those to other layers.
+ *          - The per-layer CaloHitList objects themselves are only deleted with the ordered calo hit list. The list of a layer that is
+ *            emptied is cleared and may be reused for another layer, so its address must not be retained as a handle to its layer.
+ *          Callers must therefore not add or remove calo hits while iterating over the layers of the same ordered calo hit list, and must
+ *          not pass one of its own per-layer lists to Add or Remove. Iterate over a copy, e.g. from FillCaloHitList, instead.
  */
 class OrderedCaloHitList
 {
 public:
-    typedef std::map<unsigned int, CaloHitList *> TheList;
+    typedef std::vector<std::pair<unsigned int, CaloHitList *> > TheList;
     typedef TheList::value_type value_type;
     typedef TheList::const_iterator const_iterator;
     typedef TheList::const_reverse_iterator const_reverse_iterator;
@@ -161,11 +178,46 @@ public:
     bool operator= (const OrderedCaloHitList &rhs);
 
 private:
+    typedef std::vector<CaloHitList *> SpareListVector;
+
     /**
      *  @brief  Clear the ordered calo hit list
      */
     void clear();
 
+    /**
+     *  @brief  Get an empty calo hit list, recycling a spare list if one is available
+     * 
+     *  @return address of the empty calo hit list
+     */
+    CaloHitList *GetEmptyCaloHitList();
+
+    /**
+     *  @brief  Whether the pseudo layer of a list entry is less than a specified pseudo layer
+     * 
+     *  @param  entry the list entry
+     *  @param  pseudoLayer the specified pseudo layer
+     * 
+     *  @return boolean
+     */
+    static bool IsLayerLessThan(const value_type &entry, const unsigned int pseudoLayer);
+
+    /**
+     *  @brief  Whether a calo hit may be present in the ordered calo hit list, i.e. whether the flag for its index is set
+     * 
+     *  @param  pCaloHit the address of the calo hit
+     * 
+     *  @return boolean
+     */
+    bool IsFlagged(const CaloHit *const pCaloHit) const;
+
+    /**
+     *  @brief  Set the flag for the index of a calo hit added to the ordered calo hit list
+     * 
+     *  @param  pCaloHit the address of the calo hit
+     */
+    void SetFlag(const CaloHit *const pCaloHit);
+
     /**
      *  @brief  Add a calo hit to a specified pseudo layer
      * 
@@ -182,7 +234,9 @@ private:
      */
     StatusCode Remove(const CaloHit *const pCaloHit, const unsigned int pseudoLayer);
 
-    TheList     m_theList;      ///< The ordered calo hit list
+    TheList             m_theList;              ///< The ordered calo hit list
+    SpareListVector     m_spareCaloHitLists;    ///< Empty calo hit lists, retained for reuse by newly populated pseudo layers
+    std::vector<bool>   m_indexFlags;           ///< Flags for the indices of calo hits added since the last reset, not cleared on removal
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -203,7 +257,12 @@ inline OrderedCaloHitList::const_iterator OrderedCaloHitList::end() const
 
 inline OrderedCaloHitList::const_iterator OrderedCaloHitList::find(const unsigned int index) const
 {
-    return m_theList.find(index);
+    const_iterator iter(std::lower_bound(m_theList.begin(), m_theList.end(), index, OrderedCaloHitList::IsLayerLessThan));
+
+    if ((m_theList.end() != iter) && (index == iter->first))
+        return iter;
+
+    return m_theList.end();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -254,6 +313,34 @@ inline void OrderedCaloHitList::clear()
     m_theList.clear();
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool OrderedCaloHitList::IsLayerLessThan(const value_type &entry, const unsigned int pseudoLayer)
+{
+    return (entry.first < pseudoLayer);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool OrderedCaloHitList::IsFlagged(const CaloHit *const pCaloHit) const
+{
+    const unsigned int index(pCaloHit->GetIndex());
+
+    return ((index < m_indexFlags.size()) && m_indexFlags[index]);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void OrderedCaloHitList::SetFlag(const CaloHit *const pCaloHit)
+{
+    const unsigned int index(pCaloHit->GetIndex());
+
+    if (index >= m_indexFlags.size())
+        m_indexFlags.resize(index + 1, false);
+
+    m_indexFlags[index] = true;
+}
+
 } // namespace pandora
 
 #endif // #ifndef PANDORA_ORDERED_CALO_HIT_LIST_H
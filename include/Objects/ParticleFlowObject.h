@@ -9,6 +9,7 @@
 #define PANDORA_PARTICLE_FLOW_OBJECT_H 1
 
 #include "Pandora/ObjectCreation.h"
+#include "Pandora/ObjectPool.h"
 #include "Pandora/StatusCodes.h"
 
 namespace pandora
@@ -144,6 +145,24 @@ public:
      */
     const PropertiesMap &GetPropertiesMap() const;
 
+#ifdef PANDORA_OBJECT_POOL
+    /**
+     *  @brief  Allocate storage for a particle flow object, drawing on the event-scoped object pool when one is active
+     * 
+     *  @param  size the number of bytes required
+     * 
+     *  @return the address of the storage
+     */
+    static void *operator new(std::size_t size);
+
+    /**
+     *  @brief  Release storage for a particle flow object, returning it to its object pool
+     * 
+     *  @param  pAddress the address of the storage
+     */
+    static void operator delete(void *pAddress);
+#endif
+
 protected:
     /**
      *  @brief  Constructor
@@ -339,6 +358,22 @@ inline const PropertiesMap &ParticleFlowObject::GetPropertiesMap() const
     return m_propertiesMap;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+#ifdef PANDORA_OBJECT_POOL
+inline void *ParticleFlowObject::operator new(std::size_t size)
+{
+    return ObjectPool::Allocate(size);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void ParticleFlowObject::operator delete(void *pAddress)
+{
+    ObjectPool::Free(pAddress);
+}
+#endif
+
 } // namespace pandora
 
 #endif // #ifndef PANDORA_PARTICLE_FLOW_OBJECT_H
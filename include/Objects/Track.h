@@ -9,6 +9,7 @@
 #define PANDORA_TRACK_H 1
 
 #include "Pandora/ObjectCreation.h"
+#include "Pandora/ObjectPool.h"
 #include "Pandora/StatusCodes.h"
 
 namespace pandora
@@ -158,6 +159,13 @@ public:
      */
     const void *GetParentAddress() const;
 
+    /**
+     *  @brief  Get the dense per-event index of the track, assigned on creation and unique amongst the tracks created in the event
+     * 
+     *  @return the index
+     */
+    unsigned int GetIndex() const;
+
     /**
      *  @brief  Get the parent track list
      * 
@@ -195,6 +203,24 @@ public:
      */
     bool operator< (const Track &rhs) const;
 
+#ifdef PANDORA_OBJECT_POOL
+    /**
+     *  @brief  Allocate storage for a track, drawing on the event-scoped object pool when one is active
+     * 
+     *  @param  size the number of bytes required
+     * 
+     *  @return the address of the storage
+     */
+    static void *operator new(std::size_t size);
+
+    /**
+     *  @brief  Release storage for a track, returning it to its object pool
+     * 
+     *  @param  pAddress the address of the storage
+     */
+    static void operator delete(void *pAddress);
+#endif
+
 protected:
     /**
      *  @brief  Constructor
@@ -284,6 +310,7 @@ protected:
     TrackList               m_siblingTrackList;         ///< The list of sibling track addresses
     TrackList               m_daughterTrackList;        ///< The list of daughter track addresses
     bool                    m_isAvailable;              ///< Whether the track is available to be added to a particle flow object
+    unsigned int            m_index;                    ///< The dense per-event index, assigned by the track manager
 
     friend class TrackManager;
     friend class InputObjectManager<Track>;
@@ -418,6 +445,13 @@ inline const void *Track::GetParentAddress() const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline unsigned int Track::GetIndex() const
+{
+    return m_index;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline const TrackList &Track::GetParentList() const
 {
     return m_parentTrackList;
@@ -451,6 +485,22 @@ inline void Track::SetAvailability(bool isAvailable)
     m_isAvailable = isAvailable;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+#ifdef PANDORA_OBJECT_POOL
+inline void *Track::operator new(std::size_t size)
+{
+    return ObjectPool::Allocate(size);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void Track::operator delete(void *pAddress)
+{
+    ObjectPool::Free(pAddress);
+}
+#endif
+
 } // namespace pandora
 
 #endif // #ifndef PANDORA_TRACK_H
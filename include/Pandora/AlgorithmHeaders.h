@@ -34,6 +34,7 @@
 #include "Objects/Vertex.h"
 
 #include "Pandora/AlgorithmTool.h"
+#include "Pandora/DaughterAlgorithmGroup.h"
 #include "Pandora/PandoraEnumeratedTypes.h"
 #include "Pandora/PandoraInternal.h"
 #include "Pandora/PandoraInputTypes.h"
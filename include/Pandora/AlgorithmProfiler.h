@@ -0,0 +1,141 @@
+/**
+ *  @file   PandoraSDK/include/Pandora/AlgorithmProfiler.h
+ *
+ *  @brief  Header file for the algorithm profiler class.
+ *
+ *  $Log: $
+ */
+#ifndef PANDORA_ALGORITHM_PROFILER_H
+#define PANDORA_ALGORITHM_PROFILER_H 1
+
+#include "Pandora/StatusCodes.h"
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace pandora
+{
+
+class Algorithm;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  AlgorithmProfiler class, accumulating wall time, cpu time, call counts and manager object counts for each algorithm instance,
+ *          separately for each chain of parent algorithms through which the instance is run. Summaries are written as a csv table and
+ *          in the collapsed stack format read by flame graph tools.
+ */
+class AlgorithmProfiler
+{
+public:
+    /**
+     *  @brief  The manager identification enum, for the managers whose object counts are profiled
+     */
+    enum ManagerId
+    {
+        CALO_HIT_MANAGER,
+        TRACK_MANAGER,
+        MC_MANAGER,
+        CLUSTER_MANAGER,
+        PFO_MANAGER,
+        VERTEX_MANAGER,
+        N_MANAGER_IDS
+    };
+
+    /**
+     *  @brief  ObjectCounts class
+     */
+    class ObjectCounts
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        ObjectCounts();
+
+        std::size_t     m_nCreated[N_MANAGER_IDS];      ///< The number of objects created, indexed by manager id
+        std::size_t     m_nDeleted[N_MANAGER_IDS];      ///< The number of objects deleted, indexed by manager id
+    };
+
+    /**
+     *  @brief  Default constructor
+     */
+    AlgorithmProfiler();
+
+    /**
+     *  @brief  Start profiling a run of an algorithm, nested within any algorithm runs already being profiled
+     *
+     *  @param  pAlgorithm address of the algorithm
+     *  @param  objectCounts the cumulative manager object counts at the start of the run
+     */
+    void BeginAlgorithm(const Algorithm *const pAlgorithm, const ObjectCounts &objectCounts);
+
+    /**
+     *  @brief  Stop profiling the innermost algorithm run being profiled
+     *
+     *  @param  objectCounts the cumulative manager object counts at the end of the run
+     */
+    void EndAlgorithm(const ObjectCounts &objectCounts);
+
+    /**
+     *  @brief  Write the profile summaries, to files with the specified name and extensions .csv and .folded
+     *
+     *  @param  fileName the file name, without extension
+     */
+    StatusCode WriteSummary(const std::string &fileName) const;
+
+private:
+    /**
+     *  @brief  ProfileEntry class, holding the totals for an algorithm instance run via a specific chain of parent algorithms
+     */
+    class ProfileEntry
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        ProfileEntry();
+
+        std::string         m_type;                     ///< The algorithm type
+        unsigned int        m_nCalls;                   ///< The number of runs
+        double              m_wallTime;                 ///< The wall time, including daughter algorithms, units s
+        double              m_selfWallTime;             ///< The wall time, excluding daughter algorithms, units s
+        double              m_cpuTime;                  ///< The cpu time, including daughter algorithms, units s
+        double              m_selfCpuTime;              ///< The cpu time, excluding daughter algorithms, units s
+        ObjectCounts        m_objectCounts;             ///< The objects created and deleted, including by daughter algorithms
+    };
+
+    /**
+     *  @brief  Frame class, describing an algorithm run in progress
+     */
+    class Frame
+    {
+    public:
+        std::string                                 m_path;             ///< The algorithm instance, preceded by its parent algorithms
+        std::chrono::steady_clock::time_point       m_wallStart;        ///< The wall clock time at the start of the run
+        double                                      m_cpuStart;         ///< The thread cpu time at the start of the run, units s
+        double                                      m_daughterWallTime; ///< The wall time spent in daughter algorithms, units s
+        double                                      m_daughterCpuTime;  ///< The cpu time spent in daughter algorithms, units s
+        ObjectCounts                                m_objectCounts;     ///< The cumulative manager object counts at the start of the run
+    };
+
+    /**
+     *  @brief  Get the cpu time consumed by the calling thread
+     *
+     *  @return the cpu time, units s
+     */
+    static double GetThreadCpuTime();
+
+    typedef std::map<std::string, ProfileEntry> ProfileMap;
+    typedef std::vector<Frame> FrameVector;
+
+    ProfileMap              m_profileMap;               ///< The profile entries, keyed by algorithm path
+    FrameVector             m_frameStack;               ///< The algorithm runs in progress, innermost last
+};
+
+} // namespace pandora
+
+#endif // #ifndef PANDORA_ALGORITHM_PROFILER_H
@@ -0,0 +1,115 @@
+/**
+ *  @file   PandoraSDK/include/Pandora/DaughterAlgorithmGroup.h
+ *
+ *  @brief  Header file for the daughter algorithm group class.
+ *
+ *  $Log: $
+ */
+#ifndef PANDORA_DAUGHTER_ALGORITHM_GROUP_H
+#define PANDORA_DAUGHTER_ALGORITHM_GROUP_H 1
+
+#include "Pandora/PandoraInternal.h"
+#include "Pandora/StatusCodes.h"
+
+namespace pandora
+{
+
+/**
+ *  @brief  DaughterAlgorithmGroup class, describing a group of daughter algorithms to be run by a parent algorithm, each with the names of
+ *          the saved lists it reads and writes. The daughters are partitioned into stages: a daughter is placed in the first stage after
+ *          those of all earlier daughters with which it conflicts, where two daughters conflict if either writes a list the other reads or
+ *          writes. Daughters in the same stage are therefore independent, and every ordering of them gives the same result.
+ *
+ *          List names are compared irrespective of object type, so a calo hit list and a cluster list with the same name will conflict.
+ *          The declarations are checked as each daughter runs: reading a saved list that is not a declared input or output, or writing
+ *          a saved list that is not a declared output, is an error. Changes to the objects themselves (e.g. calo hit availability) are not
+ *          tracked, so daughters that cluster the same calo hits must declare a common output list.
+ */
+class DaughterAlgorithmGroup
+{
+public:
+    typedef std::vector<StringVector> StageVector;
+
+    /**
+     *  @brief  Add a daughter algorithm to the group
+     *
+     *  @param  daughterAlgorithmName the name of the daughter algorithm instance
+     *  @param  inputListNames the names of the saved lists read by the daughter algorithm
+     *  @param  outputListNames the names of the saved lists created or modified by the daughter algorithm
+     */
+    StatusCode AddDaughterAlgorithm(const std::string &daughterAlgorithmName, const StringVector &inputListNames, const StringVector &outputListNames);
+
+    /**
+     *  @brief  Get the stages, each holding the names of mutually independent daughter algorithms, in the order in which they were added
+     *
+     *  @param  stageVector to receive the stages, in the order in which they must be run
+     */
+    void GetStages(StageVector &stageVector) const;
+
+    /**
+     *  @brief  Get the names of the saved lists declared as inputs of a daughter algorithm
+     *
+     *  @param  daughterAlgorithmName the name of the daughter algorithm instance
+     *
+     *  @return the input list names
+     */
+    const StringSet &GetInputListNames(const std::string &daughterAlgorithmName) const;
+
+    /**
+     *  @brief  Get the names of the saved lists declared as outputs of a daughter algorithm
+     *
+     *  @param  daughterAlgorithmName the name of the daughter algorithm instance
+     *
+     *  @return the output list names
+     */
+    const StringSet &GetOutputListNames(const std::string &daughterAlgorithmName) const;
+
+private:
+    /**
+     *  @brief  Daughter class
+     */
+    class Daughter
+    {
+    public:
+        std::string             m_algorithmName;        ///< The daughter algorithm instance name
+        StringSet               m_inputListNames;       ///< The names of the saved lists read by the daughter algorithm
+        StringSet               m_outputListNames;      ///< The names of the saved lists written by the daughter algorithm
+    };
+
+    /**
+     *  @brief  Get a daughter algorithm, throwing status code "not found" if it is not in the group
+     *
+     *  @param  daughterAlgorithmName the name of the daughter algorithm instance
+     *
+     *  @return the daughter algorithm
+     */
+    const Daughter &GetDaughter(const std::string &daughterAlgorithmName) const;
+
+    /**
+     *  @brief  Whether two daughter algorithms conflict, such that they must be run in separate stages
+     *
+     *  @param  lhs the first daughter algorithm
+     *  @param  rhs the second daughter algorithm
+     *
+     *  @return boolean
+     */
+    static bool IsConflict(const Daughter &lhs, const Daughter &rhs);
+
+    /**
+     *  @brief  Whether two sets of list names have any name in common
+     *
+     *  @param  lhs the first set of list names
+     *  @param  rhs the second set of list names
+     *
+     *  @return boolean
+     */
+    static bool IsOverlap(const StringSet &lhs, const StringSet &rhs);
+
+    typedef std::vector<Daughter> DaughterVector;
+
+    DaughterVector              m_daughterVector;       ///< The daughter algorithms, in the order in which they were added
+};
+
+} // namespace pandora
+
+#endif // #ifndef PANDORA_DAUGHTER_ALGORITHM_GROUP_H
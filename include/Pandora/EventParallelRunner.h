@@ -0,0 +1,192 @@
+/**
+ *  @file   PandoraSDK/include/Pandora/EventParallelRunner.h
+ *
+ *  @brief  Header file for the event parallel runner class.
+ *
+ *  $Log: $
+ */
+#ifndef PANDORA_EVENT_PARALLEL_RUNNER_H
+#define PANDORA_EVENT_PARALLEL_RUNNER_H 1
+
+#include "Pandora/StatusCodes.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace pandora
+{
+
+class Pandora;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  EventParallelRunner class, owning a set of pandora instances configured from a single settings file and processing a sequence
+ *          of events across them, with one worker thread per instance. Each pandora instance remains single-threaded: an instance is only
+ *          ever used by its own worker thread, which takes the next event number from a shared counter, prepares and processes the event,
+ *          then waits for its turn to emit the output.
+ *
+ *          Ordering guarantee: EventProcessor::ProcessOutput is called serially, never concurrently, in strictly increasing event number
+ *          order, for a contiguous range of events starting at event zero. If any event fails, no further events are dispensed and no
+ *          outputs are emitted for that event or any later event. Each instance is reset after passing on the output turn, so a failure to
+ *          reset stops the run, but the output of the next event may already have been emitted.
+ *
+ *          ATTN External parameters, see ExternallyConfiguredAlgorithm, are held in a map shared by all pandora instances, so must only be
+ *          set before Run is called, and not from within the EventProcessor callbacks.
+ */
+class EventParallelRunner
+{
+public:
+    /**
+     *  @brief  InstanceSetup class, to be implemented by the client, registering algorithm factories and plugins with each pandora instance
+     *          before its settings are read. The geometry is created once, for the first instance, then shared by all instances.
+     */
+    class InstanceSetup
+    {
+    public:
+        /**
+         *  @brief  Destructor
+         */
+        virtual ~InstanceSetup();
+
+        /**
+         *  @brief  Register algorithm factories and plugins with a pandora instance
+         *
+         *  @param  pandora the pandora instance
+         */
+        virtual StatusCode Register(const Pandora &pandora) const = 0;
+
+        /**
+         *  @brief  Create the geometry, called for the first pandora instance only, after Register and before its settings are read. Geometry
+         *          read by an EventReadingAlgorithm during the first instance initialization is likewise shared with the other instances.
+         *
+         *  @param  pandora the first pandora instance
+         */
+        virtual StatusCode CreateGeometry(const Pandora &pandora) const;
+    };
+
+    /**
+     *  @brief  EventProcessor class, to be implemented by the client, providing the input objects for each event and consuming its output.
+     *          PrepareEvent is called concurrently from all worker threads, each with its own pandora instance, so implementations must only
+     *          share state that is read-only or separately synchronized.
+     */
+    class EventProcessor
+    {
+    public:
+        /**
+         *  @brief  Destructor
+         */
+        virtual ~EventProcessor();
+
+        /**
+         *  @brief  Create the input objects for an event in a pandora instance, called from the worker thread owning the instance
+         *
+         *  @param  pandora the pandora instance
+         *  @param  eventNumber the event number, counting from zero
+         */
+        virtual StatusCode PrepareEvent(const Pandora &pandora, const unsigned int eventNumber) = 0;
+
+        /**
+         *  @brief  Consume the output of an event processed by a pandora instance, called before the instance is reset
+         *
+         *  @param  pandora the pandora instance
+         *  @param  eventNumber the event number, counting from zero
+         */
+        virtual StatusCode ProcessOutput(const Pandora &pandora, const unsigned int eventNumber) = 0;
+    };
+
+    /**
+     *  @brief  Constructor, creating the pandora instances and configuring each from a single parsing of the settings file, with the
+     *          geometry of the first instance shared, read-only, by all the others
+     *
+     *  @param  nInstances the number of pandora instances, and so worker threads
+     *  @param  settingsFileName the name of the xml file containing the pandora settings
+     *  @param  instanceSetup the client setup, applied to each pandora instance before its settings are read
+     */
+    EventParallelRunner(const unsigned int nInstances, const std::string &settingsFileName, const InstanceSetup &instanceSetup);
+
+    /**
+     *  @brief  Destructor
+     */
+    ~EventParallelRunner();
+
+    /**
+     *  @brief  Process a sequence of events across the pandora instances, returning once all dispensed events have been completed
+     *
+     *  @param  nEvents the number of events
+     *  @param  eventProcessor the client event processor
+     *
+     *  @return the status code of the first event to fail, in event number order, or success
+     */
+    StatusCode Run(const unsigned int nEvents, EventProcessor &eventProcessor);
+
+    /**
+     *  @brief  Get the number of pandora instances
+     *
+     *  @return the number of pandora instances
+     */
+    unsigned int GetNInstances() const;
+
+    /**
+     *  @brief  Get a pandora instance, which must not be used while events are being run
+     *
+     *  @param  instanceIndex the instance index
+     *
+     *  @return the pandora instance
+     */
+    const Pandora &GetPandora(const unsigned int instanceIndex) const;
+
+private:
+    /**
+     *  @brief  Process events with a single pandora instance, until no events remain
+     *
+     *  @param  pPandora address of the pandora instance
+     *  @param  nEvents the number of events
+     *  @param  pEventProcessor address of the client event processor
+     */
+    void ProcessEvents(const Pandora *const pPandora, const unsigned int nEvents, EventProcessor *const pEventProcessor);
+
+    /**
+     *  @brief  Prepare and process a single event with a pandora instance
+     *
+     *  @param  pandora the pandora instance
+     *  @param  eventNumber the event number
+     *  @param  eventProcessor the client event processor
+     */
+    StatusCode ProcessEvent(const Pandora &pandora, const unsigned int eventNumber, EventProcessor &eventProcessor) const;
+
+    /**
+     *  @brief  Wait for the turn of an event, emit its output if no earlier event has failed, pass the turn on and reset the pandora instance
+     *
+     *  @param  pandora the pandora instance
+     *  @param  eventNumber the event number
+     *  @param  statusCode the status code from processing the event
+     *  @param  eventProcessor the client event processor
+     */
+    void CompleteEvent(const Pandora &pandora, const unsigned int eventNumber, StatusCode statusCode, EventProcessor &eventProcessor);
+
+    /**
+     *  @brief  Record a failure as the run status code, unless an earlier failure has been recorded, and stop the run. The output mutex
+     *          must be held by the caller.
+     *
+     *  @param  statusCode the status code
+     */
+    void RecordStatusCode(const StatusCode statusCode);
+
+    typedef std::vector<Pandora *> PandoraVector;
+
+    PandoraVector               m_pandoraVector;        ///< The pandora instances, each used by a single worker thread
+    std::atomic<unsigned int>   m_nextEventNumber;      ///< The number of the next event to dispense
+    std::atomic<bool>           m_shouldStop;           ///< Whether to stop dispensing events, following a failure
+    std::mutex                  m_outputMutex;          ///< The mutex guarding the output turn and run status
+    std::condition_variable     m_outputCondition;      ///< The condition variable signalling a change of output turn
+    unsigned int                m_nextOutputNumber;     ///< The number of the event whose output is next to be emitted
+    StatusCode                  m_runStatusCode;        ///< The status code of the first failed event, or success
+};
+
+} // namespace pandora
+
+#endif // #ifndef PANDORA_EVENT_PARALLEL_RUNNER_H
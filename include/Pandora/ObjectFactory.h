@@ -61,6 +61,14 @@ public:
      */
     virtual StatusCode Write(const Object *const pObject, FileWriter &fileWriter) const = 0;
 
+    /**
+     *  @brief  Whether the factory creates standard pandora objects from their parameters, reading and persisting no additional parameters.
+     *          Objects from a standard factory may be created in bulk, without calling the factory, e.g. calo hits from a calo hit block.
+     *
+     *  @return boolean
+     */
+    virtual bool IsStandardFactory() const;
+
 protected:
     /**
      *  @brief  Create an object with the given parameters
@@ -93,6 +101,14 @@ inline ObjectFactory<PARAMETERS, OBJECT>::~ObjectFactory()
 {
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename PARAMETERS, typename OBJECT>
+inline bool ObjectFactory<PARAMETERS, OBJECT>::IsStandardFactory() const
+{
+    return false;
+}
+
 } // namespace pandora
 
 #endif // #ifndef PANDORA_OBJECT_FACTORY_H
@@ -0,0 +1,135 @@
+/**
+ *  @file   PandoraSDK/include/Pandora/ObjectPool.h
+ *
+ *  @brief  Header file for the object pool class.
+ *
+ *  $Log: $
+ */
+#ifndef PANDORA_OBJECT_POOL_H
+#define PANDORA_OBJECT_POOL_H 1
+
+#include <cstddef>
+#include <vector>
+
+namespace pandora
+{
+
+/**
+ *  @brief  ObjectPool class, providing event-scoped storage for pandora objects. Memory is carved from large blocks, freed slots are recycled
+ *          and, once all objects have been deleted at the end of an event, the blocks are rewound wholesale for reuse in the next event.
+ *          Only used by objects built with PANDORA_OBJECT_POOL defined, which route their class-specific allocation functions here.
+ */
+class ObjectPool
+{
+public:
+    /**
+     *  @brief  Activation class, directing allocation of pooled objects on the current thread to a specified pool for its lifetime
+     */
+    class Activation
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  objectPool the object pool to activate
+         */
+        Activation(ObjectPool &objectPool);
+
+        /**
+         *  @brief  Destructor, restoring the previously active pool
+         */
+        ~Activation();
+
+    private:
+        ObjectPool     *m_pPreviousPool;        ///< The previously active pool
+    };
+
+    /**
+     *  @brief  Default constructor
+     */
+    ObjectPool();
+
+    /**
+     *  @brief  Destructor, releasing all blocks
+     */
+    ~ObjectPool();
+
+    /**
+     *  @brief  Rewind all blocks for reuse, provided that no pooled objects remain alive
+     */
+    void Reset();
+
+    /**
+     *  @brief  Allocate storage from the pool active on the current thread, or from the heap if there is no active pool
+     *
+     *  @param  size the number of bytes required
+     *
+     *  @return the address of the storage
+     */
+    static void *Allocate(const std::size_t size);
+
+    /**
+     *  @brief  Return storage obtained via Allocate to its originating pool, or to the heap
+     *
+     *  @param  pAddress the address of the storage
+     */
+    static void Free(void *const pAddress);
+
+private:
+    /**
+     *  @brief  SlotPool class, managing blocks of slots of a single size
+     */
+    class SlotPool
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  slotSize the slot size, including the slot header
+         */
+        SlotPool(const std::size_t slotSize);
+
+        /**
+         *  @brief  Destructor
+         */
+        ~SlotPool();
+
+        std::size_t             m_slotSize;         ///< The slot size, including the slot header
+        std::vector<char *>     m_blockList;        ///< The list of blocks
+        std::size_t             m_blockIndex;       ///< The index of the block from which new slots are taken
+        std::size_t             m_slotIndex;        ///< The index of the next unused slot in the current block
+        void                   *m_pFreeSlot;        ///< Head of the singly-linked list of freed slots
+    };
+
+    /**
+     *  @brief  SlotHeader class, preceding each allocation and recording its origin
+     */
+    class alignas(alignof(std::max_align_t)) SlotHeader
+    {
+    public:
+        ObjectPool     *m_pObjectPool;              ///< The originating object pool, nullptr for heap allocations
+        SlotPool       *m_pSlotPool;                ///< The originating slot pool, nullptr for heap allocations
+    };
+
+    typedef std::vector<SlotPool *> SlotPoolList;
+
+    /**
+     *  @brief  Get the slot pool for a given allocation size, creating it if required
+     *
+     *  @param  size the number of bytes required
+     *
+     *  @return the address of the slot pool
+     */
+    SlotPool *GetSlotPool(const std::size_t size);
+
+    static const std::size_t    m_nSlotsPerBlock;   ///< The number of slots in each block
+
+    SlotPoolList                m_slotPoolList;     ///< The slot pools, one per distinct allocation size
+    std::size_t                 m_nLiveObjects;     ///< The number of objects currently allocated from the pool
+
+    static thread_local ObjectPool *m_pActivePool;  ///< The pool active on the current thread
+};
+
+} // namespace pandora
+
+#endif // #ifndef PANDORA_OBJECT_POOL_H
@@ -17,6 +17,7 @@ namespace pandora
 {
 
 class AlgorithmManager;
+class AlgorithmProfiler;
 class CaloHitManager;
 class ClusterManager;
 class EnergyCorrectionsPlugin;
@@ -31,6 +32,7 @@ class PandoraSettings;
 class ParticleFlowObjectManager;
 class ParticleIdPlugin;
 class PluginManager;
+class TiXmlHandle;
 class TrackManager;
 class VertexManager;
 
@@ -181,6 +183,13 @@ private:
      */
     StatusCode ReadSettings(const std::string &xmlFileName);
 
+    /**
+     *  @brief  Read pandora settings from an already parsed xml document
+     *
+     *  @param  pXmlHandle address of the handle to the top-level xml element containing the settings
+     */
+    StatusCode ReadSettings(const TiXmlHandle *const pXmlHandle);
+
     AlgorithmManager *m_pAlgorithmManager;    ///< The algorithm manager
     CaloHitManager *m_pCaloHitManager;        ///< The hit manager
     ClusterManager *m_pClusterManager;        ///< The cluster manager
@@ -196,12 +205,14 @@ private:
     PandoraContentApiImpl *m_pPandoraContentApiImpl; ///< The pandora content api implementation
     PandoraImpl *m_pPandoraImpl;                     ///< The pandora implementation
     EventContext *m_pEventContext;  ///< The event instance
+    AlgorithmProfiler *m_pAlgorithmProfiler;         ///< The algorithm profiler
 
     std::string m_name; ///< The descriptive name or label for the pandora instance
     InputUInt m_run;    ///< the run number of the input data
     InputUInt m_subrun; ///< the subrun number of the input data
     InputUInt m_event;  ///< the event number of the input data
 
+    friend class EventParallelRunner;
     friend class PandoraApiImpl;
     friend class PandoraContentApiImpl;
     friend class PandoraImpl;
@@ -17,6 +17,11 @@ namespace pandora
 class PandoraImpl
 {
 private:
+    /**
+     *  @brief  Prepare geometry: index any detector gaps created since the last event
+     */
+    StatusCode PrepareGeometry() const;
+
     /**
      *  @brief  Prepare mc particles: select mc pfo targets, match tracks and calo hits to the correct mc
      *          particles for particle flow
@@ -32,6 +32,7 @@ class CaloHit;
 class CartesianVector;
 class Cluster;
 class ConcentricGap;
+class DaughterAlgorithmGroup;
 class DetectorGap;
 class EnergyCorrectionPlugin;
 class ExternalParameters;
@@ -171,6 +172,27 @@ inline bool PointerLessThan<T>::operator()(const T *lhs, const T *rhs) const
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+/**
+ *  @brief  Enable ordering of pointers to input objects (calo hits, tracks, mc particles) by their dense per-event index, i.e. by creation
+ */
+template <typename T>
+class IndexLessThan
+{
+public:
+    bool operator()(const T *lhs, const T *rhs) const;
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline bool IndexLessThan<T>::operator()(const T *lhs, const T *rhs) const
+{
+    return (lhs->GetIndex() < rhs->GetIndex());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  Wrapper around std::list
  */
@@ -428,7 +450,102 @@ inline void MyList<T>::clear()
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-#define MANAGED_CONTAINER std::list
+/**
+ *  @brief  Contiguous, vector-backed container offering the std::list member functions used for managed object lists.
+ *          Unlike std::list, insertion and erasure invalidate iterators to subsequent elements.
+ */
+template <typename T>
+class ManagedVector : public std::vector<T>
+{
+public:
+    typedef typename std::vector<T> TheVector;
+    typedef typename TheVector::value_type value_type;
+
+    using TheVector::TheVector;
+
+    /**
+     *  @brief  push_front
+     * 
+     *  @param  val
+     */
+    void push_front(const value_type &val);
+
+    /**
+     *  @brief  pop_front
+     */
+    void pop_front();
+
+    /**
+     *  @brief  remove
+     * 
+     *  @param  val
+     */
+    void remove(const value_type &val);
+
+    /**
+     *  @brief  sort, preserving the relative order of equivalent elements (matching std::list::sort)
+     */
+    void sort();
+
+    /**
+     *  @brief  sort, preserving the relative order of equivalent elements (matching std::list::sort)
+     * 
+     *  @param  comp
+     */
+    template <class Compare>
+    void sort(Compare comp);
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void ManagedVector<T>::push_front(const value_type &val)
+{
+    this->insert(this->begin(), val);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void ManagedVector<T>::pop_front()
+{
+    this->erase(this->begin());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void ManagedVector<T>::remove(const value_type &val)
+{
+    this->erase(std::remove(this->begin(), this->end(), val), this->end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void ManagedVector<T>::sort()
+{
+    std::stable_sort(this->begin(), this->end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+template <class Compare>
+inline void ManagedVector<T>::sort(Compare comp)
+{
+    std::stable_sort(this->begin(), this->end(), comp);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+// ATTN Build with PANDORA_VECTOR_MANAGED_CONTAINER defined to select contiguous storage for managed object lists
+#ifdef PANDORA_VECTOR_MANAGED_CONTAINER
+    #define MANAGED_CONTAINER pandora::ManagedVector
+#else
+    #define MANAGED_CONTAINER std::list
+#endif
 
 typedef MANAGED_CONTAINER<const CaloHit *> CaloHitList;
 typedef MANAGED_CONTAINER<const Cluster *> ClusterList;
@@ -463,7 +580,9 @@ typedef std::unordered_set<const SubDetector *> SubDetectorSet;
 typedef std::unordered_set<const Track *> TrackSet;
 typedef std::unordered_set<const Vertex *> VertexSet;
 
+typedef std::vector<bool> BoolVector;
 typedef std::vector<int> IntVector;
+typedef std::vector<unsigned int> UIntVector;
 typedef std::vector<float> FloatVector;
 typedef std::vector<std::string> StringVector;
 typedef std::vector<CartesianVector> CartesianPointVector;
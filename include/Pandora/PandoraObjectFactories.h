@@ -27,6 +27,7 @@ public:
     Parameters *NewParameters() const;
     StatusCode Read(Parameters &parameters, FileReader &fileReader) const;
     StatusCode Write(const Object *const pObject, FileWriter &fileWriter) const;
+    bool IsStandardFactory() const;
 
 private:
     StatusCode Create(const Parameters &parameters, const Object *&pObject) const;
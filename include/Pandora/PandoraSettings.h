@@ -10,6 +10,8 @@
 
 #include "Pandora/StatusCodes.h"
 
+#include <string>
+
 namespace pandora
 {
 
@@ -50,6 +52,20 @@ public:
      */
     bool ShouldDisplayAlgorithmInfo() const;
 
+    /**
+     *  @brief  Whether to profile the time taken and objects created and deleted by each algorithm
+     * 
+     *  @return boolean
+     */
+    bool ShouldProfileAlgorithms() const;
+
+    /**
+     *  @brief  Get the name of the algorithm profile summary files, without extension
+     * 
+     *  @return the algorithm profile file name
+     */
+    const std::string &GetAlgorithmProfileFileName() const;
+
     /**
      *  @brief  Whether to allow only single hit types in individual clusters
      * 
@@ -130,6 +146,8 @@ private:
 
     bool     m_isMonitoringEnabled;                         ///< Whether monitoring is enabled
     bool     m_shouldDisplayAlgorithmInfo;                  ///< Whether to display algorithm information during processing
+    bool     m_shouldProfileAlgorithms;                     ///< Whether to profile the time taken and objects created and deleted by each algorithm
+    std::string m_algorithmProfileFileName;                 ///< The name of the algorithm profile summary files, without extension
     bool     m_singleHitTypeClusteringMode;                 ///< Whether to allow only single hit types in individual clusters
     bool     m_shouldCollapseMCParticlesToPfoTarget;        ///< Whether to collapse mc particle decay chains down to just the pfo target
     bool     m_useSingleMCParticleAssociation;              ///< Whether to allow only single mc particle association to objects (largest weight)
@@ -164,6 +182,20 @@ inline bool PandoraSettings::ShouldDisplayAlgorithmInfo() const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline bool PandoraSettings::ShouldProfileAlgorithms() const
+{
+    return m_shouldProfileAlgorithms;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const std::string &PandoraSettings::GetAlgorithmProfileFileName() const
+{
+    return m_algorithmProfileFileName;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline bool PandoraSettings::SingleHitTypeClusteringMode() const
 {
     return m_singleHitTypeClusteringMode;
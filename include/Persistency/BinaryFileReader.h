@@ -10,12 +10,16 @@
 
 #include "Pandora/Pandora.h"
 
+#include "Objects/CaloHitBlock.h"
 #include "Objects/CartesianVector.h"
 #include "Objects/TrackState.h"
 
 #include "Persistency/FileReader.h"
 
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <vector>
 
 namespace pandora
 {
@@ -45,6 +49,50 @@ public:
     template <typename T>
     StatusCode ReadVariable(T &t);
 
+    /**
+     *  @brief  Complete the index of event and geometry container positions and write it to the index file alongside the binary file,
+     *          allowing subsequent readers to go directly to any event or geometry without first scanning the file
+     */
+    StatusCode WriteIndexFile();
+
+protected:
+    /**
+     *  @brief  Constructor for derived readers that provide their own access to the file contents
+     *
+     *  @param  pandora the pandora instance to be used alongside the file reader
+     *  @param  fileName the name of the file containing the pandora objects
+     *  @param  openFileStream whether to open the file stream
+     */
+    BinaryFileReader(const pandora::Pandora &pandora, const std::string &fileName, const bool openFileStream);
+
+    /**
+     *  @brief  Get the current position in the file
+     *
+     *  @return the current position in the file
+     */
+    virtual std::ifstream::pos_type GetFilePosition();
+
+    /**
+     *  @brief  Move to a specified position in the file
+     *
+     *  @param  position the position in the file
+     */
+    virtual StatusCode SetFilePosition(const std::ifstream::pos_type position);
+
+    /**
+     *  @brief  Make the remainder of the current container available in memory, so that its variables can be decoded in place
+     */
+    virtual StatusCode BufferContainer();
+
+    /**
+     *  @brief  Discard any buffered container contents, so that subsequent reads are taken directly from the file
+     */
+    virtual void ClearContainerBuffer();
+
+    const char *m_pMemory;                       ///< Address of the in-memory bytes from which variables are decoded, nullptr to use the file stream
+    std::size_t m_memorySize;                    ///< The number of in-memory bytes available
+    std::size_t m_memoryPosition;                ///< The position of the next unread in-memory byte
+
 private:
     StatusCode ReadHeader();
     StatusCode GoToNextContainer();
@@ -55,6 +103,79 @@ private:
     StatusCode ReadNextGeometryComponent();
     StatusCode ReadNextEventComponent();
 
+    /**
+     *  @brief  Read the container header from the current position in the file, without buffering the container contents
+     */
+    StatusCode ReadContainerHeader();
+
+    /**
+     *  @brief  Decompress the contents of the current compressed event container, so that its variables can be decoded in place
+     */
+    StatusCode DecompressContainer();
+
+    /**
+     *  @brief  Discard any decompressed or buffered container contents, so that subsequent reads are taken directly from the file
+     */
+    void ResetContainerMemory();
+
+    /**
+     *  @brief  Move to the start of a specified event or geometry container, using (and if necessary extending) the container index
+     *
+     *  @param  containerId the container id, event or geometry
+     *  @param  containerNumber the container number, counting only containers of the specified type
+     */
+    StatusCode GoToIndexedContainer(const ContainerId containerId, const unsigned int containerNumber);
+
+    /**
+     *  @brief  Extend the container index, by stepping through container headers, until a specified container is indexed or the end
+     *          of the file is reached
+     *
+     *  @param  containerId the container id, event or geometry
+     *  @param  containerNumber the container number, counting only containers of the specified type
+     */
+    void ExtendIndex(const ContainerId containerId, const unsigned int containerNumber);
+
+    /**
+     *  @brief  Discard the container index, including any contents read from the index file
+     */
+    void ResetIndex();
+
+    /**
+     *  @brief  Read the container index from the index file alongside the binary file, if present and consistent with the binary file
+     */
+    StatusCode ReadIndexFile();
+
+    /**
+     *  @brief  Get the name of the index file alongside the binary file
+     *
+     *  @return the name of the index file
+     */
+    std::string GetIndexFileName() const;
+
+    /**
+     *  @brief  Get the size and modification time of the binary file, recorded in the index file to tie it to the binary file
+     *
+     *  @param  fileSize to receive the file size, units bytes
+     *  @param  modificationTime to receive the file modification time, units s since the epoch
+     */
+    StatusCode GetFileStatus(std::int64_t &fileSize, std::int64_t &modificationTime) const;
+
+    /**
+     *  @brief  Read a specified number of bytes from memory or, if no bytes are held in memory, from the file stream
+     *
+     *  @param  pAddress the address to receive the bytes
+     *  @param  nBytes the number of bytes to read
+     */
+    StatusCode ReadBytes(void *const pAddress, const std::size_t nBytes);
+
+    /**
+     *  @brief  Read all values in a calo hit block column, sized to the number of calo hits in the block, as a single run of bytes
+     *
+     *  @param  column the calo hit block column, to receive the values
+     */
+    template <typename T>
+    StatusCode ReadColumn(std::vector<T> &column);
+
     /**
      *  @brief  Read file version information from the current position in the file
      *
@@ -104,6 +225,14 @@ private:
      */
     StatusCode ReadCaloHit(bool checkComponentId = true);
 
+    /**
+     *  @brief  Read a calo hit block from the current position in the file, recreating all the stored objects in a single pass over
+     *          the block columns
+     *
+     *  @param  checkComponentId whether to check the component id before deserializing
+     */
+    StatusCode ReadCaloHitBlock(bool checkComponentId = true);
+
     /**
      *  @brief  Read a track from the current position in the file, recreating the stored object
      *
@@ -135,18 +264,44 @@ private:
     std::ifstream::pos_type m_containerPosition; ///< Position of start of the current event/geometry container object in file
     std::ifstream::pos_type m_containerSize;     ///< Size of the current event/geometry container object in the file
     std::ifstream m_fileStream;                  ///< The stream class to read from the file
+
+    typedef std::vector<char> CharVector;
+    typedef std::vector<std::streamoff> OffsetVector;
+
+    CharVector m_containerBuffer;                ///< The contents of the current container, reused between containers
+
+    bool m_isContainerCompressed;                ///< Whether the current container is a compressed event container
+    bool m_isContainerDecompressed;              ///< Whether variables are currently decoded from the decompressed container contents
+    CharVector m_decompressedBuffer;             ///< The decompressed contents of the current container, reused between containers
+    const char *m_pSavedMemory;                  ///< The in-memory bytes address to restore once decoding of decompressed contents ends
+    std::size_t m_savedMemorySize;               ///< The in-memory bytes size to restore once decoding of decompressed contents ends
+    std::size_t m_savedMemoryPosition;           ///< The in-memory bytes position to restore once decoding of decompressed contents ends
+
+    CaloHitBlock m_caloHitBlock;                 ///< The columns of the current calo hit block, reused between events
+
+    OffsetVector m_eventOffsets;                 ///< The indexed positions of the starts of the event containers
+    OffsetVector m_geometryOffsets;              ///< The indexed positions of the starts of the geometry containers
+    std::streamoff m_indexedSize;                ///< The size of the indexed part of the file, i.e. the position of the next unindexed container
+    bool m_isIndexComplete;                      ///< Whether the index covers all containers in the file
+    bool m_isIndexFileChecked;                   ///< Whether an attempt has been made to read the index file
+    bool m_isIndexFromFile;                      ///< Whether the index contents were read from the index file
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-template <typename T>
-inline StatusCode BinaryFileReader::ReadVariable(T &t)
+inline StatusCode BinaryFileReader::ReadBytes(void *const pAddress, const std::size_t nBytes)
 {
-    char *const pMemBlock = new char[sizeof(T)];
-    m_fileStream.read(pMemBlock, sizeof(T));
+    if (m_pMemory)
+    {
+        if (m_memorySize - m_memoryPosition < nBytes)
+            return STATUS_CODE_FAILURE;
+
+        std::memcpy(pAddress, m_pMemory + m_memoryPosition, nBytes);
+        m_memoryPosition += nBytes;
+        return STATUS_CODE_SUCCESS;
+    }
 
-    t = *(reinterpret_cast<T *>(pMemBlock));
-    delete[] pMemBlock;
+    m_fileStream.read(static_cast<char *>(pAddress), nBytes);
 
     if (!m_fileStream.good())
         return STATUS_CODE_FAILURE;
@@ -154,6 +309,22 @@ inline StatusCode BinaryFileReader::ReadVariable(T &t)
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline StatusCode BinaryFileReader::ReadColumn(std::vector<T> &column)
+{
+    return column.empty() ? STATUS_CODE_SUCCESS : this->ReadBytes(column.data(), column.size() * sizeof(T));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline StatusCode BinaryFileReader::ReadVariable(T &t)
+{
+    return this->ReadBytes(&t, sizeof(T));
+}
+
 template <>
 inline StatusCode BinaryFileReader::ReadVariable(std::string &t)
 {
@@ -163,16 +334,18 @@ inline StatusCode BinaryFileReader::ReadVariable(std::string &t)
     if (STATUS_CODE_SUCCESS != statusCode)
         return statusCode;
 
-    char *const pMemBlock = new char[stringSize];
-    m_fileStream.read(pMemBlock, stringSize);
+    if (m_pMemory)
+    {
+        if (m_memorySize - m_memoryPosition < stringSize)
+            return STATUS_CODE_FAILURE;
 
-    t = std::string(pMemBlock, stringSize);
-    delete[] pMemBlock;
+        t.assign(m_pMemory + m_memoryPosition, stringSize);
+        m_memoryPosition += stringSize;
+        return STATUS_CODE_SUCCESS;
+    }
 
-    if (!m_fileStream.good())
-        return STATUS_CODE_FAILURE;
-
-    return STATUS_CODE_SUCCESS;
+    t.resize(stringSize);
+    return (0 == stringSize) ? STATUS_CODE_SUCCESS : this->ReadBytes(&t[0], stringSize);
 }
 
 template <>
@@ -10,18 +10,21 @@
 
 #include "Pandora/Pandora.h"
 
+#include "Objects/CaloHitBlock.h"
 #include "Objects/CartesianVector.h"
 #include "Objects/TrackState.h"
 
 #include "Persistency/FileWriter.h"
 
 #include <fstream>
+#include <vector>
 
 namespace pandora
 {
 
 /**
- *  @brief  BinaryFileWriter class
+ *  @brief  BinaryFileWriter class. From file minor version 1, each event container is compressed as a single block. From file minor version 2,
+ *          the calo hits in each event are also written column-wise, as a single calo hit block.
  */
 class BinaryFileWriter : public FileWriter
 {
@@ -56,22 +59,58 @@ private:
     StatusCode WriteSubDetector(const SubDetector *const pSubDetector);
     StatusCode WriteLArTPC(const LArTPC *const pLArTPC);
     StatusCode WriteDetectorGap(const DetectorGap *const pDetectorGap);
+    StatusCode WriteCaloHitList(const CaloHitList &caloHitList);
     StatusCode WriteCaloHit(const CaloHit *const pCaloHit);
     StatusCode WriteTrack(const Track *const pTrack);
     StatusCode WriteMCParticle(const MCParticle *const pMCParticle);
     StatusCode WriteRelationship(const RelationshipId relationshipId, const void *address1, const void *address2, const float weight);
     StatusCode WriteEventInformation();
 
+    /**
+     *  @brief  Write a specified number of bytes to the file or, if set, to the current write buffer
+     *
+     *  @param  pAddress the address of the bytes
+     *  @param  nBytes the number of bytes to write
+     */
+    StatusCode WriteBytes(const void *const pAddress, const std::size_t nBytes);
+
+    /**
+     *  @brief  Compress the buffered contents of the current container and write them to the file as a single block
+     */
+    StatusCode WriteCompressedContainer();
+
+    /**
+     *  @brief  Write all values in a calo hit block column, as a single run of bytes
+     *
+     *  @param  column the calo hit block column
+     */
+    template <typename T>
+    StatusCode WriteColumn(const std::vector<T> &column);
+
+    typedef std::vector<char> CharVector;
+
     std::ofstream::pos_type m_containerPosition; ///< Position of start of the current event/geometry container object in file
     std::ofstream m_fileStream;                  ///< The stream class to write to the file
+    bool m_isCompressingContainer;               ///< Whether the contents of the current container are being buffered for compression
+    CharVector *m_pWriteBuffer;                  ///< Address of the buffer to receive written bytes in place of the file, nullptr to write to the file
+    CharVector m_containerBuffer;                ///< The buffered contents of the current container, reused between containers
+    CharVector m_compressedBuffer;               ///< The compressed contents of the current container, reused between containers
+    CharVector m_extensionBuffer;                ///< The calo hit factory contents for the current calo hit block, reused between events
+    CaloHitBlock m_caloHitBlock;                 ///< The columns of the current calo hit block, reused between events
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-template <typename T>
-inline StatusCode BinaryFileWriter::WriteVariable(const T &t)
+inline StatusCode BinaryFileWriter::WriteBytes(const void *const pAddress, const std::size_t nBytes)
 {
-    m_fileStream.write(reinterpret_cast<const char *>(&t), sizeof(T));
+    if (m_pWriteBuffer)
+    {
+        const char *const pBytes(static_cast<const char *>(pAddress));
+        m_pWriteBuffer->insert(m_pWriteBuffer->end(), pBytes, pBytes + nBytes);
+        return STATUS_CODE_SUCCESS;
+    }
+
+    m_fileStream.write(static_cast<const char *>(pAddress), nBytes);
 
     if (!m_fileStream.good())
         return STATUS_CODE_FAILURE;
@@ -79,17 +118,21 @@ inline StatusCode BinaryFileWriter::WriteVariable(const T &t)
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline StatusCode BinaryFileWriter::WriteVariable(const T &t)
+{
+    return this->WriteBytes(&t, sizeof(T));
+}
+
 template <>
 inline StatusCode BinaryFileWriter::WriteVariable(const std::string &t)
 {
     const unsigned int stringSize(t.size());
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(stringSize));
-    m_fileStream.write(reinterpret_cast<const char *>(t.c_str()), stringSize);
-
-    if (!m_fileStream.good())
-        return STATUS_CODE_FAILURE;
 
-    return STATUS_CODE_SUCCESS;
+    return this->WriteBytes(t.c_str(), stringSize);
 }
 
 template <>
@@ -109,6 +152,14 @@ inline StatusCode BinaryFileWriter::WriteVariable(const TrackState &t)
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline StatusCode BinaryFileWriter::WriteColumn(const std::vector<T> &column)
+{
+    return column.empty() ? STATUS_CODE_SUCCESS : this->WriteBytes(column.data(), column.size() * sizeof(T));
+}
+
 } // namespace pandora
 
 #endif // #ifndef PANDORA_BINARY_FILE_WRITER_H
@@ -0,0 +1,112 @@
+/**
+ *  @file   PandoraSDK/include/Persistency/CompressionHelper.h
+ *
+ *  @brief  Header file for the compression helper class.
+ *
+ *  $Log: $
+ */
+#ifndef PANDORA_COMPRESSION_HELPER_H
+#define PANDORA_COMPRESSION_HELPER_H 1
+
+#include "Pandora/StatusCodes.h"
+
+#include "Persistency/PandoraIO.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace pandora
+{
+
+/**
+ *  @brief  CompressionHelper class, compressing and decompressing whole blocks of persisted data. The built-in pandora lz codec is always
+ *          available; the zlib codec is available only in builds with PANDORA_ZLIB defined.
+ */
+class CompressionHelper
+{
+public:
+    typedef std::vector<char> CharVector;
+
+    /**
+     *  @brief  Get the id of the codec to be used when writing compressed blocks, preferring a library codec where available
+     *
+     *  @return the compression id
+     */
+    static CompressionId GetDefaultCompressionId();
+
+    /**
+     *  @brief  Compress a block of bytes
+     *
+     *  @param  compressionId the id of the codec to use
+     *  @param  pInput address of the bytes to compress
+     *  @param  inputSize the number of bytes to compress
+     *  @param  output to receive the compressed bytes
+     */
+    static StatusCode Compress(const CompressionId compressionId, const char *const pInput, const std::size_t inputSize, CharVector &output);
+
+    /**
+     *  @brief  Decompress a block of bytes, requiring the decompressed size to match that expected
+     *
+     *  @param  compressionId the id of the codec used to compress the block
+     *  @param  pInput address of the compressed bytes
+     *  @param  inputSize the number of compressed bytes
+     *  @param  pOutput address to receive the decompressed bytes
+     *  @param  outputSize the expected number of decompressed bytes
+     */
+    static StatusCode Decompress(const CompressionId compressionId, const char *const pInput, const std::size_t inputSize, char *const pOutput,
+        const std::size_t outputSize);
+
+    /**
+     *  @brief  Get the largest number of bytes into which a block of compressed bytes can decompress, allowing declared decompressed sizes
+     *          to be checked before any memory is allocated
+     *
+     *  @param  compressionId the id of the codec used to compress the block
+     *  @param  inputSize the number of compressed bytes
+     *  @param  maxOutputSize to receive the maximum number of decompressed bytes
+     */
+    static StatusCode GetMaxDecompressedSize(const CompressionId compressionId, const std::size_t inputSize, std::size_t &maxOutputSize);
+
+private:
+    /**
+     *  @brief  Compress a block of bytes using the built-in pandora lz codec, a byte-oriented lz77 variant emitting sequences of literals
+     *          followed by back-references of up to 64kB into the preceding data
+     *
+     *  @param  pInput address of the bytes to compress
+     *  @param  inputSize the number of bytes to compress
+     *  @param  output to receive the compressed bytes
+     */
+    static void CompressPandoraLZ(const unsigned char *const pInput, const std::size_t inputSize, CharVector &output);
+
+    /**
+     *  @brief  Decompress a block of bytes compressed using the built-in pandora lz codec
+     *
+     *  @param  pInput address of the compressed bytes
+     *  @param  inputSize the number of compressed bytes
+     *  @param  pOutput address to receive the decompressed bytes
+     *  @param  outputSize the expected number of decompressed bytes
+     */
+    static StatusCode DecompressPandoraLZ(const unsigned char *const pInput, const std::size_t inputSize, unsigned char *const pOutput,
+        const std::size_t outputSize);
+
+    /**
+     *  @brief  Write a sequence length, beyond that held in the sequence token, as a run of bytes
+     *
+     *  @param  length the length remaining once the token value has been subtracted
+     *  @param  pOutput address to receive the bytes, advanced past the run
+     */
+    static void WriteExtendedLength(std::size_t length, unsigned char *&pOutput);
+
+    /**
+     *  @brief  Read a sequence length, beyond that held in the sequence token, from a run of bytes
+     *
+     *  @param  pInput address of the compressed bytes
+     *  @param  inputSize the number of compressed bytes
+     *  @param  position the position of the next unread compressed byte, advanced past the run
+     *  @param  length to receive the additional length
+     */
+    static StatusCode ReadExtendedLength(const unsigned char *const pInput, const std::size_t inputSize, std::size_t &position, std::size_t &length);
+};
+
+} // namespace pandora
+
+#endif // #ifndef PANDORA_COMPRESSION_HELPER_H
@@ -52,6 +52,7 @@ public:
         std::string             m_geometryFileName;             ///< Name of the file containing geometry information
         std::string             m_eventFileNameList;            ///< Colon-separated list of file names to be processed
         pandora::InputUInt      m_skipToEvent;                  ///< Index of first event to consider in input file
+        pandora::InputBool      m_useMappedFileReader;          ///< Whether to read binary event files via a read-only memory mapping
     };
 
 protected:
@@ -86,6 +87,8 @@ protected:
     pandora::StringVector       m_eventFileNameVector;          ///< Vector of file names to be processed
 
     unsigned int                m_skipToEvent;                  ///< Index of first event to consider in first input file
+    bool                        m_useMappedFileReader;          ///< Whether to read binary event files via a read-only memory mapping
+    bool                        m_writeEventIndexFile;          ///< Whether to write an index file alongside each binary event file
 
     pandora::FileReader        *m_pEventFileReader;             ///< Address of the event file reader
 };
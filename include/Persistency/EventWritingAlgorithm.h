@@ -60,6 +60,8 @@ protected:
 
     bool                    m_shouldOverwriteEventFile;     ///< Whether to overwrite existing event file with specified name, or append
     bool                    m_shouldOverwriteGeometryFile;  ///< Whether to overwrite existing geometry file with specified name, or append
+    bool                    m_shouldCompressEventFile;      ///< Whether to compress each event container in a binary event file
+    bool                    m_shouldWriteCaloHitBlocks;     ///< Whether to write calo hits column-wise in a binary event file, implies compression
 
     pandora::FileWriter    *m_pEventFileWriter;             ///< Address of the event file writer
 };
@@ -105,6 +105,13 @@ protected:
      */
     virtual StatusCode WriteDetectorGap(const DetectorGap *const pDetectorGap) = 0;
 
+    /**
+     *  @brief  Write a calo hit list to the current position in the file, by default writing each calo hit in turn
+     *
+     *  @param  caloHitList the calo hit list
+     */
+    virtual StatusCode WriteCaloHitList(const CaloHitList &caloHitList);
+
     /**
      *  @brief  Write a calo hit to the current position in the file
      *
@@ -167,13 +174,6 @@ private:
      */
     StatusCode WriteTrackList(const TrackList &trackList);
 
-    /**
-     *  @brief  Write a calo hit list to the current position in the file
-     *
-     *  @param  caloHitList the calo hit list
-     */
-    StatusCode WriteCaloHitList(const CaloHitList &caloHitList);
-
     /**
      *  @brief  Write a mc particle list to the current position in the file
      *
@@ -0,0 +1,48 @@
+/**
+ *  @file   PandoraSDK/include/Persistency/MappedBinaryFileReader.h
+ *
+ *  @brief  Header file for the mapped binary file reader class.
+ *
+ *  $Log: $
+ */
+#ifndef PANDORA_MAPPED_BINARY_FILE_READER_H
+#define PANDORA_MAPPED_BINARY_FILE_READER_H 1
+
+#include "Persistency/BinaryFileReader.h"
+
+namespace pandora
+{
+
+/**
+ *  @brief  MappedBinaryFileReader class. Maps the whole binary file read-only into memory and decodes containers and components in place,
+ *          without copying. Jobs reading the same file therefore share the page cache, rather than each holding private buffers.
+ */
+class MappedBinaryFileReader : public BinaryFileReader
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  pandora the pandora instance to be used alongside the file reader
+     *  @param  fileName the name of the file containing the pandora objects
+     */
+    MappedBinaryFileReader(const pandora::Pandora &pandora, const std::string &fileName);
+
+    /**
+     *  @brief  Destructor
+     */
+    ~MappedBinaryFileReader();
+
+private:
+    std::ifstream::pos_type GetFilePosition();
+    StatusCode SetFilePosition(const std::ifstream::pos_type position);
+    StatusCode BufferContainer();
+    void ClearContainerBuffer();
+
+    void *m_pMapping;                            ///< The address of the file mapping
+    std::size_t m_mappingSize;                   ///< The size of the file mapping
+};
+
+} // namespace pandora
+
+#endif // #ifndef PANDORA_MAPPED_BINARY_FILE_READER_H
@@ -25,6 +25,7 @@ enum ContainerId
     EVENT_CONTAINER,
     GEOMETRY_CONTAINER,
     HEADER_CONTAINER,
+    COMPRESSED_EVENT_CONTAINER,
     UNKNOWN_CONTAINER
 };
 
@@ -49,11 +50,24 @@ enum ComponentId
     EVENT_INFO_COMPONENT,
     VERSION_COMPONENT,
     HEADER_END_COMPONENT,
+    CALO_HIT_BLOCK_COMPONENT,
     UNKNOWN_COMPONENT
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+/**
+ *  @brief  The compression identification enum
+ */
+enum CompressionId
+{
+    PANDORA_LZ_COMPRESSION,
+    ZLIB_COMPRESSION,
+    UNKNOWN_COMPRESSION
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  The relationship identification enum
  */
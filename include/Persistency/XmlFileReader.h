@@ -112,10 +112,23 @@ private:
      */
     StatusCode ReadEventInformation();
 
+    /**
+     *  @brief  Move to a specified event or geometry container, indexing all container xml nodes in the document on first use
+     *
+     *  @param  containerId the container id, event or geometry
+     *  @param  containerNumber the container number, counting only containers of the specified type
+     */
+    StatusCode GoToIndexedContainer(const ContainerId containerId, const unsigned int containerNumber);
+
+    typedef std::vector<TiXmlNode *> XmlNodeVector;
+
     TiXmlDocument *m_pXmlDocument;      ///< The xml document
     TiXmlNode *m_pContainerXmlNode;     ///< The document xml node
     TiXmlElement *m_pCurrentXmlElement; ///< The current xml element
     bool m_isAtFileStart;               ///< Whether reader is at file start
+    bool m_isIndexed;                   ///< Whether the container xml nodes have been indexed
+    XmlNodeVector m_eventXmlNodes;      ///< The indexed event container xml nodes
+    XmlNodeVector m_geometryXmlNodes;   ///< The indexed geometry container xml nodes
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -29,6 +29,14 @@ public:
      */
     virtual float GetBField(const CartesianVector &positionVector) const = 0;
 
+    /**
+     *  @brief  Get the bfield values for a number of position vectors. The default implementation calls GetBField for each position in turn.
+     * 
+     *  @param  positionVectors the specified positions
+     *  @param  bFieldValues to receive the bfield values, units Tesla, in the order of the specified positions
+     */
+    virtual void GetBFieldValues(const CartesianPointVector &positionVectors, FloatVector &bFieldValues) const;
+
 protected:
     friend class PluginManager;
 };
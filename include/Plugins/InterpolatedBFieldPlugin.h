@@ -0,0 +1,104 @@
+/**
+ *  @file   PandoraSDK/include/Plugins/InterpolatedBFieldPlugin.h
+ *
+ *  @brief  Header file for the interpolated bfield plugin class.
+ *
+ *  $Log: $
+ */
+#ifndef PANDORA_INTERPOLATED_BFIELD_PLUGIN_H
+#define PANDORA_INTERPOLATED_BFIELD_PLUGIN_H 1
+
+#include "Plugins/BFieldPlugin.h"
+
+namespace pandora
+{
+
+/**
+ *  @brief  InterpolatedBFieldPlugin class, wrapping the registered bfield plugin. The wrapped plugin is sampled once, at initialization, at
+ *          the nodes of a regular grid spanning the sub detectors, either in (r, z), for an axially symmetric field, or in (x, y, z). The
+ *          bfield within the grid is then obtained by linear interpolation between the nodes, whilst the bfield outside the grid is still
+ *          obtained from the wrapped plugin. Created by the plugin manager if an InterpolatedBFieldPlugin xml element is provided.
+ */
+class InterpolatedBFieldPlugin : public BFieldPlugin
+{
+public:
+    float GetBField(const CartesianVector &positionVector) const;
+    void GetBFieldValues(const CartesianPointVector &positionVectors, FloatVector &bFieldValues) const;
+
+private:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  pBFieldPlugin address of the wrapped bfield plugin
+     */
+    InterpolatedBFieldPlugin(const BFieldPlugin *const pBFieldPlugin);
+
+    StatusCode ReadSettings(const TiXmlHandle xmlHandle);
+    StatusCode Initialize();
+
+    /**
+     *  @brief  Get the extents of the sub detectors, as the maximum radius and maximum absolute z coordinate
+     *
+     *  @param  maxR to receive the maximum radius
+     *  @param  maxZ to receive the maximum absolute z coordinate
+     */
+    StatusCode GetSubDetectorExtents(float &maxR, float &maxZ) const;
+
+    /**
+     *  @brief  Sample the wrapped bfield plugin at the grid nodes
+     */
+    void FillGrid();
+
+    /**
+     *  @brief  Compare the interpolated bfield with that of the wrapped plugin at a number of grid cell centres, where the interpolation is
+     *          least accurate. For a (r, z) grid, each cell centre is checked at a number of phi values, so that a wrapped bfield that is
+     *          not axially symmetric is rejected.
+     */
+    StatusCode CheckAccuracy() const;
+
+    /**
+     *  @brief  Get the bfield by interpolation between the grid nodes, or from the wrapped plugin if the position lies outside the grid
+     *
+     *  @param  positionVector the specified position
+     *
+     *  @return the bfield, units Tesla
+     */
+    float GetInterpolatedBField(const CartesianVector &positionVector) const;
+
+    /**
+     *  @brief  Locate a coordinate within the grid cells along one axis
+     *
+     *  @param  coordinate the coordinate
+     *  @param  low the low edge of the grid along the axis
+     *  @param  nBins the number of grid cells along the axis
+     *  @param  cellSize the grid cell size along the axis
+     *  @param  bin to receive the index of the grid cell containing the coordinate
+     *  @param  fraction to receive the fractional position of the coordinate within the grid cell
+     *
+     *  @return whether the coordinate lies within the grid
+     */
+    static bool LocateInGrid(const float coordinate, const float low, const unsigned int nBins, const float cellSize, unsigned int &bin,
+        float &fraction);
+
+    const BFieldPlugin *const   m_pBFieldPlugin;            ///< Address of the wrapped bfield plugin
+
+    bool                        m_useRZGrid;                ///< Whether to use a grid in (r, z), assuming an axially symmetric bfield
+    unsigned int                m_nBinsR;                   ///< The number of grid cells in r, for a (r, z) grid
+    unsigned int                m_nBinsXY;                  ///< The number of grid cells in each of x and y, for a (x, y, z) grid
+    unsigned int                m_nBinsZ;                   ///< The number of grid cells in z
+    float                       m_maxR;                     ///< The maximum radius covered by the grid, zero to take the sub detector extents
+    float                       m_maxZ;                     ///< The maximum absolute z coordinate covered by the grid, zero to take the sub detector extents
+    unsigned int                m_nAccuracyCheckPoints;     ///< The number of grid cell centres at which to check the interpolation accuracy
+    unsigned int                m_nAccuracyCheckPhiValues;  ///< The number of phi values at which to check each cell centre, for a (r, z) grid
+    float                       m_maxBFieldDeviation;       ///< The maximum allowed deviation from the wrapped plugin at the check points, units Tesla
+
+    float                       m_cellSizeR;                ///< The grid cell size in r, or in each of x and y, units mm
+    float                       m_cellSizeZ;                ///< The grid cell size in z, units mm
+    FloatVector                 m_gridBField;               ///< The bfield at the grid nodes, with r (or x, then y) varying fastest
+
+    friend class PluginManager;
+};
+
+} // namespace pandora
+
+#endif // #ifndef PANDORA_INTERPOLATED_BFIELD_PLUGIN_H
@@ -29,6 +29,15 @@ public:
      */
     virtual unsigned int GetPseudoLayer(const CartesianVector &positionVector) const = 0;
 
+    /**
+     *  @brief  Get the appropriate pseudolayers for a number of position vectors. The default implementation calls GetPseudoLayer for each
+     *          position in turn.
+     * 
+     *  @param  positionVectors the specified positions
+     *  @param  pseudoLayers to receive the pseudolayers, in the order of the specified positions
+     */
+    virtual void GetPseudoLayers(const CartesianPointVector &positionVectors, UIntVector &pseudoLayers) const;
+
     /**
      *  @brief  Get the pseudolayer assigned to a point at the ip, i.e. the initial offset for pseudolayer values
      *          and the start of the pseudolayer scale
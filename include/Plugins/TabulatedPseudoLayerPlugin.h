@@ -0,0 +1,172 @@
+/**
+ *  @file   PandoraSDK/include/Plugins/TabulatedPseudoLayerPlugin.h
+ *
+ *  @brief  Header file for the tabulated pseudo layer plugin class.
+ *
+ *  $Log: $
+ */
+#ifndef PANDORA_TABULATED_PSEUDO_LAYER_PLUGIN_H
+#define PANDORA_TABULATED_PSEUDO_LAYER_PLUGIN_H 1
+
+#include "Plugins/PseudoLayerPlugin.h"
+
+namespace pandora
+{
+
+/**
+ *  @brief  TabulatedPseudoLayerPlugin class, wrapping the registered pseudo layer plugin with a lookup table. The sub detector extents and
+ *          layers provide boundaries in polygonal radius (w.r.t. a reference barrel polygon) and in absolute z coordinate. The plane of
+ *          these two coordinates is divided into fixed width bins, and a bin is tabulated only if no boundary passes through it, so that
+ *          the whole bin lies inside a single layer; the pseudolayer of each such region is taken from the wrapped plugin. Positions in
+ *          bins crossed by a boundary, or beyond the outermost boundaries, are passed to the wrapped plugin.
+ *
+ *          The table therefore reproduces the wrapped plugin exactly, provided that the wrapped pseudolayer changes only at the sub
+ *          detector boundaries. Boundaries of sub detectors with a symmetry different to the reference polygon are widened to cover all
+ *          azimuthal angles. Barrel layers are taken to be measured w.r.t. the reference polygon, as in linear collider pseudo layer
+ *          plugins, unless ReferenceBarrelLayers is set false via xml. Created by the plugin manager if a TabulatedPseudoLayerPlugin xml
+ *          element is provided.
+ */
+class TabulatedPseudoLayerPlugin : public PseudoLayerPlugin
+{
+public:
+    unsigned int GetPseudoLayer(const CartesianVector &positionVector) const;
+    void GetPseudoLayers(const CartesianPointVector &positionVectors, UIntVector &pseudoLayers) const;
+    unsigned int GetPseudoLayerAtIp() const;
+
+private:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  pPseudoLayerPlugin address of the wrapped pseudo layer plugin
+     */
+    TabulatedPseudoLayerPlugin(const PseudoLayerPlugin *const pPseudoLayerPlugin);
+
+    StatusCode ReadSettings(const TiXmlHandle xmlHandle);
+    StatusCode Initialize();
+
+    /**
+     *  @brief  Boundary class, the range of a coordinate covered by a sub detector surface
+     */
+    class Boundary
+    {
+    public:
+        float   m_low;      ///< The lowest coordinate value on the surface
+        float   m_high;     ///< The highest coordinate value on the surface
+    };
+
+    typedef std::vector<Boundary> BoundaryVector;
+
+    /**
+     *  @brief  Set the reference barrel polygon, using the inner edge of the ecal barrel unless specified via xml
+     */
+    void SetReferencePolygon();
+
+    /**
+     *  @brief  Collect the boundaries in polygonal radius and absolute z coordinate, from the sub detector extents and layers
+     *
+     *  @param  rBoundaries to receive the boundaries in polygonal radius
+     *  @param  zBoundaries to receive the boundaries in absolute z coordinate
+     */
+    StatusCode GetBoundaries(BoundaryVector &rBoundaries, BoundaryVector &zBoundaries) const;
+
+    /**
+     *  @brief  Add the boundary in polygonal radius of a barrel polygon surface, covering all azimuthal angles
+     *
+     *  @param  distance the distance of the sides of the barrel polygon from the z axis
+     *  @param  symmetryOrder the order of symmetry of the barrel polygon, below three for a cylinder
+     *  @param  symmetryPhi the angle of the normal to the first side of the barrel polygon
+     *  @param  rBoundaries the boundaries in polygonal radius, to receive the new boundary
+     */
+    void AddRBoundary(const float distance, const unsigned int symmetryOrder, const float symmetryPhi, BoundaryVector &rBoundaries) const;
+
+    /**
+     *  @brief  Divide an axis into fixed width bins, recording for each bin the index of the region between boundaries containing it
+     *
+     *  @param  boundaries the boundaries along the axis
+     *  @param  binRegions to receive the region index for each bin, or UNTABULATED for bins crossed by a boundary
+     *  @param  regionCentres to receive the central coordinate of each region
+     */
+    void FillAxis(BoundaryVector boundaries, UIntVector &binRegions, FloatVector &regionCentres) const;
+
+    /**
+     *  @brief  Take the pseudolayer of each region from the wrapped plugin, at the region centre, over a number of azimuthal angles and at
+     *          positive and negative z coordinates; a region is left untabulated if the wrapped plugin does not return a single value
+     *
+     *  @param  rRegionCentres the central polygonal radius of each region along the polygonal radius axis
+     *  @param  zRegionCentres the central absolute z coordinate of each region along the z axis
+     */
+    void FillTable(const FloatVector &rRegionCentres, const FloatVector &zRegionCentres);
+
+    /**
+     *  @brief  Compare the tabulated pseudolayers with those of the wrapped plugin at a number of positions spread through the table
+     */
+    StatusCode CheckAccuracy() const;
+
+    /**
+     *  @brief  Get the pseudolayer from the table, or from the wrapped plugin if the position lies in an untabulated bin
+     *
+     *  @param  positionVector the specified position
+     *
+     *  @return the pseudolayer
+     */
+    unsigned int GetTabulatedPseudoLayer(const CartesianVector &positionVector) const;
+
+    /**
+     *  @brief  Get the polygonal radius of a position, i.e. the largest projection of its x and y coordinates onto the normals to the
+     *          sides of the reference barrel polygon, or the cylindrical radius if no polygon is defined
+     *
+     *  @param  x the x coordinate
+     *  @param  y the y coordinate
+     *
+     *  @return the polygonal radius
+     */
+    float GetPolygonalRadius(const float x, const float y) const;
+
+    /**
+     *  @brief  Get the position with a specified polygonal radius, azimuthal angle and z coordinate
+     *
+     *  @param  polygonalRadius the polygonal radius
+     *  @param  phi the azimuthal angle
+     *  @param  z the z coordinate
+     *
+     *  @return the position
+     */
+    CartesianVector GetPosition(const float polygonalRadius, const float phi, const float z) const;
+
+    /**
+     *  @brief  Get the region index of the bin containing a coordinate
+     *
+     *  @param  binRegions the region index for each bin
+     *  @param  coordinate the coordinate
+     *
+     *  @return the region index, or UNTABULATED if the bin is crossed by a boundary or the coordinate lies outside the binned range
+     */
+    unsigned int GetRegion(const UIntVector &binRegions, const float coordinate) const;
+
+    static const unsigned int UNTABULATED;                      ///< The table entry for bins in which the wrapped plugin must be used
+
+    const PseudoLayerPlugin *const  m_pPseudoLayerPlugin;       ///< Address of the wrapped pseudo layer plugin
+
+    bool                            m_useEcalBarrelSymmetry;    ///< Whether to take the reference polygon from the ecal barrel inner edge
+    bool                            m_referenceBarrelLayers;    ///< Whether barrel layers are measured w.r.t. the reference polygon
+    unsigned int                    m_symmetryOrder;            ///< The order of symmetry of the reference polygon, below three for none
+    float                           m_symmetryPhi;              ///< The angle of the normal to the first side of the reference polygon
+    float                           m_binWidth;                 ///< The width of the bins in polygonal radius and absolute z, units mm
+    float                           m_boundaryTolerance;        ///< The distance by which boundaries are widened, units mm
+    unsigned int                    m_nPhiSamples;              ///< The number of azimuthal angles at which region pseudolayers are taken
+    unsigned int                    m_nAccuracyCheckPoints;     ///< The number of positions at which to check the tabulated pseudolayers
+
+    float                           m_inverseBinWidth;          ///< The inverse of the bin width, units mm^-1
+    FloatVector                     m_sideNormalX;              ///< The x components of the normals to the sides of the reference polygon
+    FloatVector                     m_sideNormalY;              ///< The y components of the normals to the sides of the reference polygon
+    UIntVector                      m_rBinRegions;              ///< The region index of each bin in polygonal radius
+    UIntVector                      m_zBinRegions;              ///< The region index of each bin in absolute z coordinate
+    unsigned int                    m_nRRegions;                ///< The number of regions in polygonal radius
+    UIntVector                      m_regionPseudoLayers;       ///< The region pseudolayers, polygonal radius varying fastest
+
+    friend class PluginManager;
+};
+
+} // namespace pandora
+
+#endif // #ifndef PANDORA_TABULATED_PSEUDO_LAYER_PLUGIN_H
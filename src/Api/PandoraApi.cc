@@ -56,6 +56,13 @@ pandora::StatusCode PandoraApi::RegisterAlgorithmToolFactory(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+pandora::StatusCode PandoraApi::CreateCaloHits(const pandora::Pandora &pandora, const pandora::CaloHitBlock &caloHitBlock)
+{
+    return pandora.GetPandoraApiImpl()->CreateCaloHits(caloHitBlock);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 pandora::StatusCode PandoraApi::SetMCParentDaughterRelationship(
     const pandora::Pandora &pandora, const void *const pParentAddress, const void *const pDaughterAddress)
 {
@@ -126,6 +133,13 @@ pandora::StatusCode PandoraApi::SetHitTypeGranularity(const pandora::Pandora &pa
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+pandora::StatusCode PandoraApi::ShareGeometry(const pandora::Pandora &sourcePandora, const pandora::Pandora &targetPandora)
+{
+    return targetPandora.GetPandoraApiImpl()->ShareGeometry(sourcePandora);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 pandora::StatusCode PandoraApi::SetBFieldPlugin(const pandora::Pandora &pandora, pandora::BFieldPlugin *const pBFieldPlugin)
 {
     return pandora.GetPandoraApiImpl()->SetBFieldPlugin(pBFieldPlugin);
@@ -97,6 +97,13 @@ StatusCode PandoraApiImpl::Create(const PARAMETERS & /*parameters*/, const Objec
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode PandoraApiImpl::CreateCaloHits(const CaloHitBlock &caloHitBlock) const
+{
+    return m_pPandora->m_pCaloHitManager->Create(caloHitBlock);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode PandoraApiImpl::ProcessEvent() const
 {
     return m_pPandora->ProcessEvent();
@@ -197,6 +204,13 @@ StatusCode PandoraApiImpl::SetHitTypeGranularity(const HitType hitType, const Gr
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode PandoraApiImpl::ShareGeometry(const Pandora &sourcePandora) const
+{
+    return m_pPandora->m_pGeometryManager->ShareContent(*(sourcePandora.m_pGeometryManager));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode PandoraApiImpl::SetBFieldPlugin(BFieldPlugin *const pBFieldPlugin) const
 {
     return m_pPandora->m_pPluginManager->SetBFieldPlugin(pBFieldPlugin);
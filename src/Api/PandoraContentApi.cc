@@ -79,7 +79,7 @@ pandora::StatusCode PandoraContentApi::CreateAlgorithmTool(const pandora::Algori
 pandora::StatusCode PandoraContentApi::CreateDaughterAlgorithm(const pandora::Algorithm &algorithm, pandora::TiXmlElement *const pXmlElement,
     std::string &daughterAlgorithmName)
 {
-    return algorithm.GetPandora().GetPandoraContentApiImpl()->CreateDaughterAlgorithm(pXmlElement, daughterAlgorithmName);
+    return algorithm.GetPandora().GetPandoraContentApiImpl()->CreateDaughterAlgorithm(algorithm, pXmlElement, daughterAlgorithmName);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -91,6 +91,13 @@ pandora::StatusCode PandoraContentApi::RunDaughterAlgorithm(const pandora::Algor
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+pandora::StatusCode PandoraContentApi::RunDaughterAlgorithmGroup(const pandora::Algorithm &algorithm, const pandora::DaughterAlgorithmGroup &daughterAlgorithmGroup)
+{
+    return algorithm.GetPandora().GetPandoraContentApiImpl()->RunAlgorithmGroup(algorithm, daughterAlgorithmGroup);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 pandora::StatusCode PandoraContentApi::RunClusteringAlgorithm(const pandora::Algorithm &algorithm, const std::string &clusteringAlgorithmName,
     const pandora::ClusterList *&pNewClusterList, std::string &newClusterListName)
 {
@@ -223,6 +230,14 @@ bool PandoraContentApi::IsAvailable(const pandora::Algorithm &algorithm, const T
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+pandora::StatusCode PandoraContentApi::GetNIndices(const pandora::Algorithm &algorithm, unsigned int &nIndices)
+{
+    return algorithm.GetPandora().GetPandoraContentApiImpl()->GetNIndices<T>(nIndices);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 pandora::StatusCode PandoraContentApi::Delete(const pandora::Algorithm &algorithm, const T *const pT)
 {
@@ -280,6 +295,15 @@ pandora::StatusCode PandoraContentApi::Fragment(const pandora::Algorithm &algori
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+pandora::StatusCode PandoraContentApi::Fragment(const pandora::Algorithm &algorithm, const pandora::CaloHitVector &originalCaloHits,
+    const pandora::FloatVector &fractions1, pandora::CaloHitVector &daughterCaloHits1, pandora::CaloHitVector &daughterCaloHits2,
+    const pandora::ObjectFactory<object_creation::CaloHitFragment::Parameters, object_creation::CaloHitFragment::Object> &factory)
+{
+    return algorithm.GetPandora().GetPandoraContentApiImpl()->Fragment(originalCaloHits, fractions1, daughterCaloHits1, daughterCaloHits2, factory);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 pandora::StatusCode PandoraContentApi::MergeFragments(const pandora::Algorithm &algorithm, const pandora::CaloHit *const pFragmentCaloHit1,
     const pandora::CaloHit *const pFragmentCaloHit2, const pandora::CaloHit *&pMergedCaloHit,
     const pandora::ObjectFactory<object_creation::CaloHitFragment::Parameters, object_creation::CaloHitFragment::Object> &factory)
@@ -289,6 +313,22 @@ pandora::StatusCode PandoraContentApi::MergeFragments(const pandora::Algorithm &
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+pandora::StatusCode PandoraContentApi::GetCaloHitsInRange(const pandora::Algorithm &algorithm, const std::string &listName,
+    const pandora::HitType hitType, const pandora::CartesianVector &position, const float distance, pandora::CaloHitVector &caloHitVector)
+{
+    return algorithm.GetPandora().GetPandoraContentApiImpl()->GetCaloHitsInRange(listName, hitType, position, distance, caloHitVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+pandora::StatusCode PandoraContentApi::GetNearestCaloHits(const pandora::Algorithm &algorithm, const std::string &listName,
+    const pandora::HitType hitType, const pandora::CartesianVector &position, const unsigned int nCaloHits, pandora::CaloHitVector &caloHitVector)
+{
+    return algorithm.GetPandora().GetPandoraContentApiImpl()->GetNearestCaloHits(listName, hitType, position, nCaloHits, caloHitVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 pandora::StatusCode PandoraContentApi::AddTrackClusterAssociation(const pandora::Algorithm &algorithm, const pandora::Track *const pTrack,
     const pandora::Cluster *const pCluster)
 {
@@ -493,6 +533,10 @@ template bool PandoraContentApi::IsAvailable<pandora::ClusterList>(const pandora
 template bool PandoraContentApi::IsAvailable<pandora::Vertex>(const pandora::Algorithm &, const pandora::Vertex *);
 template bool PandoraContentApi::IsAvailable<pandora::VertexList>(const pandora::Algorithm &, const pandora::VertexList *);
 
+template pandora::StatusCode PandoraContentApi::GetNIndices<pandora::CaloHit>(const pandora::Algorithm &, unsigned int &);
+template pandora::StatusCode PandoraContentApi::GetNIndices<pandora::Track>(const pandora::Algorithm &, unsigned int &);
+template pandora::StatusCode PandoraContentApi::GetNIndices<pandora::MCParticle>(const pandora::Algorithm &, unsigned int &);
+
 template pandora::StatusCode PandoraContentApi::Delete<pandora::Cluster>(const pandora::Algorithm &, const pandora::Cluster *);
 template pandora::StatusCode PandoraContentApi::Delete<pandora::ClusterList>(const pandora::Algorithm &, const pandora::ClusterList *);
 template pandora::StatusCode PandoraContentApi::Delete<pandora::ParticleFlowObject>(const pandora::Algorithm &, const pandora::ParticleFlowObject *);
@@ -26,6 +26,7 @@
 
 #include "Pandora/Algorithm.h"
 #include "Pandora/AlgorithmTool.h"
+#include "Pandora/DaughterAlgorithmGroup.h"
 #include "Pandora/ObjectFactory.h"
 #include "Pandora/Pandora.h"
 #include "Pandora/PandoraSettings.h"
@@ -234,9 +235,13 @@ StatusCode PandoraContentApiImpl::CreateAlgorithmTool(TiXmlElement *const pXmlEl
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode PandoraContentApiImpl::CreateDaughterAlgorithm(TiXmlElement *const pXmlElement, std::string &daughterAlgorithmName) const
+StatusCode PandoraContentApiImpl::CreateDaughterAlgorithm(const Algorithm &parentAlgorithm, TiXmlElement *const pXmlElement,
+    std::string &daughterAlgorithmName) const
 {
-    return m_pPandora->m_pAlgorithmManager->CreateAlgorithm(pXmlElement, daughterAlgorithmName);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pAlgorithmManager->CreateAlgorithm(pXmlElement, daughterAlgorithmName));
+    m_pPandora->m_pAlgorithmManager->m_daughterAlgorithmMap[&parentAlgorithm].insert(daughterAlgorithmName);
+
+    return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -250,6 +255,11 @@ StatusCode PandoraContentApiImpl::RunAlgorithm(const std::string &algorithmName)
 
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->PreRunAlgorithm(iter->second));
 
+    const bool shouldProfileAlgorithm(m_pPandora->GetSettings()->ShouldProfileAlgorithms());
+
+    if (shouldProfileAlgorithm)
+        this->BeginAlgorithmProfile(iter->second);
+
     try
     {
         const bool shouldDisplayAlgorithmInfo(m_pPandora->GetSettings()->ShouldDisplayAlgorithmInfo());
@@ -271,6 +281,10 @@ StatusCode PandoraContentApiImpl::RunAlgorithm(const std::string &algorithmName)
     {
         std::cout << "Algorithm " << iter->first << ", " << iter->second->GetType() << " raised stop processing exception: "
                   << exception.GetDescription() << std::endl;
+
+        if (shouldProfileAlgorithm)
+            this->EndAlgorithmProfile();
+
         throw exception;
     }
     catch (...)
@@ -278,13 +292,97 @@ StatusCode PandoraContentApiImpl::RunAlgorithm(const std::string &algorithmName)
         std::cout << "Failure in algorithm " << iter->first << ", " << iter->second->GetType() << ", unknown exception" << std::endl;
     }
 
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->PostRunAlgorithm(iter->second));
+    // ATTN Profiles include the deletion of temporary objects once the algorithm completes
+    const StatusCode postRunStatusCode(this->PostRunAlgorithm(iter->second));
+
+    if (shouldProfileAlgorithm)
+        this->EndAlgorithmProfile();
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, postRunStatusCode);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode PandoraContentApiImpl::RunAlgorithmGroup(const Algorithm &parentAlgorithm, const DaughterAlgorithmGroup &daughterAlgorithmGroup) const
+{
+    if (!this->GetManager<CaloHit>()->m_algorithmInfoMap.count(&parentAlgorithm))
+    {
+        std::cout << "Algorithm " << parentAlgorithm.GetInstanceName() << " is not running, so cannot run a daughter algorithm group" << std::endl;
+        return STATUS_CODE_NOT_ALLOWED;
+    }
+
+    const AlgorithmManager::DaughterAlgorithmMap &daughterAlgorithmMap(m_pPandora->m_pAlgorithmManager->m_daughterAlgorithmMap);
+    const AlgorithmManager::DaughterAlgorithmMap::const_iterator parentIter(daughterAlgorithmMap.find(&parentAlgorithm));
+
+    DaughterAlgorithmGroup::StageVector stageVector;
+    daughterAlgorithmGroup.GetStages(stageVector);
+
+    for (const StringVector &stage : stageVector)
+    {
+        for (const std::string &algorithmName : stage)
+        {
+            if ((daughterAlgorithmMap.end() == parentIter) || !parentIter->second.count(algorithmName))
+            {
+                std::cout << "Algorithm " << algorithmName << " is not a daughter of algorithm " << parentAlgorithm.GetInstanceName() << std::endl;
+                return STATUS_CODE_NOT_ALLOWED;
+            }
+        }
+    }
+
+    // ATTN Algorithms within a stage are independent, by their declared lists, so are simply run in turn in the order they were added
+    for (const StringVector &stage : stageVector)
+    {
+        for (const std::string &algorithmName : stage)
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RunGroupedAlgorithm(algorithmName, daughterAlgorithmGroup));
+    }
 
     return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode PandoraContentApiImpl::RunGroupedAlgorithm(const std::string &algorithmName, const DaughterAlgorithmGroup &daughterAlgorithmGroup) const
+{
+    ListStateVector listStateVector;
+    this->GetListStates(listStateVector);
+
+    // ATTN Record the accesses of this algorithm alone, then add them to those of any enclosing grouped algorithm
+    const ListAccess enclosingListAccess(m_listAccess);
+    m_listAccess.m_isRecording = true;
+    m_listAccess.m_readListNames.clear();
+    m_listAccess.m_writtenListNames.clear();
+
+    StatusCode runStatusCode(STATUS_CODE_FAILURE);
+
+    try
+    {
+        runStatusCode = this->RunAlgorithm(algorithmName);
+    }
+    catch (...)
+    {
+        m_listAccess = enclosingListAccess;
+        throw;
+    }
+
+    const ListAccess listAccess(m_listAccess);
+    m_listAccess = enclosingListAccess;
+
+    if (m_listAccess.m_isRecording)
+    {
+        m_listAccess.m_readListNames.insert(listAccess.m_readListNames.begin(), listAccess.m_readListNames.end());
+        m_listAccess.m_writtenListNames.insert(listAccess.m_writtenListNames.begin(), listAccess.m_writtenListNames.end());
+    }
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, runStatusCode);
+
+    return this->CheckListStates(algorithmName, daughterAlgorithmGroup.GetInputListNames(algorithmName),
+        daughterAlgorithmGroup.GetOutputListNames(algorithmName), listStateVector, listAccess);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode PandoraContentApiImpl::RunClusteringAlgorithm(const Algorithm &algorithm, const std::string &clusteringAlgorithmName,
     const ClusterList *&pNewClusterList, std::string &newClusterListName) const
 {
@@ -301,6 +399,7 @@ StatusCode PandoraContentApiImpl::RunClusteringAlgorithm(const Algorithm &algori
 template <typename T>
 StatusCode PandoraContentApiImpl::GetCurrentList(const T *&pT, std::string &listName) const
 {
+    this->RecordCurrentListRead<T>();
     return this->GetManager<T>()->GetCurrentList(pT, listName);
 }
 
@@ -317,6 +416,7 @@ StatusCode PandoraContentApiImpl::GetCurrentListName(std::string &listName) cons
 template <typename T>
 StatusCode PandoraContentApiImpl::ReplaceCurrentList(const Algorithm &algorithm, const std::string &newListName) const
 {
+    this->RecordListRead<T>(newListName);
     return this->GetManager<T>()->ReplaceCurrentAndAlgorithmInputLists(&algorithm, newListName);
 }
 
@@ -333,6 +433,7 @@ StatusCode PandoraContentApiImpl::DropCurrentList(const Algorithm &algorithm) co
 template <typename T>
 StatusCode PandoraContentApiImpl::GetList(const std::string &listName, const T *&pT) const
 {
+    this->RecordListRead<T>(listName);
     return this->GetManager<T>()->GetList(listName, pT);
 }
 
@@ -341,7 +442,11 @@ StatusCode PandoraContentApiImpl::GetList(const std::string &listName, const T *
 template <typename T>
 StatusCode PandoraContentApiImpl::RenameList(const std::string &oldListName, const std::string &newListName) const
 {
-    return this->GetManager<T>()->RenameList(oldListName, newListName);
+    this->RecordListWrite<T>(oldListName);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetManager<T>()->RenameList(oldListName, newListName));
+    this->RecordListWrite<T>(newListName);
+
+    return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -349,7 +454,10 @@ StatusCode PandoraContentApiImpl::RenameList(const std::string &oldListName, con
 template <typename T>
 StatusCode PandoraContentApiImpl::SaveList(const T &t, const std::string &newListName) const
 {
-    return this->GetManager<T>()->SaveList(newListName, t);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetManager<T>()->SaveList(newListName, t));
+    this->RecordListWrite<T>(newListName);
+
+    return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -359,7 +467,11 @@ StatusCode PandoraContentApiImpl::SaveList(const std::string &newListName) const
 {
     std::string currentListName;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetManager<T>()->GetCurrentListName(currentListName));
-    return this->GetManager<T>()->SaveObjects(newListName, currentListName);
+    this->RecordListWrite<T>(currentListName);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetManager<T>()->SaveObjects(newListName, currentListName));
+    this->RecordListWrite<T>(newListName);
+
+    return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -367,7 +479,11 @@ StatusCode PandoraContentApiImpl::SaveList(const std::string &newListName) const
 template <typename T>
 StatusCode PandoraContentApiImpl::SaveList(const std::string &oldListName, const std::string &newListName) const
 {
-    return this->GetManager<T>()->SaveObjects(newListName, oldListName);
+    this->RecordListWrite<T>(oldListName);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetManager<T>()->SaveObjects(newListName, oldListName));
+    this->RecordListWrite<T>(newListName);
+
+    return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -377,7 +493,11 @@ StatusCode PandoraContentApiImpl::SaveList(const std::string &newListName, const
 {
     std::string currentListName;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetManager<T>()->GetCurrentListName(currentListName));
-    return this->GetManager<T>()->SaveObjects(newListName, currentListName, t);
+    this->RecordListWrite<T>(currentListName);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetManager<T>()->SaveObjects(newListName, currentListName, t));
+    this->RecordListWrite<T>(newListName);
+
+    return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -385,7 +505,11 @@ StatusCode PandoraContentApiImpl::SaveList(const std::string &newListName, const
 template <typename T>
 StatusCode PandoraContentApiImpl::SaveList(const std::string &oldListName, const std::string &newListName, const T &t) const
 {
-    return this->GetManager<T>()->SaveObjects(newListName, oldListName, t);
+    this->RecordListWrite<T>(oldListName);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetManager<T>()->SaveObjects(newListName, oldListName, t));
+    this->RecordListWrite<T>(newListName);
+
+    return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -393,6 +517,7 @@ StatusCode PandoraContentApiImpl::SaveList(const std::string &oldListName, const
 template <typename T>
 StatusCode PandoraContentApiImpl::TemporarilyReplaceCurrentList(const std::string &newListName) const
 {
+    this->RecordListRead<T>(newListName);
     return this->GetManager<T>()->TemporarilyReplaceCurrentList(newListName);
 }
 
@@ -415,6 +540,15 @@ bool PandoraContentApiImpl::IsAvailable(const T *const pT) const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+StatusCode PandoraContentApiImpl::GetNIndices(unsigned int &nIndices) const
+{
+    nIndices = this->GetManager<T>()->GetNIndices();
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <>
 StatusCode PandoraContentApiImpl::AddToCluster(const Cluster *const pCluster, const CaloHitList *const pCaloHitList) const
 {
@@ -503,6 +637,14 @@ StatusCode PandoraContentApiImpl::Fragment(const CaloHit *const pOriginalCaloHit
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode PandoraContentApiImpl::Fragment(const CaloHitVector &originalCaloHits, const FloatVector &fractions1, CaloHitVector &daughterCaloHits1,
+    CaloHitVector &daughterCaloHits2, const ObjectFactory<object_creation::CaloHitFragment::Parameters, object_creation::CaloHitFragment::Object> &factory) const
+{
+    return this->GetManager<CaloHit>()->FragmentCaloHits(originalCaloHits, fractions1, daughterCaloHits1, daughterCaloHits2, factory);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode PandoraContentApiImpl::MergeFragments(const CaloHit *const pFragmentCaloHit1, const CaloHit *const pFragmentCaloHit2,
     const CaloHit *&pMergedCaloHit, const ObjectFactory<object_creation::CaloHitFragment::Parameters, object_creation::CaloHitFragment::Object> &factory) const
 {
@@ -511,6 +653,24 @@ StatusCode PandoraContentApiImpl::MergeFragments(const CaloHit *const pFragmentC
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode PandoraContentApiImpl::GetCaloHitsInRange(const std::string &listName, const HitType hitType, const CartesianVector &position,
+    const float distance, CaloHitVector &caloHitVector) const
+{
+    this->RecordListRead<CaloHit>(listName);
+    return this->GetManager<CaloHit>()->GetCaloHitsInRange(listName, hitType, position, distance, caloHitVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode PandoraContentApiImpl::GetNearestCaloHits(const std::string &listName, const HitType hitType, const CartesianVector &position,
+    const unsigned int nCaloHits, CaloHitVector &caloHitVector) const
+{
+    this->RecordListRead<CaloHit>(listName);
+    return this->GetManager<CaloHit>()->GetNearestCaloHits(listName, hitType, position, nCaloHits, caloHitVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode PandoraContentApiImpl::AddTrackClusterAssociation(const Track *const pTrack, const Cluster *const pCluster) const
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetManager<Track>()->SetAssociatedCluster(pTrack, pCluster));
@@ -586,6 +746,9 @@ StatusCode PandoraContentApiImpl::MergeAndDeleteClusters(const Cluster *const pC
     if ((pClusterToEnlarge == pClusterToDelete) || !this->GetManager<Cluster>()->IsAvailable(pClusterToDelete))
         return STATUS_CODE_NOT_ALLOWED;
 
+    this->RecordListWrite<Cluster>(enlargeListName);
+    this->RecordListWrite<Cluster>(deleteListName);
+
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetManager<Track>()->RemoveClusterAssociations(pClusterToDelete->GetAssociatedTrackList()));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetManager<Cluster>()->MergeAndDeleteClusters(pClusterToEnlarge, pClusterToDelete,
         enlargeListName, deleteListName));
@@ -637,6 +800,7 @@ StatusCode PandoraContentApiImpl::RemovePfoParentDaughterRelationship(const Part
 PandoraContentApiImpl::PandoraContentApiImpl(Pandora *const pPandora) :
     m_pPandora(pPandora)
 {
+    m_listAccess.m_isRecording = false;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -762,6 +926,7 @@ StatusCode PandoraContentApiImpl::Delete(const T *const pT) const
 template <typename T>
 StatusCode PandoraContentApiImpl::Delete(const T *const pT, const std::string &listName) const
 {
+    this->RecordListWrite<T>(listName);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->PrepareForDeletion(pT));
     return this->GetManager<T>()->DeleteObject(pT, listName);
 }
@@ -769,6 +934,7 @@ StatusCode PandoraContentApiImpl::Delete(const T *const pT, const std::string &l
 template <>
 StatusCode PandoraContentApiImpl::Delete(const ClusterList *const pT, const std::string &listName) const
 {
+    this->RecordListWrite<ClusterList>(listName);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->PrepareForDeletion(pT));
     return this->GetManager<ClusterList>()->DeleteObjects(*pT, listName);
 }
@@ -776,6 +942,7 @@ StatusCode PandoraContentApiImpl::Delete(const ClusterList *const pT, const std:
 template <>
 StatusCode PandoraContentApiImpl::Delete(const PfoList *const pT, const std::string &listName) const
 {
+    this->RecordListWrite<PfoList>(listName);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->PrepareForDeletion(pT));
     return this->GetManager<PfoList>()->DeleteObjects(*pT, listName);
 }
@@ -783,6 +950,7 @@ StatusCode PandoraContentApiImpl::Delete(const PfoList *const pT, const std::str
 template <>
 StatusCode PandoraContentApiImpl::Delete(const VertexList *const pT, const std::string &listName) const
 {
+    this->RecordListWrite<VertexList>(listName);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->PrepareForDeletion(pT));
     return this->GetManager<VertexList>()->DeleteObjects(*pT, listName);
 }
@@ -794,6 +962,7 @@ StatusCode PandoraContentApiImpl::InitializeFragmentation(const Algorithm &algor
 {
     std::string inputClusterListName;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetManager<Cluster>()->GetAlgorithmInputListName(&algorithm, inputClusterListName));
+    this->RecordListWrite<Cluster>(inputClusterListName);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetManager<Cluster>()->MoveObjectsToTemporaryListAndSetCurrent(&algorithm, inputClusterListName, originalClustersListName, inputClusterList));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetManager<CaloHit>()->InitializeReclustering(&algorithm, inputClusterList, originalClustersListName));
 
@@ -811,6 +980,7 @@ StatusCode PandoraContentApiImpl::EndFragmentation(const Algorithm &algorithm, c
     std::string inputClusterListName;
     const ClusterList *pClustersToBeDeleted(nullptr);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetManager<Cluster>()->GetAlgorithmInputListName(&algorithm, inputClusterListName));
+    this->RecordListWrite<Cluster>(inputClusterListName);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetManager<Cluster>()->SaveObjects(inputClusterListName, clusterListToSaveName));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetManager<Cluster>()->GetList(clusterListToDeleteName, pClustersToBeDeleted));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->PrepareForReclusteringDeletion(pClustersToBeDeleted));
@@ -830,6 +1000,7 @@ StatusCode PandoraContentApiImpl::InitializeReclustering(const Algorithm &algori
 {
     std::string inputClusterListName;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetManager<Cluster>()->GetAlgorithmInputListName(&algorithm, inputClusterListName));
+    this->RecordListWrite<Cluster>(inputClusterListName);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetManager<Cluster>()->MoveObjectsToTemporaryListAndSetCurrent(&algorithm, inputClusterListName, originalClustersListName, inputClusterList));
 
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetManager<Track>()->InitializeReclustering(&algorithm, inputTrackList, originalClustersListName));
@@ -845,6 +1016,7 @@ StatusCode PandoraContentApiImpl::EndReclustering(const Algorithm &algorithm, co
     std::string inputClusterListName;
     ClusterList clustersToBeDeleted;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetManager<Cluster>()->GetAlgorithmInputListName(&algorithm, inputClusterListName));
+    this->RecordListWrite<Cluster>(inputClusterListName);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetManager<Cluster>()->SaveObjects(inputClusterListName, selectedClusterListName));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetManager<Cluster>()->GetResetDeletionObjects(&algorithm, clustersToBeDeleted));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->PrepareForReclusteringDeletion(&clustersToBeDeleted));
@@ -898,6 +1070,141 @@ StatusCode PandoraContentApiImpl::PostRunAlgorithm(Algorithm *const pAlgorithm)
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PandoraContentApiImpl::BeginAlgorithmProfile(const Algorithm *const pAlgorithm) const
+{
+    AlgorithmProfiler::ObjectCounts objectCounts;
+    this->GetObjectCounts(objectCounts);
+    m_pPandora->m_pAlgorithmProfiler->BeginAlgorithm(pAlgorithm, objectCounts);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PandoraContentApiImpl::EndAlgorithmProfile() const
+{
+    AlgorithmProfiler::ObjectCounts objectCounts;
+    this->GetObjectCounts(objectCounts);
+    m_pPandora->m_pAlgorithmProfiler->EndAlgorithm(objectCounts);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PandoraContentApiImpl::GetObjectCounts(AlgorithmProfiler::ObjectCounts &objectCounts) const
+{
+    objectCounts.m_nCreated[AlgorithmProfiler::CALO_HIT_MANAGER] = this->GetManager<CaloHit>()->m_nObjectsCreated;
+    objectCounts.m_nDeleted[AlgorithmProfiler::CALO_HIT_MANAGER] = this->GetManager<CaloHit>()->m_nObjectsDeleted;
+    objectCounts.m_nCreated[AlgorithmProfiler::TRACK_MANAGER] = this->GetManager<Track>()->m_nObjectsCreated;
+    objectCounts.m_nDeleted[AlgorithmProfiler::TRACK_MANAGER] = this->GetManager<Track>()->m_nObjectsDeleted;
+    objectCounts.m_nCreated[AlgorithmProfiler::MC_MANAGER] = this->GetManager<MCParticle>()->m_nObjectsCreated;
+    objectCounts.m_nDeleted[AlgorithmProfiler::MC_MANAGER] = this->GetManager<MCParticle>()->m_nObjectsDeleted;
+    objectCounts.m_nCreated[AlgorithmProfiler::CLUSTER_MANAGER] = this->GetManager<Cluster>()->m_nObjectsCreated;
+    objectCounts.m_nDeleted[AlgorithmProfiler::CLUSTER_MANAGER] = this->GetManager<Cluster>()->m_nObjectsDeleted;
+    objectCounts.m_nCreated[AlgorithmProfiler::PFO_MANAGER] = this->GetManager<ParticleFlowObject>()->m_nObjectsCreated;
+    objectCounts.m_nDeleted[AlgorithmProfiler::PFO_MANAGER] = this->GetManager<ParticleFlowObject>()->m_nObjectsDeleted;
+    objectCounts.m_nCreated[AlgorithmProfiler::VERTEX_MANAGER] = this->GetManager<Vertex>()->m_nObjectsCreated;
+    objectCounts.m_nDeleted[AlgorithmProfiler::VERTEX_MANAGER] = this->GetManager<Vertex>()->m_nObjectsDeleted;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PandoraContentApiImpl::GetListStates(ListStateVector &listStateVector) const
+{
+    listStateVector.resize(6);
+    this->GetListState<CaloHit>(listStateVector[0]);
+    this->GetListState<Track>(listStateVector[1]);
+    this->GetListState<MCParticle>(listStateVector[2]);
+    this->GetListState<Cluster>(listStateVector[3]);
+    this->GetListState<ParticleFlowObject>(listStateVector[4]);
+    this->GetListState<Vertex>(listStateVector[5]);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void PandoraContentApiImpl::GetListState(ListState &listState) const
+{
+    listState.m_currentListName = this->GetManager<T>()->m_currentListName;
+    listState.m_savedListNames = this->GetManager<T>()->m_savedLists;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode PandoraContentApiImpl::CheckListStates(const std::string &algorithmName, const StringSet &inputListNames,
+    const StringSet &outputListNames, const ListStateVector &listStateVector, const ListAccess &listAccess) const
+{
+    ListStateVector newListStateVector;
+    this->GetListStates(newListStateVector);
+
+    for (unsigned int iManager = 0; iManager < listStateVector.size(); ++iManager)
+    {
+        const ListState &listState(listStateVector[iManager]), &newListState(newListStateVector[iManager]);
+
+        if (listState.m_currentListName != newListState.m_currentListName)
+        {
+            std::cout << "Algorithm " << algorithmName << ", run in a group, changed current list from " << listState.m_currentListName
+                      << " to " << newListState.m_currentListName << std::endl;
+            return STATUS_CODE_NOT_ALLOWED;
+        }
+
+        for (const std::string &listName : newListState.m_savedListNames)
+        {
+            if (!listState.m_savedListNames.count(listName) && !outputListNames.count(listName))
+            {
+                std::cout << "Algorithm " << algorithmName << ", run in a group, saved undeclared output list " << listName << std::endl;
+                return STATUS_CODE_NOT_ALLOWED;
+            }
+        }
+    }
+
+    for (const std::string &listName : listAccess.m_readListNames)
+    {
+        if (!inputListNames.count(listName) && !outputListNames.count(listName))
+        {
+            std::cout << "Algorithm " << algorithmName << ", run in a group, read undeclared input list " << listName << std::endl;
+            return STATUS_CODE_NOT_ALLOWED;
+        }
+    }
+
+    for (const std::string &listName : listAccess.m_writtenListNames)
+    {
+        if (!outputListNames.count(listName))
+        {
+            std::cout << "Algorithm " << algorithmName << ", run in a group, wrote undeclared output list " << listName << std::endl;
+            return STATUS_CODE_NOT_ALLOWED;
+        }
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void PandoraContentApiImpl::RecordListRead(const std::string &listName) const
+{
+    if (m_listAccess.m_isRecording && this->GetManager<T>()->m_savedLists.count(listName))
+        m_listAccess.m_readListNames.insert(listName);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void PandoraContentApiImpl::RecordListWrite(const std::string &listName) const
+{
+    if (m_listAccess.m_isRecording && this->GetManager<T>()->m_savedLists.count(listName))
+        m_listAccess.m_writtenListNames.insert(listName);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void PandoraContentApiImpl::RecordCurrentListRead() const
+{
+    if (m_listAccess.m_isRecording)
+        this->RecordListRead<T>(this->GetManager<T>()->m_currentListName);
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -994,6 +1301,10 @@ template bool PandoraContentApiImpl::IsAvailable<TrackList>(const TrackList *) c
 template bool PandoraContentApiImpl::IsAvailable<ClusterList>(const ClusterList *) const;
 template bool PandoraContentApiImpl::IsAvailable<VertexList>(const VertexList *) const;
 
+template StatusCode PandoraContentApiImpl::GetNIndices<CaloHit>(unsigned int &) const;
+template StatusCode PandoraContentApiImpl::GetNIndices<Track>(unsigned int &) const;
+template StatusCode PandoraContentApiImpl::GetNIndices<MCParticle>(unsigned int &) const;
+
 template StatusCode PandoraContentApiImpl::AddToPfo<Cluster>(const ParticleFlowObject *, const Cluster *) const;
 template StatusCode PandoraContentApiImpl::AddToPfo<Track>(const ParticleFlowObject *, const Track *) const;
 template StatusCode PandoraContentApiImpl::AddToPfo<Vertex>(const ParticleFlowObject *, const Vertex *) const;
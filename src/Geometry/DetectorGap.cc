@@ -59,7 +59,13 @@ BoxGap::BoxGap(const object_creation::Geometry::BoxGap::Parameters &parameters)
     m_vertex(parameters.m_vertex.Get()),
     m_side1(parameters.m_side1.Get()),
     m_side2(parameters.m_side2.Get()),
-    m_side3(parameters.m_side3.Get())
+    m_side3(parameters.m_side3.Get()),
+    m_unitSide1(m_side1.GetUnitVector()),
+    m_unitSide2(m_side2.GetUnitVector()),
+    m_unitSide3(m_side3.GetUnitVector()),
+    m_side1Length(m_side1.GetMagnitude()),
+    m_side2Length(m_side2.GetMagnitude()),
+    m_side3Length(m_side3.GetMagnitude())
 {
 }
 
@@ -72,19 +78,19 @@ bool BoxGap::IsInGap(const CartesianVector &positionVector, const HitType hitTyp
 
     const CartesianVector relativePosition(positionVector - m_vertex);
 
-    const float projection1(relativePosition.GetDotProduct(m_side1.GetUnitVector()));
+    const float projection1(relativePosition.GetDotProduct(m_unitSide1));
 
-    if ((projection1 < -gapTolerance) || (projection1 > m_side1.GetMagnitude() + gapTolerance))
+    if ((projection1 < -gapTolerance) || (projection1 > m_side1Length + gapTolerance))
         return false;
 
-    const float projection2(relativePosition.GetDotProduct(m_side2.GetUnitVector()));
+    const float projection2(relativePosition.GetDotProduct(m_unitSide2));
 
-    if ((projection2 < -gapTolerance) || (projection2 > m_side2.GetMagnitude() + gapTolerance))
+    if ((projection2 < -gapTolerance) || (projection2 > m_side2Length + gapTolerance))
         return false;
 
-    const float projection3(relativePosition.GetDotProduct(m_side3.GetUnitVector()));
+    const float projection3(relativePosition.GetDotProduct(m_unitSide3));
 
-    if ((projection3 < -gapTolerance) || (projection3 > m_side3.GetMagnitude() + gapTolerance))
+    if ((projection3 < -gapTolerance) || (projection3 > m_side3Length + gapTolerance))
         return false;
 
     return true;
@@ -101,11 +107,15 @@ ConcentricGap::ConcentricGap(const object_creation::Geometry::ConcentricGap::Par
     m_innerSymmetryOrder(parameters.m_innerSymmetryOrder.Get()),
     m_outerRCoordinate(parameters.m_outerRCoordinate.Get()),
     m_outerPhiCoordinate(parameters.m_outerPhiCoordinate.Get()),
-    m_outerSymmetryOrder(parameters.m_outerSymmetryOrder.Get())
+    m_outerSymmetryOrder(parameters.m_outerSymmetryOrder.Get()),
+    m_outerRMax(0.f)
 {
     if ((0 == m_innerSymmetryOrder) || (0 == m_outerSymmetryOrder))
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
+    static const float pi(std::acos(-1.f));
+    m_outerRMax = m_outerRCoordinate / std::cos(pi / static_cast<float>(m_outerSymmetryOrder));
+
     const float centralZCoordinate(0.5f * (m_maxZCoordinate + m_minZCoordinate));
     this->GetPolygonVertices(m_innerRCoordinate, centralZCoordinate, m_innerPhiCoordinate, m_innerSymmetryOrder, m_innerVertexPointList);
     this->GetPolygonVertices(m_outerRCoordinate, centralZCoordinate, m_outerPhiCoordinate, m_outerSymmetryOrder, m_outerVertexPointList);
@@ -130,9 +140,7 @@ bool ConcentricGap::IsInGap(const CartesianVector &positionVector, const HitType
     if (r < m_innerRCoordinate)
         return false;
 
-    static const float pi(std::acos(-1.f));
-
-    if (r > m_outerRCoordinate / std::cos(pi / static_cast<float>(m_outerSymmetryOrder)))
+    if (r > m_outerRMax)
         return false;
 
     if (!this->IsIn2DPolygon(positionVector, m_outerVertexPointList, m_outerSymmetryOrder))
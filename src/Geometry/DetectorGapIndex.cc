@@ -0,0 +1,385 @@
+/**
+ *  @file   PandoraSDK/src/Geometry/DetectorGapIndex.cc
+ *
+ *  @brief  Implementation of the detector gap index class.
+ *
+ *  $Log: $
+ */
+
+#include "Geometry/DetectorGap.h"
+#include "Geometry/DetectorGapIndex.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace pandora
+{
+
+DetectorGapIndex::DetectorGapIndex() :
+    m_nIndexedGaps(0),
+    m_nLineGaps(0),
+    m_nVolumeGaps(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DetectorGapIndex::AddDetectorGap(const DetectorGap *const pDetectorGap)
+{
+    if (!pDetectorGap)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    if (dynamic_cast<const LineGap *>(pDetectorGap))
+    {
+        ++m_nLineGaps;
+    }
+    else if (dynamic_cast<const BoxGap *>(pDetectorGap) || dynamic_cast<const ConcentricGap *>(pDetectorGap))
+    {
+        ++m_nVolumeGaps;
+    }
+
+    m_detectorGapVector.push_back(pDetectorGap);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DetectorGapIndex::Build()
+{
+    FloatVector lowerEdges[4], upperEdges[4];
+    m_boundedGapVector.clear();
+    m_boundingNodeVector.clear();
+    m_unboundedGapVector.clear();
+
+    for (const DetectorGap *const pDetectorGap : m_detectorGapVector)
+    {
+        const LineGap *const pLineGap(dynamic_cast<const LineGap *>(pDetectorGap));
+        const BoxGap *const pBoxGap(dynamic_cast<const BoxGap *>(pDetectorGap));
+        const ConcentricGap *const pConcentricGap(dynamic_cast<const ConcentricGap *>(pDetectorGap));
+
+        BoundedGap boundedGap;
+        boundedGap.m_pDetectorGap = pDetectorGap;
+
+        if (pLineGap)
+        {
+            const bool isDriftGap(TPC_DRIFT_GAP == pLineGap->GetLineGapType());
+            const unsigned int listIndex(static_cast<unsigned int>(pLineGap->GetLineGapType()));
+
+            if (listIndex > 3)
+                throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+            lowerEdges[listIndex].push_back(isDriftGap ? pLineGap->GetLineStartX() : pLineGap->GetLineStartZ());
+            upperEdges[listIndex].push_back(isDriftGap ? pLineGap->GetLineEndX() : pLineGap->GetLineEndZ());
+        }
+        else if (pBoxGap && DetectorGapIndex::GetBoundingBox(pBoxGap, boundedGap.m_boundingBox))
+        {
+            m_boundedGapVector.push_back(boundedGap);
+        }
+        else if (pConcentricGap)
+        {
+            DetectorGapIndex::GetBoundingBox(pConcentricGap, boundedGap.m_boundingBox);
+            m_boundedGapVector.push_back(boundedGap);
+        }
+        else
+        {
+            m_unboundedGapVector.push_back(pDetectorGap);
+        }
+    }
+
+    m_wireGapLists[0].SetIntervals(lowerEdges[TPC_WIRE_GAP_VIEW_U], upperEdges[TPC_WIRE_GAP_VIEW_U]);
+    m_wireGapLists[1].SetIntervals(lowerEdges[TPC_WIRE_GAP_VIEW_V], upperEdges[TPC_WIRE_GAP_VIEW_V]);
+    m_wireGapLists[2].SetIntervals(lowerEdges[TPC_WIRE_GAP_VIEW_W], upperEdges[TPC_WIRE_GAP_VIEW_W]);
+    m_driftGapList.SetIntervals(lowerEdges[TPC_DRIFT_GAP], upperEdges[TPC_DRIFT_GAP]);
+
+    if (!m_boundedGapVector.empty())
+        this->BuildNode(0, m_boundedGapVector.size());
+
+    m_nIndexedGaps = m_detectorGapVector.size();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool DetectorGapIndex::IsInAnyGap(const CartesianVector &positionVector, const HitType hitType, const float gapTolerance) const
+{
+    const bool isTwoDView((TPC_VIEW_U == hitType) || (TPC_VIEW_V == hitType) || (TPC_VIEW_W == hitType));
+    const bool isTPC(isTwoDView || (TPC_3D == hitType));
+
+    if (((m_nLineGaps > 0) && !isTPC) || ((m_nVolumeGaps > 0) && isTwoDView))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    if (isTwoDView)
+    {
+        const unsigned int listIndex((TPC_VIEW_U == hitType) ? 0 : (TPC_VIEW_V == hitType) ? 1 : 2);
+
+        if (m_wireGapLists[listIndex].Contains(positionVector.GetZ(), gapTolerance))
+            return true;
+    }
+
+    if (isTPC && m_driftGapList.Contains(positionVector.GetX(), gapTolerance))
+        return true;
+
+    if (!m_boundingNodeVector.empty())
+    {
+        const float position[3] = {positionVector.GetX(), positionVector.GetY(), positionVector.GetZ()};
+
+        if (this->IsInBoundedGap(0, position, positionVector, hitType, gapTolerance))
+            return true;
+    }
+
+    for (const DetectorGap *const pDetectorGap : m_unboundedGapVector)
+    {
+        if (pDetectorGap->IsInGap(positionVector, hitType, gapTolerance))
+            return true;
+    }
+
+    for (unsigned int iGap = m_nIndexedGaps; iGap < m_detectorGapVector.size(); ++iGap)
+    {
+        if (m_detectorGapVector[iGap]->IsInGap(positionVector, hitType, gapTolerance))
+            return true;
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool DetectorGapIndex::GetBoundingBox(const BoxGap *const pBoxGap, BoundingBox &boundingBox)
+{
+    // ATTN The box gap tests projections onto its unit side vectors, so its region is bounded by the planes of constant projection, whose
+    // intersections are found using the dual basis; this region matches the parallelepiped described by the sides only if they are orthogonal
+    const CartesianVector sides[3] = {pBoxGap->GetSide1(), pBoxGap->GetSide2(), pBoxGap->GetSide3()};
+    const CartesianVector unitSides[3] = {sides[0].GetUnitVector(), sides[1].GetUnitVector(), sides[2].GetUnitVector()};
+    const float tripleProduct(unitSides[0].GetDotProduct(unitSides[1].GetCrossProduct(unitSides[2])));
+
+    if (std::fabs(tripleProduct) < 1.e-6f)
+        return false;
+
+    const CartesianVector dualSides[3] = {unitSides[1].GetCrossProduct(unitSides[2]) * (1.f / tripleProduct),
+        unitSides[2].GetCrossProduct(unitSides[0]) * (1.f / tripleProduct), unitSides[0].GetCrossProduct(unitSides[1]) * (1.f / tripleProduct)};
+
+    const CartesianVector &vertex(pBoxGap->GetVertex());
+    const float vertexPosition[3] = {vertex.GetX(), vertex.GetY(), vertex.GetZ()};
+    float scale(0.f);
+
+    for (unsigned int iDimension = 0; iDimension < 3; ++iDimension)
+    {
+        boundingBox.m_min[iDimension] = vertexPosition[iDimension];
+        boundingBox.m_max[iDimension] = vertexPosition[iDimension];
+        boundingBox.m_growth[iDimension] = 0.f;
+
+        for (unsigned int iSide = 0; iSide < 3; ++iSide)
+        {
+            const float dualComponent((0 == iDimension) ? dualSides[iSide].GetX() : (1 == iDimension) ? dualSides[iSide].GetY() : dualSides[iSide].GetZ());
+            const float extent(sides[iSide].GetMagnitude() * dualComponent);
+            boundingBox.m_min[iDimension] += std::min(0.f, extent);
+            boundingBox.m_max[iDimension] += std::max(0.f, extent);
+            boundingBox.m_growth[iDimension] += std::fabs(dualComponent);
+        }
+
+        scale = std::max(scale, std::max(std::fabs(boundingBox.m_min[iDimension]), std::fabs(boundingBox.m_max[iDimension])));
+    }
+
+    // ATTN Pad the box generously, relative to its coordinates, so that rounding in the box gap calculation cannot place a position outside
+    for (unsigned int iDimension = 0; iDimension < 3; ++iDimension)
+    {
+        const float padding(1.e-4f * scale * (1.f + boundingBox.m_growth[iDimension]));
+        boundingBox.m_min[iDimension] -= padding;
+        boundingBox.m_max[iDimension] += padding;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DetectorGapIndex::GetBoundingBox(const ConcentricGap *const pConcentricGap, BoundingBox &boundingBox)
+{
+    // ATTN The concentric gap is bounded in the xy plane by the circumscribed circle of its outer polygon, and the gap tolerance applies only in z
+    const float outerRMax(std::fabs(pConcentricGap->GetOuterRMax()));
+    const float zScale(std::max(std::fabs(pConcentricGap->GetMinZCoordinate()), std::fabs(pConcentricGap->GetMaxZCoordinate())));
+    const float rPadding(1.e-4f * outerRMax), zPadding(1.e-4f * zScale);
+
+    boundingBox.m_min[0] = -outerRMax - rPadding;
+    boundingBox.m_max[0] = outerRMax + rPadding;
+    boundingBox.m_growth[0] = 0.f;
+    boundingBox.m_min[1] = -outerRMax - rPadding;
+    boundingBox.m_max[1] = outerRMax + rPadding;
+    boundingBox.m_growth[1] = 0.f;
+    boundingBox.m_min[2] = pConcentricGap->GetMinZCoordinate() - zPadding;
+    boundingBox.m_max[2] = pConcentricGap->GetMaxZCoordinate() + zPadding;
+    boundingBox.m_growth[2] = 1.f;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DetectorGapIndex::BuildNode(const unsigned int begin, const unsigned int end)
+{
+    const unsigned int nodeIndex(m_boundingNodeVector.size());
+
+    BoundingNode boundingNode;
+    boundingNode.m_boundingBox = m_boundedGapVector[begin].m_boundingBox;
+    boundingNode.m_begin = begin;
+    boundingNode.m_end = end;
+    boundingNode.m_secondChild = 0;
+
+    float minCentre[3] = {0.f, 0.f, 0.f}, maxCentre[3] = {0.f, 0.f, 0.f};
+
+    for (unsigned int iGap = begin; iGap < end; ++iGap)
+    {
+        const BoundingBox &boundingBox(m_boundedGapVector[iGap].m_boundingBox);
+        boundingNode.m_boundingBox.Enclose(boundingBox);
+
+        for (unsigned int iDimension = 0; iDimension < 3; ++iDimension)
+        {
+            const float centre(0.5f * (boundingBox.m_min[iDimension] + boundingBox.m_max[iDimension]));
+            minCentre[iDimension] = (begin == iGap) ? centre : std::min(minCentre[iDimension], centre);
+            maxCentre[iDimension] = (begin == iGap) ? centre : std::max(maxCentre[iDimension], centre);
+        }
+    }
+
+    m_boundingNodeVector.push_back(boundingNode);
+
+    static const unsigned int maxLeafSize(4);
+
+    if (end - begin <= maxLeafSize)
+        return;
+
+    unsigned int splitDimension(0);
+
+    for (unsigned int iDimension = 1; iDimension < 3; ++iDimension)
+    {
+        if ((maxCentre[iDimension] - minCentre[iDimension]) > (maxCentre[splitDimension] - minCentre[splitDimension]))
+            splitDimension = iDimension;
+    }
+
+    const unsigned int median((begin + end) / 2);
+    std::nth_element(m_boundedGapVector.begin() + begin, m_boundedGapVector.begin() + median, m_boundedGapVector.begin() + end,
+        CentreLessThan(splitDimension));
+
+    this->BuildNode(begin, median);
+    m_boundingNodeVector[nodeIndex].m_secondChild = m_boundingNodeVector.size();
+    this->BuildNode(median, end);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool DetectorGapIndex::IsInBoundedGap(const unsigned int nodeIndex, const float *const position, const CartesianVector &positionVector,
+    const HitType hitType, const float gapTolerance) const
+{
+    const BoundingNode &boundingNode(m_boundingNodeVector[nodeIndex]);
+
+    if (!boundingNode.m_boundingBox.Contains(position, gapTolerance))
+        return false;
+
+    if (0 != boundingNode.m_secondChild)
+    {
+        return (this->IsInBoundedGap(nodeIndex + 1, position, positionVector, hitType, gapTolerance) ||
+            this->IsInBoundedGap(boundingNode.m_secondChild, position, positionVector, hitType, gapTolerance));
+    }
+
+    for (unsigned int iGap = boundingNode.m_begin; iGap < boundingNode.m_end; ++iGap)
+    {
+        const BoundedGap &boundedGap(m_boundedGapVector[iGap]);
+
+        if (boundedGap.m_boundingBox.Contains(position, gapTolerance) && boundedGap.m_pDetectorGap->IsInGap(positionVector, hitType, gapTolerance))
+            return true;
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DetectorGapIndex::IntervalList::SetIntervals(const FloatVector &lowerEdges, const FloatVector &upperEdges)
+{
+    if (lowerEdges.size() != upperEdges.size())
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    typedef std::vector<std::pair<float, float> > IntervalVector;
+    IntervalVector intervalVector;
+
+    for (unsigned int iInterval = 0; iInterval < lowerEdges.size(); ++iInterval)
+        intervalVector.push_back(IntervalVector::value_type(lowerEdges[iInterval], upperEdges[iInterval]));
+
+    std::sort(intervalVector.begin(), intervalVector.end());
+
+    m_lowerEdges.clear();
+    m_maxUpperEdges.clear();
+
+    for (const IntervalVector::value_type &interval : intervalVector)
+    {
+        m_lowerEdges.push_back(interval.first);
+        m_maxUpperEdges.push_back(m_maxUpperEdges.empty() ? interval.second : std::max(m_maxUpperEdges.back(), interval.second));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool DetectorGapIndex::IntervalList::Contains(const float coordinate, const float tolerance) const
+{
+    // ATTN Widening by the tolerance preserves the ordering of the edges, so the intervals with lower edges below the coordinate form a prefix
+    unsigned int nBelow(0), nRemaining(m_lowerEdges.size());
+
+    while (nRemaining > 0)
+    {
+        const unsigned int halfRemaining(nRemaining / 2);
+
+        if (m_lowerEdges[nBelow + halfRemaining] - tolerance < coordinate)
+        {
+            nBelow += halfRemaining + 1;
+            nRemaining -= halfRemaining + 1;
+        }
+        else
+        {
+            nRemaining = halfRemaining;
+        }
+    }
+
+    return ((nBelow > 0) && (coordinate < m_maxUpperEdges[nBelow - 1] + tolerance));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool DetectorGapIndex::BoundingBox::Contains(const float *const position, const float gapTolerance) const
+{
+    for (unsigned int iDimension = 0; iDimension < 3; ++iDimension)
+    {
+        const float growth(gapTolerance * m_growth[iDimension]);
+
+        if ((position[iDimension] < m_min[iDimension] - growth) || (position[iDimension] > m_max[iDimension] + growth))
+            return false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DetectorGapIndex::BoundingBox::Enclose(const BoundingBox &rhs)
+{
+    for (unsigned int iDimension = 0; iDimension < 3; ++iDimension)
+    {
+        m_min[iDimension] = std::min(m_min[iDimension], rhs.m_min[iDimension]);
+        m_max[iDimension] = std::max(m_max[iDimension], rhs.m_max[iDimension]);
+        m_growth[iDimension] = std::max(m_growth[iDimension], rhs.m_growth[iDimension]);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+DetectorGapIndex::CentreLessThan::CentreLessThan(const unsigned int dimension) :
+    m_dimension(dimension)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool DetectorGapIndex::CentreLessThan::operator()(const BoundedGap &lhs, const BoundedGap &rhs) const
+{
+    return ((lhs.m_boundingBox.m_min[m_dimension] + lhs.m_boundingBox.m_max[m_dimension]) <
+        (rhs.m_boundingBox.m_min[m_dimension] + rhs.m_boundingBox.m_max[m_dimension]));
+}
+
+} // namespace pandora
@@ -33,19 +33,16 @@ StatusCode ClusterFitHelper::FitStart(const Cluster *const pCluster, const unsig
 
     unsigned int occupiedLayerCount(0);
 
-    ClusterFitPointList clusterFitPointList;
+    ClusterFitMoments clusterFitMoments;
     for (const OrderedCaloHitList::value_type &layerIter : orderedCaloHitList)
     {
         if (++occupiedLayerCount > maxOccupiedLayers)
             break;
 
-        for (const CaloHit *const pCaloHit : *layerIter.second)
-        {
-            clusterFitPointList.push_back(ClusterFitPoint(pCaloHit));
-        }
+        clusterFitMoments.Add(pCluster->GetFitMoments(layerIter.first));
     }
 
-    return FitPoints(clusterFitPointList, clusterFitResult);
+    return FitMoments(clusterFitMoments, clusterFitResult);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -66,19 +63,16 @@ StatusCode ClusterFitHelper::FitEnd(const Cluster *const pCluster, const unsigne
 
     unsigned int occupiedLayerCount(0);
 
-    ClusterFitPointList clusterFitPointList;
+    ClusterFitMoments clusterFitMoments;
     for (OrderedCaloHitList::const_reverse_iterator iter = orderedCaloHitList.rbegin(), iterEnd = orderedCaloHitList.rend(); iter != iterEnd; ++iter)
     {
         if (++occupiedLayerCount > maxOccupiedLayers)
             break;
 
-        for (const CaloHit *const pCaloHit : *iter->second)
-        {
-            clusterFitPointList.push_back(ClusterFitPoint(pCaloHit));
-        }
+        clusterFitMoments.Add(pCluster->GetFitMoments(iter->first));
     }
 
-    return FitPoints(clusterFitPointList, clusterFitResult);
+    return FitMoments(clusterFitMoments, clusterFitResult);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -94,16 +88,27 @@ StatusCode ClusterFitHelper::FitFullCluster(const Cluster *const pCluster, Clust
     if (listSize < 2)
         return STATUS_CODE_OUT_OF_RANGE;
 
-    ClusterFitPointList clusterFitPointList;
-    for (const OrderedCaloHitList::value_type &layerIter : orderedCaloHitList)
+    return FitMoments(pCluster->GetFitMoments(), clusterFitResult);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ClusterFitHelper::FitClusters(const ClusterVector &clusterVector, ClusterFitResultList &clusterFitResultList)
+{
+    for (const Cluster *const pCluster : clusterVector)
     {
-        for (const CaloHit *const pCaloHit : *layerIter.second)
-        {
-            clusterFitPointList.push_back(ClusterFitPoint(pCaloHit));
-        }
+        if (!pCluster)
+            return STATUS_CODE_INVALID_PARAMETER;
     }
 
-    return FitPoints(clusterFitPointList, clusterFitResult);
+    clusterFitResultList.clear();
+    clusterFitResultList.resize(clusterVector.size());
+
+    // ATTN Full cluster fits are made from the cached cluster fit moments, so the cost of each is independent of the number of calo hits
+    for (unsigned int iCluster = 0, nClusters = clusterVector.size(); iCluster < nClusters; ++iCluster)
+        (void) ClusterFitHelper::FitFullCluster(clusterVector[iCluster], clusterFitResultList[iCluster]);
+
+    return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -123,7 +128,7 @@ StatusCode ClusterFitHelper::FitLayers(const Cluster *const pCluster, const unsi
     if (listSize < 2)
         return STATUS_CODE_OUT_OF_RANGE;
 
-    ClusterFitPointList clusterFitPointList;
+    ClusterFitMoments clusterFitMoments;
     for (const OrderedCaloHitList::value_type &layerIter : orderedCaloHitList)
     {
         const unsigned int pseudoLayer(layerIter.first);
@@ -134,13 +139,10 @@ StatusCode ClusterFitHelper::FitLayers(const Cluster *const pCluster, const unsi
         if (endLayer < pseudoLayer)
             break;
 
-        for (const CaloHit *const pCaloHit : *layerIter.second)
-        {
-            clusterFitPointList.push_back(ClusterFitPoint(pCaloHit));
-        }
+        clusterFitMoments.Add(pCluster->GetFitMoments(pseudoLayer));
     }
 
-    return FitPoints(clusterFitPointList, clusterFitResult);
+    return FitMoments(clusterFitMoments, clusterFitResult);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -236,75 +238,104 @@ StatusCode ClusterFitHelper::FitPoints(ClusterFitPointList &clusterFitPointList,
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode ClusterFitHelper::FitMoments(const ClusterFitMoments &clusterFitMoments, ClusterFitResult &clusterFitResult)
+{
+    // ATTN Consistent with FitPoints, for which no cluster fit point can be constructed from a calo hit without a cell size
+    if (0 != clusterFitMoments.m_nInvalidPoints)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    try
+    {
+        const unsigned int nFitPoints(clusterFitMoments.GetNPoints());
+
+        if (nFitPoints < 2)
+            return STATUS_CODE_INVALID_PARAMETER;
+
+        clusterFitResult.Reset();
+        const double nPoints(static_cast<double>(nFitPoints));
+
+        const CartesianVector positionMean(static_cast<float>(clusterFitMoments.m_positionSums[0] / nPoints),
+            static_cast<float>(clusterFitMoments.m_positionSums[1] / nPoints), static_cast<float>(clusterFitMoments.m_positionSums[2] / nPoints));
+        const CartesianVector normalVectorSum(static_cast<float>(clusterFitMoments.m_normalSums[0]),
+            static_cast<float>(clusterFitMoments.m_normalSums[1]), static_cast<float>(clusterFitMoments.m_normalSums[2]));
+
+        return PerformLinearFit(positionMean, normalVectorSum.GetUnitVector(), clusterFitMoments, clusterFitResult);
+    }
+    catch (StatusCodeException &statusCodeException)
+    {
+        std::cout << "ClusterFitHelper: linear fit to cluster failed. " << std::endl;
+        clusterFitResult.SetSuccessFlag(false);
+        return statusCodeException.GetStatusCode();
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ClusterFitHelper::PerformLinearFit(const CartesianVector &centralPosition, const CartesianVector &centralDirection,
-    ClusterFitPointList &clusterFitPointList, ClusterFitResult &clusterFitResult)
+    const ClusterFitPointList &clusterFitPointList, ClusterFitResult &clusterFitResult)
 {
-    std::sort(clusterFitPointList.begin(), clusterFitPointList.end());
+    const unsigned int nFitPoints(clusterFitPointList.size());
+
+    double rotation[3][3];
+    ClusterFitHelper::GetRotationMatrix(centralDirection, rotation);
+
+    // Copy the fit point properties into structure-of-arrays buffers, so that the loops over fit points below can be vectorized
+    std::vector<float> xValues(nFitPoints), yValues(nFitPoints), zValues(nFitPoints), layerValues(nFitPoints);
+    std::vector<double> errorValues(nFitPoints), pValues(nFitPoints), qValues(nFitPoints), rValues(nFitPoints);
+
+    for (unsigned int iPoint = 0; iPoint < nFitPoints; ++iPoint)
+    {
+        const ClusterFitPoint &clusterFitPoint(clusterFitPointList[iPoint]);
+        xValues[iPoint] = clusterFitPoint.GetPosition().GetX();
+        yValues[iPoint] = clusterFitPoint.GetPosition().GetY();
+        zValues[iPoint] = clusterFitPoint.GetPosition().GetZ();
+        layerValues[iPoint] = static_cast<float>(clusterFitPoint.GetPseudoLayer());
+        errorValues[iPoint] = clusterFitPoint.GetCellSize() / 3.46;
+    }
 
     // Extract the data
-    double sumP(0.), sumQ(0.), sumR(0.), sumWeights(0.);
+    const float centralX(centralPosition.GetX()), centralY(centralPosition.GetY()), centralZ(centralPosition.GetZ());
+    double sumP(0.), sumQ(0.), sumR(0.);
     double sumPR(0.), sumQR(0.), sumRR(0.);
 
-    const CartesianVector chosenAxis(0.f, 0.f, 1.f);
-    const double cosTheta(centralDirection.GetCosOpeningAngle(chosenAxis));
-    const double sinTheta(std::sin(std::acos(cosTheta)));
+    for (unsigned int iPoint = 0; iPoint < nFitPoints; ++iPoint)
+    {
+        const double x(xValues[iPoint] - centralX), y(yValues[iPoint] - centralY), z(zValues[iPoint] - centralZ);
 
-    const CartesianVector rotationAxis((std::fabs(cosTheta) > 0.99) ? CartesianVector(1.f, 0.f, 0.f) :
-        centralDirection.GetCrossProduct(chosenAxis).GetUnitVector());
+        const double p(rotation[0][0] * x + rotation[0][1] * y + rotation[0][2] * z);
+        const double q(rotation[1][0] * x + rotation[1][1] * y + rotation[1][2] * z);
+        const double r(rotation[2][0] * x + rotation[2][1] * y + rotation[2][2] * z);
 
-    for (const ClusterFitPoint &clusterFitPoint : clusterFitPointList)
-    {
-        const CartesianVector position(clusterFitPoint.GetPosition() - centralPosition);
-        const double weight(1.);
-
-        const double p( (cosTheta + rotationAxis.GetX() * rotationAxis.GetX() * (1. - cosTheta)) * position.GetX() +
-            (rotationAxis.GetX() * rotationAxis.GetY() * (1. - cosTheta) - rotationAxis.GetZ() * sinTheta) * position.GetY() +
-            (rotationAxis.GetX() * rotationAxis.GetZ() * (1. - cosTheta) + rotationAxis.GetY() * sinTheta) * position.GetZ() );
-        const double q( (rotationAxis.GetY() * rotationAxis.GetX() * (1. - cosTheta) + rotationAxis.GetZ() * sinTheta) * position.GetX() +
-            (cosTheta + rotationAxis.GetY() * rotationAxis.GetY() * (1. - cosTheta)) * position.GetY() +
-            (rotationAxis.GetY() * rotationAxis.GetZ() * (1. - cosTheta) - rotationAxis.GetX() * sinTheta) * position.GetZ() );
-        const double r( (rotationAxis.GetZ() * rotationAxis.GetX() * (1. - cosTheta) - rotationAxis.GetY() * sinTheta) * position.GetX() +
-            (rotationAxis.GetZ() * rotationAxis.GetY() * (1. - cosTheta) + rotationAxis.GetX() * sinTheta) * position.GetY() +
-            (cosTheta + rotationAxis.GetZ() * rotationAxis.GetZ() * (1. - cosTheta)) * position.GetZ() );
-
-        sumP += p * weight; sumQ += q * weight; sumR += r * weight;
-        sumPR += p * r * weight; sumQR += q * r * weight; sumRR += r * r * weight;
-        sumWeights += weight;
+        pValues[iPoint] = p; qValues[iPoint] = q; rValues[iPoint] = r;
+        sumP += p; sumQ += q; sumR += r;
+        sumPR += p * r; sumQR += q * r; sumRR += r * r;
     }
 
     // Perform the fit
-    const double denominatorR(sumR * sumR - sumWeights * sumRR);
+    const double nPoints(static_cast<double>(nFitPoints));
+    const double denominatorR(sumR * sumR - nPoints * sumRR);
 
     if (std::fabs(denominatorR) < std::numeric_limits<double>::epsilon())
         return STATUS_CODE_FAILURE;
 
-    const double aP((sumR * sumP - sumWeights * sumPR) / denominatorR);
-    const double bP((sumP - aP * sumR) / sumWeights);
-    const double aQ((sumR * sumQ - sumWeights * sumQR) / denominatorR);
-    const double bQ((sumQ - aQ * sumR) / sumWeights);
+    const double aP((sumR * sumP - nPoints * sumPR) / denominatorR);
+    const double bP((sumP - aP * sumR) / nPoints);
+    const double aQ((sumR * sumQ - nPoints * sumQR) / denominatorR);
+    const double bQ((sumQ - aQ * sumR) / nPoints);
 
     // Extract direction and intercept
     const double magnitude(std::sqrt(1. + aP * aP + aQ * aQ));
     const double dirP(aP / magnitude), dirQ(aQ / magnitude), dirR(1. / magnitude);
 
     CartesianVector direction(
-        static_cast<float>((cosTheta + rotationAxis.GetX() * rotationAxis.GetX() * (1. - cosTheta)) * dirP +
-            (rotationAxis.GetX() * rotationAxis.GetY() * (1. - cosTheta) + rotationAxis.GetZ() * sinTheta) * dirQ +
-            (rotationAxis.GetX() * rotationAxis.GetZ() * (1. - cosTheta) - rotationAxis.GetY() * sinTheta) * dirR),
-        static_cast<float>((rotationAxis.GetY() * rotationAxis.GetX() * (1. - cosTheta) - rotationAxis.GetZ() * sinTheta) * dirP +
-            (cosTheta + rotationAxis.GetY() * rotationAxis.GetY() * (1. - cosTheta)) * dirQ +
-            (rotationAxis.GetY() * rotationAxis.GetZ() * (1. - cosTheta) + rotationAxis.GetX() * sinTheta) * dirR),
-        static_cast<float>((rotationAxis.GetZ() * rotationAxis.GetX() * (1. - cosTheta) + rotationAxis.GetY() * sinTheta) * dirP +
-            (rotationAxis.GetZ() * rotationAxis.GetY() * (1. - cosTheta) - rotationAxis.GetX() * sinTheta) * dirQ +
-            (cosTheta + rotationAxis.GetZ() * rotationAxis.GetZ() * (1. - cosTheta)) * dirR) );
-
-    CartesianVector intercept(centralPosition + CartesianVector(
-        static_cast<float>((cosTheta + rotationAxis.GetX() * rotationAxis.GetX() * (1. - cosTheta)) * bP +
-            (rotationAxis.GetX() * rotationAxis.GetY() * (1. - cosTheta) + rotationAxis.GetZ() * sinTheta) * bQ),
-        static_cast<float>((rotationAxis.GetY() * rotationAxis.GetX() * (1. - cosTheta) - rotationAxis.GetZ() * sinTheta) * bP +
-            (cosTheta + rotationAxis.GetY() * rotationAxis.GetY() * (1. - cosTheta)) * bQ),
-        static_cast<float>((rotationAxis.GetZ() * rotationAxis.GetX() * (1. - cosTheta) + rotationAxis.GetY() * sinTheta) * bP +
-            (rotationAxis.GetZ() * rotationAxis.GetY() * (1. - cosTheta) - rotationAxis.GetX() * sinTheta) * bQ) ));
+        static_cast<float>(rotation[0][0] * dirP + rotation[1][0] * dirQ + rotation[2][0] * dirR),
+        static_cast<float>(rotation[0][1] * dirP + rotation[1][1] * dirQ + rotation[2][1] * dirR),
+        static_cast<float>(rotation[0][2] * dirP + rotation[1][2] * dirQ + rotation[2][2] * dirR));
+
+    const CartesianVector intercept(centralPosition + CartesianVector(
+        static_cast<float>(rotation[0][0] * bP + rotation[1][0] * bQ),
+        static_cast<float>(rotation[0][1] * bP + rotation[1][1] * bQ),
+        static_cast<float>(rotation[0][2] * bP + rotation[1][2] * bQ)));
 
     // Extract radial direction cosine
     float dirCosR(direction.GetDotProduct(intercept) / intercept.GetMagnitude());
@@ -316,39 +347,31 @@ StatusCode ClusterFitHelper::PerformLinearFit(const CartesianVector &centralPosi
     }
 
     // Now calculate something like a chi2
+    const float dirX(direction.GetX()), dirY(direction.GetY()), dirZ(direction.GetZ());
+    const float interceptX(intercept.GetX()), interceptY(intercept.GetY()), interceptZ(intercept.GetZ());
     double chi2_P(0.), chi2_Q(0.), rms(0.);
     double sumA(0.), sumL(0.), sumAL(0.), sumLL(0.);
 
-    for (const ClusterFitPoint &clusterFitPoint : clusterFitPointList)
+    for (unsigned int iPoint = 0; iPoint < nFitPoints; ++iPoint)
     {
-        const CartesianVector position(clusterFitPoint.GetPosition() - centralPosition);
-
-        const double p( (cosTheta + rotationAxis.GetX() * rotationAxis.GetX() * (1. - cosTheta)) * position.GetX() +
-            (rotationAxis.GetX() * rotationAxis.GetY() * (1. - cosTheta) - rotationAxis.GetZ() * sinTheta) * position.GetY() +
-            (rotationAxis.GetX() * rotationAxis.GetZ() * (1. - cosTheta) + rotationAxis.GetY() * sinTheta) * position.GetZ() );
-        const double q( (rotationAxis.GetY() * rotationAxis.GetX() * (1. - cosTheta) + rotationAxis.GetZ() * sinTheta) * position.GetX() +
-            (cosTheta + rotationAxis.GetY() * rotationAxis.GetY() * (1. - cosTheta)) * position.GetY() +
-            (rotationAxis.GetY() * rotationAxis.GetZ() * (1. - cosTheta) - rotationAxis.GetX() * sinTheta) * position.GetZ() );
-        const double r( (rotationAxis.GetZ() * rotationAxis.GetX() * (1. - cosTheta) - rotationAxis.GetY() * sinTheta) * position.GetX() +
-            (rotationAxis.GetZ() * rotationAxis.GetY() * (1. - cosTheta) + rotationAxis.GetX() * sinTheta) * position.GetY() +
-            (cosTheta + rotationAxis.GetZ() * rotationAxis.GetZ() * (1. - cosTheta)) * position.GetZ() );
-
-        const double error(clusterFitPoint.GetCellSize() / 3.46);
-        const double chiP((p - aP * r - bP) / error);
-        const double chiQ((q - aQ * r - bQ) / error);
+        const double error(errorValues[iPoint]);
+        const double chiP((pValues[iPoint] - aP * rValues[iPoint] - bP) / error);
+        const double chiQ((qValues[iPoint] - aQ * rValues[iPoint] - bQ) / error);
 
         chi2_P += chiP * chiP;
         chi2_Q += chiQ * chiQ;
 
-        const CartesianVector difference(clusterFitPoint.GetPosition() - intercept);
-        rms += (direction.GetCrossProduct(difference)).GetMagnitudeSquared();
+        const float differenceX(xValues[iPoint] - interceptX), differenceY(yValues[iPoint] - interceptY), differenceZ(zValues[iPoint] - interceptZ);
+        const float crossX((dirY * differenceZ) - (differenceY * dirZ));
+        const float crossY((dirZ * differenceX) - (differenceZ * dirX));
+        const float crossZ((dirX * differenceY) - (differenceX * dirY));
+        rms += (crossX * crossX) + (crossY * crossY) + (crossZ * crossZ);
 
-        const float a(direction.GetDotProduct(difference));
-        const float l(static_cast<float>(clusterFitPoint.GetPseudoLayer()));
+        const float a((dirX * differenceX) + (dirY * differenceY) + (dirZ * differenceZ));
+        const float l(layerValues[iPoint]);
         sumA += a; sumL += l; sumAL += a * l; sumLL += l * l;
     }
 
-    const double nPoints(static_cast<double>(clusterFitPointList.size()));
     const double denominatorL(sumL * sumL - nPoints * sumLL);
 
     if (std::fabs(denominatorL) > std::numeric_limits<double>::epsilon())
@@ -367,6 +390,304 @@ StatusCode ClusterFitHelper::PerformLinearFit(const CartesianVector &centralPosi
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ClusterFitHelper::PerformLinearFit(const CartesianVector &centralPosition, const CartesianVector &centralDirection,
+    const ClusterFitMoments &clusterFitMoments, ClusterFitResult &clusterFitResult)
+{
+    double rotation[3][3];
+    ClusterFitHelper::GetRotationMatrix(centralDirection, rotation);
+
+    // Moments of the fit point positions relative to the central position, from which all point sums in the fit can be formed
+    const double nPoints(static_cast<double>(clusterFitMoments.m_nPoints));
+    const double weightSum(clusterFitMoments.m_weightSum);
+    const double centre[3] = {centralPosition.GetX(), centralPosition.GetY(), centralPosition.GetZ()};
+
+    double positionSums[3], weightedPositionSums[3];
+
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        positionSums[i] = clusterFitMoments.m_positionSums[i] - nPoints * centre[i];
+        weightedPositionSums[i] = clusterFitMoments.m_weightedPositionSums[i] - weightSum * centre[i];
+    }
+
+    double positionProductSums[6], weightedPositionProductSums[6];
+
+    for (unsigned int i = 0, k = 0; i < 3; ++i)
+    {
+        for (unsigned int j = i; j < 3; ++j, ++k)
+        {
+            positionProductSums[k] = clusterFitMoments.m_positionProductSums[k] - centre[i] * clusterFitMoments.m_positionSums[j] -
+                centre[j] * clusterFitMoments.m_positionSums[i] + nPoints * centre[i] * centre[j];
+            weightedPositionProductSums[k] = clusterFitMoments.m_weightedPositionProductSums[k] -
+                centre[i] * clusterFitMoments.m_weightedPositionSums[j] - centre[j] * clusterFitMoments.m_weightedPositionSums[i] +
+                weightSum * centre[i] * centre[j];
+        }
+    }
+
+    // Extract the data
+    const double sumP(rotation[0][0] * positionSums[0] + rotation[0][1] * positionSums[1] + rotation[0][2] * positionSums[2]);
+    const double sumQ(rotation[1][0] * positionSums[0] + rotation[1][1] * positionSums[1] + rotation[1][2] * positionSums[2]);
+    const double sumR(rotation[2][0] * positionSums[0] + rotation[2][1] * positionSums[1] + rotation[2][2] * positionSums[2]);
+    const double sumPR(ClusterFitHelper::GetQuadraticForm(rotation[0], positionProductSums, rotation[2]));
+    const double sumQR(ClusterFitHelper::GetQuadraticForm(rotation[1], positionProductSums, rotation[2]));
+    const double sumRR(ClusterFitHelper::GetQuadraticForm(rotation[2], positionProductSums, rotation[2]));
+
+    // Perform the fit
+    const double denominatorR(sumR * sumR - nPoints * sumRR);
+
+    if (std::fabs(denominatorR) < std::numeric_limits<double>::epsilon())
+        return STATUS_CODE_FAILURE;
+
+    const double aP((sumR * sumP - nPoints * sumPR) / denominatorR);
+    const double bP((sumP - aP * sumR) / nPoints);
+    const double aQ((sumR * sumQ - nPoints * sumQR) / denominatorR);
+    const double bQ((sumQ - aQ * sumR) / nPoints);
+
+    // Extract direction and intercept
+    const double magnitude(std::sqrt(1. + aP * aP + aQ * aQ));
+    const double dirP(aP / magnitude), dirQ(aQ / magnitude), dirR(1. / magnitude);
+
+    CartesianVector direction(
+        static_cast<float>(rotation[0][0] * dirP + rotation[1][0] * dirQ + rotation[2][0] * dirR),
+        static_cast<float>(rotation[0][1] * dirP + rotation[1][1] * dirQ + rotation[2][1] * dirR),
+        static_cast<float>(rotation[0][2] * dirP + rotation[1][2] * dirQ + rotation[2][2] * dirR));
+
+    const CartesianVector intercept(centralPosition + CartesianVector(
+        static_cast<float>(rotation[0][0] * bP + rotation[1][0] * bQ),
+        static_cast<float>(rotation[0][1] * bP + rotation[1][1] * bQ),
+        static_cast<float>(rotation[0][2] * bP + rotation[1][2] * bQ)));
+
+    // Extract radial direction cosine
+    float dirCosR(direction.GetDotProduct(intercept) / intercept.GetMagnitude());
+
+    if (0.f > dirCosR)
+    {
+        dirCosR = -dirCosR;
+        direction = direction * -1.f;
+    }
+
+    // Now calculate something like a chi2, with each residual weighted by its inverse squared position error
+    double chi2(0.);
+
+    for (unsigned int iRow = 0; iRow < 2; ++iRow)
+    {
+        const double slope((0 == iRow) ? aP : aQ), offset((0 == iRow) ? bP : bQ);
+        const double residualAxis[3] = {rotation[iRow][0] - slope * rotation[2][0], rotation[iRow][1] - slope * rotation[2][1],
+            rotation[iRow][2] - slope * rotation[2][2]};
+
+        const double weightedResidualSum(residualAxis[0] * weightedPositionSums[0] + residualAxis[1] * weightedPositionSums[1] +
+            residualAxis[2] * weightedPositionSums[2]);
+
+        chi2 += ClusterFitHelper::GetQuadraticForm(residualAxis, weightedPositionProductSums, residualAxis) -
+            2. * offset * weightedResidualSum + offset * offset * weightSum;
+    }
+
+    // Positions relative to the intercept are the positions relative to the central position, offset by a constant vector
+    const double dirVector[3] = {direction.GetX(), direction.GetY(), direction.GetZ()};
+    const double offsetVector[3] = {centre[0] - intercept.GetX(), centre[1] - intercept.GetY(), centre[2] - intercept.GetZ()};
+
+    double dirDotDir(0.), dirDotOffset(0.), dirDotPositionSums(0.), offsetDotOffset(0.), offsetDotPositionSums(0.), dirDotLayerPositionSums(0.);
+
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        dirDotDir += dirVector[i] * dirVector[i];
+        dirDotOffset += dirVector[i] * offsetVector[i];
+        dirDotPositionSums += dirVector[i] * positionSums[i];
+        offsetDotOffset += offsetVector[i] * offsetVector[i];
+        offsetDotPositionSums += offsetVector[i] * positionSums[i];
+        dirDotLayerPositionSums += dirVector[i] * (clusterFitMoments.m_layerPositionSums[i] - centre[i] * clusterFitMoments.m_layerSum);
+    }
+
+    const double positionProductTrace(positionProductSums[0] + positionProductSums[3] + positionProductSums[5]);
+    const double rms(dirDotDir * (positionProductTrace + 2. * offsetDotPositionSums + nPoints * offsetDotOffset) -
+        (ClusterFitHelper::GetQuadraticForm(dirVector, positionProductSums, dirVector) + 2. * dirDotOffset * dirDotPositionSums +
+        nPoints * dirDotOffset * dirDotOffset));
+
+    const double sumA(dirDotPositionSums + nPoints * dirDotOffset);
+    const double sumL(clusterFitMoments.m_layerSum), sumLL(clusterFitMoments.m_layerSquaredSum);
+    const double sumAL(dirDotLayerPositionSums + dirDotOffset * sumL);
+    const double denominatorL(sumL * sumL - nPoints * sumLL);
+
+    if (std::fabs(denominatorL) > std::numeric_limits<double>::epsilon())
+    {
+        if (0. > ((sumL * sumA - nPoints * sumAL) / denominatorL))
+            direction = direction * -1.f;
+    }
+
+    // ATTN Differences of large sums can leave small negative values where the point sums would be zero
+    clusterFitResult.SetDirection(direction);
+    clusterFitResult.SetIntercept(intercept);
+    clusterFitResult.SetChi2(static_cast<float>(std::max(0., chi2) / nPoints));
+    clusterFitResult.SetRms(static_cast<float>(std::sqrt(std::max(0., rms) / nPoints)));
+    clusterFitResult.SetRadialDirectionCosine(dirCosR);
+    clusterFitResult.SetSuccessFlag(true);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterFitHelper::GetRotationMatrix(const CartesianVector &centralDirection, double rotation[3][3])
+{
+    const CartesianVector chosenAxis(0.f, 0.f, 1.f);
+    const double cosTheta(centralDirection.GetCosOpeningAngle(chosenAxis));
+    const double sinTheta(std::sin(std::acos(cosTheta)));
+
+    const CartesianVector rotationAxis((std::fabs(cosTheta) > 0.99) ? CartesianVector(1.f, 0.f, 0.f) :
+        centralDirection.GetCrossProduct(chosenAxis).GetUnitVector());
+
+    // ATTN Products of rotation axis components are formed in single precision, as they always have been, so fit results are unchanged
+    const float ax(rotationAxis.GetX()), ay(rotationAxis.GetY()), az(rotationAxis.GetZ());
+
+    rotation[0][0] = cosTheta + ax * ax * (1. - cosTheta);
+    rotation[0][1] = ax * ay * (1. - cosTheta) - az * sinTheta;
+    rotation[0][2] = ax * az * (1. - cosTheta) + ay * sinTheta;
+    rotation[1][0] = ay * ax * (1. - cosTheta) + az * sinTheta;
+    rotation[1][1] = cosTheta + ay * ay * (1. - cosTheta);
+    rotation[1][2] = ay * az * (1. - cosTheta) - ax * sinTheta;
+    rotation[2][0] = az * ax * (1. - cosTheta) - ay * sinTheta;
+    rotation[2][1] = az * ay * (1. - cosTheta) + ax * sinTheta;
+    rotation[2][2] = cosTheta + az * az * (1. - cosTheta);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+double ClusterFitHelper::GetQuadraticForm(const double *const u, const double *const symmetricMatrix, const double *const v)
+{
+    const double *const m(symmetricMatrix);
+
+    return (u[0] * (m[0] * v[0] + m[1] * v[1] + m[2] * v[2]) +
+        u[1] * (m[1] * v[0] + m[3] * v[1] + m[4] * v[2]) +
+        u[2] * (m[2] * v[0] + m[4] * v[1] + m[5] * v[2]));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ClusterFitMoments::ClusterFitMoments()
+{
+    this->Reset();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterFitMoments::AddCaloHit(const CaloHit *const pCaloHit)
+{
+    this->Accumulate(pCaloHit, true);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterFitMoments::RemoveCaloHit(const CaloHit *const pCaloHit)
+{
+    if (0 == m_nPoints)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    this->Accumulate(pCaloHit, false);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterFitMoments::Add(const ClusterFitMoments &rhs)
+{
+    m_nPoints += rhs.m_nPoints;
+    m_nInvalidPoints += rhs.m_nInvalidPoints;
+    m_weightSum += rhs.m_weightSum;
+    m_layerSum += rhs.m_layerSum;
+    m_layerSquaredSum += rhs.m_layerSquaredSum;
+
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        m_positionSums[i] += rhs.m_positionSums[i];
+        m_normalSums[i] += rhs.m_normalSums[i];
+        m_weightedPositionSums[i] += rhs.m_weightedPositionSums[i];
+        m_layerPositionSums[i] += rhs.m_layerPositionSums[i];
+    }
+
+    for (unsigned int k = 0; k < 6; ++k)
+    {
+        m_positionProductSums[k] += rhs.m_positionProductSums[k];
+        m_weightedPositionProductSums[k] += rhs.m_weightedPositionProductSums[k];
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterFitMoments::Reset()
+{
+    m_nPoints = 0;
+    m_nInvalidPoints = 0;
+    m_weightSum = 0.;
+    m_layerSum = 0.;
+    m_layerSquaredSum = 0.;
+
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        m_positionSums[i] = 0.;
+        m_normalSums[i] = 0.;
+        m_weightedPositionSums[i] = 0.;
+        m_layerPositionSums[i] = 0.;
+    }
+
+    for (unsigned int k = 0; k < 6; ++k)
+    {
+        m_positionProductSums[k] = 0.;
+        m_weightedPositionProductSums[k] = 0.;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterFitMoments::Accumulate(const CaloHit *const pCaloHit, const bool isAddition)
+{
+    const double sign(isAddition ? 1. : -1.);
+    const CartesianVector &positionVector(pCaloHit->GetPositionVector());
+    const CartesianVector &cellNormalVector(pCaloHit->GetCellNormalVector());
+
+    const double position[3] = {positionVector.GetX(), positionVector.GetY(), positionVector.GetZ()};
+    const double normal[3] = {cellNormalVector.GetX(), cellNormalVector.GetY(), cellNormalVector.GetZ()};
+    const double layer(static_cast<double>(pCaloHit->GetPseudoLayer()));
+
+    // ATTN Hits without a cell size are counted, so that any fit to them fails, but cannot contribute to the weighted sums
+    const bool isValid(pCaloHit->GetCellLengthScale() >= std::numeric_limits<float>::epsilon());
+    const double error(pCaloHit->GetCellLengthScale() / 3.46);
+    const double weight(isValid ? sign / (error * error) : 0.);
+
+    if (isAddition)
+    {
+        ++m_nPoints;
+
+        if (!isValid)
+            ++m_nInvalidPoints;
+    }
+    else
+    {
+        --m_nPoints;
+
+        if (!isValid)
+            --m_nInvalidPoints;
+    }
+
+    m_weightSum += weight;
+    m_layerSum += sign * layer;
+    m_layerSquaredSum += sign * layer * layer;
+
+    for (unsigned int i = 0, k = 0; i < 3; ++i)
+    {
+        m_positionSums[i] += sign * position[i];
+        m_normalSums[i] += sign * normal[i];
+        m_weightedPositionSums[i] += weight * position[i];
+        m_layerPositionSums[i] += sign * layer * position[i];
+
+        for (unsigned int j = i; j < 3; ++j, ++k)
+        {
+            m_positionProductSums[k] += sign * position[i] * position[j];
+            m_weightedPositionProductSums[k] += weight * position[i] * position[j];
+        }
+    }
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -23,24 +23,7 @@ namespace pandora
 template <typename T>
 const MCParticle *MCParticleHelper::GetMainMCParticle(const T *const pT)
 {
-    float bestWeight(0.f);
-    const MCParticle *pBestMCParticle(nullptr);
-    const MCParticleWeightMap &hitMCParticleWeightMap(pT->GetMCParticleWeightMap());
-
-    MCParticleVector mcParticleVector;
-    for (const MCParticleWeightMap::value_type &mapEntry : hitMCParticleWeightMap) mcParticleVector.push_back(mapEntry.first);
-    std::sort(mcParticleVector.begin(), mcParticleVector.end(), PointerLessThan<MCParticle>());
-
-    for (const MCParticle *const pMCParticle : mcParticleVector)
-    {
-        const float weight(hitMCParticleWeightMap.at(pMCParticle));
-
-        if (weight > bestWeight)
-        {
-            bestWeight = weight;
-            pBestMCParticle = pMCParticle;
-        }
-    }
+    const MCParticle *const pBestMCParticle(MCParticleHelper::GetBestMCParticle(pT->GetMCParticleWeightMap()));
 
     if (!pBestMCParticle)
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
@@ -55,36 +38,11 @@ const MCParticle *MCParticleHelper::GetMainMCParticle(const CaloHitList *const p
 
     for (const CaloHit *const pCaloHit : *pCaloHitList)
     {
-        const MCParticleWeightMap &hitMCParticleWeightMap(pCaloHit->GetMCParticleWeightMap());
-
-        MCParticleVector mcParticleVector;
-        for (const MCParticleWeightMap::value_type &mapEntry : hitMCParticleWeightMap) mcParticleVector.push_back(mapEntry.first);
-        std::sort(mcParticleVector.begin(), mcParticleVector.end(), PointerLessThan<MCParticle>());
-
-        for (const MCParticle *const pMCParticle : mcParticleVector)
-        {
-            const float weight(hitMCParticleWeightMap.at(pMCParticle));
-            mcParticleWeightMap[pMCParticle] += weight;
-        }
+        for (const MCParticleWeightMap::value_type &mapEntry : pCaloHit->GetMCParticleWeightMap())
+            mcParticleWeightMap[mapEntry.first] += mapEntry.second;
     }
 
-    float bestWeight(0.f);
-    const MCParticle *pBestMCParticle(nullptr);
-
-    MCParticleVector mcParticleVector;
-    for (const MCParticleWeightMap::value_type &mapEntry : mcParticleWeightMap) mcParticleVector.push_back(mapEntry.first);
-    std::sort(mcParticleVector.begin(), mcParticleVector.end(), PointerLessThan<MCParticle>());
-
-    for (const MCParticle *const pCurrentMCParticle : mcParticleVector)
-    {
-        const float currentWeight(mcParticleWeightMap.at(pCurrentMCParticle));
-
-        if (currentWeight > bestWeight)
-        {
-            pBestMCParticle = pCurrentMCParticle;
-            bestWeight = currentWeight;
-        }
-    }
+    const MCParticle *const pBestMCParticle(MCParticleHelper::GetBestMCParticle(mcParticleWeightMap));
 
     if (!pBestMCParticle)
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
@@ -112,6 +70,27 @@ const MCParticle *MCParticleHelper::GetMainMCParticle(const ClusterList *const p
     return MCParticleHelper::GetMainMCParticle(&caloHitList);
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const MCParticle *MCParticleHelper::GetBestMCParticle(const MCParticleWeightMap &mcParticleWeightMap)
+{
+    float bestWeight(0.f);
+    const MCParticle *pBestMCParticle(nullptr);
+
+    // ATTN Single pass, with ties resolved in favour of the first mc particle in the PointerLessThan ordering, as for a sorted iteration
+    for (const MCParticleWeightMap::value_type &mapEntry : mcParticleWeightMap)
+    {
+        if ((mapEntry.second > bestWeight) ||
+            (pBestMCParticle && !(mapEntry.second < bestWeight) && PointerLessThan<MCParticle>()(mapEntry.first, pBestMCParticle)))
+        {
+            bestWeight = mapEntry.second;
+            pBestMCParticle = mapEntry.first;
+        }
+    }
+
+    return pBestMCParticle;
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -112,36 +112,45 @@ StatusCode AlgorithmObjectManager<T>::MoveObjectsBetweenLists(const std::string
     if (Manager<T>::m_nameToListMap.end() == targetListIter)
         return STATUS_CODE_FAILURE;
 
+    ObjectList *const pSourceList(sourceListIter->second);
+    ObjectList *const pTargetList(targetListIter->second);
+
+    // ATTN Validate all objects, against the list membership indices, before altering either list
+    ObjectSet &targetIndex(this->GetListIndex(*pTargetList));
+
     if (!pObjectSubset)
     {
-        for (const T *const pT : *sourceListIter->second)
+        for (const T *const pT : *pSourceList)
         {
-            if (targetListIter->second->end() != std::find(targetListIter->second->begin(), targetListIter->second->end(), pT))
+            if (targetIndex.count(pT))
                 return STATUS_CODE_ALREADY_PRESENT;
-
-            targetListIter->second->push_back(pT);
         }
 
-        sourceListIter->second->clear();
+        pTargetList->insert(pTargetList->end(), pSourceList->begin(), pSourceList->end());
+        targetIndex.insert(pSourceList->begin(), pSourceList->end());
+        pSourceList->clear();
+        m_listIndexMap.erase(pSourceList);
     }
     else
     {
-        if ((sourceListIter->second == pObjectSubset) || (targetListIter->second == pObjectSubset))
+        if ((pSourceList == pObjectSubset) || (pTargetList == pObjectSubset))
             return STATUS_CODE_INVALID_PARAMETER;
 
+        const ObjectSet &sourceIndex(this->GetListIndex(*pSourceList));
+        ObjectSet objectsToMove;
+
         for (const T *const pT : *pObjectSubset)
         {
-            typename ObjectList::iterator objectIter = std::find(sourceListIter->second->begin(), sourceListIter->second->end(), pT);
-
-            if (sourceListIter->second->end() == objectIter)
+            if (!sourceIndex.count(pT) || !objectsToMove.insert(pT).second)
                 return STATUS_CODE_NOT_FOUND;
 
-            if (targetListIter->second->end() != std::find(targetListIter->second->begin(), targetListIter->second->end(), pT))
+            if (targetIndex.count(pT))
                 return STATUS_CODE_ALREADY_PRESENT;
-
-            targetListIter->second->push_back(pT);
-            objectIter = sourceListIter->second->erase(objectIter);
         }
+
+        pTargetList->insert(pTargetList->end(), pObjectSubset->begin(), pObjectSubset->end());
+        targetIndex.insert(pObjectSubset->begin(), pObjectSubset->end());
+        this->EraseObjects(*pSourceList, objectsToMove);
     }
 
     m_canMakeNewObjects = false;
@@ -171,13 +180,12 @@ StatusCode AlgorithmObjectManager<T>::DeleteObject(const T *const pT, const std:
     if (Manager<T>::m_nameToListMap.end() == listIter)
         return STATUS_CODE_NOT_FOUND;
 
-    typename ObjectList::iterator deletionIter = std::find(listIter->second->begin(), listIter->second->end(), pT);
-
-    if (listIter->second->end() == deletionIter)
+    if (!this->GetListIndex(*listIter->second).count(pT))
         return STATUS_CODE_NOT_FOUND;
 
-    deletionIter = listIter->second->erase(deletionIter);
+    this->EraseObject(*listIter->second, pT);
     delete pT;
+    ++Manager<T>::m_nObjectsDeleted;
 
     return STATUS_CODE_SUCCESS;
 }
@@ -195,17 +203,22 @@ StatusCode AlgorithmObjectManager<T>::DeleteObjects(const ObjectList &objectList
     if (listIter->second == &objectList)
         return STATUS_CODE_INVALID_PARAMETER;
 
+    // ATTN Validate all objects, against the list membership index, before altering the list
+    const ObjectSet &listIndex(this->GetListIndex(*listIter->second));
+    ObjectSet objectsToDelete;
+
     for (const T *const pT : objectList)
     {
-        typename ObjectList::iterator deletionIter = std::find(listIter->second->begin(), listIter->second->end(), pT);
-
-        if (listIter->second->end() == deletionIter)
+        if (!listIndex.count(pT) || !objectsToDelete.insert(pT).second)
             return STATUS_CODE_NOT_FOUND;
+    }
 
-        deletionIter = listIter->second->erase(deletionIter);
+    this->EraseObjects(*listIter->second, objectsToDelete);
+
+    for (const T *const pT : objectList)
         delete pT;
-    }
 
+    Manager<T>::m_nObjectsDeleted += objectList.size();
     return STATUS_CODE_SUCCESS;
 }
 
@@ -233,7 +246,9 @@ StatusCode AlgorithmObjectManager<T>::DeleteTemporaryObjects(const Algorithm *co
     for (const T *const pT : *listIter->second)
         delete pT;
 
+    Manager<T>::m_nObjectsDeleted += listIter->second->size();
     listIter->second->clear();
+    m_listIndexMap.erase(listIter->second);
     return STATUS_CODE_SUCCESS;
 }
 
@@ -309,6 +324,19 @@ StatusCode AlgorithmObjectManager<T>::ResetAlgorithmInfo(const Algorithm *const
     for (const T *const pT : objectList)
         delete pT;
 
+    Manager<T>::m_nObjectsDeleted += objectList.size();
+
+    // ATTN The temporary lists are deleted by the base class, so their indices must go first
+    typename Manager<T>::AlgorithmInfoMap::const_iterator algorithmIter = Manager<T>::m_algorithmInfoMap.find(pAlgorithm);
+
+    for (const std::string &temporaryListName : algorithmIter->second.m_temporaryListNames)
+    {
+        typename Manager<T>::NameToListMap::const_iterator listIter = Manager<T>::m_nameToListMap.find(temporaryListName);
+
+        if (Manager<T>::m_nameToListMap.end() != listIter)
+            m_listIndexMap.erase(listIter->second);
+    }
+
     m_canMakeNewObjects = false;
     return Manager<T>::ResetAlgorithmInfo(pAlgorithm, isAlgorithmFinished);
 }
@@ -322,12 +350,87 @@ StatusCode AlgorithmObjectManager<T>::EraseAllContent()
     {
         for (const T *const pT : *mapEntry.second)
             delete pT;
+
+        Manager<T>::m_nObjectsDeleted += mapEntry.second->size();
     }
 
     m_canMakeNewObjects = false;
+    m_listIndexMap.clear();
     return Manager<T>::EraseAllContent();
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+void AlgorithmObjectManager<T>::AddObjectToList(ObjectList &objectList, const T *const pT)
+{
+    objectList.push_back(pT);
+
+    typename ListIndexMap::iterator indexIter = m_listIndexMap.find(&objectList);
+
+    if (m_listIndexMap.end() != indexIter)
+        indexIter->second.insert(pT);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+typename AlgorithmObjectManager<T>::ObjectSet &AlgorithmObjectManager<T>::GetListIndex(const ObjectList &objectList)
+{
+    typename ListIndexMap::iterator indexIter = m_listIndexMap.find(&objectList);
+
+    if (m_listIndexMap.end() != indexIter)
+        return indexIter->second;
+
+    return m_listIndexMap.emplace(&objectList, ObjectSet(objectList.begin(), objectList.end())).first->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+void AlgorithmObjectManager<T>::EraseObjects(ObjectList &objectList, const ObjectSet &objectsToErase)
+{
+    if (1 == objectsToErase.size())
+    {
+        this->EraseObject(objectList, *objectsToErase.begin());
+        return;
+    }
+
+    typename ObjectList::iterator keepIter(objectList.begin());
+
+    for (typename ObjectList::iterator iter = objectList.begin(), iterEnd = objectList.end(); iter != iterEnd; ++iter)
+    {
+        if (!objectsToErase.count(*iter))
+            *(keepIter++) = *iter;
+    }
+
+    objectList.erase(keepIter, objectList.end());
+
+    typename ListIndexMap::iterator indexIter = m_listIndexMap.find(&objectList);
+
+    if (m_listIndexMap.end() != indexIter)
+    {
+        for (const T *const pT : objectsToErase)
+            indexIter->second.erase(pT);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+void AlgorithmObjectManager<T>::EraseObject(ObjectList &objectList, const T *const pT)
+{
+    typename ObjectList::iterator eraseIter = std::find(objectList.begin(), objectList.end(), pT);
+
+    if (objectList.end() != eraseIter)
+        eraseIter = objectList.erase(eraseIter);
+
+    typename ListIndexMap::iterator indexIter = m_listIndexMap.find(&objectList);
+
+    if (m_listIndexMap.end() != indexIter)
+        indexIter->second.erase(pT);
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -11,6 +11,7 @@
 
 #include "Objects/Cluster.h"
 #include "Objects/CaloHit.h"
+#include "Objects/CaloHitBlock.h"
 
 #include "Pandora/ObjectFactory.h"
 #include "Pandora/Pandora.h"
@@ -48,6 +49,7 @@ StatusCode CaloHitManager::Create(const object_creation::CaloHit::Parameters &pa
 
     try
     {
+        const ObjectPool::Activation activation(m_objectPool);
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, factory.Create(parameters, pCaloHit));
 
         NameToListMap::iterator inputIter = m_nameToListMap.find(m_inputListName);
@@ -61,7 +63,10 @@ StatusCode CaloHitManager::Create(const object_creation::CaloHit::Parameters &pa
 
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Modifiable(pCaloHit)->SetPseudoLayer(pseudoLayer));
 
+        this->AssignIndex(pCaloHit);
         inputIter->second->push_back(pCaloHit);
+        this->ResetSpatialIndices(m_inputListName);
+        ++m_nObjectsCreated;
         return STATUS_CODE_SUCCESS;
     }
     catch (StatusCodeException &statusCodeException)
@@ -75,8 +80,151 @@ StatusCode CaloHitManager::Create(const object_creation::CaloHit::Parameters &pa
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode CaloHitManager::AlterMetadata(const CaloHit *const pCaloHit, const object_creation::CaloHit::Metadata &metadata) const
+StatusCode CaloHitManager::Create(const CaloHitBlock &caloHitBlock)
 {
+    NameToListMap::iterator inputIter = m_nameToListMap.find(m_inputListName);
+
+    if (m_nameToListMap.end() == inputIter)
+        return STATUS_CODE_FAILURE;
+
+    if (!CaloHitManager::IsValid(caloHitBlock))
+    {
+        std::cout << "Failed to create calo hits: invalid calo hit block" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    const unsigned int nCaloHits(caloHitBlock.m_positionX.size());
+    CaloHitVector caloHitVector;
+
+    try
+    {
+        const ObjectPool::Activation activation(m_objectPool);
+        caloHitVector.reserve(nCaloHits);
+
+        for (unsigned int iCaloHit = 0; iCaloHit < nCaloHits; ++iCaloHit)
+            caloHitVector.push_back(new CaloHit(caloHitBlock, iCaloHit));
+
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->AssignPseudoLayers(caloHitVector));
+
+        // ATTN A failed range insertion leaves the input list unchanged, so each calo hit is either owned by the list or deleted below
+        inputIter->second->insert(inputIter->second->end(), caloHitVector.begin(), caloHitVector.end());
+    }
+    catch (StatusCodeException &statusCodeException)
+    {
+        std::cout << "Failed to create calo hits: " << statusCodeException.ToString() << std::endl;
+
+        for (const CaloHit *const pCaloHit : caloHitVector)
+            delete pCaloHit;
+
+        return statusCodeException.GetStatusCode();
+    }
+    catch (...)
+    {
+        std::cout << "Failed to create calo hits, unknown exception" << std::endl;
+
+        for (const CaloHit *const pCaloHit : caloHitVector)
+            delete pCaloHit;
+
+        throw;
+    }
+
+    for (const CaloHit *const pCaloHit : caloHitVector)
+        this->AssignIndex(pCaloHit);
+
+    this->ResetSpatialIndices(m_inputListName);
+    m_nObjectsCreated += nCaloHits;
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool CaloHitManager::IsValid(const CaloHitBlock &caloHitBlock)
+{
+    const size_t nCaloHits(caloHitBlock.m_positionX.size());
+
+    if ((caloHitBlock.m_cellGeometry.size() != nCaloHits) || (caloHitBlock.m_positionY.size() != nCaloHits) ||
+        (caloHitBlock.m_positionZ.size() != nCaloHits) || (caloHitBlock.m_expectedDirectionX.size() != nCaloHits) ||
+        (caloHitBlock.m_expectedDirectionY.size() != nCaloHits) || (caloHitBlock.m_expectedDirectionZ.size() != nCaloHits) ||
+        (caloHitBlock.m_cellNormalX.size() != nCaloHits) || (caloHitBlock.m_cellNormalY.size() != nCaloHits) ||
+        (caloHitBlock.m_cellNormalZ.size() != nCaloHits) || (caloHitBlock.m_cellThickness.size() != nCaloHits) ||
+        (caloHitBlock.m_nCellRadiationLengths.size() != nCaloHits) || (caloHitBlock.m_nCellInteractionLengths.size() != nCaloHits) ||
+        (caloHitBlock.m_time.size() != nCaloHits) || (caloHitBlock.m_inputEnergy.size() != nCaloHits) ||
+        (caloHitBlock.m_mipEquivalentEnergy.size() != nCaloHits) || (caloHitBlock.m_electromagneticEnergy.size() != nCaloHits) ||
+        (caloHitBlock.m_hadronicEnergy.size() != nCaloHits) || (caloHitBlock.m_isDigital.size() != nCaloHits) ||
+        (caloHitBlock.m_hitType.size() != nCaloHits) || (caloHitBlock.m_hitRegion.size() != nCaloHits) ||
+        (caloHitBlock.m_layer.size() != nCaloHits) || (caloHitBlock.m_isInOuterSamplingLayer.size() != nCaloHits) ||
+        (caloHitBlock.m_parentAddress.size() != nCaloHits) || (caloHitBlock.m_cellSize0.size() != nCaloHits) ||
+        (caloHitBlock.m_cellSize1.size() != nCaloHits))
+    {
+        return false;
+    }
+
+    const CaloHitBlock::FloatColumn *const floatColumns[] = {&caloHitBlock.m_positionX, &caloHitBlock.m_positionY, &caloHitBlock.m_positionZ,
+        &caloHitBlock.m_expectedDirectionX, &caloHitBlock.m_expectedDirectionY, &caloHitBlock.m_expectedDirectionZ, &caloHitBlock.m_cellNormalX,
+        &caloHitBlock.m_cellNormalY, &caloHitBlock.m_cellNormalZ, &caloHitBlock.m_cellThickness, &caloHitBlock.m_nCellRadiationLengths,
+        &caloHitBlock.m_nCellInteractionLengths, &caloHitBlock.m_time, &caloHitBlock.m_inputEnergy, &caloHitBlock.m_mipEquivalentEnergy,
+        &caloHitBlock.m_electromagneticEnergy, &caloHitBlock.m_hadronicEnergy, &caloHitBlock.m_cellSize0, &caloHitBlock.m_cellSize1};
+
+    // ATTN Accumulate, rather than branch, so that each column is checked in a single tight loop
+    bool isValid(true);
+
+    for (const CaloHitBlock::FloatColumn *const pFloatColumn : floatColumns)
+    {
+        for (const float value : *pFloatColumn)
+            isValid &= std::isfinite(value);
+    }
+
+    if (!isValid)
+        return false;
+
+    // ATTN Expected directions and cell normals are normalized on calo hit construction, as for individually created calo hits
+    for (size_t iCaloHit = 0; iCaloHit < nCaloHits; ++iCaloHit)
+    {
+        const CartesianVector expectedDirection(caloHitBlock.m_expectedDirectionX[iCaloHit], caloHitBlock.m_expectedDirectionY[iCaloHit],
+            caloHitBlock.m_expectedDirectionZ[iCaloHit]);
+        const CartesianVector cellNormalVector(caloHitBlock.m_cellNormalX[iCaloHit], caloHitBlock.m_cellNormalY[iCaloHit],
+            caloHitBlock.m_cellNormalZ[iCaloHit]);
+
+        isValid &= (std::fabs(expectedDirection.GetMagnitude()) >= std::numeric_limits<float>::epsilon());
+        isValid &= (std::fabs(cellNormalVector.GetMagnitude()) >= std::numeric_limits<float>::epsilon());
+    }
+
+    return isValid;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CaloHitManager::AssignPseudoLayers(const CaloHitVector &caloHitVector)
+{
+    // ATTN No longer require presence of pseudo layer plugin, accepting use of a single dummy value for all hits
+    UIntVector pseudoLayers(caloHitVector.size(), 0);
+
+    if (m_pPandora->GetPlugins()->HasPseudoLayerPlugin())
+    {
+        CartesianPointVector positionVectors;
+        positionVectors.reserve(caloHitVector.size());
+
+        for (const CaloHit *const pCaloHit : caloHitVector)
+            positionVectors.push_back(pCaloHit->GetPositionVector());
+
+        m_pPandora->GetPlugins()->GetPseudoLayerPlugin()->GetPseudoLayers(positionVectors, pseudoLayers);
+
+        if (pseudoLayers.size() != caloHitVector.size())
+            return STATUS_CODE_FAILURE;
+    }
+
+    for (unsigned int iCaloHit = 0, nCaloHits = caloHitVector.size(); iCaloHit < nCaloHits; ++iCaloHit)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Modifiable(caloHitVector[iCaloHit])->SetPseudoLayer(pseudoLayers[iCaloHit]));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CaloHitManager::AlterMetadata(const CaloHit *const pCaloHit, const object_creation::CaloHit::Metadata &metadata)
+{
+    // ATTN Calo hit positions can be altered, so spatial indices for any list containing the calo hit may be invalidated
+    this->ResetSpatialIndices();
     return this->Modifiable(pCaloHit)->AlterMetadata(metadata);
 }
 
@@ -156,8 +304,66 @@ StatusCode CaloHitManager::CreateTemporaryListAndSetCurrent(const Algorithm *con
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode CaloHitManager::SaveList(const std::string &listName, const CaloHitList &caloHitList)
+{
+    this->ResetSpatialIndices(listName);
+    return InputObjectManager<CaloHit>::SaveList(listName, caloHitList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CaloHitManager::AddObjectsToList(const std::string &listName, const CaloHitList &caloHitList)
+{
+    this->ResetSpatialIndices(listName);
+    return InputObjectManager<CaloHit>::AddObjectsToList(listName, caloHitList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CaloHitManager::RemoveObjectsFromList(const std::string &listName, const CaloHitList &caloHitList)
+{
+    this->ResetSpatialIndices(listName);
+    return InputObjectManager<CaloHit>::RemoveObjectsFromList(listName, caloHitList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CaloHitManager::RenameList(const std::string &oldListName, const std::string &newListName)
+{
+    this->ResetSpatialIndices(oldListName);
+    this->ResetSpatialIndices(newListName);
+    return InputObjectManager<CaloHit>::RenameList(oldListName, newListName);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CaloHitManager::ResetAlgorithmInfo(const Algorithm *const pAlgorithm, bool isAlgorithmFinished)
+{
+    const StatusCode statusCode(InputObjectManager<CaloHit>::ResetAlgorithmInfo(pAlgorithm, isAlgorithmFinished));
+
+    // ATTN Temporary list names are reused, so remove the spatial indices for any temporary lists deleted
+    for (SpatialIndexMap::iterator iter = m_spatialIndexMap.begin(); iter != m_spatialIndexMap.end(); )
+    {
+        if (m_nameToListMap.end() == m_nameToListMap.find(iter->first.first))
+        {
+            delete iter->second;
+            iter = m_spatialIndexMap.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode CaloHitManager::EraseAllContent()
 {
+    this->ResetSpatialIndices();
+
     for (const ReclusterMetadata *const pMetaData : m_reclusterMetadataList)
         delete pMetaData;
 
@@ -221,6 +427,7 @@ StatusCode CaloHitManager::FragmentCaloHit(const CaloHit *const pOriginalCaloHit
     object_creation::CaloHitFragment::Parameters parameters1;
     parameters1.m_pOriginalCaloHit = pOriginalCaloHit;
     parameters1.m_weight = fraction1;
+    const ObjectPool::Activation activation(m_objectPool);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, factory.Create(parameters1, pDaughterCaloHit1));
 
     object_creation::CaloHitFragment::Parameters parameters2;
@@ -231,10 +438,16 @@ StatusCode CaloHitManager::FragmentCaloHit(const CaloHit *const pOriginalCaloHit
     if (!pDaughterCaloHit1 || !pDaughterCaloHit2)
         return STATUS_CODE_FAILURE;
 
+    this->AssignIndex(pDaughterCaloHit1);
+    this->AssignIndex(pDaughterCaloHit2);
+    m_nObjectsCreated += 2;
+
     CaloHitReplacement caloHitReplacement;
     caloHitReplacement.m_oldCaloHits.push_back(pOriginalCaloHit);
     caloHitReplacement.m_newCaloHits.push_back(pDaughterCaloHit1); caloHitReplacement.m_newCaloHits.push_back(pDaughterCaloHit2);
 
+    this->ResetSpatialIndices();
+
     if (m_nReclusteringProcesses > 0)
     {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pCurrentReclusterMetadata->GetCurrentCaloHitMetadata()->Update(caloHitReplacement));
@@ -249,6 +462,94 @@ StatusCode CaloHitManager::FragmentCaloHit(const CaloHit *const pOriginalCaloHit
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode CaloHitManager::FragmentCaloHits(const CaloHitVector &originalCaloHits, const FloatVector &fractions1, CaloHitVector &daughterCaloHits1,
+    CaloHitVector &daughterCaloHits2, const ObjectFactory<object_creation::CaloHitFragment::Parameters, object_creation::CaloHitFragment::Object> &factory)
+{
+    daughterCaloHits1.clear(); daughterCaloHits2.clear();
+
+    if (originalCaloHits.empty() || (originalCaloHits.size() != fractions1.size()))
+        return STATUS_CODE_INVALID_PARAMETER;
+
+    NameToListMap::const_iterator iter = m_nameToListMap.find(m_currentListName);
+
+    if (m_nameToListMap.end() == iter)
+        return STATUS_CODE_FAILURE;
+
+    // ATTN For look-up efficiency, check all original calo hits against a single set of current list hits
+    const CaloHitSet currentCaloHitSet(iter->second->begin(), iter->second->end());
+    CaloHitSet originalCaloHitSet;
+
+    for (unsigned int iHit = 0; iHit < originalCaloHits.size(); ++iHit)
+    {
+        const CaloHit *const pOriginalCaloHit(originalCaloHits.at(iHit));
+        const float fraction1(fractions1.at(iHit));
+
+        if ((fraction1 < std::numeric_limits<float>::epsilon()) || (fraction1 > 1.f) || !this->IsAvailable(pOriginalCaloHit))
+            return STATUS_CODE_NOT_ALLOWED;
+
+        if (!currentCaloHitSet.count(pOriginalCaloHit) || !originalCaloHitSet.insert(pOriginalCaloHit).second)
+            return STATUS_CODE_NOT_ALLOWED;
+    }
+
+    CaloHitReplacementList caloHitReplacementList;
+
+    try
+    {
+        const ObjectPool::Activation activation(m_objectPool);
+
+        for (unsigned int iHit = 0; iHit < originalCaloHits.size(); ++iHit)
+        {
+            const CaloHit *pDaughterCaloHit1(nullptr), *pDaughterCaloHit2(nullptr);
+
+            object_creation::CaloHitFragment::Parameters parameters1;
+            parameters1.m_pOriginalCaloHit = originalCaloHits.at(iHit);
+            parameters1.m_weight = fractions1.at(iHit);
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, factory.Create(parameters1, pDaughterCaloHit1));
+            daughterCaloHits1.push_back(pDaughterCaloHit1);
+
+            object_creation::CaloHitFragment::Parameters parameters2;
+            parameters2.m_pOriginalCaloHit = originalCaloHits.at(iHit);
+            parameters2.m_weight = 1.f - fractions1.at(iHit);
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, factory.Create(parameters2, pDaughterCaloHit2));
+            daughterCaloHits2.push_back(pDaughterCaloHit2);
+
+            if (!pDaughterCaloHit1 || !pDaughterCaloHit2)
+                throw StatusCodeException(STATUS_CODE_FAILURE);
+
+            this->AssignIndex(pDaughterCaloHit1);
+            this->AssignIndex(pDaughterCaloHit2);
+
+            CaloHitReplacement *const pCaloHitReplacement(new CaloHitReplacement);
+            pCaloHitReplacement->m_oldCaloHits.push_back(originalCaloHits.at(iHit));
+            pCaloHitReplacement->m_newCaloHits.push_back(pDaughterCaloHit1); pCaloHitReplacement->m_newCaloHits.push_back(pDaughterCaloHit2);
+            caloHitReplacementList.push_back(pCaloHitReplacement);
+        }
+    }
+    catch (StatusCodeException &statusCodeException)
+    {
+        for (const CaloHit *const pCaloHit : daughterCaloHits1) delete pCaloHit;
+        for (const CaloHit *const pCaloHit : daughterCaloHits2) delete pCaloHit;
+        for (const CaloHitReplacement *const pCaloHitReplacement : caloHitReplacementList) delete pCaloHitReplacement;
+
+        daughterCaloHits1.clear(); daughterCaloHits2.clear();
+        return statusCodeException.GetStatusCode();
+    }
+
+    m_nObjectsCreated += daughterCaloHits1.size() + daughterCaloHits2.size();
+
+    this->ResetSpatialIndices();
+
+    const StatusCode statusCode((m_nReclusteringProcesses > 0) ?
+        m_pCurrentReclusterMetadata->GetCurrentCaloHitMetadata()->Update(caloHitReplacementList) : this->Update(caloHitReplacementList));
+
+    for (const CaloHitReplacement *const pCaloHitReplacement : caloHitReplacementList)
+        delete pCaloHitReplacement;
+
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode CaloHitManager::MergeCaloHitFragments(const CaloHit *const pFragmentCaloHit1, const CaloHit *const pFragmentCaloHit2,
     const CaloHit *&pMergedCaloHit, const ObjectFactory<object_creation::CaloHitFragment::Parameters, object_creation::CaloHitFragment::Object> &factory)
 {
@@ -262,15 +563,21 @@ StatusCode CaloHitManager::MergeCaloHitFragments(const CaloHit *const pFragmentC
     object_creation::CaloHitFragment::Parameters parameters;
     parameters.m_pOriginalCaloHit = pFragmentCaloHit1;
     parameters.m_weight = newWeight;
+    const ObjectPool::Activation activation(m_objectPool);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, factory.Create(parameters, pMergedCaloHit));
 
     if (!pMergedCaloHit)
         return STATUS_CODE_FAILURE;
 
+    this->AssignIndex(pMergedCaloHit);
+    ++m_nObjectsCreated;
+
     CaloHitReplacement caloHitReplacement;
     caloHitReplacement.m_newCaloHits.push_back(pMergedCaloHit);
     caloHitReplacement.m_oldCaloHits.push_back(pFragmentCaloHit1); caloHitReplacement.m_oldCaloHits.push_back(pFragmentCaloHit2);
 
+    this->ResetSpatialIndices();
+
     if (m_nReclusteringProcesses > 0)
     {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pCurrentReclusterMetadata->GetCurrentCaloHitMetadata()->Update(caloHitReplacement));
@@ -382,47 +689,43 @@ StatusCode CaloHitManager::EndReclustering(const Algorithm *const /*const pAlgor
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pCurrentReclusterMetadata->ExtractCaloHitMetadata(selectedReclusterListName,
         pSelectedCaloHitMetaData));
 
+    // ATTN The selected metadata is an overlay on the input hits held by the recluster metadata, so delete the latter after the merge
+    ReclusterMetadata *const pSelectedReclusterMetadata(m_pCurrentReclusterMetadata);
     m_reclusterMetadataList.pop_back();
-    delete m_pCurrentReclusterMetadata;
+    StatusCode statusCode(STATUS_CODE_SUCCESS);
+    this->ResetSpatialIndices();
 
     if (--m_nReclusteringProcesses > 0)
     {
         m_pCurrentReclusterMetadata = m_reclusterMetadataList.back();
         CaloHitMetadata *const pCurrentCaloHitMetaData = m_pCurrentReclusterMetadata->GetCurrentCaloHitMetadata();
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, pCurrentCaloHitMetaData->Update(*pSelectedCaloHitMetaData));
+        statusCode = pCurrentCaloHitMetaData->Update(*pSelectedCaloHitMetaData);
     }
     else
     {
         m_pCurrentReclusterMetadata = nullptr;
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Update(*pSelectedCaloHitMetaData));
+        statusCode = this->Update(*pSelectedCaloHitMetaData);
     }
 
     pSelectedCaloHitMetaData->Clear();
     delete pSelectedCaloHitMetaData;
+    delete pSelectedReclusterMetadata;
 
-    return STATUS_CODE_SUCCESS;
+    return statusCode;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode CaloHitManager::Update(const CaloHitMetadata &caloHitMetadata)
 {
-    const CaloHitReplacementList &caloHitReplacementList(caloHitMetadata.GetCaloHitReplacementList());
-
-    for (const CaloHitReplacement *const pCaloHitReplacement : caloHitReplacementList)
-    {
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Update(*pCaloHitReplacement));
-    }
-
-    const CaloHitUsageMap &caloHitUsageMap(caloHitMetadata.GetCaloHitUsageMap());
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Update(caloHitMetadata.GetCaloHitReplacementList()));
 
     CaloHitVector caloHitVector;
-    for (const CaloHitUsageMap::value_type &mapEntry : caloHitUsageMap) caloHitVector.push_back(mapEntry.first);
-    std::sort(caloHitVector.begin(), caloHitVector.end(), PointerLessThan<CaloHit>());
+    caloHitMetadata.GetCaloHits(caloHitVector);
 
     for (const CaloHit *const pCaloHit : caloHitVector)
     {
-        this->Modifiable(pCaloHit)->SetAvailability(caloHitUsageMap.at(pCaloHit));
+        this->Modifiable(pCaloHit)->SetAvailability(caloHitMetadata.IsAvailable(pCaloHit));
     }
 
     return STATUS_CODE_SUCCESS;
@@ -440,6 +743,102 @@ StatusCode CaloHitManager::Update(const CaloHitReplacement &caloHitReplacement)
     for (const CaloHit *const pCaloHit : caloHitReplacement.m_oldCaloHits)
         delete pCaloHit;
 
+    m_nObjectsDeleted += caloHitReplacement.m_oldCaloHits.size();
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CaloHitManager::Update(const CaloHitReplacementList &caloHitReplacementList)
+{
+    if (caloHitReplacementList.empty())
+        return STATUS_CODE_SUCCESS;
+
+    for (const CaloHitReplacement *const pCaloHitReplacement : caloHitReplacementList)
+    {
+        if (pCaloHitReplacement->m_newCaloHits.empty() || pCaloHitReplacement->m_oldCaloHits.empty())
+            return STATUS_CODE_NOT_INITIALIZED;
+    }
+
+    for (const NameToListMap::value_type &mapEntry : m_nameToListMap)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Update(mapEntry.second, caloHitReplacementList));
+    }
+
+    for (const CaloHitReplacement *const pCaloHitReplacement : caloHitReplacementList)
+    {
+        for (const CaloHit *const pCaloHit : pCaloHitReplacement->m_oldCaloHits)
+            delete pCaloHit;
+
+        m_nObjectsDeleted += pCaloHitReplacement->m_oldCaloHits.size();
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CaloHitManager::Update(CaloHitList *const pCaloHitList, const CaloHitReplacementList &caloHitReplacementList)
+{
+    // ATTN For look-up efficiency, apply all replacements to a set of hits, then make a single pass over the calo hit list
+    CaloHitSet caloHitSet(pCaloHitList->begin(), pCaloHitList->end());
+    CaloHitSet removedCaloHits;
+    CaloHitVector addedCaloHits;
+
+    for (const CaloHitReplacement *const pCaloHitReplacement : caloHitReplacementList)
+    {
+        if (pCaloHitList == &pCaloHitReplacement->m_oldCaloHits)
+            return STATUS_CODE_FAILURE;
+
+        bool replacementFound(false), allReplacementsFound(true);
+
+        for (const CaloHit *const pCaloHit : pCaloHitReplacement->m_oldCaloHits)
+        {
+            if (caloHitSet.erase(pCaloHit))
+            {
+                (void) removedCaloHits.insert(pCaloHit);
+                replacementFound = true;
+                continue;
+            }
+
+            allReplacementsFound = false;
+        }
+
+        if (!replacementFound)
+            continue;
+
+        if (!allReplacementsFound)
+            std::cout << "CaloHitManager::Update - imperfect calo hit replacements made to list " << std::endl;
+
+        for (const CaloHit *const pCaloHit : pCaloHitReplacement->m_newCaloHits)
+        {
+            if (!caloHitSet.insert(pCaloHit).second)
+                return STATUS_CODE_ALREADY_PRESENT;
+
+            addedCaloHits.push_back(pCaloHit);
+        }
+    }
+
+    if (removedCaloHits.empty())
+        return STATUS_CODE_SUCCESS;
+
+    CaloHitList::iterator keepIter(pCaloHitList->begin());
+
+    for (CaloHitList::iterator iter = pCaloHitList->begin(), iterEnd = pCaloHitList->end(); iter != iterEnd; ++iter)
+    {
+        if (!removedCaloHits.count(*iter))
+            *(keepIter++) = *iter;
+    }
+
+    pCaloHitList->erase(keepIter, pCaloHitList->end());
+
+    for (const CaloHit *const pCaloHit : addedCaloHits)
+    {
+        if (!removedCaloHits.count(pCaloHit))
+            pCaloHitList->push_back(pCaloHit);
+    }
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -486,4 +885,86 @@ StatusCode CaloHitManager::Update(CaloHitList *const pCaloHitList, const CaloHit
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CaloHitManager::GetCaloHitsInRange(const std::string &listName, const HitType hitType, const CartesianVector &position,
+    const float distance, CaloHitVector &caloHitVector)
+{
+    const CaloHitSpatialIndex *pCaloHitSpatialIndex(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetSpatialIndex(listName, hitType, pCaloHitSpatialIndex));
+
+    const CaloHitMetadata *const pCaloHitMetadata((0 == m_nReclusteringProcesses) ? nullptr :
+        m_pCurrentReclusterMetadata->GetCurrentCaloHitMetadata());
+
+    pCaloHitSpatialIndex->GetCaloHitsInRange(position, distance, pCaloHitMetadata, caloHitVector);
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CaloHitManager::GetNearestCaloHits(const std::string &listName, const HitType hitType, const CartesianVector &position,
+    const unsigned int nCaloHits, CaloHitVector &caloHitVector)
+{
+    const CaloHitSpatialIndex *pCaloHitSpatialIndex(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetSpatialIndex(listName, hitType, pCaloHitSpatialIndex));
+
+    const CaloHitMetadata *const pCaloHitMetadata((0 == m_nReclusteringProcesses) ? nullptr :
+        m_pCurrentReclusterMetadata->GetCurrentCaloHitMetadata());
+
+    pCaloHitSpatialIndex->GetNearestCaloHits(position, nCaloHits, pCaloHitMetadata, caloHitVector);
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CaloHitManager::GetSpatialIndex(const std::string &listName, const HitType hitType, const CaloHitSpatialIndex *&pCaloHitSpatialIndex)
+{
+    const SpatialIndexKey spatialIndexKey(listName, hitType);
+    SpatialIndexMap::const_iterator indexIter = m_spatialIndexMap.find(spatialIndexKey);
+
+    if (m_spatialIndexMap.end() != indexIter)
+    {
+        pCaloHitSpatialIndex = indexIter->second;
+        return STATUS_CODE_SUCCESS;
+    }
+
+    const CaloHitList *pCaloHitList(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetList(listName, pCaloHitList));
+
+    CaloHitSpatialIndex *const pNewCaloHitSpatialIndex(new CaloHitSpatialIndex(*pCaloHitList, hitType));
+
+    if (!m_spatialIndexMap.insert(SpatialIndexMap::value_type(spatialIndexKey, pNewCaloHitSpatialIndex)).second)
+    {
+        delete pNewCaloHitSpatialIndex;
+        return STATUS_CODE_ALREADY_PRESENT;
+    }
+
+    pCaloHitSpatialIndex = pNewCaloHitSpatialIndex;
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitManager::ResetSpatialIndices()
+{
+    for (const SpatialIndexMap::value_type &mapEntry : m_spatialIndexMap)
+        delete mapEntry.second;
+
+    m_spatialIndexMap.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitManager::ResetSpatialIndices(const std::string &listName)
+{
+    // ATTN Keys are ordered by list name, then hit type, with TRACKER the first hit type
+    SpatialIndexMap::iterator iter = m_spatialIndexMap.lower_bound(SpatialIndexKey(listName, TRACKER));
+
+    while ((m_spatialIndexMap.end() != iter) && (listName == iter->first.first))
+    {
+        delete iter->second;
+        iter = m_spatialIndexMap.erase(iter);
+    }
+}
+
 } // namespace pandora
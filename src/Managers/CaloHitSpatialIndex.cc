@@ -0,0 +1,225 @@
+/**
+ *  @file   PandoraSDK/src/Managers/CaloHitSpatialIndex.cc
+ *
+ *  @brief  Implementation of the calo hit spatial index class.
+ *
+ *  $Log: $
+ */
+
+#include "Managers/CaloHitSpatialIndex.h"
+#include "Managers/Metadata.h"
+
+#include "Objects/CaloHit.h"
+
+#include <algorithm>
+
+namespace pandora
+{
+
+CaloHitSpatialIndex::CaloHitSpatialIndex(const CaloHitList &caloHitList, const HitType hitType)
+{
+    for (const CaloHit *const pCaloHit : caloHitList)
+    {
+        if (hitType != pCaloHit->GetHitType())
+            continue;
+
+        Point point;
+        point.m_position[0] = pCaloHit->GetPositionVector().GetX();
+        point.m_position[1] = pCaloHit->GetPositionVector().GetY();
+        point.m_position[2] = pCaloHit->GetPositionVector().GetZ();
+        point.m_pCaloHit = pCaloHit;
+        m_points.push_back(point);
+    }
+
+    m_splitDimensions.resize(m_points.size(), 0);
+    this->Build(0, m_points.size());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitSpatialIndex::GetCaloHitsInRange(const CartesianVector &position, const float distance, const CaloHitMetadata *const pCaloHitMetadata,
+    CaloHitVector &caloHitVector) const
+{
+    caloHitVector.clear();
+
+    if (distance < 0.f)
+        return;
+
+    const float queryPosition[3] = {position.GetX(), position.GetY(), position.GetZ()};
+
+    NeighbourVector neighbourVector;
+    this->FindInRange(0, m_points.size(), queryPosition, distance * distance, pCaloHitMetadata, neighbourVector);
+    std::sort(neighbourVector.begin(), neighbourVector.end());
+
+    for (const Neighbour &neighbour : neighbourVector)
+        caloHitVector.push_back(neighbour.m_pCaloHit);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitSpatialIndex::GetNearestCaloHits(const CartesianVector &position, const unsigned int nCaloHits, const CaloHitMetadata *const pCaloHitMetadata,
+    CaloHitVector &caloHitVector) const
+{
+    caloHitVector.clear();
+
+    if (0 == nCaloHits)
+        return;
+
+    const float queryPosition[3] = {position.GetX(), position.GetY(), position.GetZ()};
+
+    NeighbourVector neighbourHeap;
+    this->FindNearest(0, m_points.size(), queryPosition, nCaloHits, pCaloHitMetadata, neighbourHeap);
+    std::sort_heap(neighbourHeap.begin(), neighbourHeap.end());
+
+    for (const Neighbour &neighbour : neighbourHeap)
+        caloHitVector.push_back(neighbour.m_pCaloHit);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitSpatialIndex::Build(const unsigned int begin, const unsigned int end)
+{
+    if (end - begin < 2)
+        return;
+
+    float minPosition[3] = {m_points[begin].m_position[0], m_points[begin].m_position[1], m_points[begin].m_position[2]};
+    float maxPosition[3] = {minPosition[0], minPosition[1], minPosition[2]};
+
+    for (unsigned int iPoint = begin + 1; iPoint < end; ++iPoint)
+    {
+        for (unsigned int iDimension = 0; iDimension < 3; ++iDimension)
+        {
+            minPosition[iDimension] = std::min(minPosition[iDimension], m_points[iPoint].m_position[iDimension]);
+            maxPosition[iDimension] = std::max(maxPosition[iDimension], m_points[iPoint].m_position[iDimension]);
+        }
+    }
+
+    unsigned int splitDimension(0);
+
+    for (unsigned int iDimension = 1; iDimension < 3; ++iDimension)
+    {
+        if ((maxPosition[iDimension] - minPosition[iDimension]) > (maxPosition[splitDimension] - minPosition[splitDimension]))
+            splitDimension = iDimension;
+    }
+
+    const unsigned int median((begin + end) / 2);
+    std::nth_element(m_points.begin() + begin, m_points.begin() + median, m_points.begin() + end, CoordinateLessThan(splitDimension));
+    m_splitDimensions[median] = static_cast<unsigned char>(splitDimension);
+
+    this->Build(begin, median);
+    this->Build(median + 1, end);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitSpatialIndex::FindInRange(const unsigned int begin, const unsigned int end, const float *const position, const float distanceSquared,
+    const CaloHitMetadata *const pCaloHitMetadata, NeighbourVector &neighbourVector) const
+{
+    if (begin >= end)
+        return;
+
+    const unsigned int median((begin + end) / 2);
+    const Point &point(m_points[median]);
+    const float pointDistanceSquared(CaloHitSpatialIndex::GetDistanceSquared(point, position));
+
+    if ((pointDistanceSquared <= distanceSquared) && CaloHitSpatialIndex::IsAvailable(point.m_pCaloHit, pCaloHitMetadata))
+    {
+        Neighbour neighbour;
+        neighbour.m_distanceSquared = pointDistanceSquared;
+        neighbour.m_pCaloHit = point.m_pCaloHit;
+        neighbourVector.push_back(neighbour);
+    }
+
+    const unsigned int splitDimension(m_splitDimensions[median]);
+    const float splitDelta(position[splitDimension] - point.m_position[splitDimension]);
+    const bool searchLowerFirst(splitDelta <= 0.f);
+
+    this->FindInRange(searchLowerFirst ? begin : median + 1, searchLowerFirst ? median : end, position, distanceSquared, pCaloHitMetadata, neighbourVector);
+
+    if (splitDelta * splitDelta <= distanceSquared)
+        this->FindInRange(searchLowerFirst ? median + 1 : begin, searchLowerFirst ? end : median, position, distanceSquared, pCaloHitMetadata, neighbourVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitSpatialIndex::FindNearest(const unsigned int begin, const unsigned int end, const float *const position, const unsigned int nCaloHits,
+    const CaloHitMetadata *const pCaloHitMetadata, NeighbourVector &neighbourHeap) const
+{
+    if (begin >= end)
+        return;
+
+    const unsigned int median((begin + end) / 2);
+    const Point &point(m_points[median]);
+
+    if (CaloHitSpatialIndex::IsAvailable(point.m_pCaloHit, pCaloHitMetadata))
+    {
+        Neighbour neighbour;
+        neighbour.m_distanceSquared = CaloHitSpatialIndex::GetDistanceSquared(point, position);
+        neighbour.m_pCaloHit = point.m_pCaloHit;
+
+        if (neighbourHeap.size() < nCaloHits)
+        {
+            neighbourHeap.push_back(neighbour);
+            std::push_heap(neighbourHeap.begin(), neighbourHeap.end());
+        }
+        else if (neighbour < neighbourHeap.front())
+        {
+            std::pop_heap(neighbourHeap.begin(), neighbourHeap.end());
+            neighbourHeap.back() = neighbour;
+            std::push_heap(neighbourHeap.begin(), neighbourHeap.end());
+        }
+    }
+
+    const unsigned int splitDimension(m_splitDimensions[median]);
+    const float splitDelta(position[splitDimension] - point.m_position[splitDimension]);
+    const bool searchLowerFirst(splitDelta <= 0.f);
+
+    this->FindNearest(searchLowerFirst ? begin : median + 1, searchLowerFirst ? median : end, position, nCaloHits, pCaloHitMetadata, neighbourHeap);
+
+    // ATTN Equidistant calo hits on the far side may still displace the furthest neighbour, through the calo hit index comparison
+    if ((neighbourHeap.size() < nCaloHits) || (splitDelta * splitDelta <= neighbourHeap.front().m_distanceSquared))
+        this->FindNearest(searchLowerFirst ? median + 1 : begin, searchLowerFirst ? end : median, position, nCaloHits, pCaloHitMetadata, neighbourHeap);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool CaloHitSpatialIndex::IsAvailable(const CaloHit *const pCaloHit, const CaloHitMetadata *const pCaloHitMetadata)
+{
+    return (pCaloHitMetadata ? pCaloHitMetadata->IsAvailable(pCaloHit) : pCaloHit->IsAvailable());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float CaloHitSpatialIndex::GetDistanceSquared(const Point &point, const float *const position)
+{
+    const float dx(point.m_position[0] - position[0]), dy(point.m_position[1] - position[1]), dz(point.m_position[2] - position[2]);
+    return ((dx * dx) + (dy * dy) + (dz * dz));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CaloHitSpatialIndex::CoordinateLessThan::CoordinateLessThan(const unsigned int dimension) :
+    m_dimension(dimension)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool CaloHitSpatialIndex::CoordinateLessThan::operator()(const Point &lhs, const Point &rhs) const
+{
+    return (lhs.m_position[m_dimension] < rhs.m_position[m_dimension]);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool CaloHitSpatialIndex::Neighbour::operator<(const Neighbour &rhs) const
+{
+    if (m_distanceSquared != rhs.m_distanceSquared)
+        return (m_distanceSquared < rhs.m_distanceSquared);
+
+    return (m_pCaloHit->GetIndex() < rhs.m_pCaloHit->GetIndex());
+}
+
+} // namespace pandora
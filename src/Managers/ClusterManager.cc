@@ -47,12 +47,14 @@ StatusCode ClusterManager::Create(const object_creation::Cluster::Parameters &pa
         if (m_nameToListMap.end() == iter)
              throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
 
+        const ObjectPool::Activation activation(m_objectPool);
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, factory.Create(parameters, pCluster));
 
         if (!pCluster)
              throw StatusCodeException(STATUS_CODE_FAILURE);
 
-        iter->second->push_back(pCluster);
+        this->AddObjectToList(*iter->second, pCluster);
+        ++m_nObjectsCreated;
         return STATUS_CODE_SUCCESS;
     }
     catch (StatusCodeException &statusCodeException)
@@ -147,16 +149,14 @@ StatusCode ClusterManager::MergeAndDeleteClusters(const Cluster *const pClusterT
     if ((m_nameToListMap.end() == enlargeListIter) || (m_nameToListMap.end() == deleteListIter))
         return STATUS_CODE_NOT_INITIALIZED;
 
-    ClusterList::iterator clusterToEnlargeIter = std::find(enlargeListIter->second->begin(), enlargeListIter->second->end(), pClusterToEnlarge);
-    ClusterList::iterator clusterToDeleteIter = std::find(deleteListIter->second->begin(), deleteListIter->second->end(), pClusterToDelete);
-
-    if ((enlargeListIter->second->end() == clusterToEnlargeIter) || (deleteListIter->second->end() == clusterToDeleteIter))
+    if (!this->GetListIndex(*enlargeListIter->second).count(pClusterToEnlarge) || !this->GetListIndex(*deleteListIter->second).count(pClusterToDelete))
         return STATUS_CODE_NOT_FOUND;
 
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Modifiable(pClusterToEnlarge)->AddHitsFromSecondCluster(pClusterToDelete));
 
-    clusterToDeleteIter = deleteListIter->second->erase(clusterToDeleteIter);
+    this->EraseObject(*deleteListIter->second, pClusterToDelete);
     delete pClusterToDelete;
+    ++m_nObjectsDeleted;
 
     return STATUS_CODE_SUCCESS;
 }
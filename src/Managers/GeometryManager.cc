@@ -20,9 +20,10 @@ namespace pandora
 {
 
 GeometryManager::GeometryManager(const Pandora *const pPandora) :
-    m_hitTypeToGranularityMap(this->GetDefaultHitTypeToGranularityMap()),
+    m_pGeometryContent(nullptr),
     m_pPandora(pPandora)
 {
+    m_pGeometryContent = new GeometryContent(this->GetDefaultHitTypeToGranularityMap());
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -36,9 +37,10 @@ GeometryManager::~GeometryManager()
 
 const SubDetector &GeometryManager::GetSubDetector(const std::string &subDetectorName) const
 {
-    SubDetectorMap::const_iterator iter = m_subDetectorMap.find(subDetectorName);
+    const SubDetectorMap &subDetectorMap(m_pGeometryContent->m_subDetectorMap);
+    SubDetectorMap::const_iterator iter = subDetectorMap.find(subDetectorName);
 
-    if (m_subDetectorMap.end() == iter)
+    if (subDetectorMap.end() == iter)
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
     return *(iter->second);
@@ -48,12 +50,13 @@ const SubDetector &GeometryManager::GetSubDetector(const std::string &subDetecto
 
 const SubDetector &GeometryManager::GetSubDetector(const SubDetectorType subDetectorType) const
 {
-    SubDetectorTypeMap::const_iterator iter = m_subDetectorTypeMap.find(subDetectorType);
+    const SubDetectorTypeMap &subDetectorTypeMap(m_pGeometryContent->m_subDetectorTypeMap);
+    SubDetectorTypeMap::const_iterator iter = subDetectorTypeMap.find(subDetectorType);
 
-    if (m_subDetectorTypeMap.end() == iter)
+    if (subDetectorTypeMap.end() == iter)
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
-    if (m_subDetectorTypeMap.count(subDetectorType) != 1)
+    if (subDetectorTypeMap.count(subDetectorType) != 1)
         throw StatusCodeException(STATUS_CODE_OUT_OF_RANGE);
 
     return *(iter->second);
@@ -63,19 +66,22 @@ const SubDetector &GeometryManager::GetSubDetector(const SubDetectorType subDete
 
 const LArTPC &GeometryManager::GetLArTPC() const
 {
-    if (1 != m_larTPCMap.size())
+    const LArTPCMap &larTPCMap(m_pGeometryContent->m_larTPCMap);
+
+    if (1 != larTPCMap.size())
         throw StatusCodeException(STATUS_CODE_OUT_OF_RANGE);
 
-    return *(m_larTPCMap.begin()->second);
+    return *(larTPCMap.begin()->second);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 Granularity GeometryManager::GetHitTypeGranularity(const HitType hitType) const
 {
-    HitTypeToGranularityMap::const_iterator iter = m_hitTypeToGranularityMap.find(hitType);
+    const HitTypeToGranularityMap &hitTypeToGranularityMap(m_pGeometryContent->m_hitTypeToGranularityMap);
+    HitTypeToGranularityMap::const_iterator iter = hitTypeToGranularityMap.find(hitType);
 
-    if (m_hitTypeToGranularityMap.end() != iter)
+    if (hitTypeToGranularityMap.end() != iter)
         return iter->second;
 
     std::cout << "GeometryManager: specified hitType must be registered with a specific granularity. See PandoraApi.h " << std::endl;
@@ -84,19 +90,35 @@ Granularity GeometryManager::GetHitTypeGranularity(const HitType hitType) const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void GeometryManager::IsInAnyGap(const CartesianPointVector &positionVectors, const HitType hitType, const float gapTolerance,
+    BoolVector &isInGapVector) const
+{
+    const DetectorGapIndex &detectorGapIndex(m_pGeometryContent->m_detectorGapIndex);
+    isInGapVector.clear();
+    isInGapVector.reserve(positionVectors.size());
+
+    for (const CartesianVector &positionVector : positionVectors)
+        isInGapVector.push_back(detectorGapIndex.IsInAnyGap(positionVector, hitType, gapTolerance));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode GeometryManager::CreateSubDetector(const object_creation::Geometry::SubDetector::Parameters &parameters,
     const ObjectFactory<object_creation::Geometry::SubDetector::Parameters, object_creation::Geometry::SubDetector::Object> &factory)
 {
+    if (!this->IsModifiable())
+        return STATUS_CODE_NOT_ALLOWED;
+
     const SubDetector *pSubDetector = nullptr;
 
     try
     {
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, factory.Create(parameters, pSubDetector));
 
-        if (!m_subDetectorMap.insert(SubDetectorMap::value_type(pSubDetector->GetSubDetectorName(), pSubDetector)).second)
+        if (!m_pGeometryContent->m_subDetectorMap.insert(SubDetectorMap::value_type(pSubDetector->GetSubDetectorName(), pSubDetector)).second)
             throw StatusCodeException(STATUS_CODE_FAILURE);
 
-        m_subDetectorTypeMap.insert(SubDetectorTypeMap::value_type(pSubDetector->GetSubDetectorType(), pSubDetector));
+        m_pGeometryContent->m_subDetectorTypeMap.insert(SubDetectorTypeMap::value_type(pSubDetector->GetSubDetectorType(), pSubDetector));
     }
     catch (StatusCodeException &statusCodeException)
     {
@@ -114,13 +136,16 @@ StatusCode GeometryManager::CreateSubDetector(const object_creation::Geometry::S
 StatusCode GeometryManager::CreateLArTPC(const object_creation::Geometry::LArTPC::Parameters &parameters,
     const ObjectFactory<object_creation::Geometry::LArTPC::Parameters, object_creation::Geometry::LArTPC::Object> &factory)
 {
+    if (!this->IsModifiable())
+        return STATUS_CODE_NOT_ALLOWED;
+
     const LArTPC *pLArTPC = nullptr;
 
     try
     {
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, factory.Create(parameters, pLArTPC));
 
-        if (!m_larTPCMap.insert(LArTPCMap::value_type(pLArTPC->GetLArTPCVolumeId(), pLArTPC)).second)
+        if (!m_pGeometryContent->m_larTPCMap.insert(LArTPCMap::value_type(pLArTPC->GetLArTPCVolumeId(), pLArTPC)).second)
             throw StatusCodeException(STATUS_CODE_FAILURE);
     }
     catch (StatusCodeException &statusCodeException)
@@ -139,6 +164,9 @@ StatusCode GeometryManager::CreateLArTPC(const object_creation::Geometry::LArTPC
 template <typename PARAMETERS, typename OBJECT>
 StatusCode GeometryManager::CreateGap(const PARAMETERS &parameters, const ObjectFactory<PARAMETERS, OBJECT> &factory)
 {
+    if (!this->IsModifiable())
+        return STATUS_CODE_NOT_ALLOWED;
+
     const OBJECT *pDetectorGap = nullptr;
 
     try
@@ -148,7 +176,8 @@ StatusCode GeometryManager::CreateGap(const PARAMETERS &parameters, const Object
         if (!pDetectorGap)
             return STATUS_CODE_FAILURE;
 
-        m_detectorGapList.push_back(pDetectorGap);
+        m_pGeometryContent->m_detectorGapList.push_back(pDetectorGap);
+        m_pGeometryContent->m_detectorGapIndex.AddDetectorGap(pDetectorGap);
         return STATUS_CODE_SUCCESS;
     }
     catch (StatusCodeException &statusCodeException)
@@ -162,28 +191,70 @@ StatusCode GeometryManager::CreateGap(const PARAMETERS &parameters, const Object
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode GeometryManager::EraseAllContent()
+StatusCode GeometryManager::IndexDetectorGaps()
 {
-    for (const SubDetectorMap::value_type &mapEntry : m_subDetectorMap)
-        delete mapEntry.second;
+    // ATTN Shared content is indexed before it is first shared, after which it is immutable, so the index is never rebuilt concurrently
+    if (m_pGeometryContent->m_detectorGapIndex.IsUpToDate())
+        return STATUS_CODE_SUCCESS;
 
-    for (const LArTPCMap::value_type &mapEntry : m_larTPCMap)
-        delete mapEntry.second;
+    if (!this->IsModifiable())
+        return STATUS_CODE_NOT_ALLOWED;
 
-    for (const DetectorGap *const pDetectorGap : m_detectorGapList)
-        delete pDetectorGap;
+    m_pGeometryContent->m_detectorGapIndex.Build();
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode GeometryManager::ShareContent(const GeometryManager &sourceManager)
+{
+    if (this == &sourceManager)
+        return STATUS_CODE_INVALID_PARAMETER;
 
-    m_subDetectorMap.clear();
-    m_larTPCMap.clear();
-    m_subDetectorTypeMap.clear();
-    m_detectorGapList.clear();
-    m_hitTypeToGranularityMap.clear();
+    if (m_pGeometryContent == sourceManager.m_pGeometryContent)
+        return STATUS_CODE_SUCCESS;
+
+    // ATTN Sharing is expected to happen during setup, before either pandora instance is used to process events
+    GeometryContent *const pGeometryContent(sourceManager.m_pGeometryContent);
+
+    if (!pGeometryContent->m_detectorGapIndex.IsUpToDate())
+        pGeometryContent->m_detectorGapIndex.Build();
+
+    pGeometryContent->m_isShared = true;
+    ++(pGeometryContent->m_nReferences);
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->EraseAllContent());
+    m_pGeometryContent = pGeometryContent;
 
     return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode GeometryManager::EraseAllContent()
+{
+    if (m_pGeometryContent && (0 == --(m_pGeometryContent->m_nReferences)))
+        delete m_pGeometryContent;
+
+    m_pGeometryContent = nullptr;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool GeometryManager::IsModifiable() const
+{
+    if (!m_pGeometryContent->m_isShared)
+        return true;
+
+    std::cout << "GeometryManager: geometry shared between pandora instances is immutable and cannot be modified" << std::endl;
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 GeometryManager::HitTypeToGranularityMap GeometryManager::GetDefaultHitTypeToGranularityMap() const
 {
     HitTypeToGranularityMap hitTypeToGranularityMap;
@@ -207,15 +278,19 @@ GeometryManager::HitTypeToGranularityMap GeometryManager::GetDefaultHitTypeToGra
 
 StatusCode GeometryManager::SetHitTypeGranularity(const HitType hitType, const Granularity granularity)
 {
-    HitTypeToGranularityMap::iterator iter = m_hitTypeToGranularityMap.find(hitType);
+    if (!this->IsModifiable())
+        return STATUS_CODE_NOT_ALLOWED;
 
-    if (m_hitTypeToGranularityMap.end() != iter)
+    HitTypeToGranularityMap &hitTypeToGranularityMap(m_pGeometryContent->m_hitTypeToGranularityMap);
+    HitTypeToGranularityMap::iterator iter = hitTypeToGranularityMap.find(hitType);
+
+    if (hitTypeToGranularityMap.end() != iter)
     {
         iter->second = granularity;
     }
     else
     {
-        m_hitTypeToGranularityMap[hitType] = granularity;
+        hitTypeToGranularityMap[hitType] = granularity;
     }
 
     return STATUS_CODE_SUCCESS;
@@ -224,6 +299,30 @@ StatusCode GeometryManager::SetHitTypeGranularity(const HitType hitType, const G
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+GeometryManager::GeometryContent::GeometryContent(const HitTypeToGranularityMap &hitTypeToGranularityMap) :
+    m_hitTypeToGranularityMap(hitTypeToGranularityMap),
+    m_nReferences(1),
+    m_isShared(false)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+GeometryManager::GeometryContent::~GeometryContent()
+{
+    for (const SubDetectorMap::value_type &mapEntry : m_subDetectorMap)
+        delete mapEntry.second;
+
+    for (const LArTPCMap::value_type &mapEntry : m_larTPCMap)
+        delete mapEntry.second;
+
+    for (const DetectorGap *const pDetectorGap : m_detectorGapList)
+        delete pDetectorGap;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template StatusCode GeometryManager::CreateGap(const object_creation::Geometry::LineGap::Parameters &, const ObjectFactory<object_creation::Geometry::LineGap::Parameters, object_creation::Geometry::LineGap::Object> &);
 template StatusCode GeometryManager::CreateGap(const object_creation::Geometry::BoxGap::Parameters &, const ObjectFactory<object_creation::Geometry::BoxGap::Parameters, object_creation::Geometry::BoxGap::Object> &);
 template StatusCode GeometryManager::CreateGap(const object_creation::Geometry::ConcentricGap::Parameters &, const ObjectFactory<object_creation::Geometry::ConcentricGap::Parameters, object_creation::Geometry::ConcentricGap::Object> &);
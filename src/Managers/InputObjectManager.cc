@@ -23,7 +23,8 @@ namespace pandora
 template<typename T>
 InputObjectManager<T>::InputObjectManager(const Pandora *const pPandora) :
     Manager<T>(pPandora),
-    m_inputListName("Input")
+    m_inputListName("Input"),
+    m_nIndices(0)
 {
 }
 
@@ -170,8 +171,12 @@ StatusCode InputObjectManager<T>::EraseAllContent()
     {
         for (const T *const pT : *inputIter->second)
             delete pT;
+
+        Manager<T>::m_nObjectsDeleted += inputIter->second->size();
     }
 
+    m_nIndices = 0;
+
     return Manager<T>::EraseAllContent();
 }
 
@@ -187,6 +192,14 @@ StatusCode InputObjectManager<T>::CreateInitialLists()
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+void InputObjectManager<T>::AssignIndex(const T *const pT)
+{
+    this->Modifiable(pT)->m_index = m_nIndices++;
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -44,6 +44,7 @@ StatusCode MCManager::Create(const object_creation::MCParticle::Parameters &para
 
     try
     {
+        const ObjectPool::Activation activation(m_objectPool);
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, factory.Create(parameters, pMCParticle));
 
         NameToListMap::iterator inputIter = m_nameToListMap.find(m_inputListName);
@@ -54,7 +55,9 @@ StatusCode MCManager::Create(const object_creation::MCParticle::Parameters &para
         if (!m_uidToMCParticleMap.insert(UidToMCParticleMap::value_type(pMCParticle->GetUid(), pMCParticle)).second)
             throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
 
+        this->AssignIndex(pMCParticle);
         inputIter->second->push_back(pMCParticle);
+        ++m_nObjectsCreated;
         return STATUS_CODE_SUCCESS;
     }
     catch (StatusCodeException &statusCodeException)
@@ -17,7 +17,9 @@ template<typename T>
 Manager<T>::Manager(const Pandora *const pPandora) :
     m_nullListName("NullList"),
     m_pPandora(pPandora),
-    m_currentListName(m_nullListName)
+    m_currentListName(m_nullListName),
+    m_nObjectsCreated(0),
+    m_nObjectsDeleted(0)
 {
 }
 
@@ -248,6 +250,7 @@ StatusCode Manager<T>::ResetForNextEvent()
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->EraseAllContent());
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CreateInitialLists());
+    m_objectPool.Reset();
 
     return STATUS_CODE_SUCCESS;
 }
@@ -15,15 +15,14 @@
 namespace pandora
 {
 
-CaloHitMetadata::CaloHitMetadata(CaloHitList *const pCaloHitList, const std::string &caloHitListName, const bool initialHitAvailability) :
+CaloHitMetadata::CaloHitMetadata(CaloHitList *const pCaloHitList, const CaloHitList *const pBaseCaloHitList,
+        const CaloHitSet *const pBaseCaloHitSet, const std::string &caloHitListName, const bool initialHitAvailability) :
     m_pCaloHitList(pCaloHitList),
-    m_caloHitListName(caloHitListName)
+    m_pBaseCaloHitList(pBaseCaloHitList),
+    m_pBaseCaloHitSet(pBaseCaloHitSet),
+    m_caloHitListName(caloHitListName),
+    m_initialHitAvailability(initialHitAvailability)
 {
-    for (const CaloHit *const pCaloHit : *pCaloHitList)
-    {
-        if (!m_caloHitUsageMap.insert(CaloHitUsageMap::value_type(pCaloHit, initialHitAvailability)).second)
-            throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
-    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -46,10 +45,13 @@ bool CaloHitMetadata::IsAvailable(const CaloHit *const pCaloHit) const
 {
     CaloHitUsageMap::const_iterator usageMapIter = m_caloHitUsageMap.find(pCaloHit);
 
-    if ((m_caloHitUsageMap.end()) == usageMapIter || !usageMapIter->second)
+    if (m_caloHitUsageMap.end() != usageMapIter)
+        return usageMapIter->second;
+
+    if (!m_initialHitAvailability || m_removedCaloHits.count(pCaloHit))
         return false;
 
-    return true;
+    return (m_pBaseCaloHitSet->count(pCaloHit) > 0);
 }
 
 template <>
@@ -57,9 +59,7 @@ bool CaloHitMetadata::IsAvailable(const CaloHitList *const pCaloHitList) const
 {
     for (const CaloHit *const pCaloHit : *pCaloHitList)
     {
-        CaloHitUsageMap::const_iterator usageMapIter = m_caloHitUsageMap.find(pCaloHit);
-
-        if ((m_caloHitUsageMap.end()) == usageMapIter || !usageMapIter->second)
+        if (!this->IsAvailable(pCaloHit))
             return false;
     }
 
@@ -71,12 +71,10 @@ bool CaloHitMetadata::IsAvailable(const CaloHitList *const pCaloHitList) const
 template <>
 StatusCode CaloHitMetadata::SetAvailability(const CaloHit *const pCaloHit, bool isAvailable)
 {
-    CaloHitUsageMap::iterator usageMapIter = m_caloHitUsageMap.find(pCaloHit);
-
-    if (m_caloHitUsageMap.end() == usageMapIter)
+    if (!this->IsMember(pCaloHit))
         return STATUS_CODE_NOT_FOUND;
 
-    usageMapIter->second = isAvailable;
+    m_caloHitUsageMap[pCaloHit] = isAvailable;
 
     return STATUS_CODE_SUCCESS;
 }
@@ -86,12 +84,10 @@ StatusCode CaloHitMetadata::SetAvailability(const CaloHitList *const pCaloHitLis
 {
     for (const CaloHit *const pCaloHit : *pCaloHitList)
     {
-        CaloHitUsageMap::iterator usageMapIter = m_caloHitUsageMap.find(pCaloHit);
-
-        if (m_caloHitUsageMap.end() == usageMapIter)
+        if (!this->IsMember(pCaloHit))
             return STATUS_CODE_NOT_FOUND;
 
-        usageMapIter->second = isAvailable;
+        m_caloHitUsageMap[pCaloHit] = isAvailable;
     }
 
     return STATUS_CODE_SUCCESS;
@@ -101,27 +97,17 @@ StatusCode CaloHitMetadata::SetAvailability(const CaloHitList *const pCaloHitLis
 
 StatusCode CaloHitMetadata::Update(const CaloHitMetadata &caloHitMetadata)
 {
-    const CaloHitReplacementList &caloHitReplacementList(caloHitMetadata.GetCaloHitReplacementList());
-
-    for (const CaloHitReplacement *const pCaloHitReplacement : caloHitReplacementList)
-    {
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Update(*pCaloHitReplacement));
-    }
-
-    const CaloHitUsageMap &caloHitUsageMap(caloHitMetadata.GetCaloHitUsageMap());
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Update(caloHitMetadata.GetCaloHitReplacementList()));
 
     CaloHitVector caloHitVector;
-    for (const CaloHitUsageMap::value_type &mapEntry : caloHitUsageMap) caloHitVector.push_back(mapEntry.first);
-    std::sort(caloHitVector.begin(), caloHitVector.end(), PointerLessThan<CaloHit>());
+    caloHitMetadata.GetCaloHits(caloHitVector);
 
     for (const CaloHit *const pCaloHit : caloHitVector)
     {
-        CaloHitUsageMap::iterator usageMapIter = m_caloHitUsageMap.find(pCaloHit);
-
-        if (m_caloHitUsageMap.end() == usageMapIter)
+        if (!this->IsMember(pCaloHit))
             return STATUS_CODE_FAILURE;
 
-        usageMapIter->second = caloHitUsageMap.at(pCaloHit);
+        m_caloHitUsageMap[pCaloHit] = caloHitMetadata.IsAvailable(pCaloHit);
     }
 
     return STATUS_CODE_SUCCESS;
@@ -133,13 +119,12 @@ StatusCode CaloHitMetadata::Update(const CaloHitReplacement &caloHitReplacement)
 {
     for (const CaloHit *const pCaloHit : caloHitReplacement.m_newCaloHits)
     {
-        if (m_pCaloHitList->end() != std::find(m_pCaloHitList->begin(), m_pCaloHitList->end(), pCaloHit))
+        if (this->IsMember(pCaloHit))
             return STATUS_CODE_ALREADY_PRESENT;
 
         m_pCaloHitList->push_back(pCaloHit);
-
-        if (!m_caloHitUsageMap.insert(CaloHitUsageMap::value_type(pCaloHit, true)).second)
-            return STATUS_CODE_ALREADY_PRESENT;
+        m_caloHitUsageMap[pCaloHit] = true;
+        (void) m_removedCaloHits.erase(pCaloHit);
     }
 
     if (m_pCaloHitList == &caloHitReplacement.m_oldCaloHits)
@@ -149,20 +134,78 @@ StatusCode CaloHitMetadata::Update(const CaloHitReplacement &caloHitReplacement)
     {
         CaloHitList::iterator listIter = std::find(m_pCaloHitList->begin(), m_pCaloHitList->end(), pCaloHit);
 
-        if (m_pCaloHitList->end() == listIter)
+        if ((m_pCaloHitList->end() == listIter) || !this->IsMember(pCaloHit))
             return STATUS_CODE_FAILURE;
 
         listIter = m_pCaloHitList->erase(listIter);
+        (void) m_caloHitUsageMap.erase(pCaloHit);
+
+        if (m_pBaseCaloHitSet->count(pCaloHit))
+            (void) m_removedCaloHits.insert(pCaloHit);
+    }
+
+    m_caloHitReplacementList.push_back(new CaloHitReplacement(caloHitReplacement));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CaloHitMetadata::Update(const CaloHitReplacementList &caloHitReplacementList)
+{
+    if (caloHitReplacementList.empty())
+        return STATUS_CODE_SUCCESS;
+
+    // ATTN For look-up efficiency, apply all replacements to the metadata overlay, then make a single pass over the calo hit list
+    CaloHitSet removedCaloHits;
+    CaloHitVector addedCaloHits;
+
+    for (const CaloHitReplacement *const pCaloHitReplacement : caloHitReplacementList)
+    {
+        for (const CaloHit *const pCaloHit : pCaloHitReplacement->m_newCaloHits)
+        {
+            if (this->IsMember(pCaloHit))
+                return STATUS_CODE_ALREADY_PRESENT;
 
-        CaloHitUsageMap::iterator mapIter = m_caloHitUsageMap.find(pCaloHit);
+            addedCaloHits.push_back(pCaloHit);
+            m_caloHitUsageMap[pCaloHit] = true;
+            (void) m_removedCaloHits.erase(pCaloHit);
+        }
 
-        if (m_caloHitUsageMap.end() == mapIter)
+        if (m_pCaloHitList == &pCaloHitReplacement->m_oldCaloHits)
             return STATUS_CODE_FAILURE;
 
-        mapIter = m_caloHitUsageMap.erase(mapIter);
+        for (const CaloHit *const pCaloHit : pCaloHitReplacement->m_oldCaloHits)
+        {
+            if (!this->IsMember(pCaloHit))
+                return STATUS_CODE_FAILURE;
+
+            (void) m_caloHitUsageMap.erase(pCaloHit);
+            (void) removedCaloHits.insert(pCaloHit);
+
+            if (m_pBaseCaloHitSet->count(pCaloHit))
+                (void) m_removedCaloHits.insert(pCaloHit);
+        }
     }
 
-    m_caloHitReplacementList.push_back(new CaloHitReplacement(caloHitReplacement));
+    CaloHitList::iterator keepIter(m_pCaloHitList->begin());
+
+    for (CaloHitList::iterator iter = m_pCaloHitList->begin(), iterEnd = m_pCaloHitList->end(); iter != iterEnd; ++iter)
+    {
+        if (!removedCaloHits.count(*iter))
+            *(keepIter++) = *iter;
+    }
+
+    m_pCaloHitList->erase(keepIter, m_pCaloHitList->end());
+
+    for (const CaloHit *const pCaloHit : addedCaloHits)
+    {
+        if (!removedCaloHits.count(pCaloHit))
+            m_pCaloHitList->push_back(pCaloHit);
+    }
+
+    for (const CaloHitReplacement *const pCaloHitReplacement : caloHitReplacementList)
+        m_caloHitReplacementList.push_back(new CaloHitReplacement(*pCaloHitReplacement));
 
     return STATUS_CODE_SUCCESS;
 }
@@ -175,11 +218,38 @@ void CaloHitMetadata::Clear()
         delete pCaloHitReplacement;
 
     m_pCaloHitList = nullptr;
+    m_pBaseCaloHitList = nullptr;
+    m_pBaseCaloHitSet = nullptr;
     m_caloHitListName.clear();
     m_caloHitUsageMap.clear();
+    m_removedCaloHits.clear();
     m_caloHitReplacementList.clear();
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitMetadata::GetCaloHits(CaloHitVector &caloHitVector) const
+{
+    caloHitVector.clear();
+
+    for (const CaloHit *const pCaloHit : *m_pBaseCaloHitList)
+    {
+        if (!m_removedCaloHits.count(pCaloHit))
+            caloHitVector.push_back(pCaloHit);
+    }
+
+    CaloHitVector addedCaloHits;
+
+    for (const CaloHitUsageMap::value_type &mapEntry : m_caloHitUsageMap)
+    {
+        if (!m_pBaseCaloHitSet->count(mapEntry.first))
+            addedCaloHits.push_back(mapEntry.first);
+    }
+
+    std::sort(addedCaloHits.begin(), addedCaloHits.end(), IndexLessThan<CaloHit>());
+    caloHitVector.insert(caloHitVector.end(), addedCaloHits.begin(), addedCaloHits.end());
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -189,6 +259,12 @@ ReclusterMetadata::ReclusterMetadata(CaloHitList *const pCaloHitList) :
 {
     if (m_caloHitList.empty())
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+
+    for (const CaloHit *const pCaloHit : m_caloHitList)
+    {
+        if (!m_caloHitSet.insert(pCaloHit).second)
+            throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -204,7 +280,7 @@ ReclusterMetadata::~ReclusterMetadata()
 StatusCode ReclusterMetadata::CreateCaloHitMetadata(CaloHitList *const pCaloHitList, const std::string &caloHitListName,
     const std::string &reclusterListName, const bool initialHitAvailability)
 {
-    m_pCurrentCaloHitMetadata = new CaloHitMetadata(pCaloHitList, caloHitListName, initialHitAvailability);
+    m_pCurrentCaloHitMetadata = new CaloHitMetadata(pCaloHitList, &m_caloHitList, &m_caloHitSet, caloHitListName, initialHitAvailability);
 
     if (!m_nameToMetadataMap.insert(NameToMetadataMap::value_type(reclusterListName, m_pCurrentCaloHitMetadata)).second)
     {
@@ -47,12 +47,14 @@ StatusCode ParticleFlowObjectManager::Create(const object_creation::ParticleFlow
         if (m_nameToListMap.end() == iter)
              throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
 
+        const ObjectPool::Activation activation(m_objectPool);
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, factory.Create(parameters, pPfo));
 
         if (!pPfo)
              throw StatusCodeException(STATUS_CODE_FAILURE);
 
-        iter->second->push_back(pPfo);
+        this->AddObjectToList(*iter->second, pPfo);
+        ++m_nObjectsCreated;
         return STATUS_CODE_SUCCESS;
     }
     catch (StatusCodeException &statusCodeException)
@@ -12,18 +12,22 @@
 
 #include "Plugins/BFieldPlugin.h"
 #include "Plugins/EnergyCorrectionsPlugin.h"
+#include "Plugins/InterpolatedBFieldPlugin.h"
 #include "Plugins/LArTransformationPlugin.h"
 #include "Plugins/ParticleIdPlugin.h"
 #include "Plugins/PseudoLayerPlugin.h"
 #include "Plugins/ShowerProfilePlugin.h"
+#include "Plugins/TabulatedPseudoLayerPlugin.h"
 
 namespace pandora
 {
 
 PluginManager::PluginManager(const Pandora *const pPandora) :
     m_pBFieldPlugin(nullptr),
+    m_pInterpolatedBFieldPlugin(nullptr),
     m_pLArTransformationPlugin(nullptr),
     m_pPseudoLayerPlugin(nullptr),
+    m_pTabulatedPseudoLayerPlugin(nullptr),
     m_pShowerProfilePlugin(nullptr),
     m_pEnergyCorrections(nullptr),
     m_pParticleId(nullptr),
@@ -52,8 +56,10 @@ PluginManager::PluginManager(const Pandora *const pPandora) :
 
 PluginManager::~PluginManager()
 {
+    delete m_pInterpolatedBFieldPlugin;
     delete m_pBFieldPlugin;
     delete m_pLArTransformationPlugin;
+    delete m_pTabulatedPseudoLayerPlugin;
     delete m_pPseudoLayerPlugin;
     delete m_pShowerProfilePlugin;
 
@@ -96,6 +102,9 @@ const BFieldPlugin *PluginManager::GetBFieldPlugin() const
     if (!m_pBFieldPlugin)
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
 
+    if (m_pInterpolatedBFieldPlugin)
+        return m_pInterpolatedBFieldPlugin;
+
     return m_pBFieldPlugin;
 }
 
@@ -116,6 +125,9 @@ const PseudoLayerPlugin *PluginManager::GetPseudoLayerPlugin() const
     if (!m_pPseudoLayerPlugin)
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
 
+    if (m_pTabulatedPseudoLayerPlugin)
+        return m_pTabulatedPseudoLayerPlugin;
+
     return m_pPseudoLayerPlugin;
 }
 
@@ -206,6 +218,16 @@ StatusCode PluginManager::InitializePlugins(const TiXmlHandle *const pXmlHandle)
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pBFieldPlugin->ReadSettings(TiXmlHandle(pBFieldXmlElement)));
 
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pBFieldPlugin->Initialize());
+
+        TiXmlElement *const pInterpolatedBFieldXmlElement(pXmlHandle->FirstChild("InterpolatedBFieldPlugin").Element());
+
+        if ((nullptr != pInterpolatedBFieldXmlElement) && (nullptr == m_pInterpolatedBFieldPlugin))
+        {
+            m_pInterpolatedBFieldPlugin = new InterpolatedBFieldPlugin(m_pBFieldPlugin);
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pInterpolatedBFieldPlugin->RegisterDetails(m_pPandora, "InterpolatedBFieldPlugin", "InterpolatedBFieldPlugin"));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pInterpolatedBFieldPlugin->ReadSettings(TiXmlHandle(pInterpolatedBFieldXmlElement)));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pInterpolatedBFieldPlugin->Initialize());
+        }
     }
 
     if (nullptr != m_pLArTransformationPlugin)
@@ -228,6 +250,16 @@ StatusCode PluginManager::InitializePlugins(const TiXmlHandle *const pXmlHandle)
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPseudoLayerPlugin->ReadSettings(TiXmlHandle(pPseudoLayerXmlElement)));
 
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPseudoLayerPlugin->Initialize());
+
+        TiXmlElement *const pTabulatedPseudoLayerXmlElement(pXmlHandle->FirstChild("TabulatedPseudoLayerPlugin").Element());
+
+        if ((nullptr != pTabulatedPseudoLayerXmlElement) && (nullptr == m_pTabulatedPseudoLayerPlugin))
+        {
+            m_pTabulatedPseudoLayerPlugin = new TabulatedPseudoLayerPlugin(m_pPseudoLayerPlugin);
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pTabulatedPseudoLayerPlugin->RegisterDetails(m_pPandora, "TabulatedPseudoLayerPlugin", "TabulatedPseudoLayerPlugin"));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pTabulatedPseudoLayerPlugin->ReadSettings(TiXmlHandle(pTabulatedPseudoLayerXmlElement)));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pTabulatedPseudoLayerPlugin->Initialize());
+        }
     }
 
     if (nullptr != m_pShowerProfilePlugin)
@@ -254,12 +286,18 @@ StatusCode PluginManager::ResetForNextEvent()
     if (m_pBFieldPlugin)
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pBFieldPlugin->Reset());
 
+    if (m_pInterpolatedBFieldPlugin)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pInterpolatedBFieldPlugin->Reset());
+
     if (m_pLArTransformationPlugin)
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pLArTransformationPlugin->Reset());
 
     if (m_pPseudoLayerPlugin)
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPseudoLayerPlugin->Reset());
 
+    if (m_pTabulatedPseudoLayerPlugin)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pTabulatedPseudoLayerPlugin->Reset());
+
     if (m_pShowerProfilePlugin)
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pShowerProfilePlugin->Reset());
 
@@ -40,6 +40,7 @@ StatusCode TrackManager::Create(const object_creation::Track::Parameters &parame
 
     try
     {
+        const ObjectPool::Activation activation(m_objectPool);
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, factory.Create(parameters, pTrack));
 
         NameToListMap::iterator inputIter = m_nameToListMap.find(m_inputListName);
@@ -50,7 +51,9 @@ StatusCode TrackManager::Create(const object_creation::Track::Parameters &parame
         if (!m_uidToTrackMap.insert(UidToTrackMap::value_type(pTrack->GetParentAddress(), pTrack)).second)
             throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
 
+        this->AssignIndex(pTrack);
         inputIter->second->push_back(pTrack);
+        ++m_nObjectsCreated;
         return STATUS_CODE_SUCCESS;
     }
     catch (StatusCodeException &statusCodeException)
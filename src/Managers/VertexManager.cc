@@ -47,12 +47,14 @@ StatusCode VertexManager::Create(const object_creation::Vertex::Parameters &para
         if (m_nameToListMap.end() == iter)
              throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
 
+        const ObjectPool::Activation activation(m_objectPool);
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, factory.Create(parameters, pVertex));
 
         if (!pVertex)
              throw StatusCodeException(STATUS_CODE_FAILURE);
 
-        iter->second->push_back(pVertex);
+        this->AddObjectToList(*iter->second, pVertex);
+        ++m_nObjectsCreated;
         return STATUS_CODE_SUCCESS;
     }
     catch (StatusCodeException &statusCodeException)
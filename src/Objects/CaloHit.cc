@@ -7,6 +7,7 @@
  */
 
 #include "Objects/CaloHit.h"
+#include "Objects/CaloHitBlock.h"
 
 #include <cmath>
 
@@ -75,7 +76,44 @@ CaloHit::CaloHit(const object_creation::CaloHit::Parameters &parameters) :
     m_isIsolated(false),
     m_isAvailable(true),
     m_weight(1.f),
-    m_pParentAddress(parameters.m_pParentAddress.Get())
+    m_pParentAddress(parameters.m_pParentAddress.Get()),
+    m_index(0)
+{
+    m_cellLengthScale = this->CalculateCellLengthScale();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CaloHit::CaloHit(const CaloHitBlock &caloHitBlock, const unsigned int iCaloHit) :
+    m_positionVector(caloHitBlock.m_positionX[iCaloHit], caloHitBlock.m_positionY[iCaloHit], caloHitBlock.m_positionZ[iCaloHit]),
+    m_x0(0.f),
+    m_expectedDirection(CartesianVector(caloHitBlock.m_expectedDirectionX[iCaloHit], caloHitBlock.m_expectedDirectionY[iCaloHit],
+        caloHitBlock.m_expectedDirectionZ[iCaloHit]).GetUnitVector()),
+    m_cellNormalVector(CartesianVector(caloHitBlock.m_cellNormalX[iCaloHit], caloHitBlock.m_cellNormalY[iCaloHit],
+        caloHitBlock.m_cellNormalZ[iCaloHit]).GetUnitVector()),
+    m_cellGeometry(caloHitBlock.m_cellGeometry[iCaloHit]),
+    m_cellSize0(caloHitBlock.m_cellSize0[iCaloHit]),
+    m_cellSize1(caloHitBlock.m_cellSize1[iCaloHit]),
+    m_cellThickness(caloHitBlock.m_cellThickness[iCaloHit]),
+    m_nCellRadiationLengths(caloHitBlock.m_nCellRadiationLengths[iCaloHit]),
+    m_nCellInteractionLengths(caloHitBlock.m_nCellInteractionLengths[iCaloHit]),
+    m_time(caloHitBlock.m_time[iCaloHit]),
+    m_inputEnergy(caloHitBlock.m_inputEnergy[iCaloHit]),
+    m_mipEquivalentEnergy(caloHitBlock.m_mipEquivalentEnergy[iCaloHit]),
+    m_electromagneticEnergy(caloHitBlock.m_electromagneticEnergy[iCaloHit]),
+    m_hadronicEnergy(caloHitBlock.m_hadronicEnergy[iCaloHit]),
+    m_isDigital(0 != caloHitBlock.m_isDigital[iCaloHit]),
+    m_hitType(caloHitBlock.m_hitType[iCaloHit]),
+    m_hitRegion(caloHitBlock.m_hitRegion[iCaloHit]),
+    m_layer(caloHitBlock.m_layer[iCaloHit]),
+    m_isInOuterSamplingLayer(0 != caloHitBlock.m_isInOuterSamplingLayer[iCaloHit]),
+    m_cellLengthScale(0.f),
+    m_isPossibleMip(false),
+    m_isIsolated(false),
+    m_isAvailable(true),
+    m_weight(1.f),
+    m_pParentAddress(caloHitBlock.m_parentAddress[iCaloHit]),
+    m_index(0)
 {
     m_cellLengthScale = this->CalculateCellLengthScale();
 }
@@ -110,7 +148,8 @@ CaloHit::CaloHit(const object_creation::CaloHitFragment::Parameters &parameters)
     m_isAvailable(parameters.m_pOriginalCaloHit->m_isAvailable),
     m_weight(parameters.m_weight.Get() * parameters.m_pOriginalCaloHit->m_weight),
     m_mcParticleWeightMap(parameters.m_pOriginalCaloHit->m_mcParticleWeightMap),
-    m_pParentAddress(parameters.m_pOriginalCaloHit->m_pParentAddress)
+    m_pParentAddress(parameters.m_pOriginalCaloHit->m_pParentAddress),
+    m_index(0)
 {
     for (MCParticleWeightMap::value_type &mapEntry : m_mcParticleWeightMap)
         mapEntry.second = mapEntry.second * parameters.m_weight.Get();
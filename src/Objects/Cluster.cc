@@ -53,6 +53,18 @@ const CartesianVector Cluster::GetCentroid(const unsigned int pseudoLayer) const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+const ClusterFitMoments &Cluster::GetFitMoments(const unsigned int pseudoLayer) const
+{
+    PointByPseudoLayerMap::const_iterator pointValueIter = m_sumXYZByPseudoLayer.find(pseudoLayer);
+
+    if (m_sumXYZByPseudoLayer.end() == pointValueIter)
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    return pointValueIter->second.m_fitMoments;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 const CartesianVector &Cluster::GetInitialDirection() const
 {
     if (!m_isDirectionUpToDate)
@@ -316,6 +328,7 @@ StatusCode Cluster::AddCaloHit(const CaloHit *const pCaloHit)
         mypoint.m_xyzPositionSums[1] += y;
         mypoint.m_xyzPositionSums[2] += z;
         ++mypoint.m_nHits;
+        mypoint.m_fitMoments.AddCaloHit(pCaloHit);
     }
     else
     {
@@ -324,8 +337,12 @@ StatusCode Cluster::AddCaloHit(const CaloHit *const pCaloHit)
         mypoint.m_xyzPositionSums[1] = y;
         mypoint.m_xyzPositionSums[2] = z;
         mypoint.m_nHits = 1;
+        mypoint.m_fitMoments.Reset();
+        mypoint.m_fitMoments.AddCaloHit(pCaloHit);
     }
 
+    m_fitMoments.AddCaloHit(pCaloHit);
+
     if (!m_innerPseudoLayer.IsInitialized() || (pseudoLayer < m_innerPseudoLayer.Get()))
         m_innerPseudoLayer = pseudoLayer;
 
@@ -370,12 +387,15 @@ StatusCode Cluster::RemoveCaloHit(const CaloHit *const pCaloHit)
         mypoint.m_xyzPositionSums[1] -= y;
         mypoint.m_xyzPositionSums[2] -= z;
         --mypoint.m_nHits;
+        mypoint.m_fitMoments.RemoveCaloHit(pCaloHit);
     }
     else
     {
         m_sumXYZByPseudoLayer.erase(pseudoLayer);
     }
 
+    m_fitMoments.RemoveCaloHit(pCaloHit);
+
     if (pseudoLayer <= m_innerPseudoLayer.Get())
         m_innerPseudoLayer = m_orderedCaloHitList.begin()->first;
 
@@ -574,6 +594,7 @@ StatusCode Cluster::ResetProperties()
     m_nCaloHitsInOuterLayer = 0;
 
     m_sumXYZByPseudoLayer.clear();
+    m_fitMoments.Reset();
 
     m_electromagneticEnergy = 0;
     m_hadronicEnergy = 0;
@@ -651,6 +672,7 @@ StatusCode Cluster::AddHitsFromSecondCluster(const Cluster *const pCluster)
             mypoint.m_xyzPositionSums[1] += theirpoint.m_xyzPositionSums[1];
             mypoint.m_xyzPositionSums[2] += theirpoint.m_xyzPositionSums[2];
             mypoint.m_nHits += theirpoint.m_nHits;
+            mypoint.m_fitMoments.Add(theirpoint.m_fitMoments);
         }
         else
         {
@@ -658,9 +680,12 @@ StatusCode Cluster::AddHitsFromSecondCluster(const Cluster *const pCluster)
             mypoint.m_xyzPositionSums[1] = theirpoint.m_xyzPositionSums[1];
             mypoint.m_xyzPositionSums[2] = theirpoint.m_xyzPositionSums[2];
             mypoint.m_nHits = theirpoint.m_nHits;
+            mypoint.m_fitMoments = theirpoint.m_fitMoments;
         }
     }
 
+    m_fitMoments.Add(pCluster->m_fitMoments);
+
     m_innerPseudoLayer = m_orderedCaloHitList.begin()->first;
     m_outerPseudoLayer = m_orderedCaloHitList.rbegin()->first;
     return STATUS_CODE_SUCCESS;
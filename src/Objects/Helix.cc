@@ -137,64 +137,14 @@ StatusCode Helix::GetPointInXY(const float x0, const float y0, const float ax, c
     if (AA <= 0)
         return STATUS_CODE_FAILURE;
 
-    const float BB((ax * (x0 - m_xCentre) + ay * (y0 - m_yCentre)) / AA);
-    const float CC(((x0 - m_xCentre) * (x0 - m_xCentre) + (y0 - m_yCentre) * (y0 - m_yCentre) - m_radius * m_radius) / AA);
+    float xx1(0.f), yy1(0.f), xx2(0.f), yy2(0.f);
 
-    const float DET(BB * BB - CC);
-
-    if (DET < 0)
+    if (!Helix::GetPlaneIntersections(m_xCentre, m_yCentre, m_radius, x0, y0, ax, ay, AA, xx1, yy1, xx2, yy2))
         return STATUS_CODE_NOT_FOUND;
 
-    float tt1(-BB + std::sqrt(DET));
-    float tt2(-BB - std::sqrt(DET));
-
-    const float xx1(x0 + tt1 * ax);
-    const float yy1(y0 + tt1 * ay);
-    const float xx2(x0 + tt2 * ax);
-    const float yy2(y0 + tt2 * ay);
-
-    const float phi1(std::atan2(yy1 - m_yCentre, xx1 - m_xCentre));
-    const float phi2(std::atan2(yy2 - m_yCentre, xx2 - m_xCentre));
     const float phi0(std::atan2(referencePoint.GetY() - m_yCentre, referencePoint.GetX() - m_xCentre));
-
-    float dphi1(phi1 - phi0);
-    float dphi2(phi2 - phi0);
-
-    if (dphi1 < 0 && m_charge < 0)
-    {
-        dphi1 = dphi1 + TWO_PI;
-    }
-    else if (dphi1 > 0 && m_charge > 0)
-    {
-        dphi1 = dphi1 - TWO_PI;
-    }
-
-    if (dphi2 < 0 && m_charge < 0)
-    {
-        dphi2 = dphi2 + TWO_PI;
-    }
-    else if (dphi2 > 0 && m_charge > 0)
-    {
-        dphi2 = dphi2 - TWO_PI;
-    }
-
-    // Calculate generic time
-    tt1 = -m_charge * dphi1 * m_radius / m_pxy;
-    tt2 = -m_charge * dphi2 * m_radius / m_pxy;
-
-    if ((tt1 < 0.) || (tt2 < 0.))
-        std::cout << "Helix:: GetPointInXY, warning - negative generic time, tt1 " << tt1 << ", tt2 " << tt2 << std::endl;
-
-    if (tt1 < tt2)
-    {
-        genericTime = tt1;
-        intersectionPoint.SetValues(xx1, yy1, referencePoint.GetZ() + genericTime * m_momentum.GetZ());
-    }
-    else
-    {
-        genericTime = tt2;
-        intersectionPoint.SetValues(xx2, yy2, referencePoint.GetZ() + genericTime * m_momentum.GetZ());
-    }
+    Helix::ChooseIntersection(m_xCentre, m_yCentre, m_radius, m_charge, m_pxy, m_momentum.GetZ(), referencePoint.GetZ(), phi0, xx1, yy1,
+        xx2, yy2, "GetPointInXY", intersectionPoint, genericTime);
 
     return STATUS_CODE_SUCCESS;
 }
@@ -207,12 +157,9 @@ StatusCode Helix::GetPointInZ(const float zPlane, const CartesianVector &referen
     if (std::fabs(m_momentum.GetZ()) < std::numeric_limits<float>::epsilon())
         return STATUS_CODE_NOT_FOUND;
 
-    genericTime = (zPlane - referencePoint.GetZ()) / m_momentum.GetZ();
-
     const float phi0(std::atan2(referencePoint.GetY() - m_yCentre, referencePoint.GetX() - m_xCentre));
-    const float phi(phi0 - m_charge * m_pxy * genericTime / m_radius);
-
-    intersectionPoint.SetValues(m_xCentre + m_radius * std::cos(phi), m_yCentre + m_radius * std::sin(phi), zPlane);
+    Helix::GetPointInZ(m_xCentre, m_yCentre, m_radius, m_charge, m_pxy, m_momentum.GetZ(), referencePoint.GetZ(), phi0, zPlane,
+        intersectionPoint, genericTime);
 
     return STATUS_CODE_SUCCESS;
 }
@@ -223,72 +170,14 @@ StatusCode Helix::GetPointOnCircle(const float radius, const CartesianVector &re
     float &genericTime) const
 {
     const float distCenterToIP(std::sqrt(m_xCentre * m_xCentre + m_yCentre * m_yCentre));
+    float xx1(0.f), yy1(0.f), xx2(0.f), yy2(0.f);
 
-    if ( ((distCenterToIP + m_radius) < radius) || ((m_radius + radius) < distCenterToIP) )
+    if (!Helix::GetCircleIntersections(m_radius, distCenterToIP, std::atan2(m_yCentre, m_xCentre), radius, xx1, yy1, xx2, yy2))
         return STATUS_CODE_NOT_FOUND;
 
-    const float phiCentre(std::atan2(m_yCentre, m_xCentre));
-
-    float phiStar(radius * radius + distCenterToIP * distCenterToIP - m_radius * m_radius);
-    phiStar = 0.5f * phiStar / std::max(1.e-20f, radius * distCenterToIP);
-
-    if (phiStar > 1.f)
-        phiStar = 0.9999999f;
-
-    if (phiStar < -1.f)
-        phiStar = -0.9999999f;
-
-    phiStar = std::acos(phiStar);
-
-    const float xx1(radius * std::cos(phiCentre + phiStar));
-    const float yy1(radius * std::sin(phiCentre + phiStar));
-
-    const float xx2(radius * std::cos(phiCentre-phiStar));
-    const float yy2(radius * std::sin(phiCentre-phiStar));
-
-    const float phi1(std::atan2(yy1 - m_yCentre, xx1 - m_xCentre));
-    const float phi2(std::atan2(yy2 - m_yCentre, xx2 - m_xCentre));
     const float phi0(std::atan2(referencePoint.GetY() - m_yCentre, referencePoint.GetX() - m_xCentre));
-
-    float dphi1(phi1 - phi0);
-    float dphi2(phi2 - phi0);
-
-    if (dphi1 < 0 && m_charge < 0)
-    {
-        dphi1 = dphi1 + TWO_PI;
-    }
-    else if (dphi1 > 0 && m_charge > 0)
-    {
-        dphi1 = dphi1 - TWO_PI;
-    }
-
-    if (dphi2 < 0 && m_charge < 0)
-    {
-        dphi2 = dphi2 + TWO_PI;
-    }
-    else if (dphi2 > 0 && m_charge > 0)
-    {
-        dphi2 = dphi2 - TWO_PI;
-    }
-
-    // Calculate generic time
-    const float tt1(-m_charge * dphi1 * m_radius / m_pxy);
-    const float tt2(-m_charge * dphi2 * m_radius / m_pxy);
-
-    if ((tt1 < 0.) || (tt2 < 0.))
-        std::cout << "Helix:: GetPointOnCircle, warning - negative generic time, tt1 " << tt1 << ", tt2 " << tt2 << std::endl;
-
-    // Previously returned both xx1, xx2, etc.
-    if (tt1 < tt2)
-    {
-        genericTime = tt1;
-        intersectionPoint.SetValues(xx1, yy1, referencePoint.GetZ() + genericTime * m_momentum.GetZ());
-    }
-    else
-    {
-        genericTime = tt2;
-        intersectionPoint.SetValues(xx2, yy2, referencePoint.GetZ() + genericTime * m_momentum.GetZ());
-    }
+    Helix::ChooseIntersection(m_xCentre, m_yCentre, m_radius, m_charge, m_pxy, m_momentum.GetZ(), referencePoint.GetZ(), phi0, xx1, yy1,
+        xx2, yy2, "GetPointOnCircle", intersectionPoint, genericTime);
 
     return STATUS_CODE_SUCCESS;
 }
@@ -297,49 +186,9 @@ StatusCode Helix::GetPointOnCircle(const float radius, const CartesianVector &re
 
 StatusCode Helix::GetDistanceToPoint(const CartesianVector &point, CartesianVector &distance, float &genericTime) const
 {
-    const float phi(std::atan2(point.GetY() - m_yCentre, point.GetX() - m_xCentre));
     const float phi0(std::atan2(m_referencePoint.GetY() - m_yCentre, m_referencePoint.GetX() - m_xCentre));
-
-    int nCircles = 0;
-    if (std::fabs(m_tanLambda * m_radius) > 1.e-20)
-    {
-        const float xCircles((phi0 - phi - m_charge * (point.GetZ() - m_referencePoint.GetZ()) / (m_tanLambda * m_radius)) / TWO_PI);
-
-        int n1, n2;
-        if (xCircles >= std::numeric_limits<float>::epsilon())
-        {
-            n1 = static_cast<int>(xCircles);
-            n2 = n1 + 1;
-        }
-        else
-        {
-            n1 = static_cast<int>(xCircles) - 1;
-            n2 = n1 + 1;
-        }
-
-        nCircles = ((std::fabs(n1 - xCircles) < std::fabs(n2 - xCircles) ? n1 : n2));
-    }
-
-    const float dPhi(TWO_PI * (static_cast<float>(nCircles)) + phi - phi0);
-    const float zOnHelix(m_referencePoint.GetZ() - m_charge * m_radius * m_tanLambda * dPhi);
-
-    const float distX(std::fabs(m_xCentre - point.GetX()));
-    const float distY(std::fabs(m_yCentre - point.GetY()));
-    const float distZ(std::fabs(zOnHelix - point.GetZ()));
-
-    float distXY(std::sqrt(distX * distX + distY * distY));
-    distXY = std::fabs(distXY - m_radius);
-
-    distance.SetValues(distXY, distZ, std::sqrt(distXY * distXY + distZ * distZ));
-
-    if (std::fabs(m_momentum.GetZ()) > 0)
-    {
-        genericTime = (zOnHelix - m_referencePoint.GetZ()) / m_momentum.GetZ();
-    }
-    else
-    {
-        genericTime = m_charge * m_radius * dPhi / m_pxy;
-    }
+    Helix::GetDistanceToPoint(m_xCentre, m_yCentre, m_radius, m_charge, m_tanLambda, m_pxy, m_momentum.GetZ(), m_referencePoint.GetZ(),
+        phi0, point, distance, genericTime);
 
     return STATUS_CODE_SUCCESS;
 }
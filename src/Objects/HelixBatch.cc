@@ -0,0 +1,203 @@
+/**
+ *  @file   PandoraSDK/src/Objects/HelixBatch.cc
+ *
+ *  @brief  Implementation of the helix batch class.
+ *
+ *  $Log: $
+ */
+
+#include "Objects/Helix.h"
+#include "Objects/HelixBatch.h"
+#include "Objects/Track.h"
+
+#include "Plugins/BFieldPlugin.h"
+
+#include <cmath>
+#include <limits>
+
+namespace pandora
+{
+
+HelixBatch::HelixBatch()
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+HelixBatch::HelixBatch(const TrackList &trackList, const BFieldPlugin &bFieldPlugin)
+{
+    for (const Track *const pTrack : trackList)
+    {
+        const TrackState &trackState(pTrack->GetTrackStateAtCalorimeter());
+        const float bField(bFieldPlugin.GetBField(trackState.GetPosition()));
+        this->AddHelix(Helix(trackState.GetPosition(), trackState.GetMomentum(), static_cast<float>(pTrack->GetCharge()), bField));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void HelixBatch::AddHelix(const Helix &helix)
+{
+    const float xCentre(helix.GetXCentre()), yCentre(helix.GetYCentre());
+    const CartesianVector &referencePoint(helix.GetReferencePoint());
+
+    m_xCentre.push_back(xCentre);
+    m_yCentre.push_back(yCentre);
+    m_radius.push_back(helix.GetRadius());
+    m_charge.push_back(helix.GetCharge());
+    m_pxy.push_back(helix.GetPxy());
+    m_pz.push_back(helix.GetMomentum().GetZ());
+    m_tanLambda.push_back(helix.GetTanLambda());
+    m_zReference.push_back(referencePoint.GetZ());
+    m_phiReference.push_back(std::atan2(referencePoint.GetY() - yCentre, referencePoint.GetX() - xCentre));
+    m_phiCentre.push_back(std::atan2(yCentre, xCentre));
+    m_distCentreToIP.push_back(std::sqrt(xCentre * xCentre + yCentre * yCentre));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode HelixBatch::GetDistancesToPoints(const CartesianPointVector &points, CartesianPointVector &distances, FloatVector &genericTimes) const
+{
+    const unsigned int nPoints(points.size());
+    distances.assign(this->GetNHelices() * nPoints, CartesianVector(0.f, 0.f, 0.f));
+    genericTimes.assign(this->GetNHelices() * nPoints, 0.f);
+
+    for (unsigned int iHelix = 0; iHelix < this->GetNHelices(); ++iHelix)
+    {
+        const float xCentre(m_xCentre[iHelix]), yCentre(m_yCentre[iHelix]), radius(m_radius[iHelix]), charge(m_charge[iHelix]);
+        const float tanLambda(m_tanLambda[iHelix]), pxy(m_pxy[iHelix]), pz(m_pz[iHelix]);
+        const float zReference(m_zReference[iHelix]), phiReference(m_phiReference[iHelix]);
+
+        for (unsigned int iPoint = 0; iPoint < nPoints; ++iPoint)
+        {
+            const unsigned int index(iHelix * nPoints + iPoint);
+            Helix::GetDistanceToPoint(xCentre, yCentre, radius, charge, tanLambda, pxy, pz, zReference, phiReference, points[iPoint],
+                distances[index], genericTimes[index]);
+        }
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode HelixBatch::GetPointsInZ(const FloatVector &zPlanes, CartesianPointVector &intersectionPoints, FloatVector &genericTimes,
+    BoolVector &isFound) const
+{
+    const unsigned int nPlanes(zPlanes.size());
+    this->PrepareOutput(nPlanes, intersectionPoints, genericTimes, isFound);
+
+    for (unsigned int iHelix = 0; iHelix < this->GetNHelices(); ++iHelix)
+    {
+        const float pz(m_pz[iHelix]);
+
+        if (std::fabs(pz) < std::numeric_limits<float>::epsilon())
+            continue;
+
+        const float xCentre(m_xCentre[iHelix]), yCentre(m_yCentre[iHelix]), radius(m_radius[iHelix]), charge(m_charge[iHelix]);
+        const float pxy(m_pxy[iHelix]), zReference(m_zReference[iHelix]), phiReference(m_phiReference[iHelix]);
+
+        for (unsigned int iPlane = 0; iPlane < nPlanes; ++iPlane)
+        {
+            const unsigned int index(iHelix * nPlanes + iPlane);
+            Helix::GetPointInZ(xCentre, yCentre, radius, charge, pxy, pz, zReference, phiReference, zPlanes[iPlane],
+                intersectionPoints[index], genericTimes[index]);
+            isFound[index] = true;
+        }
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode HelixBatch::GetPointsInXY(const CartesianPointVector &planePoints, const CartesianPointVector &planeNormals,
+    CartesianPointVector &intersectionPoints, FloatVector &genericTimes, BoolVector &isFound) const
+{
+    if (planePoints.size() != planeNormals.size())
+        return STATUS_CODE_INVALID_PARAMETER;
+
+    const unsigned int nPlanes(planePoints.size());
+    FloatVector normalMagnitudes;
+
+    for (const CartesianVector &planeNormal : planeNormals)
+    {
+        const float ax(planeNormal.GetX()), ay(planeNormal.GetY());
+        const float AA(std::sqrt(ax * ax + ay * ay));
+
+        if (AA <= 0)
+            return STATUS_CODE_INVALID_PARAMETER;
+
+        normalMagnitudes.push_back(AA);
+    }
+
+    this->PrepareOutput(nPlanes, intersectionPoints, genericTimes, isFound);
+
+    for (unsigned int iHelix = 0; iHelix < this->GetNHelices(); ++iHelix)
+    {
+        const float xCentre(m_xCentre[iHelix]), yCentre(m_yCentre[iHelix]), radius(m_radius[iHelix]), charge(m_charge[iHelix]);
+        const float pxy(m_pxy[iHelix]), pz(m_pz[iHelix]), zReference(m_zReference[iHelix]), phiReference(m_phiReference[iHelix]);
+
+        for (unsigned int iPlane = 0; iPlane < nPlanes; ++iPlane)
+        {
+            float x1(0.f), y1(0.f), x2(0.f), y2(0.f);
+
+            if (!Helix::GetPlaneIntersections(xCentre, yCentre, radius, planePoints[iPlane].GetX(), planePoints[iPlane].GetY(),
+                    planeNormals[iPlane].GetX(), planeNormals[iPlane].GetY(), normalMagnitudes[iPlane], x1, y1, x2, y2))
+            {
+                continue;
+            }
+
+            const unsigned int index(iHelix * nPlanes + iPlane);
+            Helix::ChooseIntersection(xCentre, yCentre, radius, charge, pxy, pz, zReference, phiReference, x1, y1, x2, y2, "GetPointInXY",
+                intersectionPoints[index], genericTimes[index]);
+            isFound[index] = true;
+        }
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode HelixBatch::GetPointsOnCircle(const FloatVector &radii, CartesianPointVector &intersectionPoints, FloatVector &genericTimes,
+    BoolVector &isFound) const
+{
+    const unsigned int nRadii(radii.size());
+    this->PrepareOutput(nRadii, intersectionPoints, genericTimes, isFound);
+
+    for (unsigned int iHelix = 0; iHelix < this->GetNHelices(); ++iHelix)
+    {
+        const float xCentre(m_xCentre[iHelix]), yCentre(m_yCentre[iHelix]), radius(m_radius[iHelix]), charge(m_charge[iHelix]);
+        const float pxy(m_pxy[iHelix]), pz(m_pz[iHelix]), zReference(m_zReference[iHelix]), phiReference(m_phiReference[iHelix]);
+        const float distCentreToIP(m_distCentreToIP[iHelix]), phiCentre(m_phiCentre[iHelix]);
+
+        for (unsigned int iRadius = 0; iRadius < nRadii; ++iRadius)
+        {
+            float x1(0.f), y1(0.f), x2(0.f), y2(0.f);
+
+            if (!Helix::GetCircleIntersections(radius, distCentreToIP, phiCentre, radii[iRadius], x1, y1, x2, y2))
+                continue;
+
+            const unsigned int index(iHelix * nRadii + iRadius);
+            Helix::ChooseIntersection(xCentre, yCentre, radius, charge, pxy, pz, zReference, phiReference, x1, y1, x2, y2,
+                "GetPointOnCircle", intersectionPoints[index], genericTimes[index]);
+            isFound[index] = true;
+        }
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void HelixBatch::PrepareOutput(const unsigned int nTargets, CartesianPointVector &intersectionPoints, FloatVector &genericTimes,
+    BoolVector &isFound) const
+{
+    const unsigned int nResults(this->GetNHelices() * nTargets);
+    intersectionPoints.assign(nResults, CartesianVector(0.f, 0.f, 0.f));
+    genericTimes.assign(nResults, 0.f);
+    isFound.assign(nResults, false);
+}
+
+} // namespace pandora
@@ -33,6 +33,8 @@ Histogram::Histogram(const unsigned int nBinsX, const float xLow, const float xH
     // ATTN Protect against cast to int wrapping to negative numbers if there are very many bins
     if (static_cast<int>((m_xHigh - m_xLow) / m_xBinWidth) < 0)
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    m_binContents.assign(static_cast<unsigned int>(m_nBinsX) + 2, 0.f);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -66,19 +68,21 @@ Histogram::Histogram(const TiXmlHandle *const pXmlHandle, const std::string &xml
     if (orderedBinContents.size() != static_cast<unsigned int>(m_nBinsX) + 2)
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
+    m_binContents.assign(orderedBinContents.size(), 0.f);
+
     for (int binX = this->GetUnderflowBinNumber(), endBinX = this->GetOverflowBinNumber(); binX <= endBinX; ++binX)
     {
         const float value(orderedBinContents[binX + 1]);
 
         if (std::fabs(value) > std::numeric_limits<float>::epsilon())
-            m_histogramMap[binX] = value;
+            m_binContents[this->GetBinIndex(binX)] = value;
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 Histogram::Histogram(const Histogram &rhs) :
-    m_histogramMap(rhs.m_histogramMap),
+    m_binContents(rhs.m_binContents),
     m_nBinsX(rhs.m_nBinsX),
     m_xLow(rhs.m_xLow),
     m_xHigh(rhs.m_xHigh),
@@ -90,12 +94,10 @@ Histogram::Histogram(const Histogram &rhs) :
 
 float Histogram::GetBinContent(const int binX) const
 {
-    HistogramMap::const_iterator iter = m_histogramMap.find(binX);
-
-    if (m_histogramMap.end() == iter)
+    if ((binX < this->GetUnderflowBinNumber()) || (binX > this->GetOverflowBinNumber()))
         return 0.f;
 
-    return iter->second;
+    return m_binContents[this->GetBinIndex(binX)];
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -124,12 +126,7 @@ float Histogram::GetCumulativeSum(const int xLowBin, const int xHighBin) const
 
     for (int xBin = std::max(this->GetUnderflowBinNumber(), xLowBin), xBinEnd = std::min(xHighBin, this->GetOverflowBinNumber()); xBin <= xBinEnd; ++xBin)
     {
-        HistogramMap::const_iterator iterX = m_histogramMap.find(xBin);
-
-        if (m_histogramMap.end() == iterX)
-            continue;
-
-        sumEntries += iterX->second;
+        sumEntries += m_binContents[this->GetBinIndex(xBin)];
     }
 
     return sumEntries;
@@ -144,17 +141,12 @@ void Histogram::GetMaximum(const int xLowBin, const int xHighBin, float &maximum
 
     for (int xBin = std::max(this->GetUnderflowBinNumber(), xLowBin), xBinEnd = std::min(xHighBin, this->GetOverflowBinNumber()); xBin <= xBinEnd; ++xBin)
     {
-        HistogramMap::const_iterator iterX = m_histogramMap.find(xBin);
-
-        if (m_histogramMap.end() == iterX)
-            continue;
-
-        const float binContents(iterX->second);
+        const float binContents(m_binContents[this->GetBinIndex(xBin)]);
 
         if (binContents > maximumValue)
         {
             maximumValue = binContents;
-            maximumBinX = iterX->first;
+            maximumBinX = xBin;
         }
     }
 }
@@ -168,13 +160,8 @@ float Histogram::GetMeanX(const int xLowBin, const int xHighBin) const
 
     for (int xBin = std::max(this->GetMinBinNumber(), xLowBin), xBinEnd = std::min(xHighBin, this->GetMaxBinNumber()); xBin <= xBinEnd; ++xBin)
     {
-        HistogramMap::const_iterator iterX = m_histogramMap.find(xBin);
-
-        if (m_histogramMap.end() == iterX)
-            continue;
-
-        const float binCenter(firstBinCenter + (m_xBinWidth * static_cast<float>(iterX->first)));
-        const float binContents(iterX->second);
+        const float binCenter(firstBinCenter + (m_xBinWidth * static_cast<float>(xBin)));
+        const float binContents(m_binContents[this->GetBinIndex(xBin)]);
 
         sumEntries += binContents;
         sumXEntries += binContents * binCenter;
@@ -195,13 +182,8 @@ float Histogram::GetStandardDeviationX(const int xLowBin, const int xHighBin) co
 
     for (int xBin = std::max(this->GetMinBinNumber(), xLowBin), xBinEnd = std::min(xHighBin, this->GetMaxBinNumber()); xBin <= xBinEnd; ++xBin)
     {
-        HistogramMap::const_iterator iterX = m_histogramMap.find(xBin);
-
-        if (m_histogramMap.end() == iterX)
-            continue;
-
-        const float binCenter(firstBinCenter + (m_xBinWidth * static_cast<float>(iterX->first)));
-        const float binContents(iterX->second);
+        const float binCenter(firstBinCenter + (m_xBinWidth * static_cast<float>(xBin)));
+        const float binContents(m_binContents[this->GetBinIndex(xBin)]);
 
         sumEntries += binContents;
         sumXEntries += binContents * binCenter;
@@ -224,7 +206,7 @@ void Histogram::SetBinContent(const int binX, const float value)
     if ((binX < this->GetUnderflowBinNumber()) || (binX > this->GetOverflowBinNumber()))
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
-    m_histogramMap[binX] = value;
+    m_binContents[this->GetBinIndex(binX)] = value;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -233,26 +215,20 @@ void Histogram::Fill(const float valueX, const float weight)
 {
     const int binX(this->GetBinNumber(valueX));
 
-    HistogramMap::iterator iter = m_histogramMap.find(binX);
+    // ATTN Values that cannot be binned, such as nan, would otherwise be used to index outside the bin contents
+    if ((binX < this->GetUnderflowBinNumber()) || (binX > this->GetOverflowBinNumber()))
+        return;
 
-    if (m_histogramMap.end() != iter)
-    {
-        iter->second += weight;
-    }
-    else
-    {
-        if (!m_histogramMap.insert(HistogramMap::value_type(binX, weight)).second)
-            throw StatusCodeException(STATUS_CODE_FAILURE);
-    }
+    m_binContents[this->GetBinIndex(binX)] += weight;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void Histogram::Scale(const float scaleFactor)
 {
-    for (HistogramMap::value_type &mapEntry : m_histogramMap)
+    for (float &binContents : m_binContents)
     {
-        mapEntry.second = (mapEntry.second * scaleFactor);
+        binContents = (binContents * scaleFactor);
     }
 }
 
@@ -308,6 +284,8 @@ TwoDHistogram::TwoDHistogram(const unsigned int nBinsX, const float xLow, const
     // ATTN Protect against cast to int wrapping to negative numbers if there are very many bins
     if ((static_cast<int>((m_xHigh - m_xLow) / m_xBinWidth) < 0) || (static_cast<int>((m_yHigh - m_yLow) / m_yBinWidth) < 0))
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    this->AllocateBinContents();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -354,6 +332,8 @@ TwoDHistogram::TwoDHistogram(const TiXmlHandle *const pXmlHandle, const std::str
     if (histogramEntryList.size() != static_cast<unsigned int>(m_nBinsY) + 2)
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
+    this->AllocateBinContents();
+
     for (int binY = this->GetUnderflowBinNumberY(), endBinY = this->GetOverflowBinNumberY(); binY <= endBinY; ++binY)
     {
         const FloatVector &orderedBinContents(histogramEntryList[binY + 1]);
@@ -365,10 +345,7 @@ TwoDHistogram::TwoDHistogram(const TiXmlHandle *const pXmlHandle, const std::str
         {
             const float value(orderedBinContents[binX + 1]);
             if (std::fabs(value) > std::numeric_limits<float>::epsilon())
-            {
-                m_yxHistogramMap[binY][binX] = value;
-                m_xyHistogramMap[binX][binY] = value;
-            }
+                m_binContents[this->GetBinIndex(binX, binY)] = value;
         }
     }
 }
@@ -376,8 +353,7 @@ TwoDHistogram::TwoDHistogram(const TiXmlHandle *const pXmlHandle, const std::str
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 TwoDHistogram::TwoDHistogram(const TwoDHistogram &rhs) :
-    m_xyHistogramMap(rhs.m_xyHistogramMap),
-    m_yxHistogramMap(rhs.m_yxHistogramMap),
+    m_binContents(rhs.m_binContents),
     m_nBinsX(rhs.m_nBinsX),
     m_xLow(rhs.m_xLow),
     m_xHigh(rhs.m_xHigh),
@@ -393,17 +369,10 @@ TwoDHistogram::TwoDHistogram(const TwoDHistogram &rhs) :
 
 float TwoDHistogram::GetBinContent(const int binX, const int binY) const
 {
-    TwoDHistogramMap::const_iterator iterX = m_xyHistogramMap.find(binX);
-
-    if (m_xyHistogramMap.end() == iterX)
-        return 0.f;
-
-    HistogramMap::const_iterator iterXY = iterX->second.find(binY);
-
-    if (iterX->second.end() == iterXY)
+    if ((binX < this->GetUnderflowBinNumberX()) || (binX > this->GetOverflowBinNumberX()) || (binY < this->GetUnderflowBinNumberY()) || (binY > this->GetOverflowBinNumberY()))
         return 0.f;
 
-    return iterXY->second;
+    return m_binContents[this->GetBinIndex(binX, binY)];
 }
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -448,19 +417,9 @@ float TwoDHistogram::GetCumulativeSum(const int xLowBin, const int xHighBin, con
 
     for (int yBin = std::max(this->GetUnderflowBinNumberY(), yLowBin), yBinEnd = std::min(yHighBin, this->GetOverflowBinNumberY()); yBin <= yBinEnd; ++yBin)
     {
-        TwoDHistogramMap::const_iterator iterY = m_yxHistogramMap.find(yBin);
-
-        if (m_yxHistogramMap.end() == iterY)
-            continue;
-
         for (int xBin = std::max(this->GetUnderflowBinNumberX(), xLowBin), xBinEnd = std::min(xHighBin, this->GetOverflowBinNumberX()); xBin <= xBinEnd; ++xBin)
         {
-            HistogramMap::const_iterator iterX = iterY->second.find(xBin);
-
-            if (iterY->second.end() == iterX)
-                continue;
-
-            sumEntries += iterX->second;
+            sumEntries += m_binContents[this->GetBinIndex(xBin, yBin)];
         }
     }
 
@@ -477,25 +436,15 @@ void TwoDHistogram::GetMaximum(const int xLowBin, const int xHighBin, const int
 
     for (int yBin = std::max(this->GetUnderflowBinNumberY(), yLowBin), yBinEnd = std::min(yHighBin, this->GetOverflowBinNumberY()); yBin <= yBinEnd; ++yBin)
     {
-        TwoDHistogramMap::const_iterator iterY = m_yxHistogramMap.find(yBin);
-
-        if (m_yxHistogramMap.end() == iterY)
-            continue;
-
         for (int xBin = std::max(this->GetUnderflowBinNumberX(), xLowBin), xBinEnd = std::min(xHighBin, this->GetOverflowBinNumberX()); xBin <= xBinEnd; ++xBin)
         {
-            HistogramMap::const_iterator iterX = iterY->second.find(xBin);
-
-            if (iterY->second.end() == iterX)
-                continue;
-
-            const float binContents(iterX->second);
+            const float binContents(m_binContents[this->GetBinIndex(xBin, yBin)]);
 
             if (binContents > maximumValue)
             {
                 maximumValue = binContents;
-                maximumBinX = iterX->first;
-                maximumBinY = iterY->first;
+                maximumBinX = xBin;
+                maximumBinY = yBin;
             }
         }
     }
@@ -510,20 +459,10 @@ float TwoDHistogram::GetMeanX(const int xLowBin, const int xHighBin, const int y
 
     for (int yBin = std::max(this->GetMinBinNumberY(), yLowBin), yBinEnd = std::min(yHighBin, this->GetMaxBinNumberY()); yBin <= yBinEnd; ++yBin)
     {
-        TwoDHistogramMap::const_iterator iterY = m_yxHistogramMap.find(yBin);
-
-        if (m_yxHistogramMap.end() == iterY)
-            continue;
-
         for (int xBin = std::max(this->GetMinBinNumberX(), xLowBin), xBinEnd = std::min(xHighBin, this->GetMaxBinNumberX()); xBin <= xBinEnd; ++xBin)
         {
-            HistogramMap::const_iterator iterX = iterY->second.find(xBin);
-
-            if (iterY->second.end() == iterX)
-                continue;
-
-            const float binXCenter(firstBinXCenter + (m_xBinWidth * static_cast<float>(iterX->first)));
-            const float binContents(iterX->second);
+            const float binXCenter(firstBinXCenter + (m_xBinWidth * static_cast<float>(xBin)));
+            const float binContents(m_binContents[this->GetBinIndex(xBin, yBin)]);
 
             sumEntries += binContents;
             sumXEntries += binContents * binXCenter;
@@ -545,20 +484,10 @@ float TwoDHistogram::GetStandardDeviationX(const int xLowBin, const int xHighBin
 
     for (int yBin = std::max(this->GetMinBinNumberY(), yLowBin), yBinEnd = std::min(yHighBin, this->GetMaxBinNumberY()); yBin <= yBinEnd; ++yBin)
     {
-        TwoDHistogramMap::const_iterator iterY = m_yxHistogramMap.find(yBin);
-
-        if (m_yxHistogramMap.end() == iterY)
-            continue;
-
         for (int xBin = std::max(this->GetMinBinNumberX(), xLowBin), xBinEnd = std::min(xHighBin, this->GetMaxBinNumberX()); xBin <= xBinEnd; ++xBin)
         {
-            HistogramMap::const_iterator iterX = iterY->second.find(xBin);
-
-            if (iterY->second.end() == iterX)
-                continue;
-
-            const float binXCenter(firstBinXCenter + (m_xBinWidth * static_cast<float>(iterX->first)));
-            const float binContents(iterX->second);
+            const float binXCenter(firstBinXCenter + (m_xBinWidth * static_cast<float>(xBin)));
+            const float binContents(m_binContents[this->GetBinIndex(xBin, yBin)]);
 
             sumEntries += binContents;
             sumXEntries += binContents * binXCenter;
@@ -582,22 +511,13 @@ float TwoDHistogram::GetMeanY(const int xLowBin, const int xHighBin, const int y
     float sumEntries(0.f), sumYEntries(0.f);
     const float firstBinYCenter(m_yLow + (0.5f * m_yBinWidth));
 
+    // ATTN Sum over y bins for each x bin in turn, preserving the summation order of the previous map-based storage
     for (int xBin = std::max(this->GetMinBinNumberX(), xLowBin), xBinEnd = std::min(xHighBin, this->GetMaxBinNumberX()); xBin <= xBinEnd; ++xBin)
     {
-        TwoDHistogramMap::const_iterator iterX = m_xyHistogramMap.find(xBin);
-
-        if (m_xyHistogramMap.end() == iterX)
-            continue;
-
         for (int yBin = std::max(this->GetMinBinNumberY(), yLowBin), yBinEnd = std::min(yHighBin, this->GetMaxBinNumberY()); yBin <= yBinEnd; ++yBin)
         {
-            HistogramMap::const_iterator iterY = iterX->second.find(yBin);
-
-            if (iterX->second.end() == iterY)
-                continue;
-
-            const float binYCenter(firstBinYCenter + (m_yBinWidth * static_cast<float>(iterY->first)));
-            const float binContents(iterY->second);
+            const float binYCenter(firstBinYCenter + (m_yBinWidth * static_cast<float>(yBin)));
+            const float binContents(m_binContents[this->GetBinIndex(xBin, yBin)]);
 
             sumEntries += binContents;
             sumYEntries += binContents * binYCenter;
@@ -617,22 +537,13 @@ float TwoDHistogram::GetStandardDeviationY(const int xLowBin, const int xHighBin
     float sumEntries(0.f), sumYEntries(0.f), sumYYEntries(0.f);
     const float firstBinYCenter(m_yLow + (0.5f * m_yBinWidth));
 
+    // ATTN Sum over y bins for each x bin in turn, preserving the summation order of the previous map-based storage
     for (int xBin = std::max(this->GetMinBinNumberX(), xLowBin), xBinEnd = std::min(xHighBin, this->GetMaxBinNumberX()); xBin <= xBinEnd; ++xBin)
     {
-        TwoDHistogramMap::const_iterator iterX = m_xyHistogramMap.find(xBin);
-
-        if (m_xyHistogramMap.end() == iterX)
-            continue;
-
         for (int yBin = std::max(this->GetMinBinNumberY(), yLowBin), yBinEnd = std::min(yHighBin, this->GetMaxBinNumberY()); yBin <= yBinEnd; ++yBin)
         {
-            HistogramMap::const_iterator iterY = iterX->second.find(yBin);
-
-            if (iterX->second.end() == iterY)
-                continue;
-
-            const float binYCenter(firstBinYCenter + (m_yBinWidth * static_cast<float>(iterY->first)));
-            const float binContents(iterY->second);
+            const float binYCenter(firstBinYCenter + (m_yBinWidth * static_cast<float>(yBin)));
+            const float binContents(m_binContents[this->GetBinIndex(xBin, yBin)]);
 
             sumEntries += binContents;
             sumYEntries += binContents * binYCenter;
@@ -656,8 +567,7 @@ void TwoDHistogram::SetBinContent(const int binX, const int binY, const float va
     if ((binX < this->GetUnderflowBinNumberX()) || (binX > this->GetOverflowBinNumberX()) || (binY < this->GetUnderflowBinNumberY()) || (binY > this->GetOverflowBinNumberY()))
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
-    m_xyHistogramMap[binX][binY] = value;
-    m_yxHistogramMap[binY][binX] = value;
+    m_binContents[this->GetBinIndex(binX, binY)] = value;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -667,40 +577,20 @@ void TwoDHistogram::Fill(const float valueX, const float valueY, const float wei
     const int binX(this->GetBinNumberX(valueX));
     const int binY(this->GetBinNumberY(valueY));
 
-    HistogramMap &yHistogramMap(m_xyHistogramMap[binX]);
-    HistogramMap::iterator iter = yHistogramMap.find(binY);
-
-    if (yHistogramMap.end() != iter)
-    {
-        iter->second += weight;
-    }
-    else
-    {
-        if (!yHistogramMap.insert(HistogramMap::value_type(binY, weight)).second)
-            throw StatusCodeException(STATUS_CODE_FAILURE);
-    }
+    // ATTN Values that cannot be binned, such as nan, would otherwise be used to index outside the bin contents
+    if ((binX < this->GetUnderflowBinNumberX()) || (binX > this->GetOverflowBinNumberX()) || (binY < this->GetUnderflowBinNumberY()) || (binY > this->GetOverflowBinNumberY()))
+        return;
 
-    m_yxHistogramMap[binY][binX] = yHistogramMap[binY];
+    m_binContents[this->GetBinIndex(binX, binY)] += weight;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void TwoDHistogram::Scale(const float scaleFactor)
 {
-    for (TwoDHistogramMap::value_type &mapEntryX : m_xyHistogramMap)
+    for (float &binContents : m_binContents)
     {
-        for (HistogramMap::value_type &mapEntryY : mapEntryX.second)
-        {
-            mapEntryY.second = (mapEntryY.second * scaleFactor);
-        }
-    }
-
-    for (TwoDHistogramMap::value_type &mapEntryY : m_yxHistogramMap)
-    {
-        for (HistogramMap::value_type &mapEntryX : mapEntryY.second)
-        {
-            mapEntryX.second = (mapEntryX.second * scaleFactor);
-        }
+        binContents = (binContents * scaleFactor);
     }
 }
 
@@ -755,4 +645,17 @@ void TwoDHistogram::WriteToXml(TiXmlDocument *const pTiXmlDocument, const std::s
     pTiXmlDocument->LinkEndChild(pHistogramElement);
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDHistogram::AllocateBinContents()
+{
+    const unsigned int nRows(static_cast<unsigned int>(m_nBinsY) + 2), nColumns(static_cast<unsigned int>(m_nBinsX) + 2);
+
+    // ATTN Protect against the total number of bins, including underflow and overflow bins, wrapping
+    if (nRows > std::numeric_limits<unsigned int>::max() / nColumns)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    m_binContents.assign(nRows * nColumns, 0.f);
+}
+
 } // namespace pandora
@@ -51,7 +51,8 @@ MCParticle::MCParticle(const object_creation::MCParticle::Parameters &parameters
     m_outerRadius(parameters.m_endpoint.Get().GetMagnitude()),
     m_particleId(parameters.m_particleId.Get()),
     m_mcParticleType(parameters.m_mcParticleType.Get()),
-    m_pPfoTarget(nullptr)
+    m_pPfoTarget(nullptr),
+    m_index(0)
 {
 }
 
@@ -31,27 +31,84 @@ OrderedCaloHitList::~OrderedCaloHitList()
 {
     for (const value_type &entry : m_theList)
         delete entry.second;
+
+    for (const CaloHitList *const pCaloHitList : m_spareCaloHitLists)
+        delete pCaloHitList;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode OrderedCaloHitList::Add(const OrderedCaloHitList &rhs)
 {
-    for (const value_type &rhsEntry : rhs)
+    if (this == &rhs)
+        return (this->empty() ? STATUS_CODE_SUCCESS : STATUS_CODE_ALREADY_PRESENT);
+
+    // ATTN Single merge of the two sorted layer vectors, rather than one sorted insertion per newly populated pseudo layer
+    TheList mergedList;
+    mergedList.reserve(m_theList.size() + rhs.m_theList.size());
+
+    StatusCode statusCode(STATUS_CODE_SUCCESS);
+    TheList::const_iterator iter(m_theList.begin()), rhsIter(rhs.m_theList.begin());
+
+    while ((m_theList.end() != iter) || (rhs.m_theList.end() != rhsIter))
     {
-        for (const CaloHit *const pCaloHit : *rhsEntry.second)
+        if ((rhs.m_theList.end() == rhsIter) || (STATUS_CODE_SUCCESS != statusCode) ||
+            ((m_theList.end() != iter) && (iter->first < rhsIter->first)))
         {
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Add(pCaloHit, rhsEntry.first));
+            if (m_theList.end() == iter)
+                break;
+
+            mergedList.push_back(*iter++);
+            continue;
         }
+
+        if ((m_theList.end() == iter) || (rhsIter->first < iter->first))
+        {
+            CaloHitList *const pCaloHitList(this->GetEmptyCaloHitList());
+            pCaloHitList->insert(pCaloHitList->end(), rhsIter->second->begin(), rhsIter->second->end());
+            mergedList.push_back(value_type(rhsIter->first, pCaloHitList));
+
+            for (const CaloHit *const pCaloHit : *pCaloHitList)
+                this->SetFlag(pCaloHit);
+
+            ++rhsIter;
+            continue;
+        }
+
+        CaloHitList *const pCaloHitList(iter->second);
+
+        for (const CaloHit *const pCaloHit : *rhsIter->second)
+        {
+            if (this->IsFlagged(pCaloHit) && (pCaloHitList->end() != std::find(pCaloHitList->begin(), pCaloHitList->end(), pCaloHit)))
+            {
+                statusCode = STATUS_CODE_ALREADY_PRESENT;
+                break;
+            }
+
+            pCaloHitList->push_back(pCaloHit);
+            this->SetFlag(pCaloHit);
+        }
+
+        mergedList.push_back(*iter++);
+        ++rhsIter;
     }
 
-    return STATUS_CODE_SUCCESS;
+    m_theList.swap(mergedList);
+
+    return statusCode;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode OrderedCaloHitList::Remove(const OrderedCaloHitList &rhs)
 {
+    // ATTN Removing a list from itself would otherwise erase layer entries while iterating over them
+    if (this == &rhs)
+    {
+        this->Reset();
+        return STATUS_CODE_SUCCESS;
+    }
+
     for (const value_type &rhsEntry : rhs)
     {
         for (const CaloHit *const pCaloHit : *rhsEntry.second)
@@ -118,9 +175,13 @@ unsigned int OrderedCaloHitList::GetNCaloHitsInPseudoLayer(const unsigned int ps
 void OrderedCaloHitList::Reset()
 {
     for (const value_type &entry : m_theList)
-        delete entry.second;
+    {
+        entry.second->clear();
+        m_spareCaloHitLists.push_back(entry.second);
+    }
 
     this->clear();
+    m_indexFlags.clear();
 
     if (!this->empty())
         throw StatusCodeException(STATUS_CODE_FAILURE);
@@ -153,27 +214,25 @@ bool OrderedCaloHitList::operator= (const OrderedCaloHitList &rhs)
 
 StatusCode OrderedCaloHitList::Add(const CaloHit *const pCaloHit, const unsigned int pseudoLayer)
 {
-    TheList::iterator iter = m_theList.find(pseudoLayer);
+    TheList::iterator iter = std::lower_bound(m_theList.begin(), m_theList.end(), pseudoLayer, OrderedCaloHitList::IsLayerLessThan);
 
-    if (m_theList.end() == iter)
+    if ((m_theList.end() == iter) || (pseudoLayer != iter->first))
     {
-        CaloHitList *const pCaloHitList = new CaloHitList;
+        CaloHitList *const pCaloHitList = this->GetEmptyCaloHitList();
         pCaloHitList->push_back(pCaloHit);
-
-        if (!(m_theList.insert(TheList::value_type(pseudoLayer, pCaloHitList)).second))
-        {
-            delete pCaloHitList;
-            return STATUS_CODE_FAILURE;
-        }
+        m_theList.insert(iter, TheList::value_type(pseudoLayer, pCaloHitList));
     }
     else
     {
-        if (iter->second->end() != std::find(iter->second->begin(), iter->second->end(), pCaloHit))
+        // ATTN A set flag may be left by a removed calo hit, or shared by a calo hit with the same index, so is confirmed by a search
+        if (this->IsFlagged(pCaloHit) && (iter->second->end() != std::find(iter->second->begin(), iter->second->end(), pCaloHit)))
             return STATUS_CODE_ALREADY_PRESENT;
 
         iter->second->push_back(pCaloHit);
     }
 
+    this->SetFlag(pCaloHit);
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -181,9 +240,12 @@ StatusCode OrderedCaloHitList::Add(const CaloHit *const pCaloHit, const unsigned
 
 StatusCode OrderedCaloHitList::Remove(const CaloHit *const pCaloHit, const unsigned int pseudoLayer)
 {
-    TheList::iterator listIter = m_theList.find(pseudoLayer);
+    if (!this->IsFlagged(pCaloHit))
+        return STATUS_CODE_NOT_FOUND;
+
+    TheList::iterator listIter = std::lower_bound(m_theList.begin(), m_theList.end(), pseudoLayer, OrderedCaloHitList::IsLayerLessThan);
 
-    if (m_theList.end() == listIter)
+    if ((m_theList.end() == listIter) || (pseudoLayer != listIter->first))
         return STATUS_CODE_NOT_FOUND;
 
     CaloHitList::iterator caloHitIter = std::find(listIter->second->begin(), listIter->second->end(), pCaloHit);
@@ -195,11 +257,24 @@ StatusCode OrderedCaloHitList::Remove(const CaloHit *const pCaloHit, const unsig
 
     if (listIter->second->empty())
     {
-        delete listIter->second;
+        m_spareCaloHitLists.push_back(listIter->second);
         listIter = m_theList.erase(listIter);
     }
 
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CaloHitList *OrderedCaloHitList::GetEmptyCaloHitList()
+{
+    if (m_spareCaloHitLists.empty())
+        return new CaloHitList;
+
+    CaloHitList *const pCaloHitList(m_spareCaloHitLists.back());
+    m_spareCaloHitLists.pop_back();
+
+    return pCaloHitList;
+}
+
 } // namespace pandora
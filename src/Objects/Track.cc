@@ -60,7 +60,8 @@ Track::Track(const object_creation::Track::Parameters &parameters) :
     m_canFormClusterlessPfo(parameters.m_canFormClusterlessPfo.Get()),
     m_pAssociatedCluster(nullptr),
     m_pParentAddress(parameters.m_pParentAddress.Get()),
-    m_isAvailable(true)
+    m_isAvailable(true),
+    m_index(0)
 {
     // Consistency checks
     if (m_energyAtDca < std::numeric_limits<float>::epsilon())
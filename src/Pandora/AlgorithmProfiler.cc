@@ -0,0 +1,168 @@
+/**
+ *  @file   PandoraSDK/src/Pandora/AlgorithmProfiler.cc
+ *
+ *  @brief  Implementation of the algorithm profiler class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/Algorithm.h"
+#include "Pandora/AlgorithmProfiler.h"
+
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+
+namespace pandora
+{
+
+AlgorithmProfiler::ObjectCounts::ObjectCounts()
+{
+    for (unsigned int iManager = 0; iManager < N_MANAGER_IDS; ++iManager)
+    {
+        m_nCreated[iManager] = 0;
+        m_nDeleted[iManager] = 0;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+AlgorithmProfiler::ProfileEntry::ProfileEntry() :
+    m_nCalls(0),
+    m_wallTime(0.),
+    m_selfWallTime(0.),
+    m_cpuTime(0.),
+    m_selfCpuTime(0.)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+AlgorithmProfiler::AlgorithmProfiler()
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void AlgorithmProfiler::BeginAlgorithm(const Algorithm *const pAlgorithm, const ObjectCounts &objectCounts)
+{
+    // ATTN Instance names distinguish algorithms of the same type; the type is included so that flame graphs remain readable
+    const std::string frameName(pAlgorithm->GetType() + "(" + pAlgorithm->GetInstanceName() + ")");
+
+    Frame frame;
+    frame.m_path = m_frameStack.empty() ? frameName : m_frameStack.back().m_path + ";" + frameName;
+    frame.m_daughterWallTime = 0.;
+    frame.m_daughterCpuTime = 0.;
+    frame.m_objectCounts = objectCounts;
+
+    ProfileEntry &profileEntry(m_profileMap[frame.m_path]);
+
+    if (profileEntry.m_type.empty())
+        profileEntry.m_type = pAlgorithm->GetType();
+
+    m_frameStack.push_back(frame);
+    m_frameStack.back().m_cpuStart = AlgorithmProfiler::GetThreadCpuTime();
+    m_frameStack.back().m_wallStart = std::chrono::steady_clock::now();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void AlgorithmProfiler::EndAlgorithm(const ObjectCounts &objectCounts)
+{
+    const std::chrono::steady_clock::time_point wallEnd(std::chrono::steady_clock::now());
+    const double cpuEnd(AlgorithmProfiler::GetThreadCpuTime());
+
+    if (m_frameStack.empty())
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+
+    const Frame &frame(m_frameStack.back());
+    const double wallTime(std::chrono::duration<double>(wallEnd - frame.m_wallStart).count());
+    const double cpuTime(cpuEnd - frame.m_cpuStart);
+
+    ProfileEntry &profileEntry(m_profileMap.at(frame.m_path));
+    ++profileEntry.m_nCalls;
+    profileEntry.m_wallTime += wallTime;
+    profileEntry.m_selfWallTime += wallTime - frame.m_daughterWallTime;
+    profileEntry.m_cpuTime += cpuTime;
+    profileEntry.m_selfCpuTime += cpuTime - frame.m_daughterCpuTime;
+
+    for (unsigned int iManager = 0; iManager < N_MANAGER_IDS; ++iManager)
+    {
+        profileEntry.m_objectCounts.m_nCreated[iManager] += objectCounts.m_nCreated[iManager] - frame.m_objectCounts.m_nCreated[iManager];
+        profileEntry.m_objectCounts.m_nDeleted[iManager] += objectCounts.m_nDeleted[iManager] - frame.m_objectCounts.m_nDeleted[iManager];
+    }
+
+    m_frameStack.pop_back();
+
+    if (!m_frameStack.empty())
+    {
+        m_frameStack.back().m_daughterWallTime += wallTime;
+        m_frameStack.back().m_daughterCpuTime += cpuTime;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode AlgorithmProfiler::WriteSummary(const std::string &fileName) const
+{
+    const std::string managerNames[N_MANAGER_IDS] = {"CaloHits", "Tracks", "MCParticles", "Clusters", "Pfos", "Vertices"};
+
+    std::ofstream csvFileStream((fileName + ".csv").c_str(), std::ios::out | std::ios::trunc);
+    std::ofstream foldedFileStream((fileName + ".folded").c_str(), std::ios::out | std::ios::trunc);
+
+    if (!csvFileStream.is_open() || !foldedFileStream.is_open())
+    {
+        std::cout << "AlgorithmProfiler::WriteSummary - unable to open output files " << fileName << ".csv, " << fileName << ".folded" << std::endl;
+        return STATUS_CODE_FAILURE;
+    }
+
+    csvFileStream << "Path,Type,Depth,Calls,WallTime,SelfWallTime,CpuTime,SelfCpuTime";
+
+    for (unsigned int iManager = 0; iManager < N_MANAGER_IDS; ++iManager)
+        csvFileStream << "," << managerNames[iManager] << "Created," << managerNames[iManager] << "Deleted";
+
+    csvFileStream << std::endl;
+
+    for (const ProfileMap::value_type &mapEntry : m_profileMap)
+    {
+        const ProfileEntry &profileEntry(mapEntry.second);
+
+        if (0 == profileEntry.m_nCalls)
+            continue;
+
+        const std::size_t depth(1 + std::count(mapEntry.first.begin(), mapEntry.first.end(), ';'));
+
+        csvFileStream << mapEntry.first << "," << profileEntry.m_type << "," << depth << "," << profileEntry.m_nCalls << ","
+                      << profileEntry.m_wallTime << "," << profileEntry.m_selfWallTime << "," << profileEntry.m_cpuTime << ","
+                      << profileEntry.m_selfCpuTime;
+
+        for (unsigned int iManager = 0; iManager < N_MANAGER_IDS; ++iManager)
+            csvFileStream << "," << profileEntry.m_objectCounts.m_nCreated[iManager] << "," << profileEntry.m_objectCounts.m_nDeleted[iManager];
+
+        csvFileStream << std::endl;
+
+        // ATTN Collapsed stacks carry self time in integer microseconds, as flame graph tools sum frames over their daughters
+        const double selfWallTime(profileEntry.m_selfWallTime > 0. ? profileEntry.m_selfWallTime : 0.);
+        foldedFileStream << mapEntry.first << " " << static_cast<unsigned long long>(1.e6 * selfWallTime + 0.5) << std::endl;
+    }
+
+    if (!csvFileStream.good() || !foldedFileStream.good())
+        return STATUS_CODE_FAILURE;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+double AlgorithmProfiler::GetThreadCpuTime()
+{
+    struct timespec cpuTime;
+
+    if (0 != clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpuTime))
+        return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+
+    return static_cast<double>(cpuTime.tv_sec) + 1.e-9 * static_cast<double>(cpuTime.tv_nsec);
+}
+
+} // namespace pandora
@@ -0,0 +1,119 @@
+/**
+ *  @file   PandoraSDK/src/Pandora/DaughterAlgorithmGroup.cc
+ *
+ *  @brief  Implementation of the daughter algorithm group class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/DaughterAlgorithmGroup.h"
+
+namespace pandora
+{
+
+StatusCode DaughterAlgorithmGroup::AddDaughterAlgorithm(const std::string &daughterAlgorithmName, const StringVector &inputListNames,
+    const StringVector &outputListNames)
+{
+    for (const Daughter &daughter : m_daughterVector)
+    {
+        if (daughterAlgorithmName == daughter.m_algorithmName)
+            return STATUS_CODE_ALREADY_PRESENT;
+    }
+
+    Daughter daughter;
+    daughter.m_algorithmName = daughterAlgorithmName;
+    daughter.m_inputListNames.insert(inputListNames.begin(), inputListNames.end());
+    daughter.m_outputListNames.insert(outputListNames.begin(), outputListNames.end());
+    m_daughterVector.push_back(daughter);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DaughterAlgorithmGroup::GetStages(StageVector &stageVector) const
+{
+    stageVector.clear();
+    std::vector<unsigned int> stageIndices;
+
+    for (unsigned int iDaughter = 0; iDaughter < m_daughterVector.size(); ++iDaughter)
+    {
+        unsigned int stageIndex(0);
+
+        for (unsigned int iEarlier = 0; iEarlier < iDaughter; ++iEarlier)
+        {
+            if ((stageIndices[iEarlier] >= stageIndex) && DaughterAlgorithmGroup::IsConflict(m_daughterVector[iEarlier], m_daughterVector[iDaughter]))
+                stageIndex = stageIndices[iEarlier] + 1;
+        }
+
+        stageIndices.push_back(stageIndex);
+
+        if (stageVector.size() <= stageIndex)
+            stageVector.resize(stageIndex + 1);
+
+        stageVector[stageIndex].push_back(m_daughterVector[iDaughter].m_algorithmName);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const StringSet &DaughterAlgorithmGroup::GetInputListNames(const std::string &daughterAlgorithmName) const
+{
+    return this->GetDaughter(daughterAlgorithmName).m_inputListNames;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const StringSet &DaughterAlgorithmGroup::GetOutputListNames(const std::string &daughterAlgorithmName) const
+{
+    return this->GetDaughter(daughterAlgorithmName).m_outputListNames;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const DaughterAlgorithmGroup::Daughter &DaughterAlgorithmGroup::GetDaughter(const std::string &daughterAlgorithmName) const
+{
+    for (const Daughter &daughter : m_daughterVector)
+    {
+        if (daughterAlgorithmName == daughter.m_algorithmName)
+            return daughter;
+    }
+
+    throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool DaughterAlgorithmGroup::IsConflict(const Daughter &lhs, const Daughter &rhs)
+{
+    return (DaughterAlgorithmGroup::IsOverlap(lhs.m_outputListNames, rhs.m_inputListNames) ||
+        DaughterAlgorithmGroup::IsOverlap(lhs.m_inputListNames, rhs.m_outputListNames) ||
+        DaughterAlgorithmGroup::IsOverlap(lhs.m_outputListNames, rhs.m_outputListNames));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool DaughterAlgorithmGroup::IsOverlap(const StringSet &lhs, const StringSet &rhs)
+{
+    StringSet::const_iterator lhsIter(lhs.begin()), rhsIter(rhs.begin());
+
+    while ((lhs.end() != lhsIter) && (rhs.end() != rhsIter))
+    {
+        if (*lhsIter < *rhsIter)
+        {
+            ++lhsIter;
+        }
+        else if (*rhsIter < *lhsIter)
+        {
+            ++rhsIter;
+        }
+        else
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace pandora
@@ -0,0 +1,283 @@
+/**
+ *  @file   PandoraSDK/src/Pandora/EventParallelRunner.cc
+ *
+ *  @brief  Implementation of the event parallel runner class.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+
+#include "Pandora/EventParallelRunner.h"
+#include "Pandora/Pandora.h"
+
+#include "Xml/tinyxml.h"
+
+#include <iostream>
+#include <system_error>
+#include <thread>
+
+namespace pandora
+{
+
+EventParallelRunner::InstanceSetup::~InstanceSetup()
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode EventParallelRunner::InstanceSetup::CreateGeometry(const Pandora &/*pandora*/) const
+{
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+EventParallelRunner::EventProcessor::~EventProcessor()
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+EventParallelRunner::EventParallelRunner(const unsigned int nInstances, const std::string &settingsFileName, const InstanceSetup &instanceSetup) :
+    m_nextEventNumber(0),
+    m_shouldStop(false),
+    m_nextOutputNumber(0),
+    m_runStatusCode(STATUS_CODE_SUCCESS)
+{
+    try
+    {
+        if (0 == nInstances)
+            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+        // ATTN The settings file is parsed once, with each instance then configured from the same read-only document
+        TiXmlDocument xmlDocument(settingsFileName);
+
+        if (!xmlDocument.LoadFile())
+        {
+            std::cout << "EventParallelRunner - Invalid xml file.\n"
+                      << "    Error: " << xmlDocument.ErrorDesc() << "\n"
+                      << "    File:  " << settingsFileName
+                      << " line#: " << xmlDocument.ErrorRow() << std::endl;
+            throw StatusCodeException(STATUS_CODE_FAILURE);
+        }
+
+        const TiXmlHandle xmlDocumentHandle(&xmlDocument);
+        const TiXmlHandle xmlHandle(TiXmlHandle(xmlDocumentHandle.FirstChildElement().Element()));
+
+        for (unsigned int iInstance = 0; iInstance < nInstances; ++iInstance)
+        {
+            Pandora *const pPandora(new Pandora("Instance" + std::to_string(iInstance)));
+            m_pandoraVector.push_back(pPandora);
+
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, instanceSetup.Register(*pPandora));
+
+            if (0 == iInstance)
+            {
+                PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, instanceSetup.CreateGeometry(*pPandora));
+            }
+            else
+            {
+                PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ShareGeometry(*(m_pandoraVector.front()), *pPandora));
+            }
+
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, pPandora->ReadSettings(&xmlHandle));
+        }
+    }
+    catch (StatusCodeException &statusCodeException)
+    {
+        std::cout << "Failed to create event parallel runner " << statusCodeException.ToString() << std::endl;
+
+        for (Pandora *const pPandora : m_pandoraVector)
+            delete pPandora;
+
+        throw statusCodeException;
+    }
+    catch (...)
+    {
+        std::cout << "Failed to create event parallel runner " << std::endl;
+
+        for (Pandora *const pPandora : m_pandoraVector)
+            delete pPandora;
+
+        throw;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+EventParallelRunner::~EventParallelRunner()
+{
+    for (Pandora *const pPandora : m_pandoraVector)
+        delete pPandora;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode EventParallelRunner::Run(const unsigned int nEvents, EventProcessor &eventProcessor)
+{
+    m_nextEventNumber = 0;
+    m_shouldStop = false;
+    m_nextOutputNumber = 0;
+    m_runStatusCode = STATUS_CODE_SUCCESS;
+
+    std::vector<std::thread> threadVector;
+
+    try
+    {
+        for (const Pandora *const pPandora : m_pandoraVector)
+            threadVector.push_back(std::thread(&EventParallelRunner::ProcessEvents, this, pPandora, nEvents, &eventProcessor));
+    }
+    catch (const std::system_error &)
+    {
+        // ATTN Each dispensed event is completed by the thread that took it, so the threads already started can safely be joined
+        std::cout << "EventParallelRunner::Run - unable to start worker threads" << std::endl;
+        m_shouldStop = true;
+
+        std::unique_lock<std::mutex> lock(m_outputMutex);
+        m_runStatusCode = STATUS_CODE_FAILURE;
+    }
+
+    for (std::thread &thread : threadVector)
+        thread.join();
+
+    return m_runStatusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int EventParallelRunner::GetNInstances() const
+{
+    return m_pandoraVector.size();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const Pandora &EventParallelRunner::GetPandora(const unsigned int instanceIndex) const
+{
+    if (instanceIndex >= m_pandoraVector.size())
+        throw StatusCodeException(STATUS_CODE_OUT_OF_RANGE);
+
+    return *(m_pandoraVector[instanceIndex]);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventParallelRunner::ProcessEvents(const Pandora *const pPandora, const unsigned int nEvents, EventProcessor *const pEventProcessor)
+{
+    while (!m_shouldStop)
+    {
+        const unsigned int eventNumber(m_nextEventNumber++);
+
+        if (eventNumber >= nEvents)
+            break;
+
+        const StatusCode statusCode(this->ProcessEvent(*pPandora, eventNumber, *pEventProcessor));
+
+        if (STATUS_CODE_SUCCESS != statusCode)
+            m_shouldStop = true;
+
+        this->CompleteEvent(*pPandora, eventNumber, statusCode, *pEventProcessor);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode EventParallelRunner::ProcessEvent(const Pandora &pandora, const unsigned int eventNumber, EventProcessor &eventProcessor) const
+{
+    try
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, eventProcessor.PrepareEvent(pandora, eventNumber));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(pandora));
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "EventParallelRunner: failure in event " << eventNumber << ", " << statusCodeException.ToString() << std::endl;
+        return statusCodeException.GetStatusCode();
+    }
+    catch (...)
+    {
+        std::cout << "EventParallelRunner: failure in event " << eventNumber << ", unrecognized exception" << std::endl;
+        return STATUS_CODE_FAILURE;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventParallelRunner::CompleteEvent(const Pandora &pandora, const unsigned int eventNumber, StatusCode statusCode, EventProcessor &eventProcessor)
+{
+    bool shouldEmitOutput(false);
+
+    {
+        std::unique_lock<std::mutex> lock(m_outputMutex);
+
+        while (eventNumber != m_nextOutputNumber)
+            m_outputCondition.wait(lock);
+
+        shouldEmitOutput = ((STATUS_CODE_SUCCESS == statusCode) && (STATUS_CODE_SUCCESS == m_runStatusCode));
+    }
+
+    // ATTN Only the thread holding the output turn reaches this point, so outputs are emitted serially and without holding the lock
+    try
+    {
+        if (shouldEmitOutput)
+            statusCode = eventProcessor.ProcessOutput(pandora, eventNumber);
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "EventParallelRunner: failure emitting output for event " << eventNumber << ", " << statusCodeException.ToString() << std::endl;
+        statusCode = statusCodeException.GetStatusCode();
+    }
+    catch (...)
+    {
+        std::cout << "EventParallelRunner: failure emitting output for event " << eventNumber << ", unrecognized exception" << std::endl;
+        statusCode = STATUS_CODE_FAILURE;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_outputMutex);
+        this->RecordStatusCode(statusCode);
+        ++m_nextOutputNumber;
+    }
+
+    m_outputCondition.notify_all();
+
+    // ATTN The output turn has been passed on, so resetting this pandora instance overlaps with the output of the next event
+    StatusCode resetStatusCode(STATUS_CODE_SUCCESS);
+
+    try
+    {
+        resetStatusCode = PandoraApi::Reset(pandora);
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "EventParallelRunner: failure resetting after event " << eventNumber << ", " << statusCodeException.ToString() << std::endl;
+        resetStatusCode = statusCodeException.GetStatusCode();
+    }
+    catch (...)
+    {
+        std::cout << "EventParallelRunner: failure resetting after event " << eventNumber << ", unrecognized exception" << std::endl;
+        resetStatusCode = STATUS_CODE_FAILURE;
+    }
+
+    if (STATUS_CODE_SUCCESS != resetStatusCode)
+    {
+        std::unique_lock<std::mutex> lock(m_outputMutex);
+        this->RecordStatusCode(resetStatusCode);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventParallelRunner::RecordStatusCode(const StatusCode statusCode)
+{
+    if ((STATUS_CODE_SUCCESS != statusCode) && (STATUS_CODE_SUCCESS == m_runStatusCode))
+    {
+        m_runStatusCode = statusCode;
+        m_shouldStop = true;
+    }
+}
+
+} // namespace pandora
@@ -0,0 +1,168 @@
+/**
+ *  @file   PandoraSDK/src/Pandora/ObjectPool.cc
+ *
+ *  @brief  Implementation of the object pool class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/ObjectPool.h"
+
+#include <new>
+
+namespace pandora
+{
+
+thread_local ObjectPool *ObjectPool::m_pActivePool = nullptr;
+const std::size_t ObjectPool::m_nSlotsPerBlock = 256;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ObjectPool::Activation::Activation(ObjectPool &objectPool) :
+    m_pPreviousPool(ObjectPool::m_pActivePool)
+{
+    ObjectPool::m_pActivePool = &objectPool;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ObjectPool::Activation::~Activation()
+{
+    ObjectPool::m_pActivePool = m_pPreviousPool;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ObjectPool::ObjectPool() :
+    m_nLiveObjects(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ObjectPool::~ObjectPool()
+{
+    for (const SlotPool *const pSlotPool : m_slotPoolList)
+        delete pSlotPool;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ObjectPool::Reset()
+{
+    // ATTN Objects still alive (e.g. held outside the managers) pin the pool; freed slots are then simply recycled as usual
+    if (0 != m_nLiveObjects)
+        return;
+
+    for (SlotPool *const pSlotPool : m_slotPoolList)
+    {
+        pSlotPool->m_blockIndex = 0;
+        pSlotPool->m_slotIndex = 0;
+        pSlotPool->m_pFreeSlot = nullptr;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void *ObjectPool::Allocate(const std::size_t size)
+{
+    ObjectPool *const pObjectPool(m_pActivePool);
+
+    if (!pObjectPool)
+    {
+        SlotHeader *const pSlotHeader(static_cast<SlotHeader *>(::operator new(sizeof(SlotHeader) + size)));
+        pSlotHeader->m_pObjectPool = nullptr;
+        pSlotHeader->m_pSlotPool = nullptr;
+        return (pSlotHeader + 1);
+    }
+
+    SlotPool *const pSlotPool(pObjectPool->GetSlotPool(size));
+    void *pSlot(nullptr);
+
+    if (pSlotPool->m_pFreeSlot)
+    {
+        pSlot = pSlotPool->m_pFreeSlot;
+        pSlotPool->m_pFreeSlot = *static_cast<void **>(pSlot);
+    }
+    else
+    {
+        if (m_nSlotsPerBlock == pSlotPool->m_slotIndex)
+        {
+            ++pSlotPool->m_blockIndex;
+            pSlotPool->m_slotIndex = 0;
+        }
+
+        if (pSlotPool->m_blockList.size() == pSlotPool->m_blockIndex)
+            pSlotPool->m_blockList.push_back(static_cast<char *>(::operator new(m_nSlotsPerBlock * pSlotPool->m_slotSize)));
+
+        pSlot = pSlotPool->m_blockList[pSlotPool->m_blockIndex] + (pSlotPool->m_slotIndex++ * pSlotPool->m_slotSize);
+    }
+
+    SlotHeader *const pSlotHeader(static_cast<SlotHeader *>(pSlot));
+    pSlotHeader->m_pObjectPool = pObjectPool;
+    pSlotHeader->m_pSlotPool = pSlotPool;
+    ++pObjectPool->m_nLiveObjects;
+
+    return (pSlotHeader + 1);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ObjectPool::Free(void *const pAddress)
+{
+    if (!pAddress)
+        return;
+
+    SlotHeader *const pSlotHeader(static_cast<SlotHeader *>(pAddress) - 1);
+
+    if (!pSlotHeader->m_pObjectPool)
+    {
+        ::operator delete(pSlotHeader);
+        return;
+    }
+
+    SlotPool *const pSlotPool(pSlotHeader->m_pSlotPool);
+    --pSlotHeader->m_pObjectPool->m_nLiveObjects;
+
+    *reinterpret_cast<void **>(pSlotHeader) = pSlotPool->m_pFreeSlot;
+    pSlotPool->m_pFreeSlot = pSlotHeader;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ObjectPool::SlotPool *ObjectPool::GetSlotPool(const std::size_t size)
+{
+    const std::size_t alignment(alignof(std::max_align_t));
+    const std::size_t slotSize(sizeof(SlotHeader) + ((size + alignment - 1) / alignment) * alignment);
+
+    for (SlotPool *const pSlotPool : m_slotPoolList)
+    {
+        if (slotSize == pSlotPool->m_slotSize)
+            return pSlotPool;
+    }
+
+    m_slotPoolList.push_back(new SlotPool(slotSize));
+    return m_slotPoolList.back();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ObjectPool::SlotPool::SlotPool(const std::size_t slotSize) :
+    m_slotSize(slotSize),
+    m_blockIndex(0),
+    m_slotIndex(0),
+    m_pFreeSlot(nullptr)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ObjectPool::SlotPool::~SlotPool()
+{
+    for (char *const pBlock : m_blockList)
+        ::operator delete(pBlock);
+}
+
+} // namespace pandora
@@ -23,6 +23,7 @@
 
 #include "Objects/EventContext.h"
 
+#include "Pandora/AlgorithmProfiler.h"
 #include "Pandora/Pandora.h"
 #include "Pandora/PandoraImpl.h"
 #include "Pandora/PandoraSettings.h"
@@ -47,6 +48,7 @@ Pandora::Pandora(const std::string &name) :
     m_pPandoraContentApiImpl(nullptr),
     m_pPandoraImpl(nullptr),
     m_pEventContext{nullptr},
+    m_pAlgorithmProfiler(nullptr),
     m_name(name)
 {
     try
@@ -65,6 +67,7 @@ Pandora::Pandora(const std::string &name) :
         m_pPandoraContentApiImpl = new PandoraContentApiImpl(this);
         m_pEventContext = new EventContext(this),
         m_pPandoraImpl = new PandoraImpl(this);
+        m_pAlgorithmProfiler = new AlgorithmProfiler;
     }
     catch (StatusCodeException &statusCodeException)
     {
@@ -84,6 +87,13 @@ Pandora::Pandora(const std::string &name) :
 
 Pandora::~Pandora()
 {
+    // ATTN Profile summaries cover the lifetime of the pandora instance, so are written as it is destroyed
+    if (m_pAlgorithmProfiler && m_pPandoraSettings && m_pPandoraSettings->ShouldProfileAlgorithms())
+    {
+        const std::string &fileName(m_pPandoraSettings->GetAlgorithmProfileFileName());
+        (void) m_pAlgorithmProfiler->WriteSummary(m_name.empty() ? fileName : fileName + "_" + m_name);
+    }
+
     delete m_pAlgorithmManager;
     delete m_pCaloHitManager;
     delete m_pClusterManager;
@@ -98,12 +108,14 @@ Pandora::~Pandora()
     delete m_pPandoraContentApiImpl;
     delete m_pPandoraImpl;
     delete m_pEventContext;
+    delete m_pAlgorithmProfiler;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode Pandora::PrepareEvent()
 {
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandoraImpl->PrepareGeometry());
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandoraImpl->PrepareMCParticles());
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandoraImpl->PrepareCaloHits());
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandoraImpl->PrepareTracks());
@@ -153,9 +165,31 @@ StatusCode Pandora::ReadSettings(const std::string &xmlFileName)
         const TiXmlHandle xmlDocumentHandle(&xmlDocument);
         const TiXmlHandle xmlHandle(TiXmlHandle(xmlDocumentHandle.FirstChildElement().Element()));
 
-        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandoraImpl->InitializeSettings(&xmlHandle));
-        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandoraImpl->InitializeAlgorithms(&xmlHandle));
-        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandoraImpl->InitializePlugins(&xmlHandle));
+        return this->ReadSettings(&xmlHandle);
+    }
+    catch (StatusCodeException &statusCodeException)
+    {
+        std::cout << "Failure in reading pandora settings, " << statusCodeException.ToString() << std::endl;
+        return STATUS_CODE_FAILURE;
+    }
+    catch (...)
+    {
+        std::cout << "Failure in reading pandora settings, unrecognized exception" << std::endl;
+        return STATUS_CODE_FAILURE;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode Pandora::ReadSettings(const TiXmlHandle *const pXmlHandle)
+{
+    try
+    {
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandoraImpl->InitializeSettings(pXmlHandle));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandoraImpl->InitializeAlgorithms(pXmlHandle));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandoraImpl->InitializePlugins(pXmlHandle));
     }
     catch (StatusCodeException &statusCodeException)
     {
@@ -11,6 +11,7 @@
 #include "Managers/AlgorithmManager.h"
 #include "Managers/CaloHitManager.h"
 #include "Managers/ClusterManager.h"
+#include "Managers/GeometryManager.h"
 #include "Managers/MCManager.h"
 #include "Managers/ParticleFlowObjectManager.h"
 #include "Managers/PluginManager.h"
@@ -26,6 +27,13 @@
 namespace pandora
 {
 
+StatusCode PandoraImpl::PrepareGeometry() const
+{
+    return m_pPandora->m_pGeometryManager->IndexDetectorGaps();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode PandoraImpl::PrepareMCParticles() const
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pMCManager->CreateInputList());
@@ -47,6 +47,14 @@ StatusCode PandoraObjectFactory<PARAMETERS, OBJECT>::Write(const Object *const /
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename PARAMETERS, typename OBJECT>
+bool PandoraObjectFactory<PARAMETERS, OBJECT>::IsStandardFactory() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename PARAMETERS, typename OBJECT>
 StatusCode PandoraObjectFactory<PARAMETERS, OBJECT>::Create(const PARAMETERS &parameters, const OBJECT *&pObject) const
 {
@@ -16,6 +16,8 @@ namespace pandora
 PandoraSettings::PandoraSettings(const Pandora *const pPandora) :
     m_isMonitoringEnabled(false),
     m_shouldDisplayAlgorithmInfo(false),
+    m_shouldProfileAlgorithms(false),
+    m_algorithmProfileFileName("PandoraAlgorithmProfile"),
     m_singleHitTypeClusteringMode(false),
     m_shouldCollapseMCParticlesToPfoTarget(false),
     m_useSingleMCParticleAssociation(false),
@@ -64,6 +66,14 @@ StatusCode PandoraSettings::ReadGlobalSettings(const TiXmlHandle *const pXmlHand
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(*pXmlHandle,
         "ShouldDisplayAlgorithmInfo", m_shouldDisplayAlgorithmInfo));
 
+    m_shouldProfileAlgorithms = false;
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(*pXmlHandle,
+        "ShouldProfileAlgorithms", m_shouldProfileAlgorithms));
+
+    m_algorithmProfileFileName = "PandoraAlgorithmProfile";
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(*pXmlHandle,
+        "AlgorithmProfileFileName", m_algorithmProfileFileName));
+
     m_singleHitTypeClusteringMode = false;
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(*pXmlHandle,
         "SingleHitTypeClusteringMode", m_singleHitTypeClusteringMode));
@@ -12,16 +12,45 @@
 #include "Objects/Track.h"
 
 #include "Persistency/BinaryFileReader.h"
+#include "Persistency/CompressionHelper.h"
+
+#include <cstdio>
+#include <limits>
+
+#include <sys/stat.h>
 
 namespace pandora
 {
 
 BinaryFileReader::BinaryFileReader(const pandora::Pandora &pandora, const std::string &fileName) :
+    BinaryFileReader(pandora, fileName, true)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+BinaryFileReader::BinaryFileReader(const pandora::Pandora &pandora, const std::string &fileName, const bool openFileStream) :
     FileReader(pandora, fileName),
+    m_pMemory(nullptr),
+    m_memorySize(0),
+    m_memoryPosition(0),
     m_containerPosition(0),
-    m_containerSize(0)
+    m_containerSize(0),
+    m_isContainerCompressed(false),
+    m_isContainerDecompressed(false),
+    m_pSavedMemory(nullptr),
+    m_savedMemorySize(0),
+    m_savedMemoryPosition(0),
+    m_indexedSize(0),
+    m_isIndexComplete(false),
+    m_isIndexFileChecked(false),
+    m_isIndexFromFile(false)
 {
     m_fileType = BINARY;
+
+    if (!openFileStream)
+        return;
+
     m_fileStream.open(fileName.c_str(), std::ios::in | std::ios::binary);
 
     if (!m_fileStream.is_open() || !m_fileStream.good())
@@ -32,13 +61,69 @@ BinaryFileReader::BinaryFileReader(const pandora::Pandora &pandora, const std::s
 
 BinaryFileReader::~BinaryFileReader()
 {
-    m_fileStream.close();
+    if (m_fileStream.is_open())
+        m_fileStream.close();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode BinaryFileReader::ReadHeader()
 {
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadContainerHeader());
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->BufferContainer());
+
+    if (m_isContainerCompressed)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->DecompressContainer());
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BinaryFileReader::GoToNextContainer()
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadContainerHeader());
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SetFilePosition(m_containerPosition + m_containerSize));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ContainerId BinaryFileReader::GetNextContainerId()
+{
+    this->ResetContainerMemory();
+    const std::ifstream::pos_type initialPosition(this->GetFilePosition());
+
+    std::string fileHash;
+    const StatusCode fileHashStatusCode(this->ReadVariable(fileHash));
+
+    if (STATUS_CODE_SUCCESS != fileHashStatusCode)
+        throw StatusCodeException(fileHashStatusCode);
+
+    if (PANDORA_FILE_HASH != fileHash)
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    ContainerId containerId(UNKNOWN_CONTAINER);
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(containerId));
+
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SetFilePosition(initialPosition));
+
+    // ATTN Compressed event containers are otherwise indistinguishable from event containers
+    if (COMPRESSED_EVENT_CONTAINER == containerId)
+        return EVENT_CONTAINER;
+
+    return containerId;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BinaryFileReader::ReadContainerHeader()
+{
+    this->ResetContainerMemory();
+
     std::string fileHash;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(fileHash));
 
@@ -47,10 +132,15 @@ StatusCode BinaryFileReader::ReadHeader()
 
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(m_containerId));
 
+    m_isContainerCompressed = (COMPRESSED_EVENT_CONTAINER == m_containerId);
+
+    if (m_isContainerCompressed)
+        m_containerId = EVENT_CONTAINER;
+
     if ((HEADER_CONTAINER != m_containerId) && (EVENT_CONTAINER != m_containerId) && (GEOMETRY_CONTAINER != m_containerId))
         return STATUS_CODE_FAILURE;
 
-    m_containerPosition = m_fileStream.tellg();
+    m_containerPosition = this->GetFilePosition();
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(m_containerSize));
 
     if (0 == m_containerSize)
@@ -61,60 +151,167 @@ StatusCode BinaryFileReader::ReadHeader()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode BinaryFileReader::GoToNextContainer()
+StatusCode BinaryFileReader::DecompressContainer()
 {
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadHeader());
-    m_fileStream.seekg(m_containerPosition + m_containerSize, std::ios::beg);
+    CompressionId compressionId(UNKNOWN_COMPRESSION);
+    unsigned int decompressedSize(0), compressedSize(0);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(compressionId));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(decompressedSize));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(compressedSize));
 
-    if (!m_fileStream.good())
+    if (!m_pMemory || (m_memorySize - m_memoryPosition < compressedSize))
         return STATUS_CODE_FAILURE;
 
+    // ATTN Check the declared decompressed size against the codec limit, so that a corrupt header cannot trigger a huge allocation
+    std::size_t maxDecompressedSize(0);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, CompressionHelper::GetMaxDecompressedSize(compressionId, compressedSize, maxDecompressedSize));
+
+    if (decompressedSize > maxDecompressedSize)
+        return STATUS_CODE_FAILURE;
+
+    m_decompressedBuffer.resize(decompressedSize);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, CompressionHelper::Decompress(compressionId, m_pMemory + m_memoryPosition, compressedSize,
+        m_decompressedBuffer.data(), decompressedSize));
+
+    // ATTN Decode the decompressed contents in place, retaining the position beyond the compressed block for restoration afterwards
+    m_pSavedMemory = m_pMemory;
+    m_savedMemorySize = m_memorySize;
+    m_savedMemoryPosition = m_memoryPosition + compressedSize;
+    m_isContainerDecompressed = true;
+
+    m_pMemory = m_decompressedBuffer.data();
+    m_memorySize = m_decompressedBuffer.size();
+    m_memoryPosition = 0;
+
     return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-ContainerId BinaryFileReader::GetNextContainerId()
+void BinaryFileReader::ResetContainerMemory()
 {
-    const std::ifstream::pos_type initialPosition(m_fileStream.tellg());
+    if (m_isContainerDecompressed)
+    {
+        m_pMemory = m_pSavedMemory;
+        m_memorySize = m_savedMemorySize;
+        m_memoryPosition = m_savedMemoryPosition;
+        m_isContainerDecompressed = false;
+    }
 
-    std::string fileHash;
-    const StatusCode fileHashStatusCode(this->ReadVariable(fileHash));
+    this->ClearContainerBuffer();
+}
 
-    if (STATUS_CODE_SUCCESS != fileHashStatusCode)
-        throw StatusCodeException(fileHashStatusCode);
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-    if (PANDORA_FILE_HASH != fileHash)
-        throw StatusCodeException(STATUS_CODE_FAILURE);
+std::ifstream::pos_type BinaryFileReader::GetFilePosition()
+{
+    return m_fileStream.tellg();
+}
 
-    ContainerId containerId(UNKNOWN_CONTAINER);
-    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(containerId));
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-    m_fileStream.seekg(initialPosition, std::ios::beg);
+StatusCode BinaryFileReader::SetFilePosition(const std::ifstream::pos_type position)
+{
+    // ATTN Allow repositioning after an attempt to read beyond the end of the file
+    m_fileStream.clear();
+    m_fileStream.seekg(position, std::ios::beg);
 
     if (!m_fileStream.good())
-        throw StatusCodeException(STATUS_CODE_FAILURE);
+        return STATUS_CODE_FAILURE;
 
-    return containerId;
+    return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode BinaryFileReader::GoToGeometry(const unsigned int geometryNumber)
+StatusCode BinaryFileReader::BufferContainer()
 {
-    int nGeometriesRead(0);
-    m_fileStream.seekg(0, std::ios::beg);
+    const std::streamoff nBytesRead(m_fileStream.tellg() - m_containerPosition);
+    const std::streamoff nBytesRemaining(static_cast<std::streamoff>(m_containerSize) - nBytesRead);
+
+    if ((nBytesRead <= 0) || (nBytesRemaining <= 0))
+        return STATUS_CODE_FAILURE;
+
+    // ATTN The buffer only ever grows, so reading subsequent containers of similar size requires no further allocation
+    m_containerBuffer.resize(static_cast<std::size_t>(nBytesRemaining));
+    m_fileStream.read(m_containerBuffer.data(), nBytesRemaining);
 
     if (!m_fileStream.good())
         return STATUS_CODE_FAILURE;
 
-    if (GEOMETRY_CONTAINER != this->GetNextContainerId())
-        --nGeometriesRead;
+    m_pMemory = m_containerBuffer.data();
+    m_memorySize = m_containerBuffer.size();
+    m_memoryPosition = 0;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void BinaryFileReader::ClearContainerBuffer()
+{
+    m_containerBuffer.clear();
+    m_pMemory = nullptr;
+    m_memorySize = 0;
+    m_memoryPosition = 0;
+}
 
-    while (nGeometriesRead < static_cast<int>(geometryNumber))
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BinaryFileReader::GoToGeometry(const unsigned int geometryNumber)
+{
+    return this->GoToIndexedContainer(GEOMETRY_CONTAINER, geometryNumber);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BinaryFileReader::GoToEvent(const unsigned int eventNumber)
+{
+    return this->GoToIndexedContainer(EVENT_CONTAINER, eventNumber);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BinaryFileReader::WriteIndexFile()
+{
+    this->ExtendIndex(EVENT_CONTAINER, std::numeric_limits<unsigned int>::max());
+
+    // ATTN Write to a temporary file and rename, so that concurrent readers never see a partially written index file
+    const std::string indexFileName(this->GetIndexFileName());
+    const std::string temporaryFileName(indexFileName + ".tmp");
+
+    std::ofstream indexFileStream(temporaryFileName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (!indexFileStream.is_open())
+        return STATUS_CODE_FAILURE;
+
+    std::int64_t fileSize(0), modificationTime(0);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetFileStatus(fileSize, modificationTime));
+
+    const unsigned int hashSize(PANDORA_FILE_HASH.size());
+    indexFileStream.write(reinterpret_cast<const char *>(&hashSize), sizeof(hashSize));
+    indexFileStream.write(PANDORA_FILE_HASH.c_str(), hashSize);
+    indexFileStream.write(reinterpret_cast<const char *>(&fileSize), sizeof(fileSize));
+    indexFileStream.write(reinterpret_cast<const char *>(&modificationTime), sizeof(modificationTime));
+    indexFileStream.write(reinterpret_cast<const char *>(&m_indexedSize), sizeof(m_indexedSize));
+
+    const OffsetVector *const offsetVectors[2] = {&m_geometryOffsets, &m_eventOffsets};
+
+    for (const OffsetVector *const pOffsetVector : offsetVectors)
     {
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GoToNextGeometry());
-        ++nGeometriesRead;
+        const unsigned int nOffsets(pOffsetVector->size());
+        indexFileStream.write(reinterpret_cast<const char *>(&nOffsets), sizeof(nOffsets));
+
+        if (nOffsets > 0)
+            indexFileStream.write(reinterpret_cast<const char *>(pOffsetVector->data()), nOffsets * sizeof(std::streamoff));
+    }
+
+    indexFileStream.close();
+
+    if (!indexFileStream.good() || (0 != std::rename(temporaryFileName.c_str(), indexFileName.c_str())))
+    {
+        std::remove(temporaryFileName.c_str());
+        return STATUS_CODE_FAILURE;
     }
 
     return STATUS_CODE_SUCCESS;
@@ -122,23 +319,187 @@ StatusCode BinaryFileReader::GoToGeometry(const unsigned int geometryNumber)
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode BinaryFileReader::GoToEvent(const unsigned int eventNumber)
+StatusCode BinaryFileReader::GoToIndexedContainer(const ContainerId containerId, const unsigned int containerNumber)
 {
-    int nEventsRead(0);
-    m_fileStream.seekg(0, std::ios::beg);
+    if (!m_isIndexFileChecked)
+    {
+        m_isIndexFileChecked = true;
 
-    if (!m_fileStream.good())
+        if (STATUS_CODE_SUCCESS != this->ReadIndexFile())
+            this->ResetIndex();
+    }
+
+    this->ExtendIndex(containerId, containerNumber);
+    const OffsetVector &offsetVector((EVENT_CONTAINER == containerId) ? m_eventOffsets : m_geometryOffsets);
+
+    if (containerNumber >= offsetVector.size())
+        return STATUS_CODE_OUT_OF_RANGE;
+
+    const std::streamoff containerOffset(offsetVector.at(containerNumber));
+    this->ResetContainerMemory();
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SetFilePosition(containerOffset));
+
+    // ATTN Guard against an index file that is out of date, by checking the container header at the indexed position
+    const StatusCode statusCode(this->ReadContainerHeader());
+    const bool isExpectedContainer((STATUS_CODE_SUCCESS == statusCode) && (containerId == m_containerId));
+    m_containerId = UNKNOWN_CONTAINER;
+
+    if (!isExpectedContainer)
+    {
+        if (!m_isIndexFromFile)
+            return STATUS_CODE_FAILURE;
+
+        this->ResetIndex();
+        return this->GoToIndexedContainer(containerId, containerNumber);
+    }
+
+    return this->SetFilePosition(containerOffset);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void BinaryFileReader::ExtendIndex(const ContainerId containerId, const unsigned int containerNumber)
+{
+    const OffsetVector &offsetVector((EVENT_CONTAINER == containerId) ? m_eventOffsets : m_geometryOffsets);
+
+    while (!m_isIndexComplete && (containerNumber >= offsetVector.size()))
+    {
+        const std::streamoff containerOffset(m_indexedSize);
+        this->ResetContainerMemory();
+
+        // ATTN Quietly probe for the end of the file before reading the next container header
+        unsigned int hashSize(0);
+
+        if ((STATUS_CODE_SUCCESS != this->SetFilePosition(containerOffset)) || (STATUS_CODE_SUCCESS != this->ReadVariable(hashSize)) ||
+            (STATUS_CODE_SUCCESS != this->SetFilePosition(containerOffset)) || (STATUS_CODE_SUCCESS != this->ReadContainerHeader()))
+        {
+            m_isIndexComplete = true;
+            break;
+        }
+
+        if (EVENT_CONTAINER == m_containerId)
+        {
+            m_eventOffsets.push_back(containerOffset);
+        }
+        else if (GEOMETRY_CONTAINER == m_containerId)
+        {
+            m_geometryOffsets.push_back(containerOffset);
+        }
+
+        m_indexedSize = static_cast<std::streamoff>(m_containerPosition) + static_cast<std::streamoff>(m_containerSize);
+    }
+
+    m_containerId = UNKNOWN_CONTAINER;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void BinaryFileReader::ResetIndex()
+{
+    m_eventOffsets.clear();
+    m_geometryOffsets.clear();
+    m_indexedSize = 0;
+    m_isIndexComplete = false;
+    m_isIndexFromFile = false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BinaryFileReader::ReadIndexFile()
+{
+    std::ifstream indexFileStream(this->GetIndexFileName().c_str(), std::ios::in | std::ios::binary);
+
+    if (!indexFileStream.is_open())
+        return STATUS_CODE_NOT_FOUND;
+
+    unsigned int hashSize(0);
+    indexFileStream.read(reinterpret_cast<char *>(&hashSize), sizeof(hashSize));
+
+    if (!indexFileStream.good() || (PANDORA_FILE_HASH.size() != hashSize))
         return STATUS_CODE_FAILURE;
 
-    if (EVENT_CONTAINER != this->GetNextContainerId())
-        --nEventsRead;
+    std::string fileHash(hashSize, ' ');
+    std::int64_t indexedFileSize(0), indexedModificationTime(0);
+    indexFileStream.read(&fileHash[0], hashSize);
+    indexFileStream.read(reinterpret_cast<char *>(&indexedFileSize), sizeof(indexedFileSize));
+    indexFileStream.read(reinterpret_cast<char *>(&indexedModificationTime), sizeof(indexedModificationTime));
+    indexFileStream.read(reinterpret_cast<char *>(&m_indexedSize), sizeof(m_indexedSize));
 
-    while (nEventsRead < static_cast<int>(eventNumber))
+    if (!indexFileStream.good() || (PANDORA_FILE_HASH != fileHash))
+        return STATUS_CODE_FAILURE;
+
+    // ATTN The index file is only used for the binary file it was written for: a file rewritten or appended to since is re-indexed
+    std::int64_t fileSize(0), modificationTime(0);
+
+    if ((STATUS_CODE_SUCCESS != this->GetFileStatus(fileSize, modificationTime)) || (indexedFileSize != fileSize) ||
+        (indexedModificationTime != modificationTime) || (m_indexedSize < 0) || (m_indexedSize > fileSize))
     {
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GoToNextEvent());
-        ++nEventsRead;
+        return STATUS_CODE_FAILURE;
     }
 
+    const std::streamoff indexDataPosition(indexFileStream.tellg());
+    indexFileStream.seekg(0, std::ios::end);
+    const std::streamoff indexFileSize(indexFileStream.tellg());
+    indexFileStream.seekg(indexDataPosition);
+
+    if (!indexFileStream.good() || (indexDataPosition < 0) || (indexFileSize < indexDataPosition))
+        return STATUS_CODE_FAILURE;
+
+    OffsetVector *const offsetVectors[2] = {&m_geometryOffsets, &m_eventOffsets};
+
+    for (OffsetVector *const pOffsetVector : offsetVectors)
+    {
+        unsigned int nOffsets(0);
+        indexFileStream.read(reinterpret_cast<char *>(&nOffsets), sizeof(nOffsets));
+
+        if (!indexFileStream.good())
+            return STATUS_CODE_FAILURE;
+
+        // ATTN Bound the offset count by the bytes remaining in the index file, before allocating
+        const std::streamoff nRemainingBytes(indexFileSize - static_cast<std::streamoff>(indexFileStream.tellg()));
+
+        if ((nRemainingBytes < 0) || (nOffsets > static_cast<std::size_t>(nRemainingBytes) / sizeof(std::streamoff)))
+            return STATUS_CODE_FAILURE;
+
+        pOffsetVector->resize(nOffsets);
+
+        if (nOffsets > 0)
+            indexFileStream.read(reinterpret_cast<char *>(pOffsetVector->data()), nOffsets * sizeof(std::streamoff));
+
+        if (!indexFileStream.good())
+            return STATUS_CODE_FAILURE;
+
+        for (const std::streamoff offset : *pOffsetVector)
+        {
+            if ((offset < 0) || (offset >= m_indexedSize))
+                return STATUS_CODE_FAILURE;
+        }
+    }
+
+    m_isIndexFromFile = true;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::string BinaryFileReader::GetIndexFileName() const
+{
+    return (m_fileName + ".index");
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BinaryFileReader::GetFileStatus(std::int64_t &fileSize, std::int64_t &modificationTime) const
+{
+    struct stat fileStatus;
+
+    if (0 != stat(m_fileName.c_str(), &fileStatus))
+        return STATUS_CODE_FAILURE;
+
+    fileSize = static_cast<std::int64_t>(fileStatus.st_size);
+    modificationTime = static_cast<std::int64_t>(fileStatus.st_mtime);
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -223,6 +584,8 @@ StatusCode BinaryFileReader::ReadNextEventComponent()
     {
         case CALO_HIT_COMPONENT:
             return this->ReadCaloHit(false);
+        case CALO_HIT_BLOCK_COMPONENT:
+            return this->ReadCaloHitBlock(false);
         case TRACK_COMPONENT:
             return this->ReadTrack(false);
         case MC_PARTICLE_COMPONENT:
@@ -683,6 +1046,124 @@ StatusCode BinaryFileReader::ReadCaloHit(bool checkComponentId)
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode BinaryFileReader::ReadCaloHitBlock(bool checkComponentId)
+{
+    if (EVENT_CONTAINER != m_containerId)
+        return STATUS_CODE_FAILURE;
+
+    if (checkComponentId)
+    {
+        ComponentId componentId(UNKNOWN_COMPONENT);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(componentId));
+
+        if (CALO_HIT_BLOCK_COMPONENT != componentId)
+            return STATUS_CODE_FAILURE;
+    }
+
+    unsigned int nCaloHits(0), nExtensionBytes(0);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(nCaloHits));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(nExtensionBytes));
+
+    // ATTN Calo hit blocks are only written within compressed event containers, so are always decoded from the decompressed contents
+    if (!m_pMemory)
+        return STATUS_CODE_FAILURE;
+
+    // ATTN Each column holds at least one byte per calo hit, so a corrupt count cannot trigger allocations beyond the in-memory contents
+    if (nCaloHits > m_memorySize - m_memoryPosition)
+        return STATUS_CODE_FAILURE;
+
+    m_caloHitBlock.Resize(nCaloHits);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_cellGeometry));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_positionX));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_positionY));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_positionZ));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_expectedDirectionX));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_expectedDirectionY));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_expectedDirectionZ));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_cellNormalX));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_cellNormalY));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_cellNormalZ));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_cellThickness));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_nCellRadiationLengths));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_nCellInteractionLengths));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_time));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_inputEnergy));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_mipEquivalentEnergy));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_electromagneticEnergy));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_hadronicEnergy));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_isDigital));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_hitType));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_hitRegion));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_layer));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_isInOuterSamplingLayer));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_parentAddress));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_cellSize0));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadColumn(m_caloHitBlock.m_cellSize1));
+
+    // ATTN A standard calo hit factory reads no contents of its own, so the calo hits can be recreated in bulk, directly from the columns.
+    // Any contents written by a custom calo hit factory are skipped.
+    if (m_pCaloHitFactory->IsStandardFactory())
+    {
+        if (m_memorySize - m_memoryPosition < nExtensionBytes)
+            return STATUS_CODE_FAILURE;
+
+        m_memoryPosition += nExtensionBytes;
+        return PandoraApi::CreateCaloHits(*m_pPandora, m_caloHitBlock);
+    }
+
+    // ATTN The calo hit factory contents follow the columns, in calo hit order, and are read as each calo hit is recreated
+    const std::size_t extensionPosition(m_memoryPosition);
+
+    for (unsigned int iCaloHit = 0; iCaloHit < nCaloHits; ++iCaloHit)
+    {
+        PandoraApi::CaloHit::Parameters *pParameters = m_pCaloHitFactory->NewParameters();
+
+        try
+        {
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pCaloHitFactory->Read(*pParameters, *this));
+
+            pParameters->m_positionVector = CartesianVector(
+                m_caloHitBlock.m_positionX[iCaloHit], m_caloHitBlock.m_positionY[iCaloHit], m_caloHitBlock.m_positionZ[iCaloHit]);
+            pParameters->m_expectedDirection = CartesianVector(m_caloHitBlock.m_expectedDirectionX[iCaloHit],
+                m_caloHitBlock.m_expectedDirectionY[iCaloHit], m_caloHitBlock.m_expectedDirectionZ[iCaloHit]);
+            pParameters->m_cellNormalVector = CartesianVector(
+                m_caloHitBlock.m_cellNormalX[iCaloHit], m_caloHitBlock.m_cellNormalY[iCaloHit], m_caloHitBlock.m_cellNormalZ[iCaloHit]);
+            pParameters->m_cellGeometry = m_caloHitBlock.m_cellGeometry[iCaloHit];
+            pParameters->m_cellSize0 = m_caloHitBlock.m_cellSize0[iCaloHit];
+            pParameters->m_cellSize1 = m_caloHitBlock.m_cellSize1[iCaloHit];
+            pParameters->m_cellThickness = m_caloHitBlock.m_cellThickness[iCaloHit];
+            pParameters->m_nCellRadiationLengths = m_caloHitBlock.m_nCellRadiationLengths[iCaloHit];
+            pParameters->m_nCellInteractionLengths = m_caloHitBlock.m_nCellInteractionLengths[iCaloHit];
+            pParameters->m_time = m_caloHitBlock.m_time[iCaloHit];
+            pParameters->m_inputEnergy = m_caloHitBlock.m_inputEnergy[iCaloHit];
+            pParameters->m_mipEquivalentEnergy = m_caloHitBlock.m_mipEquivalentEnergy[iCaloHit];
+            pParameters->m_electromagneticEnergy = m_caloHitBlock.m_electromagneticEnergy[iCaloHit];
+            pParameters->m_hadronicEnergy = m_caloHitBlock.m_hadronicEnergy[iCaloHit];
+            pParameters->m_isDigital = (0 != m_caloHitBlock.m_isDigital[iCaloHit]);
+            pParameters->m_hitType = m_caloHitBlock.m_hitType[iCaloHit];
+            pParameters->m_hitRegion = m_caloHitBlock.m_hitRegion[iCaloHit];
+            pParameters->m_layer = m_caloHitBlock.m_layer[iCaloHit];
+            pParameters->m_isInOuterSamplingLayer = (0 != m_caloHitBlock.m_isInOuterSamplingLayer[iCaloHit]);
+            pParameters->m_pParentAddress = m_caloHitBlock.m_parentAddress[iCaloHit];
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(*m_pPandora, *pParameters, *m_pCaloHitFactory));
+            delete pParameters;
+        }
+        catch (StatusCodeException &statusCodeException)
+        {
+            delete pParameters;
+            return statusCodeException.GetStatusCode();
+        }
+    }
+
+    // ATTN A calo hit factory reading a different number of bytes than was written would leave subsequent components misaligned
+    if (m_memoryPosition - extensionPosition != nExtensionBytes)
+        return STATUS_CODE_FAILURE;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode BinaryFileReader::ReadTrack(bool checkComponentId)
 {
     if (EVENT_CONTAINER != m_containerId)
@@ -18,13 +18,18 @@
 #include "Objects/Track.h"
 
 #include "Persistency/BinaryFileWriter.h"
+#include "Persistency/CompressionHelper.h"
+
+#include <limits>
 
 namespace pandora
 {
 
 BinaryFileWriter::BinaryFileWriter(const pandora::Pandora &pandora, const std::string &fileName, const FileMode fileMode,
     const unsigned int majorVersion, const unsigned int minorVersion) :
-    FileWriter(pandora, fileName, majorVersion, minorVersion)
+    FileWriter(pandora, fileName, majorVersion, minorVersion),
+    m_isCompressingContainer(false),
+    m_pWriteBuffer(nullptr)
 {
     m_fileType = BINARY;
 
@@ -63,8 +68,12 @@ BinaryFileWriter::~BinaryFileWriter()
 
 StatusCode BinaryFileWriter::WriteHeader(const ContainerId containerId)
 {
+    m_isCompressingContainer = false;
+    m_pWriteBuffer = nullptr;
+    const bool compressContainer((EVENT_CONTAINER == containerId) && (m_fileMinorVersion >= 1));
+
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(PANDORA_FILE_HASH));
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(containerId));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(compressContainer ? COMPRESSED_EVENT_CONTAINER : containerId));
 
     m_containerPosition = m_fileStream.tellp();
     const std::ofstream::pos_type dummyContainerSize(0);
@@ -72,6 +81,13 @@ StatusCode BinaryFileWriter::WriteHeader(const ContainerId containerId)
 
     m_containerId = containerId;
 
+    if (compressContainer)
+    {
+        m_containerBuffer.clear();
+        m_isCompressingContainer = true;
+        m_pWriteBuffer = &m_containerBuffer;
+    }
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -87,6 +103,11 @@ StatusCode BinaryFileWriter::WriteFooter()
                 : (EVENT_CONTAINER == m_containerId)            ? EVENT_END_COMPONENT
                                                                 : GEOMETRY_END_COMPONENT));
 
+    if (m_isCompressingContainer)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteCompressedContainer());
+    }
+
     m_containerId = UNKNOWN_CONTAINER;
 
     const std::ofstream::pos_type containerSize(m_fileStream.tellp() - m_containerPosition);
@@ -108,6 +129,28 @@ StatusCode BinaryFileWriter::WriteFooter()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode BinaryFileWriter::WriteCompressedContainer()
+{
+    m_isCompressingContainer = false;
+    m_pWriteBuffer = nullptr;
+
+    const CompressionId compressionId(CompressionHelper::GetDefaultCompressionId());
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, CompressionHelper::Compress(compressionId, m_containerBuffer.data(), m_containerBuffer.size(), m_compressedBuffer));
+
+    if ((m_containerBuffer.size() > std::numeric_limits<unsigned int>::max()) || (m_compressedBuffer.size() > std::numeric_limits<unsigned int>::max()))
+        return STATUS_CODE_OUT_OF_RANGE;
+
+    const unsigned int decompressedSize(m_containerBuffer.size()), compressedSize(m_compressedBuffer.size());
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(compressionId));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(decompressedSize));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(compressedSize));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteBytes(m_compressedBuffer.data(), m_compressedBuffer.size()));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode BinaryFileWriter::WriteVersion()
 {
     if (HEADER_CONTAINER != m_containerId)
@@ -250,6 +293,117 @@ StatusCode BinaryFileWriter::WriteDetectorGap(const DetectorGap *const pDetector
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode BinaryFileWriter::WriteCaloHitList(const CaloHitList &caloHitList)
+{
+    if (m_fileMinorVersion < 2)
+        return FileWriter::WriteCaloHitList(caloHitList);
+
+    if (EVENT_CONTAINER != m_containerId)
+        return STATUS_CODE_FAILURE;
+
+    if (caloHitList.empty())
+        return STATUS_CODE_SUCCESS;
+
+    if (caloHitList.size() > std::numeric_limits<unsigned int>::max())
+        return STATUS_CODE_OUT_OF_RANGE;
+
+    const unsigned int nCaloHits(caloHitList.size());
+    m_caloHitBlock.Resize(nCaloHits);
+
+    // ATTN Calo hit factory contents are written per calo hit, so are gathered separately and stored after the columns, in calo hit order
+    CharVector *const pWriteBuffer(m_pWriteBuffer);
+    m_extensionBuffer.clear();
+    m_pWriteBuffer = &m_extensionBuffer;
+
+    unsigned int iCaloHit(0);
+
+    for (const CaloHit *const pCaloHit : caloHitList)
+    {
+        const StatusCode statusCode(m_pCaloHitFactory->Write(pCaloHit, *this));
+
+        if (STATUS_CODE_SUCCESS != statusCode)
+        {
+            m_pWriteBuffer = pWriteBuffer;
+            return statusCode;
+        }
+
+        const CartesianVector &positionVector(pCaloHit->GetPositionVector());
+        const CartesianVector &expectedDirection(pCaloHit->GetExpectedDirection());
+        const CartesianVector &cellNormalVector(pCaloHit->GetCellNormalVector());
+
+        m_caloHitBlock.m_cellGeometry[iCaloHit] = pCaloHit->GetCellGeometry();
+        m_caloHitBlock.m_positionX[iCaloHit] = positionVector.GetX();
+        m_caloHitBlock.m_positionY[iCaloHit] = positionVector.GetY();
+        m_caloHitBlock.m_positionZ[iCaloHit] = positionVector.GetZ();
+        m_caloHitBlock.m_expectedDirectionX[iCaloHit] = expectedDirection.GetX();
+        m_caloHitBlock.m_expectedDirectionY[iCaloHit] = expectedDirection.GetY();
+        m_caloHitBlock.m_expectedDirectionZ[iCaloHit] = expectedDirection.GetZ();
+        m_caloHitBlock.m_cellNormalX[iCaloHit] = cellNormalVector.GetX();
+        m_caloHitBlock.m_cellNormalY[iCaloHit] = cellNormalVector.GetY();
+        m_caloHitBlock.m_cellNormalZ[iCaloHit] = cellNormalVector.GetZ();
+        m_caloHitBlock.m_cellThickness[iCaloHit] = pCaloHit->GetCellThickness();
+        m_caloHitBlock.m_nCellRadiationLengths[iCaloHit] = pCaloHit->GetNCellRadiationLengths();
+        m_caloHitBlock.m_nCellInteractionLengths[iCaloHit] = pCaloHit->GetNCellInteractionLengths();
+        m_caloHitBlock.m_time[iCaloHit] = pCaloHit->GetTime();
+        m_caloHitBlock.m_inputEnergy[iCaloHit] = pCaloHit->GetInputEnergy();
+        m_caloHitBlock.m_mipEquivalentEnergy[iCaloHit] = pCaloHit->GetMipEquivalentEnergy();
+        m_caloHitBlock.m_electromagneticEnergy[iCaloHit] = pCaloHit->GetElectromagneticEnergy();
+        m_caloHitBlock.m_hadronicEnergy[iCaloHit] = pCaloHit->GetHadronicEnergy();
+        m_caloHitBlock.m_isDigital[iCaloHit] = pCaloHit->IsDigital() ? 1 : 0;
+        m_caloHitBlock.m_hitType[iCaloHit] = pCaloHit->GetHitType();
+        m_caloHitBlock.m_hitRegion[iCaloHit] = pCaloHit->GetHitRegion();
+        m_caloHitBlock.m_layer[iCaloHit] = pCaloHit->GetLayer();
+        m_caloHitBlock.m_isInOuterSamplingLayer[iCaloHit] = pCaloHit->IsInOuterSamplingLayer() ? 1 : 0;
+        m_caloHitBlock.m_parentAddress[iCaloHit] = pCaloHit->GetParentAddress();
+        m_caloHitBlock.m_cellSize0[iCaloHit] = pCaloHit->GetCellSize0();
+        m_caloHitBlock.m_cellSize1[iCaloHit] = pCaloHit->GetCellSize1();
+        ++iCaloHit;
+    }
+
+    m_pWriteBuffer = pWriteBuffer;
+
+    if (m_extensionBuffer.size() > std::numeric_limits<unsigned int>::max())
+        return STATUS_CODE_OUT_OF_RANGE;
+
+    // ATTN Column sizes follow from the number of calo hits and, with the size of the factory contents, allow readers to skip columns
+    const unsigned int nExtensionBytes(m_extensionBuffer.size());
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(CALO_HIT_BLOCK_COMPONENT));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(nCaloHits));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(nExtensionBytes));
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_cellGeometry));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_positionX));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_positionY));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_positionZ));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_expectedDirectionX));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_expectedDirectionY));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_expectedDirectionZ));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_cellNormalX));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_cellNormalY));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_cellNormalZ));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_cellThickness));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_nCellRadiationLengths));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_nCellInteractionLengths));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_time));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_inputEnergy));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_mipEquivalentEnergy));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_electromagneticEnergy));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_hadronicEnergy));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_isDigital));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_hitType));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_hitRegion));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_layer));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_isInOuterSamplingLayer));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_parentAddress));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_cellSize0));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_caloHitBlock.m_cellSize1));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteColumn(m_extensionBuffer));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode BinaryFileWriter::WriteCaloHit(const CaloHit *const pCaloHit)
 {
     if (EVENT_CONTAINER != m_containerId)
@@ -0,0 +1,296 @@
+/**
+ *  @file   PandoraSDK/src/Persistency/CompressionHelper.cc
+ *
+ *  @brief  Implementation of the compression helper class.
+ *
+ *  $Log: $
+ */
+
+#include "Persistency/CompressionHelper.h"
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+#ifdef PANDORA_ZLIB
+#include <zlib.h>
+#endif
+
+namespace pandora
+{
+
+// Pandora lz codec parameters
+static const std::size_t PANDORA_LZ_MIN_MATCH(4);             ///< The minimum length of a back-reference
+static const std::size_t PANDORA_LZ_MAX_OFFSET(65535);        ///< The maximum distance of a back-reference
+static const std::size_t PANDORA_LZ_END_LITERALS(5);          ///< The number of trailing bytes always stored as literals
+static const std::size_t PANDORA_LZ_MIN_INPUT(13);            ///< The minimum input size for which back-references are sought
+static const unsigned int PANDORA_LZ_HASH_BITS(14);           ///< The number of bits in the hash of a four-byte sequence
+static const unsigned int PANDORA_LZ_SKIP_TRIGGER(6);         ///< Controls acceleration through incompressible data
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CompressionId CompressionHelper::GetDefaultCompressionId()
+{
+#ifdef PANDORA_ZLIB
+    return ZLIB_COMPRESSION;
+#else
+    return PANDORA_LZ_COMPRESSION;
+#endif
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CompressionHelper::Compress(const CompressionId compressionId, const char *const pInput, const std::size_t inputSize, CharVector &output)
+{
+    output.clear();
+
+    if (PANDORA_LZ_COMPRESSION == compressionId)
+    {
+        CompressionHelper::CompressPandoraLZ(reinterpret_cast<const unsigned char *>(pInput), inputSize, output);
+        return STATUS_CODE_SUCCESS;
+    }
+#ifdef PANDORA_ZLIB
+    if (ZLIB_COMPRESSION == compressionId)
+    {
+        uLongf outputSize(compressBound(inputSize));
+        output.resize(outputSize);
+
+        if (Z_OK != compress2(reinterpret_cast<Bytef *>(output.data()), &outputSize, reinterpret_cast<const Bytef *>(pInput), inputSize, Z_BEST_SPEED))
+            return STATUS_CODE_FAILURE;
+
+        output.resize(outputSize);
+        return STATUS_CODE_SUCCESS;
+    }
+#endif
+    return STATUS_CODE_NOT_ALLOWED;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CompressionHelper::Decompress(const CompressionId compressionId, const char *const pInput, const std::size_t inputSize, char *const pOutput,
+    const std::size_t outputSize)
+{
+    if (PANDORA_LZ_COMPRESSION == compressionId)
+    {
+        return CompressionHelper::DecompressPandoraLZ(reinterpret_cast<const unsigned char *>(pInput), inputSize,
+            reinterpret_cast<unsigned char *>(pOutput), outputSize);
+    }
+#ifdef PANDORA_ZLIB
+    if (ZLIB_COMPRESSION == compressionId)
+    {
+        uLongf decompressedSize(outputSize);
+
+        if ((Z_OK != uncompress(reinterpret_cast<Bytef *>(pOutput), &decompressedSize, reinterpret_cast<const Bytef *>(pInput), inputSize)) ||
+            (outputSize != decompressedSize))
+        {
+            return STATUS_CODE_FAILURE;
+        }
+
+        return STATUS_CODE_SUCCESS;
+    }
+#endif
+    std::cout << "CompressionHelper::Decompress - codec " << compressionId << " unavailable in this build" << std::endl;
+    return STATUS_CODE_NOT_ALLOWED;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CompressionHelper::GetMaxDecompressedSize(const CompressionId compressionId, const std::size_t inputSize, std::size_t &maxOutputSize)
+{
+    // ATTN Each pandora lz input byte yields at most 255 output bytes, via a length extension; deflate is limited to a ratio of 1032
+    if (PANDORA_LZ_COMPRESSION == compressionId)
+    {
+        maxOutputSize = 255 * inputSize;
+        return STATUS_CODE_SUCCESS;
+    }
+#ifdef PANDORA_ZLIB
+    if (ZLIB_COMPRESSION == compressionId)
+    {
+        maxOutputSize = 1032 * inputSize;
+        return STATUS_CODE_SUCCESS;
+    }
+#endif
+    std::cout << "CompressionHelper::GetMaxDecompressedSize - codec " << compressionId << " unavailable in this build" << std::endl;
+    return STATUS_CODE_NOT_ALLOWED;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CompressionHelper::CompressPandoraLZ(const unsigned char *const pInput, const std::size_t inputSize, CharVector &output)
+{
+    // ATTN Size the output for the worst case, incompressible input, then write sequences directly and trim at the end
+    output.resize(inputSize + inputSize / 255 + 16);
+    unsigned char *const pOutputStart(reinterpret_cast<unsigned char *>(output.data()));
+    unsigned char *pOutput(pOutputStart);
+
+    std::size_t anchor(0), position(0);
+
+    if (inputSize >= PANDORA_LZ_MIN_INPUT)
+    {
+        // ATTN Hash table entries hold positions offset by one, so that zero denotes an empty entry
+        std::vector<std::size_t> hashTable(1 << PANDORA_LZ_HASH_BITS, 0);
+        const std::size_t matchStartLimit(inputSize - PANDORA_LZ_MIN_INPUT + 1), matchEndLimit(inputSize - PANDORA_LZ_END_LITERALS);
+
+        while (position < matchStartLimit)
+        {
+            std::uint32_t sequence(0), candidateSequence(0);
+            std::memcpy(&sequence, pInput + position, sizeof(sequence));
+
+            const std::size_t hash((sequence * 2654435761U) >> (32 - PANDORA_LZ_HASH_BITS));
+            const std::size_t candidate(hashTable[hash]);
+            hashTable[hash] = position + 1;
+
+            if (0 != candidate)
+                std::memcpy(&candidateSequence, pInput + candidate - 1, sizeof(candidateSequence));
+
+            if ((0 == candidate) || (position - (candidate - 1) > PANDORA_LZ_MAX_OFFSET) || (sequence != candidateSequence))
+            {
+                position += 1 + ((position - anchor) >> PANDORA_LZ_SKIP_TRIGGER);
+                continue;
+            }
+
+            const std::size_t reference(candidate - 1);
+            std::size_t matchLength(PANDORA_LZ_MIN_MATCH);
+
+            while ((position + matchLength < matchEndLimit) && (pInput[reference + matchLength] == pInput[position + matchLength]))
+                ++matchLength;
+
+            const std::size_t literalLength(position - anchor), offset(position - reference);
+            const std::size_t extraMatchLength(matchLength - PANDORA_LZ_MIN_MATCH);
+
+            *pOutput++ = static_cast<unsigned char>(((literalLength < 15 ? literalLength : 15) << 4) | (extraMatchLength < 15 ? extraMatchLength : 15));
+
+            if (literalLength >= 15)
+                CompressionHelper::WriteExtendedLength(literalLength - 15, pOutput);
+
+            std::memcpy(pOutput, pInput + anchor, literalLength);
+            pOutput += literalLength;
+            *pOutput++ = static_cast<unsigned char>(offset & 0xff);
+            *pOutput++ = static_cast<unsigned char>(offset >> 8);
+
+            if (extraMatchLength >= 15)
+                CompressionHelper::WriteExtendedLength(extraMatchLength - 15, pOutput);
+
+            position += matchLength;
+            anchor = position;
+        }
+    }
+
+    // ATTN The final sequence holds only literals, and is identified by exhausting the compressed bytes
+    const std::size_t literalLength(inputSize - anchor);
+    *pOutput++ = static_cast<unsigned char>((literalLength < 15 ? literalLength : 15) << 4);
+
+    if (literalLength >= 15)
+        CompressionHelper::WriteExtendedLength(literalLength - 15, pOutput);
+
+    if (literalLength > 0)
+        std::memcpy(pOutput, pInput + anchor, literalLength);
+
+    pOutput += literalLength;
+    output.resize(pOutput - pOutputStart);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CompressionHelper::DecompressPandoraLZ(const unsigned char *const pInput, const std::size_t inputSize, unsigned char *const pOutput,
+    const std::size_t outputSize)
+{
+    std::size_t inputPosition(0), outputPosition(0);
+
+    while (inputPosition < inputSize)
+    {
+        const unsigned int token(pInput[inputPosition++]);
+        std::size_t literalLength(token >> 4);
+
+        if (15 == literalLength)
+        {
+            std::size_t extraLength(0);
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, CompressionHelper::ReadExtendedLength(pInput, inputSize, inputPosition, extraLength));
+            literalLength += extraLength;
+        }
+
+        if ((inputSize - inputPosition < literalLength) || (outputSize - outputPosition < literalLength))
+            return STATUS_CODE_FAILURE;
+
+        if (literalLength > 0)
+            std::memcpy(pOutput + outputPosition, pInput + inputPosition, literalLength);
+
+        inputPosition += literalLength;
+        outputPosition += literalLength;
+
+        if (inputPosition == inputSize)
+            break;
+
+        if (inputSize - inputPosition < 2)
+            return STATUS_CODE_FAILURE;
+
+        const std::size_t offset(pInput[inputPosition] | (static_cast<std::size_t>(pInput[inputPosition + 1]) << 8));
+        inputPosition += 2;
+
+        std::size_t matchLength((token & 0xf) + PANDORA_LZ_MIN_MATCH);
+
+        if (15 + PANDORA_LZ_MIN_MATCH == matchLength)
+        {
+            std::size_t extraLength(0);
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, CompressionHelper::ReadExtendedLength(pInput, inputSize, inputPosition, extraLength));
+            matchLength += extraLength;
+        }
+
+        if ((0 == offset) || (offset > outputPosition) || (outputSize - outputPosition < matchLength))
+            return STATUS_CODE_FAILURE;
+
+        unsigned char *const pMatchOutput(pOutput + outputPosition);
+        const unsigned char *const pReference(pMatchOutput - offset);
+
+        // ATTN Overlapping back-references repeat recently decompressed bytes, so must be copied byte by byte
+        if (offset >= matchLength)
+        {
+            std::memcpy(pMatchOutput, pReference, matchLength);
+        }
+        else
+        {
+            for (std::size_t iByte = 0; iByte < matchLength; ++iByte)
+                pMatchOutput[iByte] = pReference[iByte];
+        }
+
+        outputPosition += matchLength;
+    }
+
+    if (outputSize != outputPosition)
+        return STATUS_CODE_FAILURE;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CompressionHelper::WriteExtendedLength(std::size_t length, unsigned char *&pOutput)
+{
+    while (length >= 255)
+    {
+        *pOutput++ = 255;
+        length -= 255;
+    }
+
+    *pOutput++ = static_cast<unsigned char>(length);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CompressionHelper::ReadExtendedLength(const unsigned char *const pInput, const std::size_t inputSize, std::size_t &position, std::size_t &length)
+{
+    unsigned int byte(255);
+
+    while (255 == byte)
+    {
+        if (position >= inputSize)
+            return STATUS_CODE_FAILURE;
+
+        byte = pInput[position++];
+        length += byte;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace pandora
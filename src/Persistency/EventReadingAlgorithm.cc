@@ -10,6 +10,7 @@
 
 #include "Persistency/EventReadingAlgorithm.h"
 #include "Persistency/BinaryFileReader.h"
+#include "Persistency/MappedBinaryFileReader.h"
 #include "Persistency/XmlFileReader.h"
 
 #include <algorithm>
@@ -18,6 +19,8 @@ using namespace pandora;
 
 EventReadingAlgorithm::EventReadingAlgorithm() :
     m_skipToEvent(0),
+    m_useMappedFileReader(false),
+    m_writeEventIndexFile(false),
     m_pEventFileReader(nullptr)
 {
 }
@@ -33,7 +36,8 @@ EventReadingAlgorithm::~EventReadingAlgorithm()
 
 StatusCode EventReadingAlgorithm::Initialize()
 {
-    if (!m_geometryFileName.empty())
+    // ATTN Geometry shared from another pandora instance has already been read, and is immutable
+    if (!m_geometryFileName.empty() && !PandoraContentApi::GetGeometry(*this)->IsShared())
     {
         const FileType geometryFileType(this->GetFileType(m_geometryFileName));
 
@@ -116,7 +120,12 @@ StatusCode EventReadingAlgorithm::ReplaceEventFileReader(const std::string &file
 
     if (BINARY == eventFileType)
     {
-        m_pEventFileReader = new BinaryFileReader(this->GetPandora(), fileName);
+        BinaryFileReader *const pBinaryFileReader(m_useMappedFileReader ? new MappedBinaryFileReader(this->GetPandora(), fileName)
+                                                                        : new BinaryFileReader(this->GetPandora(), fileName));
+        m_pEventFileReader = pBinaryFileReader;
+
+        if (m_writeEventIndexFile && (STATUS_CODE_SUCCESS != pBinaryFileReader->WriteIndexFile()))
+            std::cout << "EventReadingAlgorithm: Unable to write index file for event file: " << fileName << std::endl;
     }
     else if (XML == eventFileType)
     {
@@ -200,6 +209,18 @@ StatusCode EventReadingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
         PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "SkipToEvent", m_skipToEvent));
     }
 
+    if (pExternalParameters && pExternalParameters->m_useMappedFileReader.IsInitialized())
+    {
+        m_useMappedFileReader = pExternalParameters->m_useMappedFileReader.Get();
+    }
+    else
+    {
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "UseMappedFileReader", m_useMappedFileReader));
+    }
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "WriteEventIndexFile", m_writeEventIndexFile));
+
     if (m_geometryFileName.empty() && m_eventFileName.empty())
     {
         std::cout << "EventReadingAlgorithm - nothing to do; neither geometry nor event file specified." << std::endl;
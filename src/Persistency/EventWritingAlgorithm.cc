@@ -23,6 +23,8 @@ EventWritingAlgorithm::EventWritingAlgorithm() :
     m_shouldWriteTrackRelationships(true),
     m_shouldOverwriteEventFile(false),
     m_shouldOverwriteGeometryFile(false),
+    m_shouldCompressEventFile(false),
+    m_shouldWriteCaloHitBlocks(false),
     m_pEventFileWriter(nullptr)
 {
 }
@@ -64,7 +66,9 @@ StatusCode EventWritingAlgorithm::Initialize()
 
         if (BINARY == m_eventFileType)
         {
-            m_pEventFileWriter = new BinaryFileWriter(this->GetPandora(), m_eventFileName, fileMode);
+            // ATTN Compressed event containers are introduced in file minor version 1, and calo hit blocks in file minor version 2
+            const unsigned int minorVersion(m_shouldWriteCaloHitBlocks ? 2 : m_shouldCompressEventFile ? 1 : 0);
+            m_pEventFileWriter = new BinaryFileWriter(this->GetPandora(), m_eventFileName, fileMode, 1, minorVersion);
         }
         else if (XML == m_eventFileType)
         {
@@ -163,6 +167,12 @@ StatusCode EventWritingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "ShouldOverwriteGeometryFile", m_shouldOverwriteGeometryFile));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "ShouldCompressEventFile", m_shouldCompressEventFile));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "ShouldWriteCaloHitBlocks", m_shouldWriteCaloHitBlocks));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "ShouldWriteMCRelationships", m_shouldWriteMCRelationships));
 
@@ -0,0 +1,96 @@
+/**
+ *  @file   PandoraSDK/src/Persistency/MappedBinaryFileReader.cc
+ *
+ *  @brief  Implementation of the mapped binary file reader class.
+ *
+ *  $Log: $
+ */
+
+#include "Persistency/MappedBinaryFileReader.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace pandora
+{
+
+MappedBinaryFileReader::MappedBinaryFileReader(const pandora::Pandora &pandora, const std::string &fileName) :
+    BinaryFileReader(pandora, fileName, false),
+    m_pMapping(nullptr),
+    m_mappingSize(0)
+{
+    const int fileDescriptor(open(fileName.c_str(), O_RDONLY));
+
+    if (fileDescriptor < 0)
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    struct stat fileStatus;
+
+    if ((0 != fstat(fileDescriptor, &fileStatus)) || (fileStatus.st_size <= 0))
+    {
+        close(fileDescriptor);
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+    }
+
+    m_mappingSize = static_cast<std::size_t>(fileStatus.st_size);
+    void *const pMapping(mmap(nullptr, m_mappingSize, PROT_READ, MAP_SHARED, fileDescriptor, 0));
+
+    // ATTN The mapping remains valid after the file descriptor is closed
+    close(fileDescriptor);
+
+    if (MAP_FAILED == pMapping)
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    (void) madvise(pMapping, m_mappingSize, MADV_SEQUENTIAL);
+
+    m_pMapping = pMapping;
+    m_pMemory = static_cast<const char *>(m_pMapping);
+    m_memorySize = m_mappingSize;
+    m_memoryPosition = 0;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+MappedBinaryFileReader::~MappedBinaryFileReader()
+{
+    munmap(m_pMapping, m_mappingSize);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::ifstream::pos_type MappedBinaryFileReader::GetFilePosition()
+{
+    return std::ifstream::pos_type(static_cast<std::streamoff>(m_memoryPosition));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MappedBinaryFileReader::SetFilePosition(const std::ifstream::pos_type position)
+{
+    const std::streamoff offset(position);
+
+    if ((offset < 0) || (static_cast<std::size_t>(offset) > m_mappingSize))
+        return STATUS_CODE_FAILURE;
+
+    m_memoryPosition = static_cast<std::size_t>(offset);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MappedBinaryFileReader::BufferContainer()
+{
+    // ATTN The whole file is already addressable, so container contents are decoded in place
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MappedBinaryFileReader::ClearContainerBuffer()
+{
+}
+
+} // namespace pandora
@@ -20,7 +20,8 @@ XmlFileReader::XmlFileReader(const pandora::Pandora &pandora, const std::string
     FileReader(pandora, fileName),
     m_pContainerXmlNode(nullptr),
     m_pCurrentXmlElement(nullptr),
-    m_isAtFileStart(true)
+    m_isAtFileStart(true),
+    m_isIndexed(false)
 {
     m_fileType = XML;
     m_pXmlDocument = new TiXmlDocument(fileName);
@@ -105,41 +106,47 @@ ContainerId XmlFileReader::GetNextContainerId()
 
 StatusCode XmlFileReader::GoToGeometry(const unsigned int geometryNumber)
 {
-    int nGeometriesRead(0);
-    m_isAtFileStart = true;
-    m_pContainerXmlNode = nullptr;
-    m_pCurrentXmlElement = nullptr;
-
-    if (GEOMETRY_CONTAINER != this->GetNextContainerId())
-        --nGeometriesRead;
-
-    while (nGeometriesRead < static_cast<int>(geometryNumber))
-    {
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GoToNextGeometry());
-        ++nGeometriesRead;
-    }
-
-    return STATUS_CODE_SUCCESS;
+    return this->GoToIndexedContainer(GEOMETRY_CONTAINER, geometryNumber);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode XmlFileReader::GoToEvent(const unsigned int eventNumber)
 {
-    int nEventsRead(0);
-    m_isAtFileStart = true;
-    m_pContainerXmlNode = nullptr;
-    m_pCurrentXmlElement = nullptr;
+    return this->GoToIndexedContainer(EVENT_CONTAINER, eventNumber);
+}
 
-    if (EVENT_CONTAINER != this->GetNextContainerId())
-        --nEventsRead;
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-    while (nEventsRead < static_cast<int>(eventNumber))
+StatusCode XmlFileReader::GoToIndexedContainer(const ContainerId containerId, const unsigned int containerNumber)
+{
+    // ATTN The whole document is already in memory, so a single pass over the container nodes suffices to index them all
+    if (!m_isIndexed)
     {
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GoToNextEvent());
-        ++nEventsRead;
+        for (TiXmlNode *pXmlNode = TiXmlHandle(m_pXmlDocument).FirstChildElement().Element(); nullptr != pXmlNode; pXmlNode = pXmlNode->NextSibling())
+        {
+            if (std::string("Event") == pXmlNode->ValueStr())
+            {
+                m_eventXmlNodes.push_back(pXmlNode);
+            }
+            else if (std::string("Geometry") == pXmlNode->ValueStr())
+            {
+                m_geometryXmlNodes.push_back(pXmlNode);
+            }
+        }
+
+        m_isIndexed = true;
     }
 
+    const XmlNodeVector &xmlNodeVector((EVENT_CONTAINER == containerId) ? m_eventXmlNodes : m_geometryXmlNodes);
+
+    if (containerNumber >= xmlNodeVector.size())
+        return STATUS_CODE_OUT_OF_RANGE;
+
+    m_isAtFileStart = false;
+    m_pContainerXmlNode = xmlNodeVector.at(containerNumber);
+    m_pCurrentXmlElement = nullptr;
+
     return STATUS_CODE_SUCCESS;
 }
 
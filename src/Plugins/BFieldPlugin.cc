@@ -0,0 +1,25 @@
+/**
+ *  @file   PandoraSDK/src/Plugins/BFieldPlugin.cc
+ * 
+ *  @brief  Implementation of the bfield plugin interface class.
+ * 
+ *  $Log: $
+ */
+
+#include "Objects/CartesianVector.h"
+
+#include "Plugins/BFieldPlugin.h"
+
+namespace pandora
+{
+
+void BFieldPlugin::GetBFieldValues(const CartesianPointVector &positionVectors, FloatVector &bFieldValues) const
+{
+    bFieldValues.clear();
+    bFieldValues.reserve(positionVectors.size());
+
+    for (const CartesianVector &positionVector : positionVectors)
+        bFieldValues.push_back(this->GetBField(positionVector));
+}
+
+} // namespace pandora
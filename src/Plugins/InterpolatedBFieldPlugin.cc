@@ -0,0 +1,298 @@
+/**
+ *  @file   PandoraSDK/src/Plugins/InterpolatedBFieldPlugin.cc
+ *
+ *  @brief  Implementation of the interpolated bfield plugin class.
+ *
+ *  $Log: $
+ */
+
+#include "Geometry/SubDetector.h"
+
+#include "Helpers/XmlHelper.h"
+
+#include "Managers/GeometryManager.h"
+
+#include "Objects/CartesianVector.h"
+
+#include "Pandora/Pandora.h"
+
+#include "Plugins/InterpolatedBFieldPlugin.h"
+
+#include <cmath>
+
+namespace pandora
+{
+
+InterpolatedBFieldPlugin::InterpolatedBFieldPlugin(const BFieldPlugin *const pBFieldPlugin) :
+    m_pBFieldPlugin(pBFieldPlugin),
+    m_useRZGrid(true),
+    m_nBinsR(100),
+    m_nBinsXY(100),
+    m_nBinsZ(200),
+    m_maxR(0.f),
+    m_maxZ(0.f),
+    m_nAccuracyCheckPoints(1000),
+    m_nAccuracyCheckPhiValues(8),
+    m_maxBFieldDeviation(0.01f),
+    m_cellSizeR(0.f),
+    m_cellSizeZ(0.f)
+{
+    if (!m_pBFieldPlugin)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float InterpolatedBFieldPlugin::GetBField(const CartesianVector &positionVector) const
+{
+    return this->GetInterpolatedBField(positionVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void InterpolatedBFieldPlugin::GetBFieldValues(const CartesianPointVector &positionVectors, FloatVector &bFieldValues) const
+{
+    bFieldValues.clear();
+    bFieldValues.reserve(positionVectors.size());
+
+    for (const CartesianVector &positionVector : positionVectors)
+        bFieldValues.push_back(this->GetInterpolatedBField(positionVector));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode InterpolatedBFieldPlugin::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "UseRZGrid", m_useRZGrid));
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NBinsR", m_nBinsR));
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NBinsXY", m_nBinsXY));
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NBinsZ", m_nBinsZ));
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxR", m_maxR));
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxZ", m_maxZ));
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "NAccuracyCheckPoints", m_nAccuracyCheckPoints));
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "NAccuracyCheckPhiValues", m_nAccuracyCheckPhiValues));
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "MaxBFieldDeviation", m_maxBFieldDeviation));
+
+    if ((0 == m_nBinsR) || (0 == m_nBinsXY) || (0 == m_nBinsZ) || (m_maxR < 0.f) || (m_maxZ < 0.f))
+    {
+        std::cout << "InterpolatedBFieldPlugin: the numbers of grid cells must be positive and the grid extents must not be negative" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    if (m_useRZGrid && (0 == m_nAccuracyCheckPhiValues))
+    {
+        std::cout << "InterpolatedBFieldPlugin: a (r, z) grid requires a positive number of accuracy check phi values" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode InterpolatedBFieldPlugin::Initialize()
+{
+    if ((m_maxR < std::numeric_limits<float>::epsilon()) || (m_maxZ < std::numeric_limits<float>::epsilon()))
+    {
+        float subDetectorMaxR(0.f), subDetectorMaxZ(0.f);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetSubDetectorExtents(subDetectorMaxR, subDetectorMaxZ));
+
+        if (m_maxR < std::numeric_limits<float>::epsilon())
+            m_maxR = subDetectorMaxR;
+
+        if (m_maxZ < std::numeric_limits<float>::epsilon())
+            m_maxZ = subDetectorMaxZ;
+    }
+
+    if ((m_maxR < std::numeric_limits<float>::epsilon()) || (m_maxZ < std::numeric_limits<float>::epsilon()))
+    {
+        std::cout << "InterpolatedBFieldPlugin: the grid extents must be positive, maxR " << m_maxR << ", maxZ " << m_maxZ << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    m_cellSizeR = m_useRZGrid ? m_maxR / static_cast<float>(m_nBinsR) : 2.f * m_maxR / static_cast<float>(m_nBinsXY);
+    m_cellSizeZ = 2.f * m_maxZ / static_cast<float>(m_nBinsZ);
+
+    this->FillGrid();
+
+    return this->CheckAccuracy();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode InterpolatedBFieldPlugin::GetSubDetectorExtents(float &maxR, float &maxZ) const
+{
+    const SubDetectorMap &subDetectorMap(this->GetPandora().GetGeometry()->GetSubDetectorMap());
+
+    if (subDetectorMap.empty())
+    {
+        std::cout << "InterpolatedBFieldPlugin: no sub detectors registered, so grid extents MaxR and MaxZ must be specified" << std::endl;
+        return STATUS_CODE_NOT_INITIALIZED;
+    }
+
+    static const float pi(std::acos(-1.f));
+    maxR = 0.f;
+    maxZ = 0.f;
+
+    for (const SubDetectorMap::value_type &mapEntry : subDetectorMap)
+    {
+        const SubDetector *const pSubDetector(mapEntry.second);
+        const unsigned int symmetryOrder(pSubDetector->GetOuterSymmetryOrder());
+
+        // ATTN The outer r coordinate of a polygonal sub detector is the distance to the centre of each side, not to the corners
+        const float outerR(std::fabs(pSubDetector->GetOuterRCoordinate()));
+        maxR = std::max(maxR, (symmetryOrder > 2) ? outerR / std::cos(pi / static_cast<float>(symmetryOrder)) : outerR);
+        maxZ = std::max(maxZ, std::fabs(pSubDetector->GetOuterZCoordinate()));
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void InterpolatedBFieldPlugin::FillGrid()
+{
+    m_gridBField.clear();
+
+    const unsigned int nNodesR(m_useRZGrid ? m_nBinsR + 1 : m_nBinsXY + 1);
+    const unsigned int nNodesY(m_useRZGrid ? 1 : m_nBinsXY + 1);
+    const float lowR(m_useRZGrid ? 0.f : -m_maxR);
+
+    for (unsigned int iZ = 0; iZ <= m_nBinsZ; ++iZ)
+    {
+        const float z(-m_maxZ + static_cast<float>(iZ) * m_cellSizeZ);
+
+        for (unsigned int iY = 0; iY < nNodesY; ++iY)
+        {
+            const float y(m_useRZGrid ? 0.f : lowR + static_cast<float>(iY) * m_cellSizeR);
+
+            for (unsigned int iR = 0; iR < nNodesR; ++iR)
+            {
+                const float x(lowR + static_cast<float>(iR) * m_cellSizeR);
+                m_gridBField.push_back(m_pBFieldPlugin->GetBField(CartesianVector(x, y, z)));
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode InterpolatedBFieldPlugin::CheckAccuracy() const
+{
+    static const float twoPi(2.f * std::acos(-1.f));
+
+    const unsigned int nBinsR(m_useRZGrid ? m_nBinsR : m_nBinsXY), nBinsY(m_useRZGrid ? 1 : m_nBinsXY);
+    const unsigned int nPhiValues(m_useRZGrid ? m_nAccuracyCheckPhiValues : 1);
+    const double nCells(static_cast<double>(nBinsR) * static_cast<double>(nBinsY) * static_cast<double>(m_nBinsZ));
+    const float lowR(m_useRZGrid ? 0.f : -m_maxR);
+
+    float maxDeviation(0.f);
+    CartesianVector maxDeviationPosition(0.f, 0.f, 0.f);
+
+    for (unsigned int iPoint = 0; iPoint < m_nAccuracyCheckPoints; ++iPoint)
+    {
+        // ATTN Check points are spread evenly through the grid cells, at the cell centres
+        const unsigned int cell(static_cast<unsigned int>((static_cast<double>(iPoint) + 0.5) * nCells / static_cast<double>(m_nAccuracyCheckPoints)));
+        const unsigned int iR(cell % nBinsR), iY((cell / nBinsR) % nBinsY), iZ(cell / (nBinsR * nBinsY));
+
+        const float x(lowR + (static_cast<float>(iR) + 0.5f) * m_cellSizeR);
+        const float y(m_useRZGrid ? 0.f : lowR + (static_cast<float>(iY) + 0.5f) * m_cellSizeR);
+        const float z(-m_maxZ + (static_cast<float>(iZ) + 0.5f) * m_cellSizeZ);
+
+        // ATTN The (r, z) grid is sampled at phi = 0 only, so the wrapped bfield must also be checked for axial symmetry, away from phi = 0
+        for (unsigned int iPhi = 0; iPhi < nPhiValues; ++iPhi)
+        {
+            const float phi(twoPi * static_cast<float>(iPhi) / static_cast<float>(nPhiValues));
+            const CartesianVector positionVector(m_useRZGrid ? CartesianVector(x * std::cos(phi), x * std::sin(phi), z) :
+                CartesianVector(x, y, z));
+
+            const float deviation(std::fabs(this->GetInterpolatedBField(positionVector) - m_pBFieldPlugin->GetBField(positionVector)));
+
+            if (deviation > maxDeviation)
+            {
+                maxDeviation = deviation;
+                maxDeviationPosition = positionVector;
+            }
+        }
+    }
+
+    if (maxDeviation > m_maxBFieldDeviation)
+    {
+        std::cout << "InterpolatedBFieldPlugin: interpolated bfield deviates from wrapped plugin by " << maxDeviation << " T at "
+                  << maxDeviationPosition << ", exceeding MaxBFieldDeviation " << m_maxBFieldDeviation << " T" << std::endl;
+
+        if (m_useRZGrid)
+        {
+            std::cout << "InterpolatedBFieldPlugin: for a bfield that depends upon phi, set UseRZGrid false, to use a (x, y, z) grid"
+                      << std::endl;
+        }
+
+        return STATUS_CODE_OUT_OF_RANGE;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float InterpolatedBFieldPlugin::GetInterpolatedBField(const CartesianVector &positionVector) const
+{
+    unsigned int iZ(0);
+    float fZ(0.f);
+
+    if (!InterpolatedBFieldPlugin::LocateInGrid(positionVector.GetZ(), -m_maxZ, m_nBinsZ, m_cellSizeZ, iZ, fZ))
+        return m_pBFieldPlugin->GetBField(positionVector);
+
+    if (m_useRZGrid)
+    {
+        const float r(std::sqrt(positionVector.GetX() * positionVector.GetX() + positionVector.GetY() * positionVector.GetY()));
+        unsigned int iR(0);
+        float fR(0.f);
+
+        if (!InterpolatedBFieldPlugin::LocateInGrid(r, 0.f, m_nBinsR, m_cellSizeR, iR, fR))
+            return m_pBFieldPlugin->GetBField(positionVector);
+
+        const unsigned int nNodesR(m_nBinsR + 1);
+        const float *const pLow(&m_gridBField[iZ * nNodesR + iR]), *const pHigh(pLow + nNodesR);
+
+        return ((1.f - fZ) * ((1.f - fR) * pLow[0] + fR * pLow[1]) + fZ * ((1.f - fR) * pHigh[0] + fR * pHigh[1]));
+    }
+
+    unsigned int iX(0), iY(0);
+    float fX(0.f), fY(0.f);
+
+    if (!InterpolatedBFieldPlugin::LocateInGrid(positionVector.GetX(), -m_maxR, m_nBinsXY, m_cellSizeR, iX, fX) ||
+        !InterpolatedBFieldPlugin::LocateInGrid(positionVector.GetY(), -m_maxR, m_nBinsXY, m_cellSizeR, iY, fY))
+    {
+        return m_pBFieldPlugin->GetBField(positionVector);
+    }
+
+    const unsigned int nNodesX(m_nBinsXY + 1), nNodesXY(nNodesX * nNodesX);
+    const float *const pLow(&m_gridBField[iZ * nNodesXY + iY * nNodesX + iX]), *const pHigh(pLow + nNodesXY);
+
+    const float lowZ((1.f - fY) * ((1.f - fX) * pLow[0] + fX * pLow[1]) + fY * ((1.f - fX) * pLow[nNodesX] + fX * pLow[nNodesX + 1]));
+    const float highZ((1.f - fY) * ((1.f - fX) * pHigh[0] + fX * pHigh[1]) + fY * ((1.f - fX) * pHigh[nNodesX] + fX * pHigh[nNodesX + 1]));
+
+    return ((1.f - fZ) * lowZ + fZ * highZ);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool InterpolatedBFieldPlugin::LocateInGrid(const float coordinate, const float low, const unsigned int nBins, const float cellSize,
+    unsigned int &bin, float &fraction)
+{
+    const float position((coordinate - low) / cellSize);
+
+    if (!((position >= 0.f) && (position <= static_cast<float>(nBins))))
+        return false;
+
+    bin = std::min(static_cast<unsigned int>(position), nBins - 1);
+    fraction = position - static_cast<float>(bin);
+
+    return true;
+}
+
+} // namespace pandora
@@ -0,0 +1,25 @@
+/**
+ *  @file   PandoraSDK/src/Plugins/PseudoLayerPlugin.cc
+ * 
+ *  @brief  Implementation of the pseudo layer plugin interface class.
+ * 
+ *  $Log: $
+ */
+
+#include "Objects/CartesianVector.h"
+
+#include "Plugins/PseudoLayerPlugin.h"
+
+namespace pandora
+{
+
+void PseudoLayerPlugin::GetPseudoLayers(const CartesianPointVector &positionVectors, UIntVector &pseudoLayers) const
+{
+    pseudoLayers.clear();
+    pseudoLayers.reserve(positionVectors.size());
+
+    for (const CartesianVector &positionVector : positionVectors)
+        pseudoLayers.push_back(this->GetPseudoLayer(positionVector));
+}
+
+} // namespace pandora
@@ -0,0 +1,426 @@
+/**
+ *  @file   PandoraSDK/src/Plugins/TabulatedPseudoLayerPlugin.cc
+ *
+ *  @brief  Implementation of the tabulated pseudo layer plugin class.
+ *
+ *  $Log: $
+ */
+
+#include "Geometry/SubDetector.h"
+
+#include "Helpers/XmlHelper.h"
+
+#include "Managers/GeometryManager.h"
+
+#include "Objects/CartesianVector.h"
+
+#include "Pandora/Pandora.h"
+
+#include "Plugins/TabulatedPseudoLayerPlugin.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace pandora
+{
+
+const unsigned int TabulatedPseudoLayerPlugin::UNTABULATED = std::numeric_limits<unsigned int>::max();
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+TabulatedPseudoLayerPlugin::TabulatedPseudoLayerPlugin(const PseudoLayerPlugin *const pPseudoLayerPlugin) :
+    m_pPseudoLayerPlugin(pPseudoLayerPlugin),
+    m_useEcalBarrelSymmetry(true),
+    m_referenceBarrelLayers(true),
+    m_symmetryOrder(0),
+    m_symmetryPhi(0.f),
+    m_binWidth(1.f),
+    m_boundaryTolerance(0.01f),
+    m_nPhiSamples(4),
+    m_nAccuracyCheckPoints(1000),
+    m_inverseBinWidth(1.f),
+    m_nRRegions(0)
+{
+    if (!m_pPseudoLayerPlugin)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int TabulatedPseudoLayerPlugin::GetPseudoLayer(const CartesianVector &positionVector) const
+{
+    return this->GetTabulatedPseudoLayer(positionVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TabulatedPseudoLayerPlugin::GetPseudoLayers(const CartesianPointVector &positionVectors, UIntVector &pseudoLayers) const
+{
+    pseudoLayers.clear();
+    pseudoLayers.reserve(positionVectors.size());
+
+    for (const CartesianVector &positionVector : positionVectors)
+        pseudoLayers.push_back(this->GetTabulatedPseudoLayer(positionVector));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int TabulatedPseudoLayerPlugin::GetPseudoLayerAtIp() const
+{
+    return m_pPseudoLayerPlugin->GetPseudoLayerAtIp();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode TabulatedPseudoLayerPlugin::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    const StatusCode symmetryStatusCode(XmlHelper::ReadValue(xmlHandle, "SymmetryOrder", m_symmetryOrder));
+
+    if (STATUS_CODE_SUCCESS == symmetryStatusCode)
+    {
+        m_useEcalBarrelSymmetry = false;
+    }
+    else if (STATUS_CODE_NOT_FOUND != symmetryStatusCode)
+    {
+        return symmetryStatusCode;
+    }
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "SymmetryPhi", m_symmetryPhi));
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "ReferenceBarrelLayers", m_referenceBarrelLayers));
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "BinWidth", m_binWidth));
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "BoundaryTolerance", m_boundaryTolerance));
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "NPhiSamples", m_nPhiSamples));
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "NAccuracyCheckPoints", m_nAccuracyCheckPoints));
+
+    if (!(m_binWidth > 0.f) || !(m_boundaryTolerance >= 0.f) || (0 == m_nPhiSamples))
+    {
+        std::cout << "TabulatedPseudoLayerPlugin: the bin width and number of phi samples must be positive, and the boundary tolerance "
+                  << "must not be negative" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode TabulatedPseudoLayerPlugin::Initialize()
+{
+    m_inverseBinWidth = 1.f / m_binWidth;
+    this->SetReferencePolygon();
+
+    BoundaryVector rBoundaries, zBoundaries;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetBoundaries(rBoundaries, zBoundaries));
+
+    FloatVector rRegionCentres, zRegionCentres;
+    this->FillAxis(rBoundaries, m_rBinRegions, rRegionCentres);
+    this->FillAxis(zBoundaries, m_zBinRegions, zRegionCentres);
+    this->FillTable(rRegionCentres, zRegionCentres);
+
+    return this->CheckAccuracy();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TabulatedPseudoLayerPlugin::SetReferencePolygon()
+{
+    if (m_useEcalBarrelSymmetry)
+    {
+        m_symmetryOrder = 0;
+        m_symmetryPhi = 0.f;
+
+        for (const SubDetectorMap::value_type &mapEntry : this->GetPandora().GetGeometry()->GetSubDetectorMap())
+        {
+            if (ECAL_BARREL != mapEntry.second->GetSubDetectorType())
+                continue;
+
+            m_symmetryOrder = mapEntry.second->GetInnerSymmetryOrder();
+            m_symmetryPhi = mapEntry.second->GetInnerPhiCoordinate();
+            break;
+        }
+    }
+
+    m_sideNormalX.clear();
+    m_sideNormalY.clear();
+
+    if (m_symmetryOrder < 3)
+        return;
+
+    static const float twoPi(2.f * std::acos(-1.f));
+
+    for (unsigned int iSide = 0; iSide < m_symmetryOrder; ++iSide)
+    {
+        const float phi(m_symmetryPhi + twoPi * static_cast<float>(iSide) / static_cast<float>(m_symmetryOrder));
+        m_sideNormalX.push_back(std::cos(phi));
+        m_sideNormalY.push_back(std::sin(phi));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode TabulatedPseudoLayerPlugin::GetBoundaries(BoundaryVector &rBoundaries, BoundaryVector &zBoundaries) const
+{
+    const SubDetectorMap &subDetectorMap(this->GetPandora().GetGeometry()->GetSubDetectorMap());
+
+    if (subDetectorMap.empty())
+    {
+        std::cout << "TabulatedPseudoLayerPlugin: no sub detectors registered, so no layer boundaries are available" << std::endl;
+        return STATUS_CODE_NOT_INITIALIZED;
+    }
+
+    for (const SubDetectorMap::value_type &mapEntry : subDetectorMap)
+    {
+        const SubDetector *const pSubDetector(mapEntry.second);
+        const SubDetectorType subDetectorType(pSubDetector->GetSubDetectorType());
+
+        this->AddRBoundary(std::fabs(pSubDetector->GetInnerRCoordinate()), pSubDetector->GetInnerSymmetryOrder(),
+            pSubDetector->GetInnerPhiCoordinate(), rBoundaries);
+        this->AddRBoundary(std::fabs(pSubDetector->GetOuterRCoordinate()), pSubDetector->GetOuterSymmetryOrder(),
+            pSubDetector->GetOuterPhiCoordinate(), rBoundaries);
+
+        FloatVector zCoordinates{std::fabs(pSubDetector->GetInnerZCoordinate()), std::fabs(pSubDetector->GetOuterZCoordinate())};
+
+        const bool isBarrel((ECAL_BARREL == subDetectorType) || (HCAL_BARREL == subDetectorType) || (MUON_BARREL == subDetectorType));
+        const bool isEndCap((ECAL_ENDCAP == subDetectorType) || (HCAL_ENDCAP == subDetectorType) || (MUON_ENDCAP == subDetectorType));
+
+        for (const SubDetector::SubDetectorLayer &subDetectorLayer : pSubDetector->GetSubDetectorLayerVector())
+        {
+            const float distance(std::fabs(subDetectorLayer.GetClosestDistanceToIp()));
+
+            // ATTN Barrel layers are measured w.r.t. the reference polygon, as in linear collider pseudo layer plugins, unless specified
+            // via xml, in which case they may follow either the inner or outer polygon of the sub detector and are widened to cover both
+            if (isBarrel && m_referenceBarrelLayers)
+            {
+                this->AddRBoundary(distance, m_symmetryOrder, m_symmetryPhi, rBoundaries);
+            }
+            else if (isBarrel)
+            {
+                this->AddRBoundary(distance, pSubDetector->GetInnerSymmetryOrder(), pSubDetector->GetInnerPhiCoordinate(), rBoundaries);
+                this->AddRBoundary(distance, pSubDetector->GetOuterSymmetryOrder(), pSubDetector->GetOuterPhiCoordinate(), rBoundaries);
+            }
+            else if (isEndCap)
+            {
+                zCoordinates.push_back(distance);
+            }
+        }
+
+        for (const float z : zCoordinates)
+        {
+            Boundary boundary;
+            boundary.m_low = z - m_boundaryTolerance;
+            boundary.m_high = z + m_boundaryTolerance;
+            zBoundaries.push_back(boundary);
+        }
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TabulatedPseudoLayerPlugin::AddRBoundary(const float distance, const unsigned int symmetryOrder, const float symmetryPhi,
+    BoundaryVector &rBoundaries) const
+{
+    static const float pi(std::acos(-1.f));
+
+    // ATTN Between consecutive side normals and vertices of the two polygons, the ratio of reference polygonal radius to surface polygonal
+    // radius is monotonic in azimuthal angle, so its extremes are found at those angles alone
+    FloatVector phiValues;
+
+    for (unsigned int iPhi = 0, nPhi = ((symmetryOrder < 3) ? 0 : 2 * symmetryOrder); iPhi < nPhi; ++iPhi)
+        phiValues.push_back(symmetryPhi + pi * static_cast<float>(iPhi) / static_cast<float>(symmetryOrder));
+
+    for (unsigned int iPhi = 0, nPhi = 2 * m_sideNormalX.size(); iPhi < nPhi; ++iPhi)
+        phiValues.push_back(m_symmetryPhi + pi * static_cast<float>(iPhi) / static_cast<float>(m_sideNormalX.size()));
+
+    float minRatio(1.f), maxRatio(1.f);
+
+    for (const float phi : phiValues)
+    {
+        float surfaceRadius(1.f);
+
+        for (unsigned int iSide = 0; iSide < symmetryOrder; ++iSide)
+        {
+            const float sidePhi(symmetryPhi + 2.f * pi * static_cast<float>(iSide) / static_cast<float>(symmetryOrder));
+            surfaceRadius = ((0 == iSide) ? std::cos(phi - sidePhi) : std::max(surfaceRadius, std::cos(phi - sidePhi)));
+        }
+
+        const float ratio(this->GetPolygonalRadius(std::cos(phi), std::sin(phi)) / surfaceRadius);
+        minRatio = std::min(minRatio, ratio);
+        maxRatio = std::max(maxRatio, ratio);
+    }
+
+    Boundary boundary;
+    boundary.m_low = distance * minRatio - m_boundaryTolerance;
+    boundary.m_high = distance * maxRatio + m_boundaryTolerance;
+    rBoundaries.push_back(boundary);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TabulatedPseudoLayerPlugin::FillAxis(BoundaryVector boundaries, UIntVector &binRegions, FloatVector &regionCentres) const
+{
+    std::sort(boundaries.begin(), boundaries.end(), [](const Boundary &lhs, const Boundary &rhs) { return (lhs.m_low < rhs.m_low); });
+
+    // The regions are the gaps between the boundaries, which are bounded only up to the highest boundary
+    FloatVector regionLows, regionHighs;
+    float regionLow(0.f);
+
+    for (const Boundary &boundary : boundaries)
+    {
+        if (boundary.m_low > regionLow)
+        {
+            regionLows.push_back(regionLow);
+            regionHighs.push_back(boundary.m_low);
+        }
+
+        regionLow = std::max(regionLow, boundary.m_high);
+    }
+
+    regionCentres.clear();
+
+    for (unsigned int iRegion = 0; iRegion < regionLows.size(); ++iRegion)
+        regionCentres.push_back(0.5f * (regionLows[iRegion] + regionHighs[iRegion]));
+
+    binRegions.assign(static_cast<unsigned int>(std::ceil(regionLow * m_inverseBinWidth)), UNTABULATED);
+
+    for (unsigned int iBin = 0, iRegion = 0; iBin < binRegions.size(); ++iBin)
+    {
+        const float binLow(m_binWidth * static_cast<float>(iBin)), binHigh(m_binWidth * static_cast<float>(iBin + 1));
+
+        while ((iRegion < regionHighs.size()) && (regionHighs[iRegion] < binHigh))
+            ++iRegion;
+
+        if ((iRegion < regionLows.size()) && (regionLows[iRegion] <= binLow))
+            binRegions[iBin] = iRegion;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TabulatedPseudoLayerPlugin::FillTable(const FloatVector &rRegionCentres, const FloatVector &zRegionCentres)
+{
+    static const float twoPi(2.f * std::acos(-1.f));
+
+    m_nRRegions = rRegionCentres.size();
+    m_regionPseudoLayers.assign(rRegionCentres.size() * zRegionCentres.size(), UNTABULATED);
+
+    for (unsigned int iZ = 0; iZ < zRegionCentres.size(); ++iZ)
+    {
+        for (unsigned int iR = 0; iR < m_nRRegions; ++iR)
+        {
+            bool isSinglePseudoLayer(true);
+            const unsigned int pseudoLayer(
+                m_pPseudoLayerPlugin->GetPseudoLayer(this->GetPosition(rRegionCentres[iR], m_symmetryPhi, zRegionCentres[iZ])));
+
+            for (unsigned int iPhi = 0; isSinglePseudoLayer && (iPhi < m_nPhiSamples); ++iPhi)
+            {
+                const float phi(m_symmetryPhi + twoPi * static_cast<float>(iPhi) / static_cast<float>(m_nPhiSamples));
+
+                for (const float z : {zRegionCentres[iZ], -zRegionCentres[iZ]})
+                {
+                    if (pseudoLayer != m_pPseudoLayerPlugin->GetPseudoLayer(this->GetPosition(rRegionCentres[iR], phi, z)))
+                        isSinglePseudoLayer = false;
+                }
+            }
+
+            if (isSinglePseudoLayer)
+                m_regionPseudoLayers[iZ * m_nRRegions + iR] = pseudoLayer;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode TabulatedPseudoLayerPlugin::CheckAccuracy() const
+{
+    static const double twoPi(2. * std::acos(-1.));
+    const float maxR(1.1f * m_binWidth * static_cast<float>(m_rBinRegions.size()));
+    const float maxZ(1.1f * m_binWidth * static_cast<float>(m_zBinRegions.size()));
+
+    for (unsigned int iPoint = 0; iPoint < m_nAccuracyCheckPoints; ++iPoint)
+    {
+        // ATTN Check positions follow additive recurrences, with irrational steps, to spread them evenly through the table
+        const double fractionR(std::fmod(0.5 + 0.7548776662 * static_cast<double>(iPoint), 1.));
+        const double fractionZ(std::fmod(0.5 + 0.5698402910 * static_cast<double>(iPoint), 1.));
+        const double fractionPhi(std::fmod(0.6180339887 * static_cast<double>(iPoint), 1.));
+        const float z(static_cast<float>(fractionZ) * ((0 == iPoint % 2) ? maxZ : -maxZ));
+        const CartesianVector positionVector(
+            this->GetPosition(static_cast<float>(fractionR) * maxR, static_cast<float>(twoPi * fractionPhi), z));
+
+        const unsigned int tabulatedPseudoLayer(this->GetTabulatedPseudoLayer(positionVector));
+        const unsigned int pseudoLayer(m_pPseudoLayerPlugin->GetPseudoLayer(positionVector));
+
+        if (tabulatedPseudoLayer != pseudoLayer)
+        {
+            std::cout << "TabulatedPseudoLayerPlugin: tabulated pseudolayer " << tabulatedPseudoLayer << " differs from wrapped plugin "
+                      << "pseudolayer " << pseudoLayer << " at " << positionVector << ", so the wrapped pseudolayers do not change only at "
+                      << "sub detector boundaries" << std::endl;
+            return STATUS_CODE_FAILURE;
+        }
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int TabulatedPseudoLayerPlugin::GetTabulatedPseudoLayer(const CartesianVector &positionVector) const
+{
+    const unsigned int rRegion(this->GetRegion(m_rBinRegions, this->GetPolygonalRadius(positionVector.GetX(), positionVector.GetY())));
+    const unsigned int zRegion(this->GetRegion(m_zBinRegions, std::fabs(positionVector.GetZ())));
+
+    if ((UNTABULATED == rRegion) || (UNTABULATED == zRegion))
+        return m_pPseudoLayerPlugin->GetPseudoLayer(positionVector);
+
+    const unsigned int pseudoLayer(m_regionPseudoLayers[zRegion * m_nRRegions + rRegion]);
+
+    return ((UNTABULATED != pseudoLayer) ? pseudoLayer : m_pPseudoLayerPlugin->GetPseudoLayer(positionVector));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float TabulatedPseudoLayerPlugin::GetPolygonalRadius(const float x, const float y) const
+{
+    if (m_sideNormalX.empty())
+        return std::sqrt(x * x + y * y);
+
+    float polygonalRadius(x * m_sideNormalX.front() + y * m_sideNormalY.front());
+
+    for (unsigned int iSide = 1, nSides = m_sideNormalX.size(); iSide < nSides; ++iSide)
+        polygonalRadius = std::max(polygonalRadius, x * m_sideNormalX[iSide] + y * m_sideNormalY[iSide]);
+
+    return polygonalRadius;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CartesianVector TabulatedPseudoLayerPlugin::GetPosition(const float polygonalRadius, const float phi, const float z) const
+{
+    const float cosPhi(std::cos(phi)), sinPhi(std::sin(phi));
+    const float radius(polygonalRadius / this->GetPolygonalRadius(cosPhi, sinPhi));
+
+    return CartesianVector(radius * cosPhi, radius * sinPhi, z);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int TabulatedPseudoLayerPlugin::GetRegion(const UIntVector &binRegions, const float coordinate) const
+{
+    // ATTN The negated comparisons also reject nan coordinates
+    const float bin(coordinate * m_inverseBinWidth);
+
+    if (!(bin >= 0.f) || !(bin < static_cast<float>(binRegions.size())))
+        return UNTABULATED;
+
+    return binRegions[static_cast<unsigned int>(bin)];
+}
+
+} // namespace pandora
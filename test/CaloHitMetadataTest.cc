@@ -0,0 +1,1080 @@
+/**
+ *  @file   PandoraSDK/test/CaloHitMetadataTest.cc
+ *
+ *  @brief  Test of the calo hit metadata used during reclustering, see CaloHitMetadata. The overlay held by each reclustering option is
+ *          compared with a reference holding the availability of every calo hit, through random availability changes, calo hit
+ *          replacements and nested reclustering. Nested fragmentation is then run through the content api, with the calo hit availability
+ *          checked at each stage.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+#include "Api/PandoraContentApi.h"
+
+#include "Helpers/XmlHelper.h"
+
+#include "Managers/Metadata.h"
+
+#include "Objects/CaloHit.h"
+#include "Objects/Cluster.h"
+
+#include "Pandora/Algorithm.h"
+
+#include "Plugins/PseudoLayerPlugin.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <random>
+#include <vector>
+
+using namespace pandora;
+
+namespace
+{
+
+unsigned int g_nFailures(0);            ///< The number of failed checks
+unsigned int g_nOperations(0);          ///< The number of operations applied to calo hit metadata
+unsigned int g_nNestedReclusters(0);    ///< The number of nested reclustering processes simulated
+
+typedef std::map<const CaloHit *, bool> CaloHitAvailabilityMap;
+
+/**
+ *  @brief  Record a failed check, if a condition does not hold
+ *
+ *  @param  condition the condition
+ *  @param  description the description of the check
+ */
+void Check(const bool condition, const std::string &description)
+{
+    if (condition)
+        return;
+
+    ++g_nFailures;
+    std::cout << "CaloHitMetadataTest: check failed: " << description << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  SimplePseudoLayerPlugin class, with pseudolayers in 10mm slices in z
+ */
+class SimplePseudoLayerPlugin : public PseudoLayerPlugin
+{
+public:
+    unsigned int GetPseudoLayer(const CartesianVector &positionVector) const
+    {
+        return 1 + static_cast<unsigned int>(std::fabs(positionVector.GetZ()) / 10.f);
+    }
+
+    unsigned int GetPseudoLayerAtIp() const
+    {
+        return 1;
+    }
+
+private:
+    StatusCode ReadSettings(const TiXmlHandle)
+    {
+        return STATUS_CODE_SUCCESS;
+    }
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  ReferenceMetadata class, holding the availability of every calo hit described by a reclustering option, as the calo hit
+ *          metadata did before it became an overlay on the reclustering input hits
+ */
+class ReferenceMetadata
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  baseCaloHitList the reclustering input calo hits
+     *  @param  initialHitAvailability the initial availability of the calo hits
+     */
+    ReferenceMetadata(const CaloHitList &baseCaloHitList, const bool initialHitAvailability);
+
+    bool IsAvailable(const CaloHit *const pCaloHit) const;
+    StatusCode SetAvailability(const CaloHitList &caloHitList, const bool isAvailable);
+    StatusCode Update(const CaloHitReplacement &caloHitReplacement);
+    StatusCode Update(const ReferenceMetadata &referenceMetadata);
+
+    /**
+     *  @brief  Get the calo hits in the order expected of CaloHitMetadata::GetCaloHits: the surviving input calo hits in their original
+     *          order, then the added calo hits ordered by index
+     *
+     *  @param  caloHitVector to receive the calo hits
+     */
+    void GetCaloHits(CaloHitVector &caloHitVector) const;
+
+    CaloHitVector                       m_baseCaloHits;             ///< The reclustering input calo hits
+    CaloHitSet                          m_baseCaloHitSet;           ///< The set of reclustering input calo hits
+    CaloHitVector                       m_caloHits;                 ///< The expected content of the associated calo hit list
+    CaloHitAvailabilityMap              m_availabilityMap;          ///< The availability of every calo hit described
+    std::vector<CaloHitReplacement>     m_caloHitReplacements;      ///< The calo hit replacements applied
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  ReclusterOption class, holding calo hit metadata for a reclustering option, its associated calo hit list and its reference
+ */
+class ReclusterOption
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  baseCaloHitList the reclustering input calo hits
+     *  @param  baseCaloHitSet the set of reclustering input calo hits
+     *  @param  initialHitAvailability the initial availability of the calo hits
+     */
+    ReclusterOption(const CaloHitList &baseCaloHitList, const CaloHitSet &baseCaloHitSet, const bool initialHitAvailability);
+
+    /**
+     *  @brief  Destructor
+     */
+    ~ReclusterOption();
+
+    CaloHitList                         m_caloHitList;              ///< The calo hit list associated with the option
+    CaloHitMetadata                    *m_pCaloHitMetadata;         ///< The calo hit metadata under test
+    ReferenceMetadata                   m_referenceMetadata;        ///< The reference metadata
+};
+
+typedef std::vector<ReclusterOption *> ReclusterOptionVector;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  MetadataModelAlgorithm class, applying random operations to calo hit metadata and to reference metadata
+ */
+class MetadataModelAlgorithm : public Algorithm
+{
+public:
+    /**
+     *  @brief  Factory class for instantiating algorithm
+     */
+    class Factory : public AlgorithmFactory
+    {
+    public:
+        Algorithm *CreateAlgorithm() const
+        {
+            return new MetadataModelAlgorithm;
+        }
+    };
+
+private:
+    StatusCode Run();
+
+    StatusCode ReadSettings(const TiXmlHandle)
+    {
+        return STATUS_CODE_SUCCESS;
+    }
+
+    /**
+     *  @brief  Simulate a reclustering process, with random operations applied to each of its options in turn
+     *
+     *  @param  baseCaloHitList the reclustering input calo hits
+     *  @param  depth the depth of nesting of the reclustering process
+     *  @param  pParentOption address of the parent reclustering option, to be updated with the selected option, if any
+     */
+    void Recluster(const CaloHitList &baseCaloHitList, const unsigned int depth, ReclusterOption *const pParentOption);
+
+    /**
+     *  @brief  Apply a random operation to a reclustering option
+     *
+     *  @param  option the reclustering option
+     *  @param  depth the depth of nesting of the reclustering process holding the option
+     */
+    void ApplyOperation(ReclusterOption &option, const unsigned int depth);
+
+    /**
+     *  @brief  Compare calo hit metadata with its reference
+     *
+     *  @param  option the reclustering option
+     *  @param  description the description of the last operation
+     */
+    void Compare(const ReclusterOption &option, const std::string &description) const;
+
+    /**
+     *  @brief  Get a random calo hit from the associated calo hit list of a reclustering option
+     *
+     *  @param  option the reclustering option
+     *
+     *  @return address of the calo hit
+     */
+    const CaloHit *GetRandomMember(const ReclusterOption &option);
+
+    /**
+     *  @brief  Get a calo hit not yet described by any metadata, to act as a replacement calo hit
+     *
+     *  @return address of the calo hit, or null if none remain
+     */
+    const CaloHit *GetFreshCaloHit();
+
+    std::mt19937                        m_generator;                ///< The random number generator
+    CaloHitVector                       m_allCaloHits;              ///< All the calo hits
+    CaloHitVector                       m_freshCaloHits;            ///< The calo hits still available to act as replacements
+    CaloHitVector                       m_trialCaloHits;            ///< The calo hits that metadata in the current trial may describe
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  MakeClustersAlgorithm class, making clusters of ten calo hits from the first calo hits in the current list
+ */
+class MakeClustersAlgorithm : public Algorithm
+{
+public:
+    /**
+     *  @brief  Factory class for instantiating algorithm
+     */
+    class Factory : public AlgorithmFactory
+    {
+    public:
+        Algorithm *CreateAlgorithm() const
+        {
+            return new MakeClustersAlgorithm;
+        }
+    };
+
+private:
+    StatusCode Run();
+
+    StatusCode ReadSettings(const TiXmlHandle)
+    {
+        return STATUS_CODE_SUCCESS;
+    }
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  OuterFragmentationAlgorithm class, fragmenting calo hits in some clusters and running a daughter algorithm that does the same
+ */
+class OuterFragmentationAlgorithm : public Algorithm
+{
+public:
+    /**
+     *  @brief  Factory class for instantiating algorithm
+     */
+    class Factory : public AlgorithmFactory
+    {
+    public:
+        Algorithm *CreateAlgorithm() const
+        {
+            return new OuterFragmentationAlgorithm;
+        }
+    };
+
+private:
+    StatusCode Run();
+    StatusCode ReadSettings(const TiXmlHandle xmlHandle);
+
+    std::string     m_innerAlgorithmName;       ///< The name of the daughter fragmentation algorithm
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  InnerFragmentationAlgorithm class, fragmenting calo hits in clusters made during the fragmentation in its parent algorithm
+ */
+class InnerFragmentationAlgorithm : public Algorithm
+{
+public:
+    /**
+     *  @brief  Factory class for instantiating algorithm
+     */
+    class Factory : public AlgorithmFactory
+    {
+    public:
+        Algorithm *CreateAlgorithm() const
+        {
+            return new InnerFragmentationAlgorithm;
+        }
+    };
+
+private:
+    StatusCode Run();
+
+    StatusCode ReadSettings(const TiXmlHandle)
+    {
+        return STATUS_CODE_SUCCESS;
+    }
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CaloHitAvailabilityMap g_expectedAvailability;      ///< The expected availability of the calo hits in the current calo hit list
+unsigned int g_nInnerChecks(0);                     ///< The number of availability checks made by the inner fragmentation algorithm
+
+/**
+ *  @brief  Check that the current calo hit list holds the expected calo hits, with the expected availability
+ *
+ *  @param  algorithm the algorithm calling this function
+ *  @param  stage the description of the stage of the fragmentation
+ */
+void CheckCurrentCaloHits(const Algorithm &algorithm, const std::string &stage)
+{
+    const CaloHitList *pCaloHitList(nullptr);
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(algorithm, pCaloHitList));
+
+    Check(pCaloHitList->size() == g_expectedAvailability.size(), stage + ": current calo hit list has the expected size");
+
+    for (const CaloHit *const pCaloHit : *pCaloHitList)
+    {
+        CaloHitAvailabilityMap::const_iterator iter(g_expectedAvailability.find(pCaloHit));
+        Check(g_expectedAvailability.end() != iter, stage + ": current calo hit list holds only expected calo hits");
+
+        if (g_expectedAvailability.end() != iter)
+            Check(PandoraContentApi::IsAvailable(algorithm, pCaloHit) == iter->second, stage + ": calo hit availability is as expected");
+    }
+}
+
+/**
+ *  @brief  Create a cluster from calo hits, updating their expected availability
+ *
+ *  @param  algorithm the algorithm calling this function
+ *  @param  caloHitList the calo hits
+ *
+ *  @return address of the cluster
+ */
+const Cluster *CreateCluster(const Algorithm &algorithm, const CaloHitList &caloHitList)
+{
+    PandoraContentApi::Cluster::Parameters parameters;
+    parameters.m_caloHitList = caloHitList;
+
+    const Cluster *pCluster(nullptr);
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Cluster::Create(algorithm, parameters, pCluster));
+
+    for (const CaloHit *const pCaloHit : caloHitList)
+        g_expectedAvailability[pCaloHit] = false;
+
+    return pCluster;
+}
+
+/**
+ *  @brief  Get the calo hits of a cluster, as a vector
+ *
+ *  @param  pCluster address of the cluster
+ *
+ *  @return the calo hits
+ */
+CaloHitVector GetClusterCaloHits(const Cluster *const pCluster)
+{
+    CaloHitList caloHitList;
+    pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+
+    return CaloHitVector(caloHitList.begin(), caloHitList.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ReferenceMetadata::ReferenceMetadata(const CaloHitList &baseCaloHitList, const bool initialHitAvailability) :
+    m_baseCaloHits(baseCaloHitList.begin(), baseCaloHitList.end()),
+    m_baseCaloHitSet(baseCaloHitList.begin(), baseCaloHitList.end()),
+    m_caloHits(baseCaloHitList.begin(), baseCaloHitList.end())
+{
+    for (const CaloHit *const pCaloHit : baseCaloHitList)
+        m_availabilityMap[pCaloHit] = initialHitAvailability;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ReferenceMetadata::IsAvailable(const CaloHit *const pCaloHit) const
+{
+    CaloHitAvailabilityMap::const_iterator iter(m_availabilityMap.find(pCaloHit));
+    return ((m_availabilityMap.end() != iter) && iter->second);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ReferenceMetadata::SetAvailability(const CaloHitList &caloHitList, const bool isAvailable)
+{
+    for (const CaloHit *const pCaloHit : caloHitList)
+    {
+        CaloHitAvailabilityMap::iterator iter(m_availabilityMap.find(pCaloHit));
+
+        if (m_availabilityMap.end() == iter)
+            return STATUS_CODE_NOT_FOUND;
+
+        iter->second = isAvailable;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ReferenceMetadata::Update(const CaloHitReplacement &caloHitReplacement)
+{
+    for (const CaloHit *const pCaloHit : caloHitReplacement.m_newCaloHits)
+    {
+        if (m_availabilityMap.count(pCaloHit))
+            return STATUS_CODE_ALREADY_PRESENT;
+
+        m_caloHits.push_back(pCaloHit);
+        m_availabilityMap[pCaloHit] = true;
+    }
+
+    for (const CaloHit *const pCaloHit : caloHitReplacement.m_oldCaloHits)
+    {
+        CaloHitVector::iterator iter(std::find(m_caloHits.begin(), m_caloHits.end(), pCaloHit));
+
+        if ((m_caloHits.end() == iter) || !m_availabilityMap.erase(pCaloHit))
+            return STATUS_CODE_FAILURE;
+
+        m_caloHits.erase(iter);
+    }
+
+    m_caloHitReplacements.push_back(caloHitReplacement);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ReferenceMetadata::Update(const ReferenceMetadata &referenceMetadata)
+{
+    for (const CaloHitReplacement &caloHitReplacement : referenceMetadata.m_caloHitReplacements)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Update(caloHitReplacement));
+
+    for (const CaloHitAvailabilityMap::value_type &mapEntry : referenceMetadata.m_availabilityMap)
+    {
+        CaloHitAvailabilityMap::iterator iter(m_availabilityMap.find(mapEntry.first));
+
+        if (m_availabilityMap.end() == iter)
+            return STATUS_CODE_FAILURE;
+
+        iter->second = mapEntry.second;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ReferenceMetadata::GetCaloHits(CaloHitVector &caloHitVector) const
+{
+    caloHitVector.clear();
+
+    for (const CaloHit *const pCaloHit : m_baseCaloHits)
+    {
+        if (m_availabilityMap.count(pCaloHit))
+            caloHitVector.push_back(pCaloHit);
+    }
+
+    CaloHitVector addedCaloHits;
+
+    for (const CaloHitAvailabilityMap::value_type &mapEntry : m_availabilityMap)
+    {
+        if (!m_baseCaloHitSet.count(mapEntry.first))
+            addedCaloHits.push_back(mapEntry.first);
+    }
+
+    std::sort(addedCaloHits.begin(), addedCaloHits.end(), IndexLessThan<CaloHit>());
+    caloHitVector.insert(caloHitVector.end(), addedCaloHits.begin(), addedCaloHits.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ReclusterOption::ReclusterOption(const CaloHitList &baseCaloHitList, const CaloHitSet &baseCaloHitSet, const bool initialHitAvailability) :
+    m_caloHitList(baseCaloHitList),
+    m_pCaloHitMetadata(nullptr),
+    m_referenceMetadata(baseCaloHitList, initialHitAvailability)
+{
+    m_pCaloHitMetadata = new CaloHitMetadata(&m_caloHitList, &baseCaloHitList, &baseCaloHitSet, "ReclusterOption", initialHitAvailability);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ReclusterOption::~ReclusterOption()
+{
+    // ATTN The replacement calo hits are owned by the pandora instance, so clear the metadata to prevent their deletion
+    m_pCaloHitMetadata->Clear();
+    delete m_pCaloHitMetadata;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MetadataModelAlgorithm::Run()
+{
+    const CaloHitList *pCaloHitList(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pCaloHitList));
+
+    m_generator.seed(24680);
+    m_allCaloHits.assign(pCaloHitList->begin(), pCaloHitList->end());
+
+    const unsigned int nBaseCaloHits(200), nTrials(10);
+
+    if (m_allCaloHits.size() <= nBaseCaloHits)
+        return STATUS_CODE_FAILURE;
+
+    for (unsigned int iTrial = 0; iTrial < nTrials; ++iTrial)
+    {
+        // ATTN No metadata from earlier trials remains, so every calo hit beyond the base calo hits may act as a replacement again
+        m_freshCaloHits.assign(m_allCaloHits.begin() + nBaseCaloHits, m_allCaloHits.end());
+        std::shuffle(m_freshCaloHits.begin(), m_freshCaloHits.end(), m_generator);
+
+        CaloHitVector baseCaloHits(m_allCaloHits.begin(), m_allCaloHits.begin() + nBaseCaloHits);
+        m_trialCaloHits = baseCaloHits;
+        std::shuffle(baseCaloHits.begin(), baseCaloHits.end(), m_generator);
+
+        const CaloHitList baseCaloHitList(baseCaloHits.begin(), baseCaloHits.begin() + nBaseCaloHits / 2 + iTrial);
+        this->Recluster(baseCaloHitList, 0, nullptr);
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MetadataModelAlgorithm::Recluster(const CaloHitList &baseCaloHitList, const unsigned int depth, ReclusterOption *const pParentOption)
+{
+    // ATTN As for the calo hit manager, the first option describes the original clusters and the others the new candidates. Fewer
+    // operations are applied at greater depths, to bound the number of nested reclustering processes
+    const CaloHitSet baseCaloHitSet(baseCaloHitList.begin(), baseCaloHitList.end());
+    const unsigned int nOptions(1 + m_generator() % 3), nOperationsPerOption(std::max(1u, 60u >> (2 * depth)));
+    ReclusterOptionVector options;
+
+    for (unsigned int iOption = 0; iOption < nOptions; ++iOption)
+    {
+        options.push_back(new ReclusterOption(baseCaloHitList, baseCaloHitSet, iOption > 0));
+        this->Compare(*options.back(), "option creation");
+
+        for (unsigned int iOperation = 0; iOperation < nOperationsPerOption; ++iOperation)
+            this->ApplyOperation(*options.back(), depth);
+    }
+
+    if (pParentOption)
+    {
+        ++g_nNestedReclusters;
+        const ReclusterOption *const pSelectedOption(options.at(m_generator() % nOptions));
+        const StatusCode updateStatusCode(pParentOption->m_pCaloHitMetadata->Update(*pSelectedOption->m_pCaloHitMetadata));
+        const StatusCode referenceStatusCode(pParentOption->m_referenceMetadata.Update(pSelectedOption->m_referenceMetadata));
+
+        Check(STATUS_CODE_SUCCESS == referenceStatusCode, "reference update with a nested reclustering option succeeds");
+        Check(updateStatusCode == referenceStatusCode, "update with a nested reclustering option status code matches reference");
+        this->Compare(*pParentOption, "update with a nested reclustering option");
+    }
+
+    for (const ReclusterOption *const pOption : options)
+        delete pOption;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MetadataModelAlgorithm::ApplyOperation(ReclusterOption &option, const unsigned int depth)
+{
+    ++g_nOperations;
+    CaloHitMetadata &caloHitMetadata(*option.m_pCaloHitMetadata);
+    ReferenceMetadata &referenceMetadata(option.m_referenceMetadata);
+
+    const unsigned int operation(m_generator() % 100);
+    const bool isAvailable(0 == m_generator() % 2);
+
+    if (operation < 25)
+    {
+        // Change the availability of a single calo hit, which may not be described by the metadata
+        const CaloHit *const pCaloHit(m_allCaloHits.at(m_generator() % m_allCaloHits.size()));
+        const CaloHitList caloHitList(1, pCaloHit);
+        const StatusCode statusCode(caloHitMetadata.SetAvailability(pCaloHit, isAvailable));
+        Check(statusCode == referenceMetadata.SetAvailability(caloHitList, isAvailable),
+            "calo hit availability status code matches reference");
+        this->Compare(option, "calo hit availability change");
+    }
+    else if (operation < 45)
+    {
+        // Change the availability of a list of calo hits
+        CaloHitList caloHitList;
+        const unsigned int nCaloHits(1 + m_generator() % 5);
+
+        for (unsigned int iHit = 0; (iHit < nCaloHits) && !option.m_caloHitList.empty(); ++iHit)
+            caloHitList.push_back(this->GetRandomMember(option));
+
+        const StatusCode statusCode(caloHitMetadata.SetAvailability(&caloHitList, isAvailable));
+        Check(statusCode == referenceMetadata.SetAvailability(caloHitList, isAvailable),
+            "calo hit list availability status code matches reference");
+        this->Compare(option, "calo hit list availability change");
+    }
+    else if (operation < 65)
+    {
+        // Fragment a calo hit, or merge two calo hits, via a single calo hit replacement
+        const bool isFragmentation(operation < 55);
+        const CaloHit *const pNewCaloHit1(this->GetFreshCaloHit());
+        const CaloHit *const pNewCaloHit2(isFragmentation ? this->GetFreshCaloHit() : nullptr);
+
+        if (!pNewCaloHit1 || (isFragmentation && !pNewCaloHit2) || (option.m_caloHitList.size() < 2))
+            return;
+
+        CaloHitReplacement caloHitReplacement;
+        caloHitReplacement.m_oldCaloHits.push_back(this->GetRandomMember(option));
+        caloHitReplacement.m_newCaloHits.push_back(pNewCaloHit1);
+
+        if (isFragmentation)
+        {
+            caloHitReplacement.m_newCaloHits.push_back(pNewCaloHit2);
+        }
+        else
+        {
+            const CaloHit *pOtherCaloHit(caloHitReplacement.m_oldCaloHits.front());
+
+            while (pOtherCaloHit == caloHitReplacement.m_oldCaloHits.front())
+                pOtherCaloHit = this->GetRandomMember(option);
+
+            caloHitReplacement.m_oldCaloHits.push_back(pOtherCaloHit);
+        }
+
+        const StatusCode statusCode(caloHitMetadata.Update(caloHitReplacement));
+        Check(statusCode == referenceMetadata.Update(caloHitReplacement), "calo hit replacement status code matches reference");
+        Check(STATUS_CODE_SUCCESS == statusCode, "calo hit replacement succeeds");
+        this->Compare(option, "calo hit replacement");
+    }
+    else if (operation < 70)
+    {
+        // Attempt a calo hit replacement adding a calo hit that is already described by the metadata
+        if (option.m_caloHitList.size() < 2)
+            return;
+
+        CaloHitReplacement caloHitReplacement;
+        caloHitReplacement.m_oldCaloHits.push_back(option.m_caloHitList.front());
+        caloHitReplacement.m_newCaloHits.push_back(option.m_caloHitList.back());
+
+        const StatusCode statusCode(caloHitMetadata.Update(caloHitReplacement));
+        Check(statusCode == referenceMetadata.Update(caloHitReplacement), "invalid calo hit replacement status code matches reference");
+        Check(STATUS_CODE_ALREADY_PRESENT == statusCode, "invalid calo hit replacement is rejected");
+        this->Compare(option, "invalid calo hit replacement");
+    }
+    else if (operation < 88)
+    {
+        // Fragment calo hits via a list of calo hit replacements, sometimes fragmenting a fragment made earlier in the same list
+        CaloHitReplacementList caloHitReplacementList;
+        CaloHitSet oldCaloHits;
+        const unsigned int nReplacements(1 + m_generator() % 4);
+
+        for (unsigned int iReplacement = 0; iReplacement < nReplacements; ++iReplacement)
+        {
+            const CaloHit *const pNewCaloHit1(this->GetFreshCaloHit()), *const pNewCaloHit2(this->GetFreshCaloHit());
+            const CaloHit *pOldCaloHit(option.m_caloHitList.empty() ? nullptr : this->GetRandomMember(option));
+
+            if (!caloHitReplacementList.empty() && (0 == m_generator() % 3))
+                pOldCaloHit = caloHitReplacementList.back()->m_newCaloHits.front();
+
+            if (!pNewCaloHit1 || !pNewCaloHit2 || !pOldCaloHit || !oldCaloHits.insert(pOldCaloHit).second)
+                continue;
+
+            CaloHitReplacement *const pCaloHitReplacement(new CaloHitReplacement);
+            pCaloHitReplacement->m_oldCaloHits.push_back(pOldCaloHit);
+            pCaloHitReplacement->m_newCaloHits.push_back(pNewCaloHit1);
+            pCaloHitReplacement->m_newCaloHits.push_back(pNewCaloHit2);
+            caloHitReplacementList.push_back(pCaloHitReplacement);
+        }
+
+        StatusCode referenceStatusCode(STATUS_CODE_SUCCESS);
+
+        for (const CaloHitReplacement *const pCaloHitReplacement : caloHitReplacementList)
+        {
+            if (STATUS_CODE_SUCCESS == referenceStatusCode)
+                referenceStatusCode = referenceMetadata.Update(*pCaloHitReplacement);
+        }
+
+        const StatusCode statusCode(caloHitMetadata.Update(caloHitReplacementList));
+        Check(statusCode == referenceStatusCode, "calo hit replacement list status code matches reference");
+        Check(STATUS_CODE_SUCCESS == statusCode, "calo hit replacement list succeeds");
+        this->Compare(option, "calo hit replacement list");
+
+        for (const CaloHitReplacement *const pCaloHitReplacement : caloHitReplacementList)
+            delete pCaloHitReplacement;
+    }
+    else if ((depth < 3) && (option.m_caloHitList.size() > 1))
+    {
+        // Run a nested reclustering process, with input a subset of the calo hits described by the option
+        CaloHitList nestedCaloHitList;
+
+        for (const CaloHit *const pCaloHit : option.m_caloHitList)
+        {
+            if (0 != m_generator() % 3)
+                nestedCaloHitList.push_back(pCaloHit);
+        }
+
+        if (!nestedCaloHitList.empty())
+            this->Recluster(nestedCaloHitList, depth + 1, &option);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MetadataModelAlgorithm::Compare(const ReclusterOption &option, const std::string &description) const
+{
+    const CaloHitMetadata &caloHitMetadata(*option.m_pCaloHitMetadata);
+    const ReferenceMetadata &referenceMetadata(option.m_referenceMetadata);
+    unsigned int nMismatches(0);
+    bool allAvailable(true);
+
+    for (const CaloHit *const pCaloHit : m_trialCaloHits)
+    {
+        const bool isAvailable(referenceMetadata.IsAvailable(pCaloHit));
+
+        if (caloHitMetadata.IsAvailable(pCaloHit) != isAvailable)
+            ++nMismatches;
+
+        if (referenceMetadata.m_availabilityMap.count(pCaloHit))
+            allAvailable = allAvailable && isAvailable;
+    }
+
+    Check(0 == nMismatches, description + ": calo hit availability matches reference");
+    Check(caloHitMetadata.IsAvailable(&option.m_caloHitList) == allAvailable,
+        description + ": calo hit list availability matches reference");
+    Check(CaloHitVector(option.m_caloHitList.begin(), option.m_caloHitList.end()) == referenceMetadata.m_caloHits,
+        description + ": associated calo hit list matches reference");
+
+    CaloHitVector caloHitVector, referenceCaloHitVector;
+    caloHitMetadata.GetCaloHits(caloHitVector);
+    referenceMetadata.GetCaloHits(referenceCaloHitVector);
+    Check(caloHitVector == referenceCaloHitVector, description + ": described calo hits match reference");
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const CaloHit *MetadataModelAlgorithm::GetRandomMember(const ReclusterOption &option)
+{
+    CaloHitList::const_iterator iter(option.m_caloHitList.begin());
+    std::advance(iter, m_generator() % option.m_caloHitList.size());
+
+    return *iter;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const CaloHit *MetadataModelAlgorithm::GetFreshCaloHit()
+{
+    if (m_freshCaloHits.empty())
+        return nullptr;
+
+    const CaloHit *const pCaloHit(m_freshCaloHits.back());
+    m_freshCaloHits.pop_back();
+    m_trialCaloHits.push_back(pCaloHit);
+
+    return pCaloHit;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MakeClustersAlgorithm::Run()
+{
+    const CaloHitList *pCaloHitList(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pCaloHitList));
+
+    const ClusterList *pClusterList(nullptr);
+    std::string clusterListName;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::CreateTemporaryListAndSetCurrent(*this, pClusterList,
+        clusterListName));
+
+    const unsigned int nClusters(4), nCaloHitsPerCluster(10);
+    CaloHitList::const_iterator iter(pCaloHitList->begin());
+
+    for (unsigned int iCluster = 0; iCluster < nClusters; ++iCluster)
+    {
+        PandoraContentApi::Cluster::Parameters parameters;
+
+        for (unsigned int iHit = 0; (iHit < nCaloHitsPerCluster) && (pCaloHitList->end() != iter); ++iHit, ++iter)
+            parameters.m_caloHitList.push_back(*iter);
+
+        const Cluster *pCluster(nullptr);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Cluster::Create(*this, parameters, pCluster));
+    }
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::SaveList<Cluster>(*this, "InputClusters"));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ReplaceCurrentList<Cluster>(*this, "InputClusters"));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode OuterFragmentationAlgorithm::Run()
+{
+    const ClusterList *pInputClusterList(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pInputClusterList));
+
+    if (pInputClusterList->size() < 4)
+        return STATUS_CODE_FAILURE;
+
+    const ClusterVector inputClusters(pInputClusterList->begin(), pInputClusterList->end());
+    const ClusterList fragmentationClusterList(inputClusters.begin(), inputClusters.begin() + 2);
+    const CaloHitVector caloHitsA(GetClusterCaloHits(inputClusters.at(0))), caloHitsB(GetClusterCaloHits(inputClusters.at(1)));
+
+    std::string originalClustersListName, fragmentClustersListName;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::InitializeFragmentation(*this, fragmentationClusterList,
+        originalClustersListName, fragmentClustersListName));
+
+    g_expectedAvailability.clear();
+
+    for (const CaloHit *const pCaloHit : caloHitsA) g_expectedAvailability[pCaloHit] = true;
+    for (const CaloHit *const pCaloHit : caloHitsB) g_expectedAvailability[pCaloHit] = true;
+
+    CheckCurrentCaloHits(*this, "outer fragmentation initialized");
+    Check(!PandoraContentApi::IsAvailable(*this, GetClusterCaloHits(inputClusters.at(2)).front()),
+        "calo hits outside the fragmentation input are unavailable");
+
+    // Fragment a calo hit, then cluster one fragment with the other calo hits of the first cluster, leaving the other fragment unclustered
+    const CaloHit *pFragment1(nullptr), *pFragment2(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Fragment(*this, caloHitsA.front(), 0.4f, pFragment1, pFragment2));
+    g_expectedAvailability.erase(caloHitsA.front());
+    g_expectedAvailability[pFragment1] = true;
+    g_expectedAvailability[pFragment2] = true;
+    CheckCurrentCaloHits(*this, "outer calo hit fragmented");
+
+    CaloHitList caloHitListP(caloHitsA.begin() + 1, caloHitsA.end()), caloHitListQ(caloHitsB.begin(), caloHitsB.begin() + 5);
+    caloHitListP.push_back(pFragment1);
+    (void) CreateCluster(*this, caloHitListP);
+    (void) CreateCluster(*this, caloHitListQ);
+    CheckCurrentCaloHits(*this, "outer fragment clusters created");
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RunDaughterAlgorithm(*this, m_innerAlgorithmName));
+    Check(g_nInnerChecks > 0, "inner fragmentation algorithm has run");
+    CheckCurrentCaloHits(*this, "inner fragmentation selected");
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::EndFragmentation(*this, fragmentClustersListName,
+        originalClustersListName));
+
+    // ATTN The calo hits in the unchanged input clusters are also now in the current calo hit list, the algorithm input list
+    for (unsigned int iCluster = 2; iCluster < inputClusters.size(); ++iCluster)
+    {
+        for (const CaloHit *const pCaloHit : GetClusterCaloHits(inputClusters.at(iCluster)))
+            g_expectedAvailability[pCaloHit] = false;
+    }
+
+    const CaloHitList *pCaloHitList(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pCaloHitList));
+
+    for (const CaloHit *const pCaloHit : *pCaloHitList)
+    {
+        if (!g_expectedAvailability.count(pCaloHit))
+            g_expectedAvailability[pCaloHit] = true;
+    }
+
+    CheckCurrentCaloHits(*this, "outer fragmentation ended");
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode OuterFragmentationAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    return XmlHelper::ProcessAlgorithm(*this, xmlHandle, "InnerFragmentation", m_innerAlgorithmName);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode InnerFragmentationAlgorithm::Run()
+{
+    const ClusterList *pInputClusterList(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pInputClusterList));
+
+    if (2 != pInputClusterList->size())
+        return STATUS_CODE_FAILURE;
+
+    const ClusterVector inputClusters(pInputClusterList->begin(), pInputClusterList->end());
+    const bool isFirstLarger(inputClusters.at(0)->GetNCaloHits() > inputClusters.at(1)->GetNCaloHits());
+    const Cluster *const pClusterP(isFirstLarger ? inputClusters.at(0) : inputClusters.at(1));
+    const Cluster *const pClusterQ(isFirstLarger ? inputClusters.at(1) : inputClusters.at(0));
+    const CaloHitVector caloHitsP(GetClusterCaloHits(pClusterP)), caloHitsQ(GetClusterCaloHits(pClusterQ));
+
+    // Fragment calo hits in cluster P, including a fragment made by the parent algorithm, and select the fragment clusters
+    const CaloHitAvailabilityMap parentExpectedAvailability(g_expectedAvailability);
+    std::string originalClustersListName, fragmentClustersListName;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::InitializeFragmentation(*this, ClusterList(1, pClusterP),
+        originalClustersListName, fragmentClustersListName));
+
+    g_expectedAvailability.clear();
+
+    for (const CaloHit *const pCaloHit : caloHitsP)
+        g_expectedAvailability[pCaloHit] = true;
+
+    CheckCurrentCaloHits(*this, "inner fragmentation initialized");
+
+    const CaloHit *pParentFragment(nullptr);
+
+    for (const CaloHit *const pCaloHit : caloHitsP)
+    {
+        if (pCaloHit->GetWeight() < 1.f)
+            pParentFragment = pCaloHit;
+    }
+
+    if (!pParentFragment)
+        return STATUS_CODE_FAILURE;
+
+    CaloHitVector originalCaloHits(1, pParentFragment), daughterCaloHits1, daughterCaloHits2;
+
+    for (const CaloHit *const pCaloHit : caloHitsP)
+    {
+        if ((pCaloHit != pParentFragment) && (originalCaloHits.size() < 3))
+            originalCaloHits.push_back(pCaloHit);
+    }
+
+    const FloatVector fractions1(originalCaloHits.size(), 0.5f);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Fragment(*this, originalCaloHits, fractions1, daughterCaloHits1,
+        daughterCaloHits2));
+
+    for (unsigned int iHit = 0; iHit < originalCaloHits.size(); ++iHit)
+    {
+        g_expectedAvailability.erase(originalCaloHits.at(iHit));
+        g_expectedAvailability[daughterCaloHits1.at(iHit)] = true;
+        g_expectedAvailability[daughterCaloHits2.at(iHit)] = true;
+    }
+
+    CheckCurrentCaloHits(*this, "inner calo hits fragmented");
+
+    CaloHitList caloHitListR(daughterCaloHits1.begin(), daughterCaloHits1.end());
+
+    for (const CaloHit *const pCaloHit : caloHitsP)
+    {
+        if (originalCaloHits.end() == std::find(originalCaloHits.begin(), originalCaloHits.end(), pCaloHit))
+            caloHitListR.push_back(pCaloHit);
+    }
+
+    (void) CreateCluster(*this, caloHitListR);
+    CheckCurrentCaloHits(*this, "inner fragment cluster created");
+
+    const CaloHitAvailabilityMap selectedExpectedAvailability(g_expectedAvailability);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::EndFragmentation(*this, fragmentClustersListName,
+        originalClustersListName));
+
+    // The parent option now holds the selected fragments, with their availability, in place of the fragmented calo hits
+    g_expectedAvailability = parentExpectedAvailability;
+
+    for (const CaloHit *const pCaloHit : originalCaloHits)
+        g_expectedAvailability.erase(pCaloHit);
+
+    for (const CaloHitAvailabilityMap::value_type &mapEntry : selectedExpectedAvailability)
+        g_expectedAvailability[mapEntry.first] = mapEntry.second;
+
+    CheckCurrentCaloHits(*this, "inner fragmentation selected");
+
+    // Fragment a calo hit in cluster Q, then discard the fragment clusters, keeping the original calo hit
+    const CaloHitAvailabilityMap keptExpectedAvailability(g_expectedAvailability);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::InitializeFragmentation(*this, ClusterList(1, pClusterQ),
+        originalClustersListName, fragmentClustersListName));
+
+    const CaloHit *pFragment1(nullptr), *pFragment2(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Fragment(*this, caloHitsQ.front(), 0.3f, pFragment1, pFragment2));
+    Check(!PandoraContentApi::IsAvailable(*this, caloHitsQ.front()), "fragmented calo hit is unavailable");
+    Check(PandoraContentApi::IsAvailable(*this, pFragment1) && PandoraContentApi::IsAvailable(*this, pFragment2),
+        "calo hit fragments are available");
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::EndFragmentation(*this, originalClustersListName,
+        fragmentClustersListName));
+
+    g_expectedAvailability = keptExpectedAvailability;
+    CheckCurrentCaloHits(*this, "inner fragmentation discarded");
+    ++g_nInnerChecks;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Create calo hits at random positions
+ *
+ *  @param  pandora the pandora instance
+ *  @param  nCaloHits the number of calo hits
+ */
+void CreateCaloHits(const Pandora &pandora, const unsigned int nCaloHits)
+{
+    std::mt19937 generator(13579);
+    std::uniform_real_distribution<float> uniform(-1000.f, 1000.f);
+
+    for (unsigned int iHit = 0; iHit < nCaloHits; ++iHit)
+    {
+        PandoraApi::CaloHit::Parameters parameters;
+        parameters.m_positionVector = CartesianVector(uniform(generator), uniform(generator), uniform(generator));
+        parameters.m_expectedDirection = CartesianVector(0.f, 0.f, 1.f);
+        parameters.m_cellNormalVector = CartesianVector(0.f, 0.f, 1.f);
+        parameters.m_cellGeometry = RECTANGULAR;
+        parameters.m_cellSize0 = 5.f;
+        parameters.m_cellSize1 = 5.f;
+        parameters.m_cellThickness = 2.f;
+        parameters.m_nCellRadiationLengths = 0.5f;
+        parameters.m_nCellInteractionLengths = 0.05f;
+        parameters.m_time = 0.f;
+        parameters.m_inputEnergy = 1.f;
+        parameters.m_mipEquivalentEnergy = 1.f;
+        parameters.m_electromagneticEnergy = 1.f;
+        parameters.m_hadronicEnergy = 1.f;
+        parameters.m_isDigital = false;
+        parameters.m_hitType = ECAL;
+        parameters.m_hitRegion = ENDCAP;
+        parameters.m_layer = 0;
+        parameters.m_isInOuterSamplingLayer = false;
+        parameters.m_pParentAddress = reinterpret_cast<const void *>(static_cast<std::uintptr_t>(iHit + 1));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(pandora, parameters));
+    }
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main()
+{
+    const std::string settingsFileName("CaloHitMetadataTest.xml");
+
+    try
+    {
+        std::ofstream settingsFile(settingsFileName);
+        settingsFile << "<pandora>\n"
+                     << "    <algorithm type = \"MetadataModel\"/>\n"
+                     << "    <algorithm type = \"MakeClusters\"/>\n"
+                     << "    <algorithm type = \"OuterFragmentation\">\n"
+                     << "        <algorithm type = \"InnerFragmentation\" description = \"InnerFragmentation\"/>\n"
+                     << "    </algorithm>\n"
+                     << "</pandora>\n";
+        settingsFile.close();
+
+        const Pandora pandora;
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetPseudoLayerPlugin(pandora, new SimplePseudoLayerPlugin));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::RegisterAlgorithmFactory(pandora, "MetadataModel",
+            new MetadataModelAlgorithm::Factory));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::RegisterAlgorithmFactory(pandora, "MakeClusters",
+            new MakeClustersAlgorithm::Factory));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::RegisterAlgorithmFactory(pandora, "OuterFragmentation",
+            new OuterFragmentationAlgorithm::Factory));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::RegisterAlgorithmFactory(pandora, "InnerFragmentation",
+            new InnerFragmentationAlgorithm::Factory));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ReadSettings(pandora, settingsFileName));
+        std::remove(settingsFileName.c_str());
+
+        CreateCaloHits(pandora, 1500);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(pandora));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(pandora));
+
+        std::cout << "CaloHitMetadataTest: " << g_nOperations << " metadata operations, " << g_nNestedReclusters << " nested reclusters"
+                  << std::endl;
+        Check(g_nNestedReclusters > 50, "many nested reclustering processes are simulated");
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::remove(settingsFileName.c_str());
+        std::cout << "CaloHitMetadataTest: unexpected exception: " << statusCodeException.ToString() << std::endl;
+        return 1;
+    }
+
+    if (0 != g_nFailures)
+    {
+        std::cout << "CaloHitMetadataTest: " << g_nFailures << " checks failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << "CaloHitMetadataTest: all checks passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,513 @@
+/**
+ *  @file   PandoraSDK/test/CaloHitSpatialIndexTest.cc
+ *
+ *  @brief  Test of the calo hit spatial index, see PandoraContentApi::GetCaloHitsInRange and PandoraContentApi::GetNearestCaloHits. Query
+ *          results are compared with a brute force search over the named calo hit list. Calo hits lie on lattices, in three dimensions and
+ *          in a plane, with some at identical positions, so that many calo hits are equidistant from a query and lie on the split planes.
+ *          The comparisons are repeated after each change that must invalidate the index: saving to and renaming calo hit lists,
+ *          fragmenting calo hits and changing availability, including during reclustering.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+#include "Api/PandoraContentApi.h"
+
+#include "Objects/CaloHit.h"
+#include "Objects/Cluster.h"
+
+#include "Pandora/Algorithm.h"
+
+#include "Plugins/PseudoLayerPlugin.h"
+
+#include "Xml/tinyxml.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace pandora;
+
+namespace
+{
+
+unsigned int g_nFailures(0);            ///< The number of failed checks
+unsigned int g_nQueries(0);             ///< The number of queries compared
+unsigned int g_nNeighbours(0);          ///< The total number of calo hits received from the queries compared
+
+/**
+ *  @brief  Record a failed check, if a condition does not hold
+ *
+ *  @param  condition the condition
+ *  @param  description the description of the check
+ */
+void Check(const bool condition, const std::string &description)
+{
+    if (condition)
+        return;
+
+    ++g_nFailures;
+    std::cout << "CaloHitSpatialIndexTest: check failed: " << description << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  SimplePseudoLayerPlugin class, with pseudolayers in 10mm slices in z
+ */
+class SimplePseudoLayerPlugin : public PseudoLayerPlugin
+{
+public:
+    unsigned int GetPseudoLayer(const CartesianVector &positionVector) const
+    {
+        return 1 + static_cast<unsigned int>(std::fabs(positionVector.GetZ()) / 10.f);
+    }
+
+    unsigned int GetPseudoLayerAtIp() const
+    {
+        return 1;
+    }
+
+private:
+    StatusCode ReadSettings(const TiXmlHandle)
+    {
+        return STATUS_CODE_SUCCESS;
+    }
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  SpatialIndexTestAlgorithm class, comparing spatial index queries with brute force searches as calo hit lists change
+ */
+class SpatialIndexTestAlgorithm : public Algorithm
+{
+public:
+    /**
+     *  @brief  Factory class for instantiating algorithm
+     */
+    class Factory : public AlgorithmFactory
+    {
+    public:
+        Algorithm *CreateAlgorithm() const
+        {
+            return new SpatialIndexTestAlgorithm;
+        }
+    };
+
+private:
+    StatusCode Run();
+
+    StatusCode ReadSettings(const TiXmlHandle)
+    {
+        return STATUS_CODE_SUCCESS;
+    }
+
+    /**
+     *  @brief  Compare random range and nearest neighbour queries on a named calo hit list with brute force searches
+     *
+     *  @param  listName the name of the calo hit list
+     *  @param  stage the description of the stage of the test
+     */
+    void CompareQueries(const std::string &listName, const std::string &stage);
+
+    /**
+     *  @brief  Get the available calo hits of a hit type in a calo hit list, ordered by increasing distance from a position, then by index
+     *
+     *  @param  caloHitList the calo hit list
+     *  @param  hitType the hit type
+     *  @param  position the position
+     *  @param  distanceSquaredVector to receive the squared distance of each calo hit from the position
+     *  @param  caloHitVector to receive the calo hits
+     */
+    void GetOrderedCaloHits(const CaloHitList &caloHitList, const HitType hitType, const CartesianVector &position,
+        std::vector<float> &distanceSquaredVector, CaloHitVector &caloHitVector) const;
+
+    /**
+     *  @brief  Get a random query position: a lattice point, a point midway between lattice points or a point anywhere near the lattice
+     *
+     *  @param  hitType the hit type, determining the lattice
+     *
+     *  @return the query position
+     */
+    CartesianVector GetQueryPosition(const HitType hitType);
+
+    std::mt19937                        m_generator;                ///< The random number generator
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const float g_latticeSpacing(10.f);     ///< The lattice spacing
+const unsigned int g_nEcalLattice(8);   ///< The number of ecal lattice points along each axis, in three dimensions
+const unsigned int g_nHcalLattice(20);  ///< The number of hcal lattice points along each axis, in the plane y = 0
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode SpatialIndexTestAlgorithm::Run()
+{
+    m_generator.seed(97531);
+
+    const CaloHitList *pCaloHitList(nullptr);
+    std::string caloHitListName;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pCaloHitList, caloHitListName));
+
+    this->CompareQueries(caloHitListName, "all calo hits available");
+
+    // Make every third calo hit unavailable, by adding it to a cluster
+    const ClusterList *pClusterList(nullptr);
+    std::string clusterListName;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::CreateTemporaryListAndSetCurrent(*this, pClusterList,
+        clusterListName));
+
+    unsigned int iHit(0);
+
+    for (const CaloHit *const pCaloHit : *pCaloHitList)
+    {
+        if (0 != iHit++ % 3)
+            continue;
+
+        PandoraContentApi::Cluster::Parameters parameters;
+        parameters.m_caloHitList.push_back(pCaloHit);
+
+        const Cluster *pCluster(nullptr);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Cluster::Create(*this, parameters, pCluster));
+    }
+
+    this->CompareQueries(caloHitListName, "clustered calo hits unavailable");
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::SaveList<Cluster>(*this, "SpatialIndexClusters"));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ReplaceCurrentList<Cluster>(*this, "SpatialIndexClusters"));
+
+    // Fragment available calo hits of each hit type, the fragments lying at the position of the original calo hits
+    for (const HitType hitType : {ECAL, HCAL})
+    {
+        CaloHitVector originalCaloHits;
+
+        for (const CaloHit *const pCaloHit : *pCaloHitList)
+        {
+            if ((hitType == pCaloHit->GetHitType()) && PandoraContentApi::IsAvailable(*this, pCaloHit) && (originalCaloHits.size() < 20))
+                originalCaloHits.push_back(pCaloHit);
+        }
+
+        const CaloHit *pDaughterCaloHit1(nullptr), *pDaughterCaloHit2(nullptr);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Fragment(*this, originalCaloHits.back(), 0.5f,
+            pDaughterCaloHit1, pDaughterCaloHit2));
+        originalCaloHits.pop_back();
+        this->CompareQueries(caloHitListName, "single calo hit fragmented");
+
+        const FloatVector fractions1(originalCaloHits.size(), 0.25f);
+        CaloHitVector daughterCaloHits1, daughterCaloHits2;
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Fragment(*this, originalCaloHits, fractions1,
+            daughterCaloHits1, daughterCaloHits2));
+        this->CompareQueries(caloHitListName, "many calo hits fragmented");
+    }
+
+    // Save subsets of the calo hits to a named list, then rename it and reuse its name
+    CaloHitList subsetCaloHitLists[3];
+    iHit = 0;
+
+    for (const CaloHit *const pCaloHit : *pCaloHitList)
+        subsetCaloHitLists[iHit++ % 3].push_back(pCaloHit);
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::SaveList(*this, subsetCaloHitLists[0], "SpatialIndexSubset"));
+    this->CompareQueries("SpatialIndexSubset", "calo hit list saved");
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::SaveList(*this, subsetCaloHitLists[1], "SpatialIndexSubset"));
+    this->CompareQueries("SpatialIndexSubset", "calo hits saved to an existing list");
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RenameList<CaloHitList>(*this, "SpatialIndexSubset",
+        "SpatialIndexRenamed"));
+    this->CompareQueries("SpatialIndexRenamed", "calo hit list renamed");
+
+    CaloHitVector renamedCaloHits;
+    Check(STATUS_CODE_SUCCESS != PandoraContentApi::GetCaloHitsInRange(*this, "SpatialIndexSubset", ECAL, CartesianVector(0.f, 0.f, 0.f),
+        10.f, renamedCaloHits), "calo hit list renamed: old list name no longer indexed");
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::SaveList(*this, subsetCaloHitLists[2], "SpatialIndexSubset"));
+    this->CompareQueries("SpatialIndexSubset", "calo hit list name reused");
+    this->CompareQueries("SpatialIndexRenamed", "renamed calo hit list unchanged");
+
+    // Fragment calo hits during reclustering, when availability is determined by the reclustering calo hit metadata
+    const ClusterList *pInputClusterList(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pInputClusterList));
+
+    ClusterList reclusterClusterList;
+
+    for (const Cluster *const pCluster : *pInputClusterList)
+    {
+        if (reclusterClusterList.size() < pInputClusterList->size() / 2)
+            reclusterClusterList.push_back(pCluster);
+    }
+
+    std::string originalClustersListName, fragmentClustersListName, reclusterCaloHitListName;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::InitializeFragmentation(*this, reclusterClusterList,
+        originalClustersListName, fragmentClustersListName));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentListName<CaloHit>(*this, reclusterCaloHitListName));
+    this->CompareQueries(reclusterCaloHitListName, "reclustering initialized");
+    this->CompareQueries(caloHitListName, "input calo hits during reclustering");
+
+    CaloHitList reclusterCaloHits;
+
+    for (const Cluster *const pCluster : reclusterClusterList)
+        pCluster->GetOrderedCaloHitList().FillCaloHitList(reclusterCaloHits);
+
+    const CaloHit *pDaughterCaloHit1(nullptr), *pDaughterCaloHit2(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Fragment(*this, reclusterCaloHits.front(), 0.5f, pDaughterCaloHit1,
+        pDaughterCaloHit2));
+    this->CompareQueries(reclusterCaloHitListName, "calo hit fragmented during reclustering");
+
+    PandoraContentApi::Cluster::Parameters parameters;
+    parameters.m_caloHitList.push_back(pDaughterCaloHit1);
+    parameters.m_caloHitList.insert(parameters.m_caloHitList.end(), std::next(reclusterCaloHits.begin()), reclusterCaloHits.end());
+
+    const Cluster *pCluster(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Cluster::Create(*this, parameters, pCluster));
+    this->CompareQueries(reclusterCaloHitListName, "cluster created during reclustering");
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::EndFragmentation(*this, fragmentClustersListName,
+        originalClustersListName));
+    this->CompareQueries(caloHitListName, "reclustering ended");
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SpatialIndexTestAlgorithm::CompareQueries(const std::string &listName, const std::string &stage)
+{
+    const CaloHitList *pCaloHitList(nullptr);
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*this, listName, pCaloHitList));
+
+    const float diagonal(g_latticeSpacing * std::sqrt(2.f)), bodyDiagonal(g_latticeSpacing * std::sqrt(3.f));
+    const std::vector<float> distances = {0.f, 0.5f * g_latticeSpacing, g_latticeSpacing, diagonal, bodyDiagonal, 2.f * g_latticeSpacing,
+        2.5f * g_latticeSpacing, 4.f * g_latticeSpacing};
+    const std::vector<unsigned int> nCaloHitsVector = {1, 2, 3, 7, 13, 40, 100000};
+
+    for (const HitType hitType : {ECAL, HCAL})
+    {
+        for (unsigned int iQuery = 0; iQuery < 60; ++iQuery)
+        {
+            const CartesianVector position(this->GetQueryPosition(hitType));
+            std::vector<float> distanceSquaredVector;
+            CaloHitVector orderedCaloHits;
+            this->GetOrderedCaloHits(*pCaloHitList, hitType, position, distanceSquaredVector, orderedCaloHits);
+
+            const float distance(distances.at(m_generator() % distances.size()));
+            const float distanceSquared(distance * distance);
+            const std::size_t nRangeCaloHits(std::upper_bound(distanceSquaredVector.begin(), distanceSquaredVector.end(), distanceSquared) -
+                distanceSquaredVector.begin());
+
+            CaloHitVector rangeCaloHits;
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCaloHitsInRange(*this, listName, hitType, position,
+                distance, rangeCaloHits));
+            Check(rangeCaloHits == CaloHitVector(orderedCaloHits.begin(), orderedCaloHits.begin() + nRangeCaloHits),
+                stage + ": range query matches brute force search");
+
+            const unsigned int nCaloHits(nCaloHitsVector.at(m_generator() % nCaloHitsVector.size()));
+            const std::size_t nNearestCaloHits(std::min<std::size_t>(nCaloHits, orderedCaloHits.size()));
+
+            CaloHitVector nearestCaloHits;
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetNearestCaloHits(*this, listName, hitType, position,
+                nCaloHits, nearestCaloHits));
+            Check(nearestCaloHits == CaloHitVector(orderedCaloHits.begin(), orderedCaloHits.begin() + nNearestCaloHits),
+                stage + ": nearest neighbour query matches brute force search");
+
+            g_nQueries += 2;
+            g_nNeighbours += rangeCaloHits.size() + nearestCaloHits.size();
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SpatialIndexTestAlgorithm::GetOrderedCaloHits(const CaloHitList &caloHitList, const HitType hitType, const CartesianVector &position,
+    std::vector<float> &distanceSquaredVector, CaloHitVector &caloHitVector) const
+{
+    typedef std::pair<float, const CaloHit *> DistanceCaloHitPair;
+    std::vector<DistanceCaloHitPair> distanceCaloHitPairs;
+
+    for (const CaloHit *const pCaloHit : caloHitList)
+    {
+        if ((hitType != pCaloHit->GetHitType()) || !PandoraContentApi::IsAvailable(*this, pCaloHit))
+            continue;
+
+        // ATTN Use the same single precision arithmetic as the spatial index, so that equidistant calo hits compare equal
+        const CartesianVector &hitPosition(pCaloHit->GetPositionVector());
+        const float dx(hitPosition.GetX() - position.GetX());
+        const float dy(hitPosition.GetY() - position.GetY());
+        const float dz(hitPosition.GetZ() - position.GetZ());
+        distanceCaloHitPairs.push_back(DistanceCaloHitPair((dx * dx) + (dy * dy) + (dz * dz), pCaloHit));
+    }
+
+    std::sort(distanceCaloHitPairs.begin(), distanceCaloHitPairs.end(), [](const DistanceCaloHitPair &lhs, const DistanceCaloHitPair &rhs)
+        { return ((lhs.first < rhs.first) || ((lhs.first == rhs.first) && (lhs.second->GetIndex() < rhs.second->GetIndex()))); });
+
+    distanceSquaredVector.clear();
+    caloHitVector.clear();
+
+    for (const DistanceCaloHitPair &distanceCaloHitPair : distanceCaloHitPairs)
+    {
+        distanceSquaredVector.push_back(distanceCaloHitPair.first);
+        caloHitVector.push_back(distanceCaloHitPair.second);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CartesianVector SpatialIndexTestAlgorithm::GetQueryPosition(const HitType hitType)
+{
+    const unsigned int nLattice((ECAL == hitType) ? g_nEcalLattice : g_nHcalLattice);
+    const unsigned int positionType(m_generator() % 3);
+    float coordinates[3] = {0.f, 0.f, 0.f};
+
+    for (unsigned int iDimension = 0; iDimension < 3; ++iDimension)
+    {
+        if ((HCAL == hitType) && (1 == iDimension) && (0 != positionType))
+            continue;
+
+        const float latticeCoordinate(g_latticeSpacing * static_cast<float>(m_generator() % nLattice));
+
+        if (0 == positionType)
+        {
+            coordinates[iDimension] = latticeCoordinate;
+        }
+        else if (1 == positionType)
+        {
+            coordinates[iDimension] = latticeCoordinate + ((0 == m_generator() % 2) ? 0.5f * g_latticeSpacing : 0.f);
+        }
+        else
+        {
+            coordinates[iDimension] = g_latticeSpacing * (static_cast<float>(m_generator() % (100 * nLattice)) / 100.f - 0.5f);
+        }
+    }
+
+    return CartesianVector(coordinates[0], coordinates[1], coordinates[2]);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Create a calo hit
+ *
+ *  @param  pandora the pandora instance
+ *  @param  position the calo hit position
+ *  @param  hitType the calo hit type
+ *  @param  iHit the calo hit number, used to make a unique parent address
+ */
+void CreateCaloHit(const Pandora &pandora, const CartesianVector &position, const HitType hitType, const unsigned int iHit)
+{
+    PandoraApi::CaloHit::Parameters parameters;
+    parameters.m_positionVector = position;
+    parameters.m_expectedDirection = CartesianVector(0.f, 0.f, 1.f);
+    parameters.m_cellNormalVector = CartesianVector(0.f, 0.f, 1.f);
+    parameters.m_cellGeometry = RECTANGULAR;
+    parameters.m_cellSize0 = 5.f;
+    parameters.m_cellSize1 = 5.f;
+    parameters.m_cellThickness = 2.f;
+    parameters.m_nCellRadiationLengths = 0.5f;
+    parameters.m_nCellInteractionLengths = 0.05f;
+    parameters.m_time = 0.f;
+    parameters.m_inputEnergy = 1.f;
+    parameters.m_mipEquivalentEnergy = 1.f;
+    parameters.m_electromagneticEnergy = 1.f;
+    parameters.m_hadronicEnergy = 1.f;
+    parameters.m_isDigital = false;
+    parameters.m_hitType = hitType;
+    parameters.m_hitRegion = ENDCAP;
+    parameters.m_layer = 0;
+    parameters.m_isInOuterSamplingLayer = false;
+    parameters.m_pParentAddress = reinterpret_cast<const void *>(static_cast<std::uintptr_t>(iHit + 1));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(pandora, parameters));
+}
+
+/**
+ *  @brief  Create ecal calo hits on a three dimensional lattice and hcal calo hits on a lattice in the plane y = 0, in a shuffled order,
+ *          with some lattice points holding more than one calo hit
+ *
+ *  @param  pandora the pandora instance
+ */
+void CreateCaloHits(const Pandora &pandora)
+{
+    typedef std::pair<CartesianVector, HitType> PositionHitTypePair;
+    std::vector<PositionHitTypePair> positionHitTypePairs;
+
+    for (unsigned int i = 0; i < g_nEcalLattice; ++i)
+    {
+        for (unsigned int j = 0; j < g_nEcalLattice; ++j)
+        {
+            for (unsigned int k = 0; k < g_nEcalLattice; ++k)
+            {
+                const CartesianVector position(g_latticeSpacing * i, g_latticeSpacing * j, g_latticeSpacing * k);
+                positionHitTypePairs.push_back(PositionHitTypePair(position, ECAL));
+            }
+        }
+    }
+
+    for (unsigned int i = 0; i < g_nHcalLattice; ++i)
+    {
+        for (unsigned int k = 0; k < g_nHcalLattice; ++k)
+            positionHitTypePairs.push_back(PositionHitTypePair(CartesianVector(g_latticeSpacing * i, 0.f, g_latticeSpacing * k), HCAL));
+    }
+
+    std::mt19937 generator(86420);
+    const unsigned int nLatticePoints(positionHitTypePairs.size());
+
+    for (unsigned int iDuplicate = 0; iDuplicate < nLatticePoints / 5; ++iDuplicate)
+        positionHitTypePairs.push_back(positionHitTypePairs.at(generator() % nLatticePoints));
+
+    std::shuffle(positionHitTypePairs.begin(), positionHitTypePairs.end(), generator);
+
+    for (unsigned int iHit = 0; iHit < positionHitTypePairs.size(); ++iHit)
+        CreateCaloHit(pandora, positionHitTypePairs.at(iHit).first, positionHitTypePairs.at(iHit).second, iHit);
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main()
+{
+    const std::string settingsFileName("CaloHitSpatialIndexTest.xml");
+
+    try
+    {
+        std::ofstream settingsFile(settingsFileName);
+        settingsFile << "<pandora>\n    <algorithm type = \"SpatialIndexTest\"/>\n</pandora>\n";
+        settingsFile.close();
+
+        const Pandora pandora;
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetPseudoLayerPlugin(pandora, new SimplePseudoLayerPlugin));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::RegisterAlgorithmFactory(pandora, "SpatialIndexTest",
+            new SpatialIndexTestAlgorithm::Factory));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ReadSettings(pandora, settingsFileName));
+        std::remove(settingsFileName.c_str());
+
+        CreateCaloHits(pandora);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(pandora));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(pandora));
+
+        std::cout << "CaloHitSpatialIndexTest: " << g_nQueries << " queries compared, receiving " << g_nNeighbours << " calo hits"
+                  << std::endl;
+        Check(g_nQueries > 1000, "many queries are compared");
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::remove(settingsFileName.c_str());
+        std::cout << "CaloHitSpatialIndexTest: unexpected exception: " << statusCodeException.ToString() << std::endl;
+        return 1;
+    }
+
+    if (0 != g_nFailures)
+    {
+        std::cout << "CaloHitSpatialIndexTest: " << g_nFailures << " checks failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << "CaloHitSpatialIndexTest: all checks passed" << std::endl;
+    return 0;
+}
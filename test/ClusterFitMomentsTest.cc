@@ -0,0 +1,380 @@
+/**
+ *  @file   PandoraSDK/test/ClusterFitMomentsTest.cc
+ *
+ *  @brief  Test of cluster fits made from cluster fit moments, see ClusterFitHelper::FitMoments. Calo hits are added to and removed from
+ *          clusters, and clusters merged, at random. After each change the moment based FitFullCluster, FitStart, FitEnd and FitLayers
+ *          results are compared with ClusterFitHelper::FitPoints results for the same calo hits.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+#include "Api/PandoraContentApi.h"
+
+#include "Helpers/ClusterFitHelper.h"
+
+#include "Objects/CaloHit.h"
+#include "Objects/Cluster.h"
+#include "Objects/OrderedCaloHitList.h"
+
+#include "Pandora/Algorithm.h"
+
+#include "Plugins/PseudoLayerPlugin.h"
+
+#include "Xml/tinyxml.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace pandora;
+
+namespace
+{
+
+unsigned int g_nFailures(0);            ///< The number of failed checks
+unsigned int g_nComparisons(0);         ///< The number of successful fits compared
+
+typedef std::function<bool(unsigned int occupiedLayerIndex, unsigned int nOccupiedLayers, unsigned int pseudoLayer)> LayerSelector;
+
+/**
+ *  @brief  Record a failed check, if a condition does not hold
+ *
+ *  @param  condition the condition
+ *  @param  description the description of the check
+ */
+void Check(const bool condition, const std::string &description)
+{
+    if (condition)
+        return;
+
+    ++g_nFailures;
+    std::cout << "ClusterFitMomentsTest: check failed: " << description << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  ShellPseudoLayerPlugin class, with pseudolayers in 10mm spherical shells
+ */
+class ShellPseudoLayerPlugin : public PseudoLayerPlugin
+{
+public:
+    unsigned int GetPseudoLayer(const CartesianVector &positionVector) const
+    {
+        return 1 + static_cast<unsigned int>(positionVector.GetMagnitude() / 10.f);
+    }
+
+    unsigned int GetPseudoLayerAtIp() const
+    {
+        return 1;
+    }
+
+private:
+    StatusCode ReadSettings(const TiXmlHandle)
+    {
+        return STATUS_CODE_SUCCESS;
+    }
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  ClusterFitMomentsTestAlgorithm class, changing clusters at random and comparing their fits after each change
+ */
+class ClusterFitMomentsTestAlgorithm : public Algorithm
+{
+public:
+    /**
+     *  @brief  Factory class for instantiating algorithm
+     */
+    class Factory : public AlgorithmFactory
+    {
+    public:
+        Algorithm *CreateAlgorithm() const
+        {
+            return new ClusterFitMomentsTestAlgorithm;
+        }
+    };
+
+private:
+    StatusCode Run();
+
+    StatusCode ReadSettings(const TiXmlHandle)
+    {
+        return STATUS_CODE_SUCCESS;
+    }
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Whether two floating point values agree, within an absolute tolerance or a relative tolerance
+ *
+ *  @param  lhs the first value
+ *  @param  rhs the second value
+ *  @param  tolerance the tolerance
+ *
+ *  @return boolean
+ */
+bool IsClose(const float lhs, const float rhs, const float tolerance)
+{
+    return (std::fabs(lhs - rhs) <= tolerance * std::max(1.f, std::max(std::fabs(lhs), std::fabs(rhs))));
+}
+
+/**
+ *  @brief  Compare a moment based fit with a point based fit to the calo hits of a cluster in selected layers
+ *
+ *  @param  pCluster address of the cluster
+ *  @param  fitName the name of the moment based fit
+ *  @param  momentStatusCode the status code of the moment based fit
+ *  @param  momentResult the moment based fit result
+ *  @param  layerSelector the selection of the layers of the cluster, by occupied layer index and pseudo layer
+ */
+void CompareFits(const Cluster *const pCluster, const std::string &fitName, const StatusCode momentStatusCode,
+    const ClusterFitResult &momentResult, const LayerSelector &layerSelector)
+{
+    const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
+
+    // ATTN The moment based fits share their preconditions with the point based fits that preceded them
+    if (orderedCaloHitList.size() < 2)
+    {
+        Check(STATUS_CODE_OUT_OF_RANGE == momentStatusCode, fitName + " rejects a cluster with a single occupied layer");
+        return;
+    }
+
+    ClusterFitPointList clusterFitPointList;
+    unsigned int occupiedLayerIndex(0);
+
+    for (const OrderedCaloHitList::value_type &layerEntry : orderedCaloHitList)
+    {
+        if (layerSelector(occupiedLayerIndex++, orderedCaloHitList.size(), layerEntry.first))
+        {
+            for (const CaloHit *const pCaloHit : *layerEntry.second)
+                clusterFitPointList.push_back(ClusterFitPoint(pCaloHit));
+        }
+    }
+
+    ClusterFitResult pointResult;
+    const StatusCode pointStatusCode(ClusterFitHelper::FitPoints(clusterFitPointList, pointResult));
+    Check(pointStatusCode == momentStatusCode, fitName + " status code " + std::to_string(momentStatusCode) +
+        " matches point fit status code " + std::to_string(pointStatusCode));
+
+    if ((STATUS_CODE_SUCCESS != pointStatusCode) || (STATUS_CODE_SUCCESS != momentStatusCode))
+        return;
+
+    ++g_nComparisons;
+    const CartesianVector &direction(momentResult.GetDirection()), &pointDirection(pointResult.GetDirection());
+    const CartesianVector &intercept(momentResult.GetIntercept()), &pointIntercept(pointResult.GetIntercept());
+
+    Check(momentResult.IsFitSuccessful() == pointResult.IsFitSuccessful(), fitName + " success flag matches point fit");
+    Check((direction - pointDirection).GetMagnitude() < 1.e-3f, fitName + " direction matches point fit");
+    Check((intercept - pointIntercept).GetMagnitude() < 1.e-4f * std::max(1.f, pointIntercept.GetMagnitude()),
+        fitName + " intercept matches point fit");
+    Check(IsClose(momentResult.GetChi2(), pointResult.GetChi2(), 1.e-3f), fitName + " chi2 matches point fit");
+    Check(IsClose(momentResult.GetRms(), pointResult.GetRms(), 1.e-3f), fitName + " rms matches point fit");
+    Check(IsClose(momentResult.GetRadialDirectionCosine(), pointResult.GetRadialDirectionCosine(), 1.e-3f),
+        fitName + " radial direction cosine matches point fit");
+}
+
+/**
+ *  @brief  Compare each of the moment based fits of a cluster with the corresponding point based fits
+ *
+ *  @param  pCluster address of the cluster
+ */
+void CompareClusterFits(const Cluster *const pCluster)
+{
+    const unsigned int nFitLayers(4);
+    ClusterFitResult fullResult, startResult, endResult, layersResult;
+
+    CompareFits(pCluster, "FitFullCluster", ClusterFitHelper::FitFullCluster(pCluster, fullResult), fullResult,
+        [](unsigned int, unsigned int, unsigned int) { return true; });
+
+    CompareFits(pCluster, "FitStart", ClusterFitHelper::FitStart(pCluster, nFitLayers, startResult), startResult,
+        [](unsigned int occupiedLayerIndex, unsigned int, unsigned int) { return (occupiedLayerIndex < nFitLayers); });
+
+    CompareFits(pCluster, "FitEnd", ClusterFitHelper::FitEnd(pCluster, nFitLayers, endResult), endResult,
+        [](unsigned int occupiedLayerIndex, unsigned int nOccupiedLayers, unsigned int)
+        { return (occupiedLayerIndex + nFitLayers >= nOccupiedLayers); });
+
+    const unsigned int startLayer(pCluster->GetInnerPseudoLayer() + 2), endLayer(pCluster->GetOuterPseudoLayer() + 1);
+
+    if (startLayer < endLayer)
+    {
+        CompareFits(pCluster, "FitLayers", ClusterFitHelper::FitLayers(pCluster, startLayer, endLayer, layersResult), layersResult,
+            [startLayer, endLayer](unsigned int, unsigned int, unsigned int pseudoLayer)
+            { return ((pseudoLayer >= startLayer) && (pseudoLayer <= endLayer)); });
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ClusterFitMomentsTestAlgorithm::Run()
+{
+    const CaloHitList *pCaloHitList(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pCaloHitList));
+
+    std::mt19937 generator(12345);
+    CaloHitVector availableCaloHits(pCaloHitList->begin(), pCaloHitList->end());
+    std::shuffle(availableCaloHits.begin(), availableCaloHits.end(), generator);
+
+    const ClusterList *pClusterList(nullptr);
+    std::string clusterListName;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::CreateTemporaryListAndSetCurrent(*this, pClusterList,
+        clusterListName));
+
+    ClusterVector clusterVector;
+    std::uniform_real_distribution<float> uniform(0.f, 1.f);
+
+    while (!availableCaloHits.empty())
+    {
+        if (clusterVector.size() < 5)
+        {
+            PandoraContentApi::Cluster::Parameters parameters;
+            parameters.m_caloHitList.push_back(availableCaloHits.back());
+            availableCaloHits.pop_back();
+
+            const Cluster *pCluster(nullptr);
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Cluster::Create(*this, parameters, pCluster));
+            clusterVector.push_back(pCluster);
+            CompareClusterFits(pCluster);
+            continue;
+        }
+
+        const float operation(uniform(generator));
+        const unsigned int clusterIndex(static_cast<unsigned int>(uniform(generator) * clusterVector.size()) % clusterVector.size());
+        const Cluster *const pCluster(clusterVector[clusterIndex]);
+
+        if (operation < 0.7f)
+        {
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::AddToCluster(*this, pCluster, availableCaloHits.back()));
+            availableCaloHits.pop_back();
+        }
+        else if ((operation < 0.97f) && (pCluster->GetNCaloHits() > 1))
+        {
+            CaloHitList clusterCaloHits;
+            pCluster->GetOrderedCaloHitList().FillCaloHitList(clusterCaloHits);
+            CaloHitVector clusterCaloHitVector(clusterCaloHits.begin(), clusterCaloHits.end());
+
+            const CaloHit *const pCaloHit(clusterCaloHitVector[static_cast<unsigned int>(uniform(generator) * clusterCaloHitVector.size()) %
+                clusterCaloHitVector.size()]);
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RemoveFromCluster(*this, pCluster, pCaloHit));
+            availableCaloHits.insert(availableCaloHits.begin(), pCaloHit);
+        }
+        else
+        {
+            ClusterVector::iterator deleteIter(std::find_if(clusterVector.begin(), clusterVector.end(),
+                [pCluster](const Cluster *const pOtherCluster) { return (pOtherCluster != pCluster); }));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, pCluster, *deleteIter));
+            clusterVector.erase(deleteIter);
+        }
+
+        CompareClusterFits(pCluster);
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Create calo hits along straight tracks from near the origin, with gaussian scatter about the tracks. The tracks lie in a forward
+ *          cone, so that the summed cell normal vectors of calo hits from different tracks cannot cancel
+ *
+ *  @param  pandora the pandora instance
+ *  @param  nTracks the number of tracks
+ *  @param  nCaloHitsPerTrack the number of calo hits per track
+ */
+void CreateCaloHits(const Pandora &pandora, const unsigned int nTracks, const unsigned int nCaloHitsPerTrack)
+{
+    std::mt19937 generator(54321);
+    std::uniform_real_distribution<float> uniform(-1.f, 1.f);
+    std::normal_distribution<float> scatter(0.f, 10.f);
+
+    for (unsigned int iTrack = 0, iHit = 0; iTrack < nTracks; ++iTrack)
+    {
+        const CartesianVector direction(CartesianVector(uniform(generator), uniform(generator), 2.f).GetUnitVector());
+
+        for (unsigned int iTrackHit = 0; iTrackHit < nCaloHitsPerTrack; ++iTrackHit, ++iHit)
+        {
+            const float distance(1800.f + 600.f * (uniform(generator) + 1.f));
+            const CartesianVector offset(scatter(generator), scatter(generator), scatter(generator));
+            const CartesianVector position(direction * distance + offset);
+            const float cellSize(5.f + 10.f * (uniform(generator) + 1.f));
+
+            PandoraApi::CaloHit::Parameters parameters;
+            parameters.m_positionVector = position;
+            parameters.m_expectedDirection = position.GetUnitVector();
+            parameters.m_cellNormalVector = (iTrack % 2) ? position.GetUnitVector() : CartesianVector(0.f, 0.f, 1.f);
+            parameters.m_cellGeometry = RECTANGULAR;
+            parameters.m_cellSize0 = cellSize;
+            parameters.m_cellSize1 = cellSize;
+            parameters.m_cellThickness = 2.f;
+            parameters.m_nCellRadiationLengths = 0.5f;
+            parameters.m_nCellInteractionLengths = 0.05f;
+            parameters.m_time = 0.f;
+            parameters.m_inputEnergy = 0.1f + (uniform(generator) + 1.f);
+            parameters.m_mipEquivalentEnergy = 1.f;
+            parameters.m_electromagneticEnergy = parameters.m_inputEnergy.Get();
+            parameters.m_hadronicEnergy = parameters.m_inputEnergy.Get();
+            parameters.m_isDigital = false;
+            parameters.m_hitType = ECAL;
+            parameters.m_hitRegion = BARREL;
+            parameters.m_layer = 0;
+            parameters.m_isInOuterSamplingLayer = false;
+            parameters.m_pParentAddress = reinterpret_cast<const void *>(static_cast<std::uintptr_t>(iHit + 1));
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(pandora, parameters));
+        }
+    }
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main()
+{
+    const std::string settingsFileName("ClusterFitMomentsTest.xml");
+
+    try
+    {
+        std::ofstream settingsFile(settingsFileName);
+        settingsFile << "<pandora>\n    <algorithm type = \"ClusterFitMomentsTest\"/>\n</pandora>\n";
+        settingsFile.close();
+
+        const Pandora pandora;
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetPseudoLayerPlugin(pandora, new ShellPseudoLayerPlugin));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::RegisterAlgorithmFactory(pandora, "ClusterFitMomentsTest",
+            new ClusterFitMomentsTestAlgorithm::Factory));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ReadSettings(pandora, settingsFileName));
+        std::remove(settingsFileName.c_str());
+
+        CreateCaloHits(pandora, 20, 100);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(pandora));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(pandora));
+
+        std::cout << "ClusterFitMomentsTest: " << g_nComparisons << " fits compared" << std::endl;
+        Check(g_nComparisons > 1000, "fits are compared for many clusters, " + std::to_string(g_nComparisons) + " comparisons made");
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::remove(settingsFileName.c_str());
+        std::cout << "ClusterFitMomentsTest: unexpected exception: " << statusCodeException.ToString() << std::endl;
+        return 1;
+    }
+
+    if (0 != g_nFailures)
+    {
+        std::cout << "ClusterFitMomentsTest: " << g_nFailures << " checks failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << "ClusterFitMomentsTest: all checks passed" << std::endl;
+    return 0;
+}
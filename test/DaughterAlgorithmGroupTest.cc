@@ -0,0 +1,398 @@
+/**
+ *  @file   PandoraSDK/test/DaughterAlgorithmGroupTest.cc
+ *
+ *  @brief  Test of daughter algorithm groups, see PandoraContentApi::RunDaughterAlgorithmGroup. The partition of a group into stages is
+ *          checked, then groups of daughter algorithms that read and write saved calo hit lists are run by a parent algorithm: daughters
+ *          that read or write saved lists they have not declared, or that were created by another parent algorithm, must be rejected.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+#include "Api/PandoraContentApi.h"
+
+#include "Helpers/XmlHelper.h"
+
+#include "Pandora/Algorithm.h"
+#include "Pandora/DaughterAlgorithmGroup.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+using namespace pandora;
+
+namespace
+{
+
+unsigned int g_nFailures(0);                        ///< The number of failed checks
+StringVector g_runOrder;                            ///< The instance names of the daughter algorithms, in the order in which they ran
+std::vector<StatusCode> g_groupStatusCodes;         ///< The status codes returned by each run of a daughter algorithm group
+std::vector<StringVector> g_daughterNamesVector;    ///< The daughter algorithm instance names created by each parent algorithm
+
+typedef std::pair<StringVector, StringVector> Declaration;
+typedef std::vector<Declaration> DeclarationVector;
+
+/**
+ *  @brief  Record a failed check, if a condition does not hold
+ *
+ *  @param  condition the condition
+ *  @param  description the description of the check
+ */
+void Check(const bool condition, const std::string &description)
+{
+    if (condition)
+        return;
+
+    ++g_nFailures;
+    std::cout << "DaughterAlgorithmGroupTest: check failed: " << description << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  ListAccessAlgorithm class, reading and writing configured saved calo hit lists
+ */
+class ListAccessAlgorithm : public Algorithm
+{
+public:
+    /**
+     *  @brief  Factory class for instantiating algorithm
+     */
+    class Factory : public AlgorithmFactory
+    {
+    public:
+        Algorithm *CreateAlgorithm() const;
+    };
+
+private:
+    StatusCode Run();
+    StatusCode ReadSettings(const TiXmlHandle xmlHandle);
+
+    StringVector    m_readListNames;        ///< The names of the saved calo hit lists to read
+    StringVector    m_writeListNames;       ///< The names of the saved calo hit lists to write
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  GroupParentAlgorithm class, running its daughter algorithms as a group with the declarations provided by its factory
+ */
+class GroupParentAlgorithm : public Algorithm
+{
+public:
+    /**
+     *  @brief  Factory class for instantiating algorithm
+     */
+    class Factory : public AlgorithmFactory
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  declarationVector the declared input and output list names, for each daughter algorithm in turn
+         */
+        Factory(const DeclarationVector &declarationVector);
+
+        Algorithm *CreateAlgorithm() const;
+
+    private:
+        const DeclarationVector m_declarationVector;    ///< The declared input and output list names of each daughter algorithm
+    };
+
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  declarationVector the declared input and output list names, for each daughter algorithm in turn
+     */
+    GroupParentAlgorithm(const DeclarationVector &declarationVector);
+
+private:
+    StatusCode Run();
+    StatusCode ReadSettings(const TiXmlHandle xmlHandle);
+
+    const DeclarationVector m_declarationVector;        ///< The declared input and output list names of each daughter algorithm
+    StringVector            m_daughterAlgorithmNames;   ///< The daughter algorithm instance names
+    bool                    m_useFirstParentDaughters;  ///< Whether to run the daughters of the first parent algorithm, not its own
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+Algorithm *ListAccessAlgorithm::Factory::CreateAlgorithm() const
+{
+    return new ListAccessAlgorithm;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ListAccessAlgorithm::Run()
+{
+    g_runOrder.push_back(this->GetInstanceName());
+
+    for (const std::string &listName : m_readListNames)
+    {
+        const CaloHitList *pCaloHitList(nullptr);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*this, listName, pCaloHitList));
+    }
+
+    for (const std::string &listName : m_writeListNames)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::SaveList(*this, CaloHitList(), listName));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ListAccessAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadVectorOfValues(xmlHandle,
+        "ReadListNames", m_readListNames));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadVectorOfValues(xmlHandle,
+        "WriteListNames", m_writeListNames));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+GroupParentAlgorithm::Factory::Factory(const DeclarationVector &declarationVector) :
+    m_declarationVector(declarationVector)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+Algorithm *GroupParentAlgorithm::Factory::CreateAlgorithm() const
+{
+    return new GroupParentAlgorithm(m_declarationVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+GroupParentAlgorithm::GroupParentAlgorithm(const DeclarationVector &declarationVector) :
+    m_declarationVector(declarationVector),
+    m_useFirstParentDaughters(false)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode GroupParentAlgorithm::Run()
+{
+    const StringVector &daughterAlgorithmNames(m_useFirstParentDaughters ? g_daughterNamesVector.front() : m_daughterAlgorithmNames);
+
+    if (daughterAlgorithmNames.size() != m_declarationVector.size())
+        return STATUS_CODE_INVALID_PARAMETER;
+
+    DaughterAlgorithmGroup daughterAlgorithmGroup;
+
+    for (unsigned int iDaughter = 0; iDaughter < daughterAlgorithmNames.size(); ++iDaughter)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, daughterAlgorithmGroup.AddDaughterAlgorithm(daughterAlgorithmNames[iDaughter],
+            m_declarationVector[iDaughter].first, m_declarationVector[iDaughter].second));
+    }
+
+    g_groupStatusCodes.push_back(PandoraContentApi::RunDaughterAlgorithmGroup(*this, daughterAlgorithmGroup));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode GroupParentAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ProcessAlgorithmList(*this, xmlHandle, "Daughters", m_daughterAlgorithmNames));
+    g_daughterNamesVector.push_back(m_daughterAlgorithmNames);
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "UseFirstParentDaughters", m_useFirstParentDaughters));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Get the xml description of a list access daughter algorithm
+ *
+ *  @param  readListNames the names of the saved calo hit lists the algorithm reads
+ *  @param  writeListNames the names of the saved calo hit lists the algorithm writes
+ *
+ *  @return the xml description
+ */
+std::string GetDaughterSettings(const std::string &readListNames, const std::string &writeListNames)
+{
+    std::string settings("<algorithm type = \"ListAccess\">");
+
+    if (!readListNames.empty())
+        settings += "<ReadListNames>" + readListNames + "</ReadListNames>";
+
+    if (!writeListNames.empty())
+        settings += "<WriteListNames>" + writeListNames + "</WriteListNames>";
+
+    return settings + "</algorithm>";
+}
+
+/**
+ *  @brief  Process an event with group parent algorithms, each configured with the same daughter algorithms and declarations
+ *
+ *  @param  daughterSettings the xml description of the daughter algorithms of each parent algorithm
+ *  @param  declarationVector the declared input and output list names, for each daughter algorithm in turn
+ *  @param  nParents the number of parent algorithms; parents after the first attempt to run the daughters of the first parent
+ */
+void ProcessEvent(const std::string &daughterSettings, const DeclarationVector &declarationVector, const unsigned int nParents = 1)
+{
+    g_runOrder.clear();
+    g_groupStatusCodes.clear();
+    g_daughterNamesVector.clear();
+
+    const std::string settingsFileName("DaughterAlgorithmGroupTest.xml");
+
+    {
+        std::ofstream settingsFile(settingsFileName);
+        settingsFile << "<pandora>\n";
+
+        for (unsigned int iParent = 0; iParent < nParents; ++iParent)
+        {
+            settingsFile << "    <algorithm type = \"GroupParent\"><Daughters>" << daughterSettings << "</Daughters><UseFirstParentDaughters>"
+                         << ((iParent > 0) ? "true" : "false") << "</UseFirstParentDaughters></algorithm>\n";
+        }
+
+        settingsFile << "</pandora>\n";
+    }
+
+    const Pandora *const pPandora(new Pandora);
+
+    try
+    {
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::RegisterAlgorithmFactory(*pPandora, "ListAccess", new ListAccessAlgorithm::Factory));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::RegisterAlgorithmFactory(*pPandora, "GroupParent",
+            new GroupParentAlgorithm::Factory(declarationVector)));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ReadSettings(*pPandora, settingsFileName));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pPandora));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pPandora));
+    }
+    catch (const StatusCodeException &)
+    {
+        delete pPandora;
+        std::remove(settingsFileName.c_str());
+        throw;
+    }
+
+    delete pPandora;
+    std::remove(settingsFileName.c_str());
+}
+
+/**
+ *  @brief  Check the partition of a daughter algorithm group into stages, without running it
+ */
+void TestStages()
+{
+    DaughterAlgorithmGroup daughterAlgorithmGroup;
+    Check(STATUS_CODE_SUCCESS == daughterAlgorithmGroup.AddDaughterAlgorithm("D0", {}, {"A"}), "daughter 0 is added");
+    Check(STATUS_CODE_SUCCESS == daughterAlgorithmGroup.AddDaughterAlgorithm("D1", {"A"}, {"B"}), "daughter 1 is added");
+    Check(STATUS_CODE_SUCCESS == daughterAlgorithmGroup.AddDaughterAlgorithm("D2", {"Z"}, {"C"}), "daughter 2 is added");
+    Check(STATUS_CODE_SUCCESS == daughterAlgorithmGroup.AddDaughterAlgorithm("D3", {"B"}, {}), "daughter 3 is added");
+    Check(STATUS_CODE_SUCCESS == daughterAlgorithmGroup.AddDaughterAlgorithm("D4", {"Z"}, {}), "daughter 4 is added");
+    Check(STATUS_CODE_SUCCESS == daughterAlgorithmGroup.AddDaughterAlgorithm("D5", {}, {"C"}), "daughter 5 is added");
+    Check(STATUS_CODE_ALREADY_PRESENT == daughterAlgorithmGroup.AddDaughterAlgorithm("D0", {}, {}), "a repeated daughter is rejected");
+
+    DaughterAlgorithmGroup::StageVector stageVector;
+    daughterAlgorithmGroup.GetStages(stageVector);
+
+    // ATTN Readers of a common list share a stage; a writer follows every earlier reader or writer of the same list
+    const DaughterAlgorithmGroup::StageVector expectedStageVector{{"D0", "D2", "D4"}, {"D1", "D5"}, {"D3"}};
+    Check(expectedStageVector == stageVector, "daughters are partitioned into the expected stages");
+
+    Check(StringSet{"A"} == daughterAlgorithmGroup.GetInputListNames("D1"), "input list names are returned");
+    Check(StringSet{"B"} == daughterAlgorithmGroup.GetOutputListNames("D1"), "output list names are returned");
+
+    try
+    {
+        daughterAlgorithmGroup.GetOutputListNames("D6");
+        Check(false, "an unknown daughter is reported");
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        Check(STATUS_CODE_NOT_FOUND == statusCodeException.GetStatusCode(), "an unknown daughter is reported as not found");
+    }
+}
+
+/**
+ *  @brief  Check that daughters declaring all the saved lists they access run successfully, stage by stage
+ */
+void TestDeclaredAccess()
+{
+    ProcessEvent(GetDaughterSettings("", "A") + GetDaughterSettings("A", "B") + GetDaughterSettings("", "C"),
+        {{{}, {"A"}}, {{"A"}, {"B"}}, {{}, {"C"}}});
+
+    const StringVector &daughterNames(g_daughterNamesVector.front());
+    Check((1 == g_groupStatusCodes.size()) && (STATUS_CODE_SUCCESS == g_groupStatusCodes.front()), "declared accesses are allowed");
+    Check(StringVector{daughterNames[0], daughterNames[2], daughterNames[1]} == g_runOrder, "daughters run stage by stage");
+}
+
+/**
+ *  @brief  Check that daughters reading or writing saved lists they have not declared are rejected
+ */
+void TestUndeclaredAccess()
+{
+    ProcessEvent(GetDaughterSettings("", "A") + GetDaughterSettings("", "A"), {{{}, {"A"}}, {{"A"}, {}}});
+    Check((1 == g_groupStatusCodes.size()) && (STATUS_CODE_NOT_ALLOWED == g_groupStatusCodes.front()),
+        "an undeclared write to an existing saved list is rejected");
+    Check(2 == g_runOrder.size(), "the undeclared write is only detected once the daughter has run");
+
+    ProcessEvent(GetDaughterSettings("", "A") + GetDaughterSettings("A", ""), {{{}, {"A"}}, {{}, {}}});
+    Check((1 == g_groupStatusCodes.size()) && (STATUS_CODE_NOT_ALLOWED == g_groupStatusCodes.front()), "an undeclared read is rejected");
+
+    ProcessEvent(GetDaughterSettings("", "A") + GetDaughterSettings("", "B"), {{{}, {"A"}}, {{}, {}}});
+    Check((1 == g_groupStatusCodes.size()) && (STATUS_CODE_NOT_ALLOWED == g_groupStatusCodes.front()),
+        "an undeclared new saved list is rejected");
+
+    ProcessEvent(GetDaughterSettings("", "A") + GetDaughterSettings("", "A"), {{{}, {"A"}}, {{}, {"A"}}});
+    Check((1 == g_groupStatusCodes.size()) && (STATUS_CODE_SUCCESS == g_groupStatusCodes.front()),
+        "writes to a commonly declared output list are allowed");
+}
+
+/**
+ *  @brief  Check that a parent algorithm may only run its own daughters as a group
+ */
+void TestParentage()
+{
+    ProcessEvent(GetDaughterSettings("", "A"), {{{}, {"A"}}}, 2);
+    Check((2 == g_groupStatusCodes.size()) && (STATUS_CODE_SUCCESS == g_groupStatusCodes.front()), "the first parent runs its daughter");
+    Check((2 == g_groupStatusCodes.size()) && (STATUS_CODE_NOT_ALLOWED == g_groupStatusCodes.back()),
+        "the second parent may not run the daughter of the first parent");
+    Check(1 == g_runOrder.size(), "the daughter of the first parent is not run by the second parent");
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main()
+{
+    try
+    {
+        TestStages();
+        TestDeclaredAccess();
+        TestUndeclaredAccess();
+        TestParentage();
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "DaughterAlgorithmGroupTest: unexpected exception: " << statusCodeException.ToString() << std::endl;
+        return 1;
+    }
+
+    if (0 != g_nFailures)
+    {
+        std::cout << "DaughterAlgorithmGroupTest: " << g_nFailures << " checks failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << "DaughterAlgorithmGroupTest: all checks passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,379 @@
+/**
+ *  @file   PandoraSDK/test/DetectorGapIndexTest.cc
+ *
+ *  @brief  Test of the detector gap index, see GeometryManager::IsInAnyGap. Results are compared with a linear scan of the detector gap
+ *          list, for positions sampled near the gap boundaries and for a range of gap tolerances. Comparisons are made before the gaps are
+ *          indexed, after indexing when an event is processed, and when gaps are added to an existing index.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+
+#include "Geometry/DetectorGap.h"
+
+#include "Managers/GeometryManager.h"
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace pandora;
+
+namespace
+{
+
+unsigned int g_nFailures(0);            ///< The number of failed checks
+unsigned int g_nQueries(0);             ///< The number of queries compared
+unsigned int g_nInGap(0);               ///< The number of queries compared for positions in a gap
+
+const float g_gapTolerances[] = {0.f, 0.5f, 2.f, 10.f};    ///< The gap tolerances, units mm
+
+typedef std::vector<HitType> HitTypeVector;
+
+/**
+ *  @brief  Record a failed check, if a condition does not hold
+ *
+ *  @param  condition the condition
+ *  @param  description the description of the check
+ */
+void Check(const bool condition, const std::string &description)
+{
+    if (condition)
+        return;
+
+    ++g_nFailures;
+    std::cout << "DetectorGapIndexTest: check failed: " << description << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Get a random float in a specified range
+ *
+ *  @param  generator the random number generator
+ *  @param  low the lower limit
+ *  @param  high the upper limit
+ *
+ *  @return the random float
+ */
+float GetRandom(std::mt19937 &generator, const float low, const float high)
+{
+    return std::uniform_real_distribution<float>(low, high)(generator);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Get a random coordinate, chosen to lie at or near a specified edge
+ *
+ *  @param  generator the random number generator
+ *  @param  edge the edge coordinate
+ *
+ *  @return the coordinate
+ */
+float GetCoordinateNearEdge(std::mt19937 &generator, const float edge)
+{
+    static const float offsets[] = {0.f, 0.f, -0.5f, 0.5f, -2.f, 2.f, -10.f, 10.f, -1.e-3f, 1.e-3f};
+    const float offset(offsets[generator() % (sizeof(offsets) / sizeof(offsets[0]))]);
+
+    return (0 == generator() % 4) ? edge + GetRandom(generator, -15.f, 15.f) : edge + offset;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Create random box gaps: axis aligned, rotated and skewed, including boxes whose sides are parallel
+ *
+ *  @param  pandora the pandora instance
+ *  @param  generator the random number generator
+ *  @param  nGaps the number of gaps
+ *  @param  positionVectors to receive positions near the gap boundaries
+ */
+void CreateBoxGaps(const Pandora &pandora, std::mt19937 &generator, const unsigned int nGaps, CartesianPointVector &positionVectors)
+{
+    for (unsigned int iGap = 0; iGap < nGaps; ++iGap)
+    {
+        const CartesianVector vertex(GetRandom(generator, -1000.f, 1000.f), GetRandom(generator, -1000.f, 1000.f),
+            GetRandom(generator, -1000.f, 1000.f));
+        const float lengths[3] = {GetRandom(generator, 1.f, 100.f), GetRandom(generator, 1.f, 100.f), GetRandom(generator, 1.f, 100.f)};
+        const unsigned int boxType(iGap % 4);
+
+        CartesianVector unitSides[3] = {CartesianVector(1.f, 0.f, 0.f), CartesianVector(0.f, 1.f, 0.f), CartesianVector(0.f, 0.f, 1.f)};
+
+        if (boxType > 0)
+        {
+            const CartesianVector axis(CartesianVector(GetRandom(generator, -1.f, 1.f), GetRandom(generator, -1.f, 1.f),
+                1.f).GetUnitVector());
+            const CartesianVector perpendicular(axis.GetCrossProduct(CartesianVector(1.f, 0.f, 0.f)).GetUnitVector());
+            unitSides[0] = axis;
+            unitSides[1] = perpendicular;
+            unitSides[2] = axis.GetCrossProduct(perpendicular);
+        }
+
+        if (2 == boxType)
+            unitSides[2] = (unitSides[2] + unitSides[0] * GetRandom(generator, 0.2f, 0.8f)).GetUnitVector();
+
+        if (3 == boxType)
+            unitSides[2] = unitSides[0] * -1.f;
+
+        PandoraApi::Geometry::BoxGap::Parameters parameters;
+        parameters.m_vertex = vertex;
+        parameters.m_side1 = unitSides[0] * lengths[0];
+        parameters.m_side2 = unitSides[1] * lengths[1];
+        parameters.m_side3 = unitSides[2] * lengths[2];
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Geometry::BoxGap::Create(pandora, parameters));
+
+        for (unsigned int iPosition = 0; iPosition < 20; ++iPosition)
+        {
+            CartesianVector positionVector(vertex);
+
+            for (unsigned int iSide = 0; iSide < 3; ++iSide)
+            {
+                const float fraction((0 == generator() % 2) ? GetRandom(generator, 0.f, 1.f) : static_cast<float>(generator() % 2));
+                positionVector += unitSides[iSide] * GetCoordinateNearEdge(generator, fraction * lengths[iSide]);
+            }
+
+            positionVectors.push_back(positionVector);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Create random concentric gaps, with a range of symmetry orders and phi coordinates
+ *
+ *  @param  pandora the pandora instance
+ *  @param  generator the random number generator
+ *  @param  nGaps the number of gaps
+ *  @param  positionVectors to receive positions near the gap boundaries
+ */
+void CreateConcentricGaps(const Pandora &pandora, std::mt19937 &generator, const unsigned int nGaps, CartesianPointVector &positionVectors)
+{
+    for (unsigned int iGap = 0; iGap < nGaps; ++iGap)
+    {
+        const float minZ(GetRandom(generator, -1000.f, 900.f)), innerR(GetRandom(generator, 100.f, 1500.f));
+
+        PandoraApi::Geometry::ConcentricGap::Parameters parameters;
+        parameters.m_minZCoordinate = minZ;
+        parameters.m_maxZCoordinate = minZ + GetRandom(generator, 1.f, 100.f);
+        parameters.m_innerRCoordinate = innerR;
+        parameters.m_innerPhiCoordinate = GetRandom(generator, 0.f, 1.f);
+        parameters.m_innerSymmetryOrder = 3 + generator() % 10;
+        parameters.m_outerRCoordinate = innerR + GetRandom(generator, 10.f, 100.f);
+        parameters.m_outerPhiCoordinate = GetRandom(generator, 0.f, 1.f);
+        parameters.m_outerSymmetryOrder = 3 + generator() % 10;
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Geometry::ConcentricGap::Create(pandora, parameters));
+
+        for (unsigned int iPosition = 0; iPosition < 20; ++iPosition)
+        {
+            const float r((0 == generator() % 2) ? GetCoordinateNearEdge(generator, parameters.m_innerRCoordinate.Get()) :
+                GetCoordinateNearEdge(generator, parameters.m_outerRCoordinate.Get()));
+            const float minZEdge(parameters.m_minZCoordinate.Get()), maxZEdge(parameters.m_maxZCoordinate.Get());
+            const float z((0 == generator() % 2) ? GetRandom(generator, minZEdge, maxZEdge) :
+                GetCoordinateNearEdge(generator, (0 == generator() % 2) ? minZEdge : maxZEdge));
+            const float phi(GetRandom(generator, 0.f, 6.2832f));
+
+            positionVectors.push_back(CartesianVector(r * std::cos(phi), r * std::sin(phi), z));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Create random line gaps of each type, many overlapping and some nested within others
+ *
+ *  @param  pandora the pandora instance
+ *  @param  generator the random number generator
+ *  @param  nGaps the number of gaps
+ *  @param  positionVectors to receive positions near the gap boundaries
+ */
+void CreateLineGaps(const Pandora &pandora, std::mt19937 &generator, const unsigned int nGaps, CartesianPointVector &positionVectors)
+{
+    const LineGapType lineGapTypes[] = {TPC_WIRE_GAP_VIEW_U, TPC_WIRE_GAP_VIEW_V, TPC_WIRE_GAP_VIEW_W, TPC_DRIFT_GAP};
+
+    for (unsigned int iGap = 0; iGap < nGaps; ++iGap)
+    {
+        const float startX(GetRandom(generator, -1000.f, 1000.f)), startZ(GetRandom(generator, -1000.f, 1000.f));
+        const float maxLength((0 == iGap % 10) ? 500.f : 20.f);
+
+        PandoraApi::Geometry::LineGap::Parameters parameters;
+        parameters.m_lineGapType = lineGapTypes[iGap % 4];
+        parameters.m_lineStartX = startX;
+        parameters.m_lineEndX = startX + GetRandom(generator, 0.f, maxLength);
+        parameters.m_lineStartZ = startZ;
+        parameters.m_lineEndZ = startZ + GetRandom(generator, 0.f, maxLength);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Geometry::LineGap::Create(pandora, parameters));
+
+        for (unsigned int iPosition = 0; iPosition < 20; ++iPosition)
+        {
+            const float x(GetCoordinateNearEdge(generator, (0 == generator() % 2) ? parameters.m_lineStartX.Get() :
+                parameters.m_lineEndX.Get()));
+            const float z(GetCoordinateNearEdge(generator, (0 == generator() % 2) ? parameters.m_lineStartZ.Get() :
+                parameters.m_lineEndZ.Get()));
+            positionVectors.push_back(CartesianVector(x, GetRandom(generator, -1000.f, 1000.f), z));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Compare the detector gap index with a linear scan of the detector gap list, for single and batch queries
+ *
+ *  @param  pandora the pandora instance
+ *  @param  positionVectors the query positions
+ *  @param  hitTypes the hit types with which to query
+ *  @param  stage the description of the stage of the test
+ */
+void CompareQueries(const Pandora &pandora, const CartesianPointVector &positionVectors, const HitTypeVector &hitTypes,
+    const std::string &stage)
+{
+    const GeometryManager *const pGeometryManager(pandora.GetGeometry());
+    unsigned int nMismatches(0);
+
+    for (const HitType hitType : hitTypes)
+    {
+        for (const float gapTolerance : g_gapTolerances)
+        {
+            BoolVector isInGapVector;
+            pGeometryManager->IsInAnyGap(positionVectors, hitType, gapTolerance, isInGapVector);
+            Check(isInGapVector.size() == positionVectors.size(), stage + ": batch query gives a result per position");
+
+            for (unsigned int iPosition = 0; iPosition < positionVectors.size(); ++iPosition)
+            {
+                const CartesianVector &positionVector(positionVectors.at(iPosition));
+                bool isInGap(false);
+
+                for (const DetectorGap *const pDetectorGap : pGeometryManager->GetDetectorGapList())
+                {
+                    if (pDetectorGap->IsInGap(positionVector, hitType, gapTolerance))
+                    {
+                        isInGap = true;
+                        break;
+                    }
+                }
+
+                if ((isInGap != pGeometryManager->IsInAnyGap(positionVector, hitType, gapTolerance)) ||
+                    (isInGapVector.size() != positionVectors.size()) || (isInGap != isInGapVector.at(iPosition)))
+                {
+                    ++nMismatches;
+                }
+
+                ++g_nQueries;
+
+                if (isInGap)
+                    ++g_nInGap;
+            }
+        }
+    }
+
+    Check(0 == nMismatches, stage + ": detector gap index matches linear scan of gaps");
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Whether querying the detector gap index with a specified hit type raises an invalid parameter exception
+ *
+ *  @param  pandora the pandora instance
+ *  @param  hitType the hit type
+ *
+ *  @return boolean
+ */
+bool IsQueryRejected(const Pandora &pandora, const HitType hitType)
+{
+    try
+    {
+        (void) pandora.GetGeometry()->IsInAnyGap(CartesianVector(0.f, 0.f, 0.f), hitType);
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        return (STATUS_CODE_INVALID_PARAMETER == statusCodeException.GetStatusCode());
+    }
+
+    return false;
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main()
+{
+    try
+    {
+        std::mt19937 generator(24680);
+        const HitTypeVector volumeHitTypes = {ECAL, HCAL, TPC_3D};
+        const HitTypeVector lineHitTypes = {TPC_VIEW_U, TPC_VIEW_V, TPC_VIEW_W, TPC_3D};
+
+        // Box and concentric gaps, queried before and after indexing, then with further gaps added to an existing index
+        const Pandora volumePandora;
+        CartesianPointVector volumePositions;
+        CreateBoxGaps(volumePandora, generator, 200, volumePositions);
+        CreateConcentricGaps(volumePandora, generator, 50, volumePositions);
+        CompareQueries(volumePandora, volumePositions, volumeHitTypes, "volume gaps not indexed");
+
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(volumePandora));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(volumePandora));
+        CompareQueries(volumePandora, volumePositions, volumeHitTypes, "volume gaps indexed");
+
+        CreateBoxGaps(volumePandora, generator, 20, volumePositions);
+        CreateConcentricGaps(volumePandora, generator, 5, volumePositions);
+        CompareQueries(volumePandora, volumePositions, volumeHitTypes, "volume gaps added to index");
+
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(volumePandora));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(volumePandora));
+        CompareQueries(volumePandora, volumePositions, volumeHitTypes, "volume gaps indexed again");
+        Check(IsQueryRejected(volumePandora, TPC_VIEW_U), "volume gaps reject 2D tpc hit types");
+
+        // Line gaps of each type, queried with each tpc hit type
+        const Pandora linePandora;
+        CartesianPointVector linePositions;
+        CreateLineGaps(linePandora, generator, 200, linePositions);
+        CompareQueries(linePandora, linePositions, lineHitTypes, "line gaps not indexed");
+
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(linePandora));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(linePandora));
+        CompareQueries(linePandora, linePositions, lineHitTypes, "line gaps indexed");
+
+        CreateLineGaps(linePandora, generator, 20, linePositions);
+        CompareQueries(linePandora, linePositions, lineHitTypes, "line gaps added to index");
+        Check(IsQueryRejected(linePandora, ECAL), "line gaps reject non-tpc hit types");
+
+        // Line gaps alongside box and concentric gaps, queried with 3D tpc hits
+        const Pandora mixedPandora;
+        CartesianPointVector mixedPositions;
+        CreateLineGaps(mixedPandora, generator, 40, mixedPositions);
+        CreateBoxGaps(mixedPandora, generator, 40, mixedPositions);
+        CreateConcentricGaps(mixedPandora, generator, 10, mixedPositions);
+
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(mixedPandora));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(mixedPandora));
+        CompareQueries(mixedPandora, mixedPositions, {TPC_3D}, "line and volume gaps indexed");
+        Check(IsQueryRejected(mixedPandora, TPC_VIEW_W), "line and volume gaps reject 2D tpc hit types");
+        Check(IsQueryRejected(mixedPandora, HCAL), "line and volume gaps reject non-tpc hit types");
+
+        std::cout << "DetectorGapIndexTest: " << g_nQueries << " queries compared, " << g_nInGap << " in a gap" << std::endl;
+        Check(g_nInGap > g_nQueries / 10, "many query positions are in a gap");
+        Check(g_nInGap < g_nQueries - g_nQueries / 10, "many query positions are outside all gaps");
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "DetectorGapIndexTest: unexpected exception: " << statusCodeException.ToString() << std::endl;
+        return 1;
+    }
+
+    if (0 != g_nFailures)
+    {
+        std::cout << "DetectorGapIndexTest: " << g_nFailures << " checks failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << "DetectorGapIndexTest: all checks passed" << std::endl;
+    return 0;
+}
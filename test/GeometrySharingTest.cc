@@ -0,0 +1,213 @@
+/**
+ *  @file   PandoraSDK/test/GeometrySharingTest.cc
+ *
+ *  @brief  Test of geometry sharing between pandora instances, see PandoraApi::ShareGeometry. Several instances share the geometry of a
+ *          source instance and query it concurrently from their own threads, the shared geometry is checked to be immutable, and the
+ *          instances are deleted in an order that leaves the last reference to the geometry with a target instance.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+
+#include "Geometry/SubDetector.h"
+
+#include "Managers/GeometryManager.h"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace pandora;
+
+namespace
+{
+
+std::atomic<unsigned int> g_nFailures(0); ///< The number of failed checks
+
+/**
+ *  @brief  Record a failed check, if a condition does not hold
+ *
+ *  @param  condition the condition
+ *  @param  description the description of the check
+ */
+void Check(const bool condition, const std::string &description)
+{
+    if (condition)
+        return;
+
+    ++g_nFailures;
+    std::cout << "GeometrySharingTest: check failed: " << description << std::endl;
+}
+
+/**
+ *  @brief  Get parameters for a two-layer sub detector
+ *
+ *  @param  subDetectorName the sub detector name
+ *  @param  innerRCoordinate the inner r coordinate, units mm
+ *
+ *  @return the sub detector parameters
+ */
+PandoraApi::Geometry::SubDetector::Parameters GetSubDetectorParameters(const std::string &subDetectorName, const float innerRCoordinate)
+{
+    PandoraApi::Geometry::SubDetector::Parameters parameters;
+    parameters.m_subDetectorName = subDetectorName;
+    parameters.m_subDetectorType = ECAL_BARREL;
+    parameters.m_innerRCoordinate = innerRCoordinate;
+    parameters.m_innerZCoordinate = 0.f;
+    parameters.m_innerPhiCoordinate = 0.f;
+    parameters.m_innerSymmetryOrder = 8;
+    parameters.m_outerRCoordinate = innerRCoordinate + 200.f;
+    parameters.m_outerZCoordinate = 2000.f;
+    parameters.m_outerPhiCoordinate = 0.f;
+    parameters.m_outerSymmetryOrder = 8;
+    parameters.m_isMirroredInZ = false;
+    parameters.m_nLayers = 2;
+
+    for (unsigned int iLayer = 0; iLayer < 2; ++iLayer)
+    {
+        PandoraApi::Geometry::LayerParameters layerParameters;
+        layerParameters.m_closestDistanceToIp = innerRCoordinate + 100.f * iLayer;
+        layerParameters.m_nRadiationLengths = 1.f;
+        layerParameters.m_nInteractionLengths = 0.1f;
+        parameters.m_layerParametersVector.push_back(layerParameters);
+    }
+
+    return parameters;
+}
+
+/**
+ *  @brief  Get parameters for a unit box gap at a specified position
+ *
+ *  @param  vertex the gap vertex
+ *
+ *  @return the box gap parameters
+ */
+PandoraApi::Geometry::BoxGap::Parameters GetBoxGapParameters(const CartesianVector &vertex)
+{
+    PandoraApi::Geometry::BoxGap::Parameters parameters;
+    parameters.m_vertex = vertex;
+    parameters.m_side1 = CartesianVector(10.f, 0.f, 0.f);
+    parameters.m_side2 = CartesianVector(0.f, 10.f, 0.f);
+    parameters.m_side3 = CartesianVector(0.f, 0.f, 10.f);
+
+    return parameters;
+}
+
+/**
+ *  @brief  Query the geometry of a pandora instance repeatedly, checking the results against the source geometry
+ *
+ *  @param  pPandora address of the pandora instance
+ *  @param  nQueries the number of queries
+ */
+void QueryGeometry(const Pandora *const pPandora, const unsigned int nQueries)
+{
+    const GeometryManager *const pGeometryManager(pPandora->GetGeometry());
+    unsigned int nErrors(0);
+
+    for (unsigned int iQuery = 0; iQuery < nQueries; ++iQuery)
+    {
+        const float offset(static_cast<float>(iQuery % 10));
+
+        if (!pGeometryManager->IsShared() || (1 != pGeometryManager->GetSubDetectorMap().size()) ||
+            (1500.f != pGeometryManager->GetSubDetector("EcalBarrel").GetInnerRCoordinate()) ||
+            (COARSE != pGeometryManager->GetHitTypeGranularity(ECAL)) || (2 != pGeometryManager->GetDetectorGapList().size()) ||
+            !pGeometryManager->IsInAnyGap(CartesianVector(offset, 5.f, 5.f), ECAL) ||
+            !pGeometryManager->IsInAnyGap(CartesianVector(100.f + offset, 105.f, 105.f), ECAL) ||
+            pGeometryManager->IsInAnyGap(CartesianVector(50.f + offset, 50.f, 50.f), ECAL))
+        {
+            ++nErrors;
+        }
+    }
+
+    Check(0 == nErrors, "concurrent queries of the shared geometry match the source geometry");
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main()
+{
+    const unsigned int nTargets(4), nQueries(20000);
+
+    try
+    {
+        Pandora *const pSourcePandora(new Pandora);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            PandoraApi::Geometry::SubDetector::Create(*pSourcePandora, GetSubDetectorParameters("EcalBarrel", 1500.f)));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            PandoraApi::Geometry::BoxGap::Create(*pSourcePandora, GetBoxGapParameters(CartesianVector(0.f, 0.f, 0.f))));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+            PandoraApi::Geometry::BoxGap::Create(*pSourcePandora, GetBoxGapParameters(CartesianVector(100.f, 100.f, 100.f))));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetHitTypeGranularity(*pSourcePandora, ECAL, COARSE));
+        Check(!pSourcePandora->GetGeometry()->IsShared(), "geometry is not shared before sharing");
+
+        // Targets with geometry of their own, to be released on sharing
+        std::vector<Pandora *> targetPandoraVector;
+
+        for (unsigned int iTarget = 0; iTarget < nTargets; ++iTarget)
+        {
+            Pandora *const pTargetPandora(new Pandora);
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+                PandoraApi::Geometry::SubDetector::Create(*pTargetPandora, GetSubDetectorParameters("TargetBarrel", 100.f)));
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ShareGeometry(*pSourcePandora, *pTargetPandora));
+            targetPandoraVector.push_back(pTargetPandora);
+        }
+
+        Check(STATUS_CODE_INVALID_PARAMETER == PandoraApi::ShareGeometry(*pSourcePandora, *pSourcePandora), "sharing with self is rejected");
+        Check(STATUS_CODE_SUCCESS == PandoraApi::ShareGeometry(*pSourcePandora, *targetPandoraVector.front()), "sharing again is harmless");
+        Check(pSourcePandora->GetGeometry()->IsShared(), "source geometry is shared");
+
+        // The shared geometry is immutable, whether modified through the source or a target instance
+        for (const Pandora *const pPandora : {static_cast<const Pandora *>(pSourcePandora), static_cast<const Pandora *>(targetPandoraVector.back())})
+        {
+            Check(STATUS_CODE_NOT_ALLOWED == PandoraApi::Geometry::SubDetector::Create(*pPandora, GetSubDetectorParameters("HcalBarrel", 1800.f)),
+                "sub detector creation is not allowed after sharing");
+            Check(STATUS_CODE_NOT_ALLOWED == PandoraApi::Geometry::BoxGap::Create(*pPandora, GetBoxGapParameters(CartesianVector(50.f, 50.f, 50.f))),
+                "gap creation is not allowed after sharing");
+            Check(STATUS_CODE_NOT_ALLOWED == PandoraApi::SetHitTypeGranularity(*pPandora, ECAL, FINE), "granularity change is not allowed after sharing");
+        }
+
+        // Query the shared geometry from each target instance in its own thread, while the source instance is deleted
+        std::vector<std::thread> threadVector;
+
+        for (const Pandora *const pTargetPandora : targetPandoraVector)
+            threadVector.emplace_back(QueryGeometry, pTargetPandora, nQueries);
+
+        delete pSourcePandora;
+
+        for (std::thread &thread : threadVector)
+            thread.join();
+
+        // Delete the target instances concurrently, so that the last reference to the shared geometry is released from any thread
+        threadVector.clear();
+
+        for (Pandora *const pTargetPandora : targetPandoraVector)
+        {
+            threadVector.emplace_back([pTargetPandora]() {
+                QueryGeometry(pTargetPandora, nQueries / 10);
+                delete pTargetPandora;
+            });
+        }
+
+        for (std::thread &thread : threadVector)
+            thread.join();
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "GeometrySharingTest: unexpected exception: " << statusCodeException.ToString() << std::endl;
+        return 1;
+    }
+
+    if (0 != g_nFailures)
+    {
+        std::cout << "GeometrySharingTest: " << g_nFailures << " checks failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << "GeometrySharingTest: all checks passed" << std::endl;
+    return 0;
+}
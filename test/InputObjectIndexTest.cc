@@ -0,0 +1,467 @@
+/**
+ *  @file   PandoraSDK/test/InputObjectIndexTest.cc
+ *
+ *  @brief  Test of the dense per-event indices of input objects, see CaloHit::GetIndex, Track::GetIndex, MCParticle::GetIndex and
+ *          PandoraContentApi::GetNIndices. Several events, with differing numbers of calo hits, tracks and mc particles, are processed in
+ *          turn; the indices are checked to follow creation order and to restart from zero in each event, with fresh indices issued to
+ *          calo hit fragments and merged calo hits.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+#include "Api/PandoraContentApi.h"
+
+#include "Objects/CaloHit.h"
+#include "Objects/CaloHitBlock.h"
+#include "Objects/MCParticle.h"
+#include "Objects/Track.h"
+
+#include "Pandora/Algorithm.h"
+
+#include "Plugins/PseudoLayerPlugin.h"
+
+#include "Xml/tinyxml.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+using namespace pandora;
+
+namespace
+{
+
+unsigned int g_nFailures(0);            ///< The number of failed checks
+unsigned int g_nEventsProcessed(0);     ///< The number of events processed by the test algorithm
+unsigned int g_nCaloHits(0);            ///< The number of calo hits created for the current event
+unsigned int g_nTracks(0);              ///< The number of tracks created for the current event
+unsigned int g_nMCParticles(0);         ///< The number of mc particles created for the current event
+
+/**
+ *  @brief  Record a failed check, if a condition does not hold
+ *
+ *  @param  condition the condition
+ *  @param  description the description of the check
+ */
+void Check(const bool condition, const std::string &description)
+{
+    if (condition)
+        return;
+
+    ++g_nFailures;
+    std::cout << "InputObjectIndexTest: check failed: " << description << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Get the parent address to give the input object created at a specified position in creation order
+ *
+ *  @param  iObject the position in creation order
+ *
+ *  @return the parent address
+ */
+const void *GetParentAddress(const unsigned int iObject)
+{
+    return reinterpret_cast<const void *>(static_cast<std::uintptr_t>(iObject + 1));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Get the parent address of an input object, identifying it in the user framework
+ *
+ *  @param  pT address of the input object
+ *
+ *  @return the parent address
+ */
+const void *GetParentAddress(const CaloHit *const pCaloHit)
+{
+    return pCaloHit->GetParentAddress();
+}
+
+const void *GetParentAddress(const Track *const pTrack)
+{
+    return pTrack->GetParentAddress();
+}
+
+const void *GetParentAddress(const MCParticle *const pMCParticle)
+{
+    return pMCParticle->GetUid();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Check the indices of a list of input objects, which must be dense, follow creation order and be within the number of indices
+ *
+ *  @param  algorithm the algorithm
+ *  @param  objectList the list of input objects
+ *  @param  nObjects the number of input objects created in the event
+ *  @param  description the description of the input objects
+ */
+template <typename T, typename LIST>
+void CheckIndices(const Algorithm &algorithm, const LIST &objectList, const unsigned int nObjects, const std::string &description)
+{
+    unsigned int nIndices(std::numeric_limits<unsigned int>::max());
+    Check(STATUS_CODE_SUCCESS == PandoraContentApi::GetNIndices<T>(algorithm, nIndices), description + ": number of indices is available");
+    Check(nObjects == nIndices, description + ": number of indices matches the number created in the event");
+    Check(nObjects == objectList.size(), description + ": all created are in the input list");
+
+    unsigned int nMismatches(0);
+
+    for (const T *const pT : objectList)
+    {
+        if (GetParentAddress(pT->GetIndex()) != GetParentAddress(pT))
+            ++nMismatches;
+    }
+
+    Check(0 == nMismatches, description + ": indices follow creation order");
+
+    std::vector<const T *> objectVector(objectList.begin(), objectList.end());
+    std::sort(objectVector.begin(), objectVector.end(), IndexLessThan<T>());
+    nMismatches = 0;
+
+    for (unsigned int iObject = 0; iObject < objectVector.size(); ++iObject)
+    {
+        if (iObject != objectVector.at(iObject)->GetIndex())
+            ++nMismatches;
+    }
+
+    Check(0 == nMismatches, description + ": indices are dense, starting from zero");
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  SimplePseudoLayerPlugin class, with pseudolayers in 10mm slices in z
+ */
+class SimplePseudoLayerPlugin : public PseudoLayerPlugin
+{
+public:
+    unsigned int GetPseudoLayer(const CartesianVector &positionVector) const
+    {
+        return 1 + static_cast<unsigned int>(std::fabs(positionVector.GetZ()) / 10.f);
+    }
+
+    unsigned int GetPseudoLayerAtIp() const
+    {
+        return 1;
+    }
+
+private:
+    StatusCode ReadSettings(const TiXmlHandle)
+    {
+        return STATUS_CODE_SUCCESS;
+    }
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  IndexTestAlgorithm class, checking the indices of the input objects in the event and of calo hit fragments
+ */
+class IndexTestAlgorithm : public Algorithm
+{
+public:
+    /**
+     *  @brief  Factory class for instantiating algorithm
+     */
+    class Factory : public AlgorithmFactory
+    {
+    public:
+        Algorithm *CreateAlgorithm() const
+        {
+            return new IndexTestAlgorithm;
+        }
+    };
+
+private:
+    StatusCode Run();
+
+    StatusCode ReadSettings(const TiXmlHandle)
+    {
+        return STATUS_CODE_SUCCESS;
+    }
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode IndexTestAlgorithm::Run()
+{
+    ++g_nEventsProcessed;
+
+    const CaloHitList *pCaloHitList(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pCaloHitList));
+    CheckIndices<CaloHit>(*this, *pCaloHitList, g_nCaloHits, "calo hits");
+
+    const TrackList *pTrackList(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pTrackList));
+    CheckIndices<Track>(*this, *pTrackList, g_nTracks, "tracks");
+
+    const MCParticleList *pMCParticleList(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pMCParticleList));
+    CheckIndices<MCParticle>(*this, *pMCParticleList, g_nMCParticles, "mc particles");
+
+    // Fragments and merged calo hits receive fresh indices, in order of creation, and the unfragmented calo hits keep theirs
+    CaloHitVector originalCaloHits(pCaloHitList->begin(), pCaloHitList->end());
+    std::sort(originalCaloHits.begin(), originalCaloHits.end(), IndexLessThan<CaloHit>());
+    originalCaloHits.resize(6);
+
+    const CaloHit *pDaughterCaloHit1(nullptr), *pDaughterCaloHit2(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Fragment(*this, originalCaloHits.back(), 0.4f,
+        pDaughterCaloHit1, pDaughterCaloHit2));
+    originalCaloHits.pop_back();
+
+    unsigned int nIndices(0);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetNIndices<CaloHit>(*this, nIndices));
+    Check((g_nCaloHits == pDaughterCaloHit1->GetIndex()) && (g_nCaloHits + 1 == pDaughterCaloHit2->GetIndex()) &&
+        (g_nCaloHits + 2 == nIndices), "calo hit fragments receive the next indices");
+
+    const FloatVector fractions1(originalCaloHits.size(), 0.25f);
+    CaloHitVector daughterCaloHits1, daughterCaloHits2;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Fragment(*this, originalCaloHits, fractions1, daughterCaloHits1,
+        daughterCaloHits2));
+
+    unsigned int nMismatches(0);
+
+    for (unsigned int iCaloHit = 0; iCaloHit < originalCaloHits.size(); ++iCaloHit)
+    {
+        if ((daughterCaloHits1.at(iCaloHit)->GetIndex() != nIndices + 2 * iCaloHit) ||
+            (daughterCaloHits2.at(iCaloHit)->GetIndex() != nIndices + 2 * iCaloHit + 1))
+        {
+            ++nMismatches;
+        }
+    }
+
+    Check(0 == nMismatches, "calo hit fragments created together receive the next indices, in pairs");
+
+    const CaloHit *pMergedCaloHit(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeFragments(*this, pDaughterCaloHit1, pDaughterCaloHit2,
+        pMergedCaloHit));
+    Check(nIndices + 2 * originalCaloHits.size() == pMergedCaloHit->GetIndex(), "merged calo hit receives the next index");
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetNIndices<CaloHit>(*this, nIndices));
+    Check(pMergedCaloHit->GetIndex() + 1 == nIndices, "number of indices counts the merged calo hit");
+
+    // Indices are never reused within an event, so the calo hits in the current list hold distinct indices, within the number of indices
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pCaloHitList));
+    std::vector<bool> isIndexUsed(nIndices, false);
+    nMismatches = 0;
+
+    for (const CaloHit *const pCaloHit : *pCaloHitList)
+    {
+        if ((pCaloHit->GetIndex() >= nIndices) || isIndexUsed.at(pCaloHit->GetIndex()))
+        {
+            ++nMismatches;
+            continue;
+        }
+
+        isIndexUsed.at(pCaloHit->GetIndex()) = true;
+    }
+
+    Check(0 == nMismatches, "calo hits in the current list hold distinct indices, within the number of indices");
+
+    const std::size_t nFragmented(originalCaloHits.size() + 1);
+    const std::size_t nUnfragmented(std::count(isIndexUsed.begin() + nFragmented, isIndexUsed.begin() + g_nCaloHits, true));
+    Check((0 == std::count(isIndexUsed.begin(), isIndexUsed.begin() + nFragmented, true)) && (g_nCaloHits - nFragmented == nUnfragmented),
+        "unfragmented calo hits keep their indices");
+    Check(g_nCaloHits + originalCaloHits.size() == pCaloHitList->size(), "current list holds the unfragmented calo hits and fragments");
+
+    unsigned int nTrackIndices(0), nMCParticleIndices(0);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetNIndices<Track>(*this, nTrackIndices));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetNIndices<MCParticle>(*this, nMCParticleIndices));
+    Check((g_nTracks == nTrackIndices) && (g_nMCParticles == nMCParticleIndices), "calo hit fragmentation leaves other indices unchanged");
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Create calo hits, some individually and then some in a single calo hit block, giving parent addresses in creation order
+ *
+ *  @param  pandora the pandora instance
+ *  @param  nSingleCaloHits the number of calo hits to create individually
+ *  @param  nBlockCaloHits the number of calo hits to create in the calo hit block
+ */
+void CreateCaloHits(const Pandora &pandora, const unsigned int nSingleCaloHits, const unsigned int nBlockCaloHits)
+{
+    for (unsigned int iCaloHit = 0; iCaloHit < nSingleCaloHits; ++iCaloHit)
+    {
+        PandoraApi::CaloHit::Parameters parameters;
+        parameters.m_positionVector = CartesianVector(10.f * iCaloHit, 0.f, 100.f);
+        parameters.m_expectedDirection = CartesianVector(0.f, 0.f, 1.f);
+        parameters.m_cellNormalVector = CartesianVector(0.f, 0.f, 1.f);
+        parameters.m_cellGeometry = RECTANGULAR;
+        parameters.m_cellSize0 = 5.f;
+        parameters.m_cellSize1 = 5.f;
+        parameters.m_cellThickness = 2.f;
+        parameters.m_nCellRadiationLengths = 0.5f;
+        parameters.m_nCellInteractionLengths = 0.05f;
+        parameters.m_time = 0.f;
+        parameters.m_inputEnergy = 1.f;
+        parameters.m_mipEquivalentEnergy = 1.f;
+        parameters.m_electromagneticEnergy = 1.f;
+        parameters.m_hadronicEnergy = 1.f;
+        parameters.m_isDigital = false;
+        parameters.m_hitType = ECAL;
+        parameters.m_hitRegion = ENDCAP;
+        parameters.m_layer = 0;
+        parameters.m_isInOuterSamplingLayer = false;
+        parameters.m_pParentAddress = GetParentAddress(iCaloHit);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(pandora, parameters));
+    }
+
+    if (0 == nBlockCaloHits)
+        return;
+
+    CaloHitBlock caloHitBlock;
+    caloHitBlock.Resize(nBlockCaloHits);
+
+    for (unsigned int iCaloHit = 0; iCaloHit < nBlockCaloHits; ++iCaloHit)
+    {
+        caloHitBlock.m_cellGeometry[iCaloHit] = RECTANGULAR;
+        caloHitBlock.m_positionX[iCaloHit] = 10.f * iCaloHit;
+        caloHitBlock.m_positionY[iCaloHit] = 10.f;
+        caloHitBlock.m_positionZ[iCaloHit] = 200.f;
+        caloHitBlock.m_expectedDirectionZ[iCaloHit] = 1.f;
+        caloHitBlock.m_cellNormalZ[iCaloHit] = 1.f;
+        caloHitBlock.m_cellThickness[iCaloHit] = 2.f;
+        caloHitBlock.m_nCellRadiationLengths[iCaloHit] = 0.5f;
+        caloHitBlock.m_nCellInteractionLengths[iCaloHit] = 0.05f;
+        caloHitBlock.m_inputEnergy[iCaloHit] = 1.f;
+        caloHitBlock.m_mipEquivalentEnergy[iCaloHit] = 1.f;
+        caloHitBlock.m_electromagneticEnergy[iCaloHit] = 1.f;
+        caloHitBlock.m_hadronicEnergy[iCaloHit] = 1.f;
+        caloHitBlock.m_hitType[iCaloHit] = HCAL;
+        caloHitBlock.m_hitRegion[iCaloHit] = ENDCAP;
+        caloHitBlock.m_parentAddress[iCaloHit] = GetParentAddress(nSingleCaloHits + iCaloHit);
+        caloHitBlock.m_cellSize0[iCaloHit] = 5.f;
+        caloHitBlock.m_cellSize1[iCaloHit] = 5.f;
+    }
+
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CreateCaloHits(pandora, caloHitBlock));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Create tracks, giving parent addresses in creation order
+ *
+ *  @param  pandora the pandora instance
+ *  @param  nTracks the number of tracks
+ */
+void CreateTracks(const Pandora &pandora, const unsigned int nTracks)
+{
+    for (unsigned int iTrack = 0; iTrack < nTracks; ++iTrack)
+    {
+        const CartesianVector momentum(0.1f * iTrack, 0.f, 1.f);
+
+        PandoraApi::Track::Parameters parameters;
+        parameters.m_d0 = 0.f;
+        parameters.m_z0 = 0.f;
+        parameters.m_particleId = 211;
+        parameters.m_charge = 1;
+        parameters.m_mass = 0.14f;
+        parameters.m_momentumAtDca = momentum;
+        parameters.m_trackStateAtStart = TrackState(CartesianVector(0.f, 0.f, 0.f), momentum);
+        parameters.m_trackStateAtEnd = TrackState(CartesianVector(0.f, 0.f, 100.f), momentum);
+        parameters.m_trackStateAtCalorimeter = TrackState(CartesianVector(0.f, 0.f, 100.f), momentum);
+        parameters.m_timeAtCalorimeter = 0.f;
+        parameters.m_reachesCalorimeter = true;
+        parameters.m_isProjectedToEndCap = true;
+        parameters.m_canFormPfo = true;
+        parameters.m_canFormClusterlessPfo = false;
+        parameters.m_pParentAddress = GetParentAddress(iTrack);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Track::Create(pandora, parameters));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Create mc particles, giving parent addresses in creation order
+ *
+ *  @param  pandora the pandora instance
+ *  @param  nMCParticles the number of mc particles
+ */
+void CreateMCParticles(const Pandora &pandora, const unsigned int nMCParticles)
+{
+    for (unsigned int iMCParticle = 0; iMCParticle < nMCParticles; ++iMCParticle)
+    {
+        PandoraApi::MCParticle::Parameters parameters;
+        parameters.m_energy = 1.f;
+        parameters.m_momentum = CartesianVector(0.f, 0.1f * iMCParticle, 1.f);
+        parameters.m_vertex = CartesianVector(0.f, 0.f, 0.f);
+        parameters.m_endpoint = CartesianVector(0.f, 0.f, 100.f);
+        parameters.m_particleId = 22;
+        parameters.m_mcParticleType = MC_3D;
+        parameters.m_pParentAddress = GetParentAddress(iMCParticle);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::MCParticle::Create(pandora, parameters));
+    }
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main()
+{
+    const std::string settingsFileName("InputObjectIndexTest.xml");
+
+    // The numbers of calo hits created individually and in a block, tracks and mc particles in each event
+    const unsigned int eventSizes[][4] = {{40, 25, 10, 15}, {6, 60, 3, 30}, {30, 0, 0, 1}, {100, 100, 20, 0}};
+    const unsigned int nEvents(sizeof(eventSizes) / sizeof(eventSizes[0]));
+
+    try
+    {
+        std::ofstream settingsFile(settingsFileName);
+        settingsFile << "<pandora>\n    <algorithm type = \"IndexTest\"/>\n</pandora>\n";
+        settingsFile.close();
+
+        const Pandora pandora;
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetPseudoLayerPlugin(pandora, new SimplePseudoLayerPlugin));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::RegisterAlgorithmFactory(pandora, "IndexTest",
+            new IndexTestAlgorithm::Factory));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ReadSettings(pandora, settingsFileName));
+        std::remove(settingsFileName.c_str());
+
+        for (unsigned int iEvent = 0; iEvent < nEvents; ++iEvent)
+        {
+            g_nCaloHits = eventSizes[iEvent][0] + eventSizes[iEvent][1];
+            g_nTracks = eventSizes[iEvent][2];
+            g_nMCParticles = eventSizes[iEvent][3];
+
+            CreateCaloHits(pandora, eventSizes[iEvent][0], eventSizes[iEvent][1]);
+            CreateTracks(pandora, g_nTracks);
+            CreateMCParticles(pandora, g_nMCParticles);
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(pandora));
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(pandora));
+        }
+
+        Check(nEvents == g_nEventsProcessed, "every event is processed");
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::remove(settingsFileName.c_str());
+        std::cout << "InputObjectIndexTest: unexpected exception: " << statusCodeException.ToString() << std::endl;
+        return 1;
+    }
+
+    if (0 != g_nFailures)
+    {
+        std::cout << "InputObjectIndexTest: " << g_nFailures << " checks failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << "InputObjectIndexTest: all checks passed" << std::endl;
+    return 0;
+}
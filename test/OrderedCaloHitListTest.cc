@@ -0,0 +1,379 @@
+/**
+ *  @file   PandoraSDK/test/OrderedCaloHitListTest.cc
+ *
+ *  @brief  Test of the ordered calo hit list, see OrderedCaloHitList. Calo hits are added to and removed from ordered calo hit lists and
+ *          the contents are compared with a reference, layer by layer. The calo hits of two pandora instances share their dense indices,
+ *          so that duplicate detection must hold when index flags are shared by different calo hits, or left behind by removed calo hits.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+#include "Api/PandoraContentApi.h"
+
+#include "Objects/CaloHit.h"
+#include "Objects/OrderedCaloHitList.h"
+
+#include "Pandora/Algorithm.h"
+
+#include "Plugins/PseudoLayerPlugin.h"
+
+#include "Xml/tinyxml.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace pandora;
+
+namespace
+{
+
+unsigned int g_nFailures(0);    ///< The number of failed checks
+CaloHitList g_caloHitList;      ///< The calo hits of the last event processed
+
+typedef std::map<unsigned int, std::set<const CaloHit *> > ReferenceMap;
+
+/**
+ *  @brief  Record a failed check, if a condition does not hold
+ *
+ *  @param  condition the condition
+ *  @param  description the description of the check
+ */
+void Check(const bool condition, const std::string &description)
+{
+    if (condition)
+        return;
+
+    ++g_nFailures;
+    std::cout << "OrderedCaloHitListTest: check failed: " << description << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  CopyCaloHitsAlgorithm class, copying the current calo hit list to g_caloHitList
+ */
+class CopyCaloHitsAlgorithm : public Algorithm
+{
+public:
+    /**
+     *  @brief  Factory class for instantiating algorithm
+     */
+    class Factory : public AlgorithmFactory
+    {
+    public:
+        Algorithm *CreateAlgorithm() const
+        {
+            return new CopyCaloHitsAlgorithm;
+        }
+    };
+
+private:
+    StatusCode Run()
+    {
+        const CaloHitList *pCaloHitList(nullptr);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pCaloHitList));
+        g_caloHitList = *pCaloHitList;
+
+        return STATUS_CODE_SUCCESS;
+    }
+
+    StatusCode ReadSettings(const TiXmlHandle)
+    {
+        return STATUS_CODE_SUCCESS;
+    }
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  ZPseudoLayerPlugin class, with pseudolayers in 10mm slices of absolute z coordinate
+ */
+class ZPseudoLayerPlugin : public PseudoLayerPlugin
+{
+public:
+    unsigned int GetPseudoLayer(const CartesianVector &positionVector) const
+    {
+        return 1 + static_cast<unsigned int>(std::fabs(positionVector.GetZ()) / 10.f);
+    }
+
+    unsigned int GetPseudoLayerAtIp() const
+    {
+        return 1;
+    }
+
+private:
+    StatusCode ReadSettings(const TiXmlHandle)
+    {
+        return STATUS_CODE_SUCCESS;
+    }
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Create a pandora instance and process an event with a number of random calo hits, leaving the event unreset
+ *
+ *  @param  nCaloHits the number of calo hits
+ *  @param  seed the random seed
+ *
+ *  @return address of the pandora instance, with the calo hits of the event copied to g_caloHitList
+ */
+const Pandora *CreateEvent(const unsigned int nCaloHits, const unsigned int seed)
+{
+    const std::string settingsFileName("OrderedCaloHitListTest.xml");
+    std::ofstream settingsFile(settingsFileName);
+    settingsFile << "<pandora>\n    <algorithm type = \"CopyCaloHits\"/>\n</pandora>\n";
+    settingsFile.close();
+
+    const Pandora *const pPandora(new Pandora);
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetPseudoLayerPlugin(*pPandora, new ZPseudoLayerPlugin));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::RegisterAlgorithmFactory(*pPandora, "CopyCaloHits",
+        new CopyCaloHitsAlgorithm::Factory));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ReadSettings(*pPandora, settingsFileName));
+    std::remove(settingsFileName.c_str());
+
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> uniform(-500.f, 500.f);
+
+    for (unsigned int iHit = 0; iHit < nCaloHits; ++iHit)
+    {
+        PandoraApi::CaloHit::Parameters parameters;
+        parameters.m_positionVector = CartesianVector(uniform(generator), uniform(generator), uniform(generator));
+        parameters.m_expectedDirection = CartesianVector(0.f, 0.f, 1.f);
+        parameters.m_cellNormalVector = CartesianVector(0.f, 0.f, 1.f);
+        parameters.m_cellGeometry = RECTANGULAR;
+        parameters.m_cellSize0 = 5.f;
+        parameters.m_cellSize1 = 5.f;
+        parameters.m_cellThickness = 2.f;
+        parameters.m_nCellRadiationLengths = 0.5f;
+        parameters.m_nCellInteractionLengths = 0.05f;
+        parameters.m_time = 0.f;
+        parameters.m_inputEnergy = 1.f;
+        parameters.m_mipEquivalentEnergy = 1.f;
+        parameters.m_electromagneticEnergy = 1.f;
+        parameters.m_hadronicEnergy = 1.f;
+        parameters.m_isDigital = false;
+        parameters.m_hitType = ECAL;
+        parameters.m_hitRegion = ENDCAP;
+        parameters.m_layer = 0;
+        parameters.m_isInOuterSamplingLayer = false;
+        parameters.m_pParentAddress = reinterpret_cast<const void *>(static_cast<std::uintptr_t>(iHit + 1));
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(*pPandora, parameters));
+    }
+
+    g_caloHitList.clear();
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pPandora));
+
+    return pPandora;
+}
+
+/**
+ *  @brief  Whether the contents of an ordered calo hit list match a reference, with layers in increasing order and none empty
+ *
+ *  @param  orderedCaloHitList the ordered calo hit list
+ *  @param  referenceMap the reference calo hits, by pseudo layer
+ *
+ *  @return boolean
+ */
+bool IsMatch(const OrderedCaloHitList &orderedCaloHitList, const ReferenceMap &referenceMap)
+{
+    ReferenceMap::const_iterator referenceIter(referenceMap.begin());
+
+    for (const OrderedCaloHitList::value_type &layerEntry : orderedCaloHitList)
+    {
+        while ((referenceMap.end() != referenceIter) && referenceIter->second.empty())
+            ++referenceIter;
+
+        if ((referenceMap.end() == referenceIter) || (referenceIter->first != layerEntry.first))
+            return false;
+
+        const std::set<const CaloHit *> caloHitSet(layerEntry.second->begin(), layerEntry.second->end());
+
+        if ((caloHitSet.size() != layerEntry.second->size()) || (caloHitSet != referenceIter->second))
+            return false;
+
+        ++referenceIter;
+    }
+
+    while ((referenceMap.end() != referenceIter) && referenceIter->second.empty())
+        ++referenceIter;
+
+    return (referenceMap.end() == referenceIter);
+}
+
+/**
+ *  @brief  Test adding and removing calo hits, comparing the ordered calo hit list with a reference after each step
+ *
+ *  @param  caloHits the calo hits of the first pandora instance
+ *  @param  otherCaloHits the calo hits of the second pandora instance, with the same indices as the first
+ */
+void TestAddRemove(const std::vector<const CaloHit *> &caloHits, const std::vector<const CaloHit *> &otherCaloHits)
+{
+    OrderedCaloHitList orderedCaloHitList;
+    ReferenceMap referenceMap;
+    unsigned int nUnexpected(0);
+
+    for (const CaloHit *const pCaloHit : caloHits)
+    {
+        nUnexpected += (STATUS_CODE_SUCCESS != orderedCaloHitList.Add(pCaloHit));
+        referenceMap[pCaloHit->GetPseudoLayer()].insert(pCaloHit);
+    }
+
+    Check(0 == nUnexpected, "new calo hits are added");
+    Check(IsMatch(orderedCaloHitList, referenceMap), "ordered calo hit list matches reference after adding");
+
+    for (const CaloHit *const pCaloHit : caloHits)
+        nUnexpected += (STATUS_CODE_ALREADY_PRESENT != orderedCaloHitList.Add(pCaloHit));
+
+    Check(0 == nUnexpected, "repeated calo hits are rejected");
+    Check(IsMatch(orderedCaloHitList, referenceMap), "ordered calo hit list is unchanged by repeated calo hits");
+
+    // ATTN Calo hits from the other instance share the index flags of those already present
+    for (const CaloHit *const pCaloHit : otherCaloHits)
+    {
+        nUnexpected += (STATUS_CODE_NOT_FOUND != orderedCaloHitList.Remove(pCaloHit));
+        nUnexpected += (STATUS_CODE_SUCCESS != orderedCaloHitList.Add(pCaloHit));
+        nUnexpected += (STATUS_CODE_ALREADY_PRESENT != orderedCaloHitList.Add(pCaloHit));
+        referenceMap[pCaloHit->GetPseudoLayer()].insert(pCaloHit);
+    }
+
+    Check(0 == nUnexpected, "calo hits sharing indices are treated as distinct");
+    Check(IsMatch(orderedCaloHitList, referenceMap), "ordered calo hit list matches reference after adding calo hits sharing indices");
+
+    // ATTN Removed calo hits leave their index flags set
+    for (unsigned int iHit = 0; iHit < caloHits.size(); iHit += 2)
+    {
+        const CaloHit *const pCaloHit(caloHits[iHit]);
+        nUnexpected += (STATUS_CODE_SUCCESS != orderedCaloHitList.Remove(pCaloHit));
+        nUnexpected += (STATUS_CODE_NOT_FOUND != orderedCaloHitList.Remove(pCaloHit));
+        referenceMap[pCaloHit->GetPseudoLayer()].erase(pCaloHit);
+    }
+
+    Check(0 == nUnexpected, "present calo hits are removed once");
+    Check(IsMatch(orderedCaloHitList, referenceMap), "ordered calo hit list matches reference after removal");
+
+    for (unsigned int iHit = 0; iHit < caloHits.size(); iHit += 4)
+    {
+        const CaloHit *const pCaloHit(caloHits[iHit]);
+        nUnexpected += (STATUS_CODE_SUCCESS != orderedCaloHitList.Add(pCaloHit));
+        nUnexpected += (STATUS_CODE_ALREADY_PRESENT != orderedCaloHitList.Add(pCaloHit));
+        referenceMap[pCaloHit->GetPseudoLayer()].insert(pCaloHit);
+    }
+
+    Check(0 == nUnexpected, "removed calo hits may be added again, once");
+    Check(IsMatch(orderedCaloHitList, referenceMap), "ordered calo hit list matches reference after adding removed calo hits");
+
+    const OrderedCaloHitList copiedList(orderedCaloHitList);
+    Check(IsMatch(copiedList, referenceMap), "copied ordered calo hit list matches reference");
+
+    OrderedCaloHitList assignedList;
+    const bool isAssigned(assignedList = orderedCaloHitList);
+    Check(isAssigned, "assignment succeeds");
+    Check(IsMatch(assignedList, referenceMap), "assigned ordered calo hit list matches reference");
+    Check(STATUS_CODE_ALREADY_PRESENT == assignedList.Add(caloHits.back()), "assigned ordered calo hit list detects repeated calo hits");
+
+    orderedCaloHitList.Reset();
+    Check(orderedCaloHitList.empty(), "ordered calo hit list is empty after reset");
+
+    for (const CaloHit *const pCaloHit : otherCaloHits)
+        nUnexpected += (STATUS_CODE_NOT_FOUND != orderedCaloHitList.Remove(pCaloHit));
+
+    Check(0 == nUnexpected, "calo hits are not found after reset");
+}
+
+/**
+ *  @brief  Test adding and removing whole ordered calo hit lists, including lists that overlap
+ *
+ *  @param  caloHits the calo hits of the first pandora instance
+ *  @param  otherCaloHits the calo hits of the second pandora instance, with the same indices as the first
+ */
+void TestAddRemoveLists(const std::vector<const CaloHit *> &caloHits, const std::vector<const CaloHit *> &otherCaloHits)
+{
+    OrderedCaloHitList firstList, secondList;
+    ReferenceMap referenceMap;
+
+    for (unsigned int iHit = 0; iHit < caloHits.size(); ++iHit)
+    {
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, ((iHit % 3) ? firstList : secondList).Add(caloHits[iHit]));
+        referenceMap[caloHits[iHit]->GetPseudoLayer()].insert(caloHits[iHit]);
+    }
+
+    Check(STATUS_CODE_SUCCESS == firstList.Add(secondList), "disjoint ordered calo hit list is added");
+    Check(IsMatch(firstList, referenceMap), "merged ordered calo hit list matches reference");
+    Check(STATUS_CODE_ALREADY_PRESENT == firstList.Add(secondList), "overlapping ordered calo hit list is rejected");
+
+    OrderedCaloHitList otherList;
+
+    for (const CaloHit *const pCaloHit : otherCaloHits)
+    {
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, otherList.Add(pCaloHit));
+        referenceMap[pCaloHit->GetPseudoLayer()].insert(pCaloHit);
+    }
+
+    Check(STATUS_CODE_SUCCESS == firstList.Add(otherList), "ordered calo hit list sharing indices is added");
+    Check(IsMatch(firstList, referenceMap), "merged ordered calo hit list sharing indices matches reference");
+
+    Check(STATUS_CODE_SUCCESS == firstList.Remove(otherList), "ordered calo hit list sharing indices is removed");
+    Check(STATUS_CODE_SUCCESS == firstList.Remove(secondList), "ordered calo hit list is removed");
+
+    for (const CaloHit *const pCaloHit : otherCaloHits)
+        referenceMap[pCaloHit->GetPseudoLayer()].erase(pCaloHit);
+
+    for (unsigned int iHit = 0; iHit < caloHits.size(); iHit += 3)
+        referenceMap[caloHits[iHit]->GetPseudoLayer()].erase(caloHits[iHit]);
+
+    Check(IsMatch(firstList, referenceMap), "ordered calo hit list matches reference after removing lists");
+    Check(STATUS_CODE_SUCCESS == firstList.Add(secondList), "removed ordered calo hit list may be added again");
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main()
+{
+    try
+    {
+        // ATTN The two events are left unreset, so that the calo hits of both instances, with the same dense indices, exist together
+        const Pandora *const pPandora(CreateEvent(5000, 12345));
+        std::vector<const CaloHit *> caloHits(g_caloHitList.begin(), g_caloHitList.end());
+
+        const Pandora *const pOtherPandora(CreateEvent(5000, 54321));
+        std::vector<const CaloHit *> otherCaloHits(g_caloHitList.begin(), g_caloHitList.end());
+
+        Check((5000 == caloHits.size()) && (5000 == otherCaloHits.size()), "all calo hits are created");
+
+        std::mt19937 generator(12345);
+        std::shuffle(caloHits.begin(), caloHits.end(), generator);
+        std::shuffle(otherCaloHits.begin(), otherCaloHits.end(), generator);
+
+        TestAddRemove(caloHits, otherCaloHits);
+        TestAddRemoveLists(caloHits, otherCaloHits);
+
+        delete pPandora;
+        delete pOtherPandora;
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "OrderedCaloHitListTest: unexpected exception: " << statusCodeException.ToString() << std::endl;
+        return 1;
+    }
+
+    if (0 != g_nFailures)
+    {
+        std::cout << "OrderedCaloHitListTest: " << g_nFailures << " checks failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << "OrderedCaloHitListTest: all checks passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,342 @@
+/**
+ *  @file   PandoraSDK/test/TabulatedPseudoLayerPluginTest.cc
+ *
+ *  @brief  Test of the tabulated pseudo layer plugin, see TabulatedPseudoLayerPlugin. The tabulated pseudolayers are compared with those
+ *          of the wrapped plugin at random positions and at positions on, and one float step either side of, every layer boundary, for
+ *          several table settings. A wrapped plugin whose pseudolayers do not change only at the sub detector boundaries must be rejected.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+
+#include "Geometry/SubDetector.h"
+
+#include "Managers/GeometryManager.h"
+#include "Managers/PluginManager.h"
+
+#include "Plugins/PseudoLayerPlugin.h"
+
+#include "Xml/tinyxml.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <random>
+
+using namespace pandora;
+
+namespace
+{
+
+unsigned int g_nFailures(0); ///< The number of failed checks
+
+/**
+ *  @brief  Record a failed check, if a condition does not hold
+ *
+ *  @param  condition the condition
+ *  @param  description the description of the check
+ */
+void Check(const bool condition, const std::string &description)
+{
+    if (condition)
+        return;
+
+    ++g_nFailures;
+    std::cout << "TabulatedPseudoLayerPluginTest: check failed: " << description << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  LayerPseudoLayerPlugin class, counting the barrel layers inside the polygonal radius of a position, w.r.t. the octagonal ecal
+ *          barrel, and the endcap layers inside its absolute z coordinate, and taking the larger count
+ */
+class LayerPseudoLayerPlugin : public PseudoLayerPlugin
+{
+public:
+    unsigned int GetPseudoLayer(const CartesianVector &positionVector) const
+    {
+        const float x(std::fabs(positionVector.GetX())), y(std::fabs(positionVector.GetY()));
+        const float polygonalRadius(std::max(std::max(x, y), 0.70710678f * (x + y)));
+        const float z(std::fabs(positionVector.GetZ()));
+
+        return std::max(this->CountLayers(polygonalRadius, m_barrelLayerPositions), this->CountLayers(z, m_endCapLayerPositions));
+    }
+
+    unsigned int GetPseudoLayerAtIp() const
+    {
+        return 0;
+    }
+
+private:
+    StatusCode ReadSettings(const TiXmlHandle)
+    {
+        return STATUS_CODE_SUCCESS;
+    }
+
+    StatusCode Initialize()
+    {
+        for (const SubDetectorMap::value_type &mapEntry : this->GetPandora().GetGeometry()->GetSubDetectorMap())
+        {
+            const SubDetectorType subDetectorType(mapEntry.second->GetSubDetectorType());
+            const bool isBarrel((ECAL_BARREL == subDetectorType) || (HCAL_BARREL == subDetectorType));
+
+            for (const SubDetector::SubDetectorLayer &layer : mapEntry.second->GetSubDetectorLayerVector())
+                (isBarrel ? m_barrelLayerPositions : m_endCapLayerPositions).push_back(layer.GetClosestDistanceToIp());
+        }
+
+        std::sort(m_barrelLayerPositions.begin(), m_barrelLayerPositions.end());
+        std::sort(m_endCapLayerPositions.begin(), m_endCapLayerPositions.end());
+
+        return STATUS_CODE_SUCCESS;
+    }
+
+    unsigned int CountLayers(const float position, const FloatVector &layerPositions) const
+    {
+        return static_cast<unsigned int>(std::upper_bound(layerPositions.begin(), layerPositions.end(), position) - layerPositions.begin());
+    }
+
+    FloatVector m_barrelLayerPositions; ///< The barrel layer positions, as polygonal radius
+    FloatVector m_endCapLayerPositions; ///< The endcap layer positions, as absolute z coordinate
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  ShellPseudoLayerPlugin class, with pseudolayers in 10mm spherical shells, which do not follow the sub detector boundaries
+ */
+class ShellPseudoLayerPlugin : public PseudoLayerPlugin
+{
+public:
+    unsigned int GetPseudoLayer(const CartesianVector &positionVector) const
+    {
+        return 1 + static_cast<unsigned int>(positionVector.GetMagnitude() / 10.f);
+    }
+
+    unsigned int GetPseudoLayerAtIp() const
+    {
+        return 1;
+    }
+
+private:
+    StatusCode ReadSettings(const TiXmlHandle)
+    {
+        return STATUS_CODE_SUCCESS;
+    }
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Get parameters for a sub detector with equally spaced layers
+ *
+ *  @param  subDetectorType the sub detector type
+ *  @param  inner the inner r coordinate for a barrel, or z coordinate for an endcap, units mm
+ *  @param  outer the outer r coordinate for a barrel, or z coordinate for an endcap, units mm
+ *  @param  outerSymmetryOrder the outer order of symmetry
+ *  @param  nLayers the number of layers
+ *
+ *  @return the sub detector parameters
+ */
+PandoraApi::Geometry::SubDetector::Parameters GetSubDetectorParameters(const SubDetectorType subDetectorType, const float inner,
+    const float outer, const unsigned int outerSymmetryOrder, const unsigned int nLayers)
+{
+    const bool isBarrel((ECAL_BARREL == subDetectorType) || (HCAL_BARREL == subDetectorType));
+
+    PandoraApi::Geometry::SubDetector::Parameters parameters;
+    parameters.m_subDetectorName = "SubDetector" + std::to_string(subDetectorType);
+    parameters.m_subDetectorType = subDetectorType;
+    parameters.m_innerRCoordinate = isBarrel ? inner : 300.f;
+    parameters.m_innerZCoordinate = isBarrel ? 0.f : inner;
+    parameters.m_innerPhiCoordinate = 0.f;
+    parameters.m_innerSymmetryOrder = 8;
+    parameters.m_outerRCoordinate = isBarrel ? outer : 3300.f;
+    parameters.m_outerZCoordinate = isBarrel ? 2400.f : outer;
+    parameters.m_outerPhiCoordinate = 0.f;
+    parameters.m_outerSymmetryOrder = outerSymmetryOrder;
+    parameters.m_isMirroredInZ = !isBarrel;
+    parameters.m_nLayers = nLayers;
+
+    for (unsigned int iLayer = 0; iLayer < nLayers; ++iLayer)
+    {
+        PandoraApi::Geometry::LayerParameters layerParameters;
+        layerParameters.m_closestDistanceToIp = inner + (outer - inner) * static_cast<float>(iLayer) / static_cast<float>(nLayers);
+        layerParameters.m_nRadiationLengths = 1.f;
+        layerParameters.m_nInteractionLengths = 0.1f;
+        parameters.m_layerParametersVector.push_back(layerParameters);
+    }
+
+    return parameters;
+}
+
+/**
+ *  @brief  Create the geometry of a pandora instance, register a pseudo layer plugin and read settings creating the tabulated plugin
+ *
+ *  @param  pandora the pandora instance
+ *  @param  pPseudoLayerPlugin address of the pseudo layer plugin
+ *  @param  tabulatedSettings the xml settings for the tabulated pseudo layer plugin
+ *
+ *  @return the status code from reading the settings, failure if the tabulated pseudo layer plugin could not be initialized
+ */
+StatusCode ConfigurePandora(const Pandora &pandora, PseudoLayerPlugin *const pPseudoLayerPlugin, const std::string &tabulatedSettings)
+{
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Geometry::SubDetector::Create(pandora,
+        GetSubDetectorParameters(ECAL_BARREL, 1800.f, 2000.f, 8, 20)));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Geometry::SubDetector::Create(pandora,
+        GetSubDetectorParameters(HCAL_BARREL, 2050.f, 3300.f, 16, 40)));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Geometry::SubDetector::Create(pandora,
+        GetSubDetectorParameters(ECAL_ENDCAP, 2450.f, 2650.f, 8, 20)));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Geometry::SubDetector::Create(pandora,
+        GetSubDetectorParameters(HCAL_ENDCAP, 2700.f, 3900.f, 16, 40)));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::SetPseudoLayerPlugin(pandora, pPseudoLayerPlugin));
+
+    const std::string settingsFileName("TabulatedPseudoLayerPluginTestSettings.xml");
+    std::ofstream settingsFile(settingsFileName);
+    settingsFile << "<pandora>\n    <TabulatedPseudoLayerPlugin>" << tabulatedSettings << "</TabulatedPseudoLayerPlugin>\n</pandora>\n";
+    settingsFile.close();
+
+    const StatusCode readStatusCode(PandoraApi::ReadSettings(pandora, settingsFileName));
+    std::remove(settingsFileName.c_str());
+
+    return readStatusCode;
+}
+
+/**
+ *  @brief  Get positions at random, and on and either side of every layer boundary of the test geometry
+ *
+ *  @param  positionVectors to receive the positions
+ */
+void GetTestPositions(CartesianPointVector &positionVectors)
+{
+    std::mt19937 generator(12345);
+    std::uniform_real_distribution<float> uniform(-1.f, 1.f);
+
+    for (unsigned int iPosition = 0; iPosition < 200000; ++iPosition)
+        positionVectors.emplace_back(4500.f * uniform(generator), 4500.f * uniform(generator), 4500.f * uniform(generator));
+
+    FloatVector barrelDistances, endCapDistances{0.f, 1200.f};
+
+    for (unsigned int iLayer = 0; iLayer < 20; ++iLayer)
+    {
+        barrelDistances.push_back(1800.f + 10.f * static_cast<float>(iLayer));
+        endCapDistances.push_back(2450.f + 10.f * static_cast<float>(iLayer));
+    }
+
+    for (unsigned int iLayer = 0; iLayer < 40; ++iLayer)
+    {
+        barrelDistances.push_back(2050.f + 31.25f * static_cast<float>(iLayer));
+        endCapDistances.push_back(2700.f + 30.f * static_cast<float>(iLayer));
+    }
+
+    // ATTN Points on the side x = distance of the octagon have polygonal radius exactly equal to the distance
+    for (const float barrelDistance : barrelDistances)
+    {
+        for (const float r : {std::nextafter(barrelDistance, 0.f), barrelDistance, std::nextafter(barrelDistance, 10000.f)})
+        {
+            for (const float endCapDistance : endCapDistances)
+            {
+                for (const float z : {std::nextafter(endCapDistance, -1.f), endCapDistance, std::nextafter(endCapDistance, 10000.f)})
+                {
+                    positionVectors.emplace_back(r, 0.f, z);
+                    positionVectors.emplace_back(-r, 0.3f * r, -z);
+                    positionVectors.emplace_back(0.4f * r, r, z);
+                }
+            }
+        }
+    }
+
+    for (const float endCapDistance : endCapDistances)
+    {
+        for (const float z : {std::nextafter(endCapDistance, -1.f), endCapDistance, std::nextafter(endCapDistance, 10000.f)})
+        {
+            for (const float r : {0.f, 500.f, 1500.f, 1999.f, 3400.f})
+                positionVectors.emplace_back(0.6f * r, 0.8f * r, z);
+        }
+    }
+}
+
+/**
+ *  @brief  Check that the tabulated pseudolayers are identical to those of the wrapped plugin, at the test positions
+ *
+ *  @param  tabulatedSettings the xml settings for the tabulated pseudo layer plugin
+ *  @param  positionVectors the test positions
+ */
+void TestIdentical(const std::string &tabulatedSettings, const CartesianPointVector &positionVectors)
+{
+    const Pandora pandora;
+    LayerPseudoLayerPlugin *const pPseudoLayerPlugin(new LayerPseudoLayerPlugin);
+    Check(STATUS_CODE_SUCCESS == ConfigurePandora(pandora, pPseudoLayerPlugin, tabulatedSettings),
+        "table initialization succeeds with settings '" + tabulatedSettings + "'");
+
+    const PseudoLayerPlugin *const pTabulatedPlugin(pandora.GetPlugins()->GetPseudoLayerPlugin());
+    Check(pTabulatedPlugin != pPseudoLayerPlugin, "pseudo layer plugin is wrapped by the table");
+
+    UIntVector batchPseudoLayers;
+    pTabulatedPlugin->GetPseudoLayers(positionVectors, batchPseudoLayers);
+    Check(positionVectors.size() == batchPseudoLayers.size(), "batch returns a pseudolayer per position");
+
+    unsigned int nMismatches(0);
+
+    for (unsigned int index = 0; index < positionVectors.size(); ++index)
+    {
+        const unsigned int pseudoLayer(pPseudoLayerPlugin->GetPseudoLayer(positionVectors[index]));
+
+        if ((pseudoLayer != pTabulatedPlugin->GetPseudoLayer(positionVectors[index])) || (pseudoLayer != batchPseudoLayers[index]))
+            ++nMismatches;
+    }
+
+    Check(0 == nMismatches, std::to_string(nMismatches) + " tabulated pseudolayers differ from the wrapped plugin, with settings '" +
+        tabulatedSettings + "'");
+    Check(pPseudoLayerPlugin->GetPseudoLayerAtIp() == pTabulatedPlugin->GetPseudoLayerAtIp(),
+        "pseudolayer at ip is that of the wrapped plugin");
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main()
+{
+    try
+    {
+        CartesianPointVector positionVectors;
+        GetTestPositions(positionVectors);
+
+        TestIdentical("", positionVectors);
+        TestIdentical("<BinWidth>0.25</BinWidth>", positionVectors);
+        TestIdentical("<BinWidth>7.3</BinWidth><BoundaryTolerance>0</BoundaryTolerance>", positionVectors);
+        TestIdentical("<ReferenceBarrelLayers>false</ReferenceBarrelLayers>", positionVectors);
+
+        // ATTN With a cylindrical reference, the octagonal barrel layers are only covered once widened over all azimuthal angles
+        TestIdentical("<SymmetryOrder>0</SymmetryOrder><ReferenceBarrelLayers>false</ReferenceBarrelLayers>", positionVectors);
+
+        const Pandora cylinderPandora;
+        Check(STATUS_CODE_FAILURE == ConfigurePandora(cylinderPandora, new LayerPseudoLayerPlugin, "<SymmetryOrder>0</SymmetryOrder>"),
+            "table with barrel layers measured w.r.t. the wrong polygon is rejected");
+
+        const Pandora shellPandora;
+        Check(STATUS_CODE_FAILURE == ConfigurePandora(shellPandora, new ShellPseudoLayerPlugin, ""),
+            "table wrapping a plugin that does not follow the sub detector boundaries is rejected");
+
+        const Pandora invalidPandora;
+        Check(STATUS_CODE_FAILURE == ConfigurePandora(invalidPandora, new LayerPseudoLayerPlugin, "<BinWidth>-1</BinWidth>"),
+            "negative bin width is rejected");
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "TabulatedPseudoLayerPluginTest: unexpected exception: " << statusCodeException.ToString() << std::endl;
+        return 1;
+    }
+
+    if (0 != g_nFailures)
+    {
+        std::cout << "TabulatedPseudoLayerPluginTest: " << g_nFailures << " checks failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << "TabulatedPseudoLayerPluginTest: all checks passed" << std::endl;
+    return 0;
+}